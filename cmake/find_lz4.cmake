@@ -0,0 +1,39 @@
+macro(find_lz4)
+    if(NOT lz4_CACHED)
+        find_package(lz4 QUIET)
+
+        if(NOT lz4_FOUND)
+            include(FindPkgConfig)
+            find_package(PkgConfig QUIET)
+            if(PKG_CONFIG_FOUND)
+                pkg_search_module(LZ4 liblz4)
+            endif()
+
+            if(LZ4_FOUND)
+                set(lz4_INCLUDE_DIRS ${LZ4_INCLUDE_DIRS}
+                    CACHE STRING "Include directories for LZ4"
+                )
+                set(lz4_LIBRARIES ${LZ4_LINK_LIBRARIES}
+                    CACHE STRING "Libraries for LZ4"
+                )
+
+                set(lz4_CACHED TRUE CACHE BOOL "LZ4 found")
+            else()
+                # LZ4 is found without pkg-config, if it isn't installed
+                find_path(LZ4_INCLUDE_DIR lz4.h)
+                find_library(LZ4_LIBRARY NAMES lz4 liblz4)
+
+                if(LZ4_INCLUDE_DIR AND LZ4_LIBRARY)
+                    set(lz4_INCLUDE_DIRS ${LZ4_INCLUDE_DIR}
+                        CACHE STRING "Include directories for LZ4"
+                    )
+                    set(lz4_LIBRARIES ${LZ4_LIBRARY}
+                        CACHE STRING "Libraries for LZ4"
+                    )
+
+                    set(lz4_CACHED TRUE CACHE BOOL "LZ4 found")
+                endif()
+            endif()
+        endif()
+    endif()
+endmacro()
@@ -32,6 +32,7 @@ class sc_machineRecipe(ConanFile):
         self.requires("websocketpp/0.8.2", options={"asio": "standalone"})
         self.requires("nlohmann_json/3.11.3")
         self.requires("glib/2.76.3")
+        self.requires("lz4/1.9.4")
         self.requires("libxml2/2.13.4", options={"zlib": False, "iconv": False})
         # TODO(FallenChromium): use this instead of thirdparty/antlr4 
         # self.requires("antlr4-cppruntime/4.9.3")
@@ -7,7 +7,7 @@
 #ifndef _sc_condition_h_
 #define _sc_condition_h_
 
-#include "sc-core/sc_defines.h"
+#include "sc-core/sc_types.h"
 
 typedef struct _sc_condition sc_condition;
 typedef struct _sc_mutex sc_mutex;
@@ -16,6 +16,11 @@ _SC_EXTERN void sc_cond_init(sc_condition * condition);
 
 _SC_EXTERN void sc_cond_wait(sc_condition * condition, sc_mutex * mutex);
 
+/*! Waits for the condition at most \p timeout milliseconds.
+ * @return Returns SC_FALSE if the timeout has passed, otherwise SC_TRUE.
+ */
+_SC_EXTERN sc_bool sc_cond_wait_timeout(sc_condition * condition, sc_mutex * mutex, sc_uint32 timeout);
+
 _SC_EXTERN void sc_cond_signal(sc_condition * condition);
 
 _SC_EXTERN void sc_cond_broadcast(sc_condition * condition);
@@ -100,4 +100,10 @@ sc_bool sc_dictionary_visit_up_nodes(
     sc_bool (*callable)(sc_dictionary_node *, void **),
     void ** dest);
 
+/*! Gets size of memory used by sc-dictionary: its nodes, their children and substrings, without data stored in it.
+ * @param dictionary A sc-dictionary pointer
+ * @returns Returns Size of memory in bytes
+ */
+sc_uint64 sc_dictionary_get_memory_size(sc_dictionary * dictionary);
+
 #endif
@@ -90,6 +90,8 @@ _SC_EXTERN sc_event_subscription * sc_event_subscription_with_user_new(
 /*! Destroys the specified sc-event subscription.
  * @param event_subscription Pointer to the sc-event subscription to be destroyed.
  * @return Returns SC_RESULT_OK if the operation is successful, SC_RESULT_NO otherwise.
+ * @remarks An sc-event subscription is also destroyed when its subscribed sc-element is erased. Its delete callback
+ * is called in both cases, after that the sc-event subscription mustn't be used.
  */
 _SC_EXTERN sc_result sc_event_subscription_destroy(sc_event_subscription * event_subscription);
 
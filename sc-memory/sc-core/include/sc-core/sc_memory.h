@@ -291,6 +291,31 @@ _SC_EXTERN sc_addr sc_memory_node_new(sc_memory_context const * ctx, sc_type typ
  */
 _SC_EXTERN sc_addr sc_memory_node_new_ext(sc_memory_context const * ctx, sc_type type, sc_result * result);
 
+/*!
+ * @brief Generates sc-nodes and sc-links of the specified types in one batch.
+ *
+ * This function creates sc-elements of all specified types at once: the context is checked once and sc-elements are
+ * allocated together, instead of calling `sc_memory_node_new_ext` or `sc_memory_link_new_ext` for each of them.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param types Types of new sc-nodes and sc-links.
+ * @param count Count of new sc-elements.
+ * @param addrs Array of size `count` to store sc-addrs of created sc-elements in order of their types.
+ *
+ * @return Returns SC_RESULT_OK if all sc-elements were created. Otherwise, no sc-elements are created and `addrs` are
+ * empty.
+ *
+ * @note This function is thread-safe.
+ *
+ * Possible values for the result:
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_ELEMENT_IS_NOT_NODE Some specified sc-type is not valid for a sc-node or a sc-link.
+ * @retval SC_RESULT_ERROR_FULL_MEMORY Unable to allocate memory for new sc-elements.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED The specified sc-memory context is not authorized.
+ */
+_SC_EXTERN sc_result
+sc_memory_nodes_new(sc_memory_context const * ctx, sc_type const * types, sc_uint32 count, sc_addr * addrs);
+
 /*!
  * @brief Generates a new sc-link with the specified type.
  *
@@ -417,6 +442,45 @@ _SC_EXTERN sc_addr sc_memory_arc_new_ext(
     sc_addr end_addr,
     sc_result * result);
 
+/*!
+ * @brief Generates sc-connectors of the specified types in one batch.
+ *
+ * This function checks the context and its permissions for all sc-connectors before creating any of them, then
+ * allocates all sc-connectors at once and connects them with their begin and end sc-elements in order of arrays.
+ * Begin and end sc-elements must exist before the call, so sc-connectors of one batch can't be incident to each other.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param types Types of new sc-connectors.
+ * @param beg_addrs sc-addrs of begin sc-elements of new sc-connectors.
+ * @param end_addrs sc-addrs of end sc-elements of new sc-connectors.
+ * @param count Count of new sc-connectors.
+ * @param addrs Array of size `count` to store sc-addrs of created sc-connectors.
+ *
+ * @return Returns SC_RESULT_OK if all sc-connectors were created. If the context hasn't permissions, then no
+ * sc-connectors are created. If some sc-connector can't be connected, then sc-connectors before it stay created and
+ * sc-addrs of it and next sc-connectors are empty.
+ *
+ * @note This function is thread-safe.
+ *
+ * Possible values for the result:
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_ELEMENT_IS_NOT_CONNECTOR Some specified type is not a valid sc-connector type.
+ * @retval SC_RESULT_ERROR_ADDR_IS_NOT_VALID Some begin or end sc-addr is not valid.
+ * @retval SC_RESULT_ERROR_FULL_MEMORY Unable to allocate memory for new sc-connectors.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS The specified sc-memory context does not have
+ * write permissions.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_PERMISSIONS_TO_WRITE_PERMISSIONS The specified sc-memory context
+ * does not have permissions to write permissions.
+ */
+_SC_EXTERN sc_result sc_memory_arcs_new(
+    sc_memory_context const * ctx,
+    sc_type const * types,
+    sc_addr const * beg_addrs,
+    sc_addr const * end_addrs,
+    sc_uint32 count,
+    sc_addr * addrs);
+
 /*!
  * @brief Retrieves the count of output connectors for the specified sc-element.
  *
@@ -710,6 +774,46 @@ _SC_EXTERN sc_result sc_memory_set_link_content_ext(
     sc_stream const * stream,
     sc_bool is_searchable_string);
 
+/*!
+ * @brief Sets the contents of the specified sc-links at once.
+ *
+ * This function sets the content of every sc-link with the specified sc-addr using the data from the stream with
+ * the same index. Contents are divided into terms in parallel, written into file memory by big sequential writes and
+ * appended to indexes of file memory in one pass, so many sc-links are loaded faster than one by one. Contents aren't
+ * set if any of specified sc-addrs isn't sc-link.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param addrs The sc-addrs of the sc-links for which to set the contents.
+ * @param streams The streams containing the content data to be associated with the sc-links.
+ * @param count A count of sc-addrs and streams.
+ * @param is_searchable_string A boolean indicating whether the contents should be treated
+ *                             as searchable strings.
+ *
+ * @return Returns the result of the operation. If successful, the function returns
+ *         SC_RESULT_OK. If an error occurs, the function returns an error code.
+ *
+ * @note The caller is responsible for handling any errors indicated by the result value.
+ * @note This function is thread-safe.
+ *
+ * Possible values for the result:
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_ADDR_IS_NOT_VALID One of the specified sc-addrs is not valid.
+ * @retval SC_RESULT_ERROR_ELEMENT_IS_NOT_LINK One of the specified sc-addrs does not represent a valid sc-link.
+ * @retval SC_RESULT_ERROR_STREAM_IO Error occurred while processing the streams.
+ * @retval SC_RESULT_ERROR_FILE_MEMORY_IO Error occurred during file/memory operations.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS The specified sc-memory context does not have
+ * write permissions.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_ERASE_PERMISSIONS The specified sc-memory context does not have
+ * erase permissions.
+ */
+_SC_EXTERN sc_result sc_memory_set_links_contents_ext(
+    sc_memory_context const * ctx,
+    sc_addr const * addrs,
+    sc_stream const * const * streams,
+    sc_uint32 count,
+    sc_bool is_searchable_string);
+
 /*!
  * @brief Retrieves the content of the specified sc-link as a stream.
  *
@@ -740,6 +844,69 @@ _SC_EXTERN sc_result sc_memory_set_link_content_ext(
  */
 _SC_EXTERN sc_result sc_memory_get_link_content(sc_memory_context const * ctx, sc_addr addr, sc_stream ** stream);
 
+/*!
+ * @brief Appends the content of the specified stream to the end of content of the specified sc-link.
+ *
+ * This function appends the data from the provided stream to the content of the sc-link with the specified sc-addr.
+ * The stream is appended by parts, so previous content isn't rewritten and big streams aren't read into memory
+ * entirely. It is intended for big binary contents, that are written by parts.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param addr The sc-addr of the sc-link to which to append the content.
+ * @param stream The stream containing the content data to be appended to the sc-link content.
+ *
+ * @return Returns the result of the operation. If successful, the function returns
+ *         SC_RESULT_OK. If an error occurs, the function returns an error code.
+ *
+ * @note Texts with appended parts smaller than `max_searchable_string_size` are indexed again and found by their
+ * contents. Bigger or binary contents with appended parts aren't indexed, so sc-links with them can't be found by
+ * their contents until their contents are set again.
+ * @note Parts of the stream appended before an error aren't rolled back, so a failed append can be partial.
+ * @note This function is thread-safe.
+ *
+ * Possible values for the result:
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_ADDR_IS_NOT_VALID The specified sc-addr is not valid.
+ * @retval SC_RESULT_ERROR_ELEMENT_IS_NOT_LINK The specified sc-addr does not represent a valid sc-link.
+ * @retval SC_RESULT_ERROR_STREAM_IO Error occurred while processing the stream.
+ * @retval SC_RESULT_ERROR_FILE_MEMORY_IO Error occurred during file/memory operations.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS The specified sc-memory context does not have
+ * write permissions.
+ */
+_SC_EXTERN sc_result
+sc_memory_append_link_content(sc_memory_context const * ctx, sc_addr addr, sc_stream const * stream);
+
+/*!
+ * @brief Opens a stream that reads the content of the specified sc-link by parts.
+ *
+ * Unlike sc_memory_get_link_content, this function doesn't read the sc-link content into memory. The content is read
+ * by parts from file memory on reading from the stream, so big contents can be read by chunks and by offsets.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param addr The sc-addr of the sc-link for which to open the content stream.
+ * @param stream Pointer to a variable that will store the opened stream.
+ *
+ * @return Returns the result of the operation. If successful, the function returns
+ *         SC_RESULT_OK, and the stream value is set accordingly. If an error occurs,
+ *         the function returns an error code, and the stream value is not valid.
+ *
+ * @note The stream must be freed with sc_stream_free. Its length is the sc-link content size when it is opened, the
+ * sc-link content mustn't be changed while the stream is read.
+ *
+ * Possible values for the result:
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_ADDR_IS_NOT_VALID The specified sc-addr is not valid.
+ * @retval SC_RESULT_ERROR_ELEMENT_IS_NOT_LINK The specified sc-addr does not represent a valid sc-link.
+ * @retval SC_RESULT_ERROR_STREAM_IO The sc-link content is too big for sc-stream.
+ * @retval SC_RESULT_ERROR_FILE_MEMORY_IO Error occurred during file/memory operations.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS The specified sc-memory context does not have read
+ * permissions.
+ */
+_SC_EXTERN sc_result
+sc_memory_open_link_content_stream(sc_memory_context const * ctx, sc_addr addr, sc_stream ** stream);
+
 /*!
  * @brief Finds sc-links with content matching the specified string.
  *
@@ -891,6 +1058,51 @@ _SC_EXTERN sc_result sc_memory_find_links_contents_by_content_substring_ext(
  */
 _SC_EXTERN sc_result sc_memory_stat(sc_memory_context const * ctx, sc_stat * stat);
 
+/*!
+ * @brief Retrieves gauges of the queue of sc-events waiting for processing.
+ *
+ * This function retrieves the number of not processed sc-events, numbers of queued sc-events of each priority class,
+ * the maximum reached number of not processed sc-events, the number of not processed sc-events above the limit, the
+ * number of emitters backing off, the number of skipped (coalesced) sc-events and the number of sc-events admitted
+ * to the full queue.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param stat Pointer to the `sc_events_stat` structure where the statistics will be stored.
+ *             It should be pre-allocated by the caller.
+ *
+ * @return Returns the result of the operation. If successful, it returns SC_RESULT_OK.
+ *
+ * @note This function is thread-safe.
+ *
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS The specified sc-memory context does not have read
+ * permissions.
+ * @retval SC_RESULT_ERROR_INVALID_STATE Sc-memory is not initialized.
+ */
+_SC_EXTERN sc_result sc_memory_events_stat(sc_memory_context const * ctx, sc_events_stat * stat);
+
+/*!
+ * @brief Retrieves counters of the cache of sc-link contents.
+ *
+ * This function retrieves numbers of hits, misses and evictions of the cache of sc-link contents read from file
+ * memory, the number of cached sc-link contents, and the current and the maximum sizes of the cache in bytes.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param stat Pointer to the `sc_link_contents_cache_stat` structure where the statistics will be stored.
+ *             It should be pre-allocated by the caller.
+ *
+ * @return Returns the result of the operation. If successful, it returns SC_RESULT_OK.
+ *
+ * @note This function is thread-safe.
+ *
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS The specified sc-memory context does not have read
+ * permissions.
+ * @retval SC_RESULT_ERROR_INVALID_STATE Sc-memory is not initialized.
+ */
+_SC_EXTERN sc_result
+sc_memory_link_contents_cache_stat(sc_memory_context const * ctx, sc_link_contents_cache_stat * stat);
+
 /*!
  * @brief Saves the current state of the sc-storage to persistent storage.
  *
@@ -14,6 +14,8 @@
 #define DEFAULT_LIMIT_MAX_THREADS_BY_MAX_PHYSICAL_CORES SC_TRUE
 #define DEFAULT_MAX_EVENTS_AND_AGENTS_THREADS 32
 #define DEFAULT_MIN_EVENTS_AND_AGENTS_THREADS 1
+#define DEFAULT_MAX_EVENTS_QUEUE_SIZE 0
+#define DEFAULT_EVENTS_QUEUE_OVERFLOW_POLICY "Backoff"
 #define DEFAULT_DUMP_MEMORY SC_TRUE
 #define DEFAULT_DUMP_MEMORY_PERIOD 32000
 #define DEFAULT_DUMP_MEMORY_STATISTICS SC_TRUE
@@ -26,6 +28,7 @@
 #define DEFAULT_MAX_SEARCHABLE_STRING_SIZE 1000
 #define DEFAULT_TERM_SEPARATORS " _"
 #define DEFAULT_SEARCH_BY_SUBSTRING SC_TRUE
+#define DEFAULT_MAX_LINK_CONTENTS_CACHE_SIZE 16777216
 
 /*! Structure representing parameters for configuring the sc-memory.
  * @note This structure holds various configuration parameters that control the behavior of the sc-memory.
@@ -46,6 +49,9 @@ typedef struct
   ///< Boolean indicating whether sc-memory limit `max_events_and_agents_threads` by maximum physical core number.
   sc_bool limit_max_threads_by_max_physical_cores;
   sc_uint32 max_events_and_agents_threads;  ///< Maximum number of threads for events and agents processing.
+  sc_uint32 max_events_queue_size;  ///< Maximum number of sc-events waiting for processing. If it is 0, then unlimited.
+  ///< Policy applied to emitted sc-events when the queue of sc-events is full (e.g., "Backoff", "Coalesce").
+  sc_char const * events_queue_overflow_policy;
 
   ///< Boolean indicating whether automatic saving of sc-memory state. By default, it is SC_TRUE.
   sc_bool dump_memory;
@@ -69,6 +75,8 @@ typedef struct
   sc_uint32 max_searchable_string_size;  ///< Maximum size of a searchable string.
   sc_char const * term_separators;       ///< String containing term separators used in string operations.
   sc_bool search_by_substring;           ///< Boolean indicating whether to allow searching by substring.
+  ///< Maximum number of bytes of cached sc-link contents. If it is 0, then sc-link contents aren't cached.
+  sc_uint32 max_link_contents_cache_size;
 } sc_memory_params;
 
 _SC_EXTERN void sc_memory_params_clear(sc_memory_params * params);
@@ -276,6 +276,33 @@ struct _sc_stat
   sc_uint64 link_count;       // amount of all sc-links stored in memory
 };
 
+// structure to store sc-events queue statistics info
+struct _sc_events_stat
+{
+  sc_uint64 events_count;                     // amount of not processed sc-events
+  sc_uint64 high_priority_queued_events_count;  // amount of queued sc-events of erasing sc-elements
+  sc_uint64 normal_priority_queued_events_count;  // amount of other queued sc-events
+  sc_uint64 max_reached_events_count;  // maximum amount of not processed sc-events reached since sc-memory start
+  sc_uint64 max_events_count;          // limit of not processed sc-events, 0 if it is unlimited
+  sc_uint64 overshoot_events_count;    // amount of not processed sc-events above the limit
+  sc_uint64 backing_off_emitters_count;  // amount of threads waiting for free space in the sc-events queue
+  sc_uint64 coalesced_events_count;      // amount of sc-events skipped because the sc-events queue was full
+  sc_uint64 overflowed_events_count;     // amount of sc-events admitted to the full sc-events queue
+  sc_uint64 events_pool_hits_count;      // amount of sc-event records reused from pools of sc-event records
+  sc_uint64 events_pool_misses_count;    // amount of sc-event records allocated because pools were empty
+};
+
+// structure to store statistics info of cache of sc-link contents
+struct _sc_link_contents_cache_stat
+{
+  sc_uint64 hits_count;       // amount of sc-link contents read from the cache
+  sc_uint64 misses_count;     // amount of sc-link contents read from file memory because they were not cached
+  sc_uint64 evictions_count;  // amount of sc-link contents removed from the cache to free space for other contents
+  sc_uint64 contents_count;   // amount of cached sc-link contents
+  sc_uint64 size;             // amount of bytes of cached sc-link contents
+  sc_uint64 max_size;         // limit of bytes of cached sc-link contents, 0 if the cache is disabled
+};
+
 #endif
 
 typedef struct _sc_arc sc_arc;
@@ -294,3 +321,5 @@ typedef struct _sc_iterator5 sc_iterator5;
 typedef struct _sc_event_subscription sc_event_subscription;
 typedef enum _sc_result sc_result;
 typedef struct _sc_stat sc_stat;
+typedef struct _sc_events_stat sc_events_stat;
+typedef struct _sc_link_contents_cache_stat sc_link_contents_cache_stat;
@@ -0,0 +1,29 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_atomic_h_
+#define _sc_atomic_h_
+
+#include <glib.h>
+
+#define sc_atomic_int_get(atomic) g_atomic_int_get(atomic)
+
+#define sc_atomic_int_set(atomic, value) g_atomic_int_set(atomic, value)
+
+#define sc_atomic_int_inc(atomic) g_atomic_int_inc(atomic)
+
+#define sc_atomic_int_dec_and_test(atomic) g_atomic_int_dec_and_test(atomic)
+
+#define sc_atomic_int_add(atomic, value) g_atomic_int_add(atomic, value)
+
+#define sc_atomic_int_compare_and_exchange(atomic, old_value, new_value) \
+  g_atomic_int_compare_and_exchange(atomic, old_value, new_value)
+
+#define sc_atomic_uint64_get(atomic) __atomic_load_n(atomic, __ATOMIC_SEQ_CST)
+
+#define sc_atomic_uint64_fetch_and_add(atomic, value) __atomic_fetch_add(atomic, value, __ATOMIC_SEQ_CST)
+
+#endif
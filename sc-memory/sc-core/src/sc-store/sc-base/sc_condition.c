@@ -18,6 +18,12 @@ void sc_cond_wait(sc_condition * condition, sc_mutex * mutex)
   g_cond_wait(&condition->instance, &mutex->instance);
 }
 
+sc_bool sc_cond_wait_timeout(sc_condition * condition, sc_mutex * mutex, sc_uint32 timeout)
+{
+  gint64 const end_time = g_get_monotonic_time() + timeout * G_TIME_SPAN_MILLISECOND;
+  return g_cond_wait_until(&condition->instance, &mutex->instance, end_time);
+}
+
 void sc_cond_signal(sc_condition * condition)
 {
   g_cond_signal(&condition->instance);
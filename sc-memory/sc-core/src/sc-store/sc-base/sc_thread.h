@@ -13,4 +13,16 @@ typedef GThread sc_thread;
 
 #define sc_thread_self g_thread_self
 
+#define sc_thread_new(name, func, data) g_thread_new(name, func, data)
+
+#define sc_thread_join(thread) g_thread_join(thread)
+
+typedef GPrivate sc_thread_local;
+
+#define SC_THREAD_LOCAL_INIT G_PRIVATE_INIT(null_ptr)
+
+#define sc_thread_local_get(key) g_private_get(key)
+
+#define sc_thread_local_set(key, value) g_private_set(key, value)
+
 #endif
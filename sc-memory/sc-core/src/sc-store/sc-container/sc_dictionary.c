@@ -10,13 +10,25 @@
 #include "sc-core/sc-base/sc_allocator.h"
 #include "sc-core/sc-container/sc_string.h"
 
-#define SC_DICTIONARY_NODE_BUCKET_SIZE 16
-#define SC_DICTIONARY_GET_BUCKET_NUM(num) ((num) / SC_DICTIONARY_NODE_BUCKET_SIZE)
-#define SC_DICTIONARY_GET_CHILD_NUM(num) ((num) % SC_DICTIONARY_NODE_BUCKET_SIZE)
+#define SC_DICTIONARY_NODE_KEYS_COUNT 256
 
 #define SC_DICTIONARY_NODE_IS_VALID(__node) ((__node) != null_ptr)
 #define SC_DICTIONARY_NODE_IS_NOT_VALID(__node) ((__node) == null_ptr)
 
+static sc_uint16 const sc_dictionary_node_kind_capacities[] = {0, 4, 16, 48, 256};
+
+//! Gets count of key indexes of sc-dictionary node children: sorted keys of small nodes or all keys of big nodes
+#define _sc_dictionary_node_get_keys_count(__kind) \
+  ((__kind) <= SC_DICTIONARY_NODE_16 ? sc_dictionary_node_kind_capacities[__kind] : SC_DICTIONARY_NODE_KEYS_COUNT)
+
+//! Gets keys of sc-dictionary node children, they are stored after children pointers
+#define _sc_dictionary_node_get_keys(__node) \
+  ((sc_uint8 *)((__node)->next + sc_dictionary_node_kind_capacities[(__node)->kind]))
+
+#define _sc_dictionary_node_get_children_size(__kind) \
+  (sc_dictionary_node_kind_capacities[__kind] * sizeof(sc_dictionary_node *) \
+   + ((__kind) == SC_DICTIONARY_NODE_256 ? 0 : _sc_dictionary_node_get_keys_count(__kind)))
+
 sc_bool sc_dictionary_initialize(
     sc_dictionary ** dictionary,
     sc_uint8 children_size,
@@ -24,27 +36,47 @@ sc_bool sc_dictionary_initialize(
 {
   *dictionary = sc_mem_new(sc_dictionary, 1);
   (*dictionary)->size = children_size;
-  (*dictionary)->root = _sc_dictionary_node_initialize(children_size);
+  (*dictionary)->memory_size = sizeof(sc_dictionary);
+  (*dictionary)->root = _sc_dictionary_node_initialize(*dictionary);
   (*dictionary)->char_to_int = char_to_int;
   sc_monitor_init(&(*dictionary)->monitor);
 
   return SC_TRUE;
 }
 
-inline sc_dictionary_node * _sc_dictionary_node_initialize(sc_uint8 children_size)
+inline sc_dictionary_node * _sc_dictionary_node_initialize(sc_dictionary * dictionary)
 {
   sc_dictionary_node * node = sc_mem_new(sc_dictionary_node, 1);
-
-  sc_uint64 const count = children_size / SC_DICTIONARY_NODE_BUCKET_SIZE + 1;
-  node->next = sc_mem_new(sc_dictionary_node **, count);
+  node->next = null_ptr;
+  node->kind = SC_DICTIONARY_NODE_0;
+  node->children_count = 0;
 
   node->data = null_ptr;
   node->offset = null_ptr;
   node->offset_size = 0;
 
+  dictionary->memory_size += sizeof(sc_dictionary_node);
+
   return node;
 }
 
+void _sc_dictionary_node_set_offset(
+    sc_dictionary * dictionary,
+    sc_dictionary_node * node,
+    sc_char const * offset,
+    sc_uint32 offset_size)
+{
+  sc_char * node_offset = node->offset;
+  if (node_offset != null_ptr)
+    dictionary->memory_size -= node->offset_size + 1;
+
+  node->offset_size = offset_size;
+  sc_str_cpy(node->offset, offset, offset_size);
+  dictionary->memory_size += offset_size + 1;
+
+  sc_mem_free(node_offset);
+}
+
 void _sc_dictionary_node_destroy(sc_dictionary_node * node)
 {
   node->data = null_ptr;
@@ -59,36 +91,153 @@ void _sc_dictionary_node_destroy(sc_dictionary_node * node)
   sc_mem_free(node);
 }
 
-void _sc_dictionary_up_destroy_node(
-    sc_dictionary const * dictionary,
+sc_dictionary_node * _sc_dictionary_node_get_child_by_key_index(sc_dictionary_node const * node, sc_uint16 key_idx)
+{
+  switch (node->kind)
+  {
+  case SC_DICTIONARY_NODE_4:
+  case SC_DICTIONARY_NODE_16:
+    return key_idx < node->children_count ? node->next[key_idx] : null_ptr;
+  case SC_DICTIONARY_NODE_48:
+  {
+    sc_uint8 const child_idx = _sc_dictionary_node_get_keys(node)[key_idx];
+    return child_idx == 0 ? null_ptr : node->next[child_idx - 1];
+  }
+  case SC_DICTIONARY_NODE_256:
+    return node->next[key_idx];
+  default:
+    return null_ptr;
+  }
+}
+
+sc_dictionary_node ** _sc_dictionary_node_get_child_place(sc_dictionary_node const * node, sc_uint8 key)
+{
+  switch (node->kind)
+  {
+  case SC_DICTIONARY_NODE_4:
+  case SC_DICTIONARY_NODE_16:
+  {
+    sc_uint8 const * keys = _sc_dictionary_node_get_keys(node);
+    for (sc_uint16 i = 0; i < node->children_count && keys[i] <= key; ++i)
+    {
+      if (keys[i] == key)
+        return &node->next[i];
+    }
+    return null_ptr;
+  }
+  case SC_DICTIONARY_NODE_48:
+  {
+    sc_uint8 const child_idx = _sc_dictionary_node_get_keys(node)[key];
+    return child_idx == 0 ? null_ptr : &node->next[child_idx - 1];
+  }
+  case SC_DICTIONARY_NODE_256:
+    return node->next[key] == null_ptr ? null_ptr : &node->next[key];
+  default:
+    return null_ptr;
+  }
+}
+
+//! Grows sc-dictionary node to next kind, so it can store more children
+void _sc_dictionary_node_grow(sc_dictionary * dictionary, sc_dictionary_node * node)
+{
+  sc_uint8 const kind = node->kind + 1;
+  sc_uint16 const capacity = sc_dictionary_node_kind_capacities[kind];
+  sc_uint64 const children_size = _sc_dictionary_node_get_children_size(kind);
+
+  sc_dictionary_node ** next = (sc_dictionary_node **)sc_mem_new(sc_uchar, children_size);
+  sc_uint8 * keys = (sc_uint8 *)(next + capacity);
+  sc_uint8 const * node_keys = node->next == null_ptr ? null_ptr : _sc_dictionary_node_get_keys(node);
+
+  if (kind <= SC_DICTIONARY_NODE_16)
+  {
+    for (sc_uint16 i = 0; i < node->children_count; ++i)
+    {
+      keys[i] = node_keys[i];
+      next[i] = node->next[i];
+    }
+  }
+  else if (kind == SC_DICTIONARY_NODE_48)
+  {
+    for (sc_uint16 i = 0; i < node->children_count; ++i)
+    {
+      keys[node_keys[i]] = i + 1;
+      next[i] = node->next[i];
+    }
+  }
+  else
+  {
+    for (sc_uint16 key = 0; key < SC_DICTIONARY_NODE_KEYS_COUNT; ++key)
+    {
+      if (node_keys[key] != 0)
+        next[key] = node->next[node_keys[key] - 1];
+    }
+  }
+
+  if (node->next != null_ptr)
+    dictionary->memory_size -= _sc_dictionary_node_get_children_size(node->kind);
+  dictionary->memory_size += children_size;
+
+  sc_mem_free(node->next);
+  node->next = next;
+  node->kind = kind;
+}
+
+sc_dictionary_node ** _sc_dictionary_node_add_child(
+    sc_dictionary * dictionary,
     sc_dictionary_node * node,
-    void (*node_clear)(sc_dictionary_node *))
+    sc_uint8 key,
+    sc_dictionary_node * child)
 {
-  sc_dictionary_node ** next_bucket = null_ptr;
-  for (sc_uint8 num = 0, prev_bucket_idx = 0; num < dictionary->size; ++num)
+  if (node->children_count == sc_dictionary_node_kind_capacities[node->kind])
+    _sc_dictionary_node_grow(dictionary, node);
+
+  sc_dictionary_node ** place;
+  switch (node->kind)
+  {
+  case SC_DICTIONARY_NODE_4:
+  case SC_DICTIONARY_NODE_16:
   {
-    sc_uint64 const bucket_idx = SC_DICTIONARY_GET_BUCKET_NUM(num);
-    if (prev_bucket_idx != bucket_idx)
-      sc_mem_free(next_bucket);
-    prev_bucket_idx = bucket_idx;
+    // keys of small nodes are sorted, so children are visited in the same order as in big nodes
+    sc_uint8 * keys = _sc_dictionary_node_get_keys(node);
+    sc_uint16 i = node->children_count;
+    for (; i > 0 && keys[i - 1] > key; --i)
+    {
+      keys[i] = keys[i - 1];
+      node->next[i] = node->next[i - 1];
+    }
+    keys[i] = key;
+    place = &node->next[i];
+    break;
+  }
+  case SC_DICTIONARY_NODE_48:
+    _sc_dictionary_node_get_keys(node)[key] = node->children_count + 1;
+    place = &node->next[node->children_count];
+    break;
+  default:
+    place = &node->next[key];
+    break;
+  }
 
-    next_bucket = node->next[bucket_idx];
-    if (SC_DICTIONARY_NODE_IS_NOT_VALID(next_bucket))
-      continue;
+  *place = child;
+  ++node->children_count;
+  return place;
+}
 
-    sc_uint64 const child_idx = SC_DICTIONARY_GET_CHILD_NUM(num);
-    sc_dictionary_node * next = next_bucket[child_idx];
+void _sc_dictionary_up_destroy_node(sc_dictionary_node * node, void (*node_clear)(sc_dictionary_node *))
+{
+  sc_uint16 const keys_count = _sc_dictionary_node_get_keys_count(node->kind);
+  for (sc_uint16 key_idx = 0; key_idx < keys_count; ++key_idx)
+  {
+    sc_dictionary_node * next = _sc_dictionary_node_get_child_by_key_index(node, key_idx);
     if (SC_DICTIONARY_NODE_IS_NOT_VALID(next))
       continue;
 
-    _sc_dictionary_up_destroy_node(dictionary, next, node_clear);
+    _sc_dictionary_up_destroy_node(next, node_clear);
 
     if (node_clear != null_ptr)
       node_clear(next);
     _sc_dictionary_node_destroy(next);
   }
-
-  sc_mem_free(next_bucket);
 }
 
 sc_bool sc_dictionary_destroy(sc_dictionary * dictionary, void (*node_clear)(sc_dictionary_node *))
@@ -96,7 +245,7 @@ sc_bool sc_dictionary_destroy(sc_dictionary * dictionary, void (*node_clear)(sc_
   if (dictionary == null_ptr)
     return SC_FALSE;
 
-  _sc_dictionary_up_destroy_node(dictionary, dictionary->root, node_clear);
+  _sc_dictionary_up_destroy_node(dictionary->root, node_clear);
 
   if (node_clear != null_ptr)
     node_clear(dictionary->root);
@@ -117,11 +266,8 @@ inline sc_dictionary_node * _sc_dictionary_get_next_node(
   sc_uint8 num;
   dictionary->char_to_int(ch, &num, &node->mask);
 
-  sc_uint64 const bucket_idx = SC_DICTIONARY_GET_BUCKET_NUM(num);
-  sc_uint64 const child_idx = SC_DICTIONARY_GET_CHILD_NUM(num);
-
-  return node->next == null_ptr ? null_ptr
-                                : (node->next[bucket_idx] == null_ptr ? null_ptr : node->next[bucket_idx][child_idx]);
+  sc_dictionary_node ** place = _sc_dictionary_node_get_child_place(node, num);
+  return place == null_ptr ? null_ptr : *place;
 }
 
 sc_dictionary_node * sc_dictionary_append_to_node(sc_dictionary * dictionary, sc_char const * string, sc_uint32 size)
@@ -130,79 +276,49 @@ sc_dictionary_node * sc_dictionary_append_to_node(sc_dictionary * dictionary, sc
   sc_char * string_ptr = (sc_char *)&*string;
 
   sc_uint32 i = 0;
-  sc_uint32 saved_offset_size = size;
   while (i < size)
   {
     sc_uint8 num;
     dictionary->char_to_int(*string_ptr, &num, &node->mask);
-    sc_uint64 bucket_idx = SC_DICTIONARY_GET_BUCKET_NUM(num);
-    sc_uint64 child_idx = SC_DICTIONARY_GET_CHILD_NUM(num);
-
-    if (SC_DICTIONARY_NODE_IS_NOT_VALID(node->next[bucket_idx]))
-      node->next[bucket_idx] = sc_mem_new(sc_dictionary_node *, SC_DICTIONARY_NODE_BUCKET_SIZE);
+    sc_dictionary_node ** place = _sc_dictionary_node_get_child_place(node, num);
 
     // define prefix
-    if (SC_DICTIONARY_NODE_IS_NOT_VALID(node->next[bucket_idx][child_idx]))
+    if (place == null_ptr)
     {
-      node->next[bucket_idx][child_idx] = _sc_dictionary_node_initialize(dictionary->size);
-
-      sc_dictionary_node * temp = node->next[bucket_idx][child_idx];
-
-      temp->offset_size = size - i;
-      sc_str_cpy(temp->offset, string_ptr, temp->offset_size);
+      sc_dictionary_node * temp = _sc_dictionary_node_initialize(dictionary);
+      _sc_dictionary_node_set_offset(dictionary, temp, string_ptr, size - i);
+      _sc_dictionary_node_add_child(dictionary, node, num, temp);
 
       node = temp;
 
       break;
     }
     // visit next substring
-    else if (node->next[bucket_idx][child_idx]->offset != null_ptr)
+    else if ((*place)->offset != null_ptr)
     {
-      sc_dictionary_node * moving = node->next[bucket_idx][child_idx];
+      sc_dictionary_node * moving = *place;
 
       sc_uint32 j = 0;
       for (; i < size && j < moving->offset_size && moving->offset[j] == *string_ptr; ++i, ++j, ++string_ptr)
         ;
 
-      if (j != moving->offset_size)
-      {
-        saved_offset_size = moving->offset_size;
-
-        node->next[bucket_idx][child_idx] = _sc_dictionary_node_initialize(dictionary->size);
-
-        sc_dictionary_node * temp = node->next[bucket_idx][child_idx];
-
-        temp->offset_size = j;
-        sc_str_cpy(temp->offset, moving->offset, temp->offset_size);
-      }
-      node = node->next[bucket_idx][child_idx];
-
       // insert intermediate node for prefix end branching
       if (j < moving->offset_size)
       {
-        sc_char * offset_ptr = &*(moving->offset + j);
-
-        dictionary->char_to_int(*offset_ptr, &num, &node->mask);
-        bucket_idx = SC_DICTIONARY_GET_BUCKET_NUM(num);
-        child_idx = SC_DICTIONARY_GET_CHILD_NUM(num);
-
-        sc_char * moving_offset_copy = moving->offset;
-
-        if (SC_DICTIONARY_NODE_IS_NOT_VALID(node->next[bucket_idx]))
-          node->next[bucket_idx] = sc_mem_new(sc_dictionary_node *, SC_DICTIONARY_NODE_BUCKET_SIZE);
-
-        node->next[bucket_idx][child_idx] = &*moving;
-
-        sc_dictionary_node * temp = node->next[bucket_idx][child_idx];
-
-        temp->offset_size = saved_offset_size - j;
-        sc_str_cpy(temp->offset, offset_ptr, temp->offset_size);
-        sc_mem_free(moving_offset_copy);
+        sc_dictionary_node * temp = _sc_dictionary_node_initialize(dictionary);
+        _sc_dictionary_node_set_offset(dictionary, temp, moving->offset, j);
+        *place = temp;
+
+        sc_char const * offset_ptr = moving->offset + j;
+        dictionary->char_to_int(*offset_ptr, &num, &temp->mask);
+        _sc_dictionary_node_set_offset(dictionary, moving, offset_ptr, moving->offset_size - j);
+        _sc_dictionary_node_add_child(dictionary, temp, num, moving);
       }
+      node = *place;
     }
     else
     {
-      node = node->next[bucket_idx][child_idx];
+      node = *place;
       ++string_ptr;
       ++i;
     }
@@ -309,28 +425,20 @@ sc_bool _sc_dictionary_get_by_key_prefix(
   if (i == string_size)
     callable(node, dest);
 
-  for (sc_uint8 num = 0; num < dictionary->size; ++num)
+  // only child by the next char of key prefix can start with the rest of key prefix
+  if (i < string_size)
   {
-    sc_uint64 const bucket_idx = SC_DICTIONARY_GET_BUCKET_NUM(num);
-    sc_dictionary_node ** next_bucket = node->next[bucket_idx];
-    if (SC_DICTIONARY_NODE_IS_NOT_VALID(next_bucket))
-      continue;
-
-    sc_uint64 const child_idx = SC_DICTIONARY_GET_CHILD_NUM(num);
-    sc_dictionary_node * next = next_bucket[child_idx];
-    if (SC_DICTIONARY_NODE_IS_NOT_VALID(next))
-      continue;
+    sc_dictionary_node * next = _sc_dictionary_get_next_node(dictionary, node, string[i]);
+    if (SC_DICTIONARY_NODE_IS_NOT_VALID(next) || !sc_str_has_prefix(next->offset, string + i))
+      return SC_TRUE;
 
-    if (i == string_size || sc_str_has_prefix(next->offset, string + i))
-    {
-      if (!callable(next, dest))
-        return SC_FALSE;
+    if (!callable(next, dest))
+      return SC_FALSE;
 
-      if (!sc_dictionary_visit_down_node_from_node(dictionary, next, callable, dest))
-        return SC_FALSE;
-    }
+    return sc_dictionary_visit_down_node_from_node(dictionary, next, callable, dest);
   }
-  return SC_TRUE;
+
+  return sc_dictionary_visit_down_node_from_node(dictionary, node, callable, dest);
 }
 
 sc_bool sc_dictionary_get_by_key_prefix(
@@ -352,15 +460,10 @@ sc_bool sc_dictionary_visit_down_node_from_node(
     sc_bool (*callable)(sc_dictionary_node *, void **),
     void ** dest)
 {
-  for (sc_uint8 num = 0; num < dictionary->size; ++num)
+  sc_uint16 const keys_count = _sc_dictionary_node_get_keys_count(node->kind);
+  for (sc_uint16 key_idx = 0; key_idx < keys_count; ++key_idx)
   {
-    sc_uint64 const bucket_idx = SC_DICTIONARY_GET_BUCKET_NUM(num);
-    sc_dictionary_node ** next_bucket = node->next[bucket_idx];
-    if (SC_DICTIONARY_NODE_IS_NOT_VALID(next_bucket))
-      continue;
-
-    sc_uint64 const child_idx = SC_DICTIONARY_GET_CHILD_NUM(num);
-    sc_dictionary_node * next = next_bucket[child_idx];
+    sc_dictionary_node * next = _sc_dictionary_node_get_child_by_key_index(node, key_idx);
     if (SC_DICTIONARY_NODE_IS_NOT_VALID(next))
       continue;
 
@@ -391,15 +494,10 @@ sc_bool sc_dictionary_visit_up_node_from_node(
     sc_bool (*callable)(sc_dictionary_node *, void **),
     void ** dest)
 {
-  for (sc_uint8 num = 0; num < dictionary->size; ++num)
+  sc_uint16 const keys_count = _sc_dictionary_node_get_keys_count(node->kind);
+  for (sc_uint16 key_idx = 0; key_idx < keys_count; ++key_idx)
   {
-    sc_uint64 const bucket_idx = SC_DICTIONARY_GET_BUCKET_NUM(num);
-    sc_dictionary_node ** next_bucket = node->next[bucket_idx];
-    if (SC_DICTIONARY_NODE_IS_NOT_VALID(next_bucket))
-      continue;
-
-    sc_uint64 const child_idx = SC_DICTIONARY_GET_CHILD_NUM(num);
-    sc_dictionary_node * next = next_bucket[child_idx];
+    sc_dictionary_node * next = _sc_dictionary_node_get_child_by_key_index(node, key_idx);
     if (SC_DICTIONARY_NODE_IS_NOT_VALID(next))
       continue;
 
@@ -423,3 +521,14 @@ sc_bool sc_dictionary_visit_up_nodes(
   sc_monitor_release_read(&dictionary->monitor);
   return status;
 }
+
+sc_uint64 sc_dictionary_get_memory_size(sc_dictionary * dictionary)
+{
+  if (dictionary == null_ptr)
+    return 0;
+
+  sc_monitor_acquire_read(&dictionary->monitor);
+  sc_uint64 const memory_size = dictionary->memory_size;
+  sc_monitor_release_read(&dictionary->monitor);
+  return memory_size;
+}
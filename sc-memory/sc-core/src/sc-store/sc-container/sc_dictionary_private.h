@@ -14,14 +14,28 @@
 
 #include "sc-store/sc-base/sc_monitor_private.h"
 
-//! A sc-dictionary structure node to store prefixes
+//! Kinds of sc-dictionary nodes by count of children they can store
+enum
+{
+  SC_DICTIONARY_NODE_0 = 0,    // node without children
+  SC_DICTIONARY_NODE_4 = 1,    // node with up to 4 children and their sorted keys
+  SC_DICTIONARY_NODE_16 = 2,   // node with up to 16 children and their sorted keys
+  SC_DICTIONARY_NODE_48 = 3,   // node with up to 48 children and indexes of children by all keys
+  SC_DICTIONARY_NODE_256 = 4,  // node with children by all keys
+};
+
+/*! A sc-dictionary structure node to store prefixes. Nodes are nodes of adaptive radix tree: a node grows from kind to
+ * kind when it gets more children, so nodes with few children don't store pointers for all keys.
+ */
 typedef struct _sc_dictionary_node
 {
-  struct _sc_dictionary_node *** next;  // a pointer to sc-dictionary node children pointers
-  sc_char * offset;                     // a pointer to substring of node string
-  sc_uint32 offset_size;                // size to substring of node string
-  void * data;                          // storing data
-  sc_uint8 mask;                        // mask for rights checking and memory optimization
+  struct _sc_dictionary_node ** next;  // a pointer to sc-dictionary node children pointers followed by their keys
+  sc_char * offset;                    // a pointer to substring of node string
+  void * data;                         // storing data
+  sc_uint32 offset_size;               // size to substring of node string
+  sc_uint16 children_count;            // count of node children
+  sc_uint8 kind;                       // kind of node by count of children it can store
+  sc_uint8 mask;                       // mask for rights checking and memory optimization
 } sc_dictionary_node;
 
 //! A sc-dictionary structure node to store pairs of <string, object> type
@@ -30,10 +44,11 @@ typedef struct _sc_dictionary
   sc_dictionary_node * root;  // sc-dictionary tree root node
   sc_uint8 size;              // default sc-dictionary node children size
   void (*char_to_int)(sc_char, sc_uint8 *, sc_uint8 const *);
+  sc_uint64 memory_size;  // size of memory used by sc-dictionary nodes, their children and substrings
   sc_monitor monitor;
 } sc_dictionary;
 
-sc_dictionary_node * _sc_dictionary_node_initialize(sc_uint8 children_size);
+sc_dictionary_node * _sc_dictionary_node_initialize(sc_dictionary * dictionary);
 
 sc_dictionary_node * _sc_dictionary_get_next_node(
     sc_dictionary const * dictionary,
@@ -0,0 +1,176 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_hash_map.h"
+
+#include "sc-core/sc-base/sc_allocator.h"
+
+#define SC_HASH_MAP_MIN_CAPACITY 16
+
+//! Items are probed while there are less than 3/4 of not empty items, so probe sequences stay short
+#define _sc_hash_map_is_full(__map, __size) ((__size) * 4 > (__map)->capacity * 3)
+
+//! Fibonacci hashing takes high bits of product, so all bits of sc-addr hashes, segments and offsets, are used
+#define _sc_hash_map_get_index(__map, __key) (((__key) * 0x9E3779B97F4A7C15ull) >> (__map)->shift)
+
+sc_uint64 _sc_hash_map_get_capacity(sc_uint64 size)
+{
+  sc_uint64 capacity = SC_HASH_MAP_MIN_CAPACITY;
+  while (capacity * 3 < size * 4)
+    capacity <<= 1;
+  return capacity;
+}
+
+void _sc_hash_map_set_capacity(sc_hash_map * map, sc_uint64 capacity)
+{
+  map->capacity = capacity;
+  map->shift = 64;
+  for (; capacity > 1; capacity >>= 1)
+    --map->shift;
+}
+
+sc_bool sc_hash_map_initialize(sc_hash_map ** map, sc_uint64 size)
+{
+  *map = sc_mem_new(sc_hash_map, 1);
+  _sc_hash_map_set_capacity(*map, _sc_hash_map_get_capacity(size));
+  (*map)->items = sc_mem_new(sc_hash_map_item, (*map)->capacity);
+  (*map)->size = 0;
+
+  return SC_TRUE;
+}
+
+sc_bool sc_hash_map_destroy(sc_hash_map * map, void (*value_clear)(void *))
+{
+  if (map == null_ptr)
+    return SC_FALSE;
+
+  if (value_clear != null_ptr)
+  {
+    for (sc_uint64 i = 0; i < map->capacity; ++i)
+    {
+      if (map->items[i].value != null_ptr)
+        value_clear(map->items[i].value);
+    }
+  }
+
+  sc_mem_free(map->items);
+  sc_mem_free(map);
+
+  return SC_TRUE;
+}
+
+sc_hash_map_item * _sc_hash_map_find_item(sc_hash_map const * map, sc_uint64 key)
+{
+  sc_uint64 const mask = map->capacity - 1;
+  for (sc_uint64 i = _sc_hash_map_get_index(map, key);; i = (i + 1) & mask)
+  {
+    sc_hash_map_item * item = &map->items[i];
+    if (item->value == null_ptr || item->key == key)
+      return item;
+  }
+}
+
+void _sc_hash_map_rehash(sc_hash_map * map, sc_uint64 capacity)
+{
+  sc_hash_map_item * items = map->items;
+  sc_uint64 const old_capacity = map->capacity;
+
+  map->items = sc_mem_new(sc_hash_map_item, capacity);
+  _sc_hash_map_set_capacity(map, capacity);
+
+  for (sc_uint64 i = 0; i < old_capacity; ++i)
+  {
+    if (items[i].value != null_ptr)
+      *_sc_hash_map_find_item(map, items[i].key) = items[i];
+  }
+
+  sc_mem_free(items);
+}
+
+void sc_hash_map_reserve(sc_hash_map * map, sc_uint64 size)
+{
+  sc_uint64 const capacity = _sc_hash_map_get_capacity(size);
+  if (capacity > map->capacity)
+    _sc_hash_map_rehash(map, capacity);
+}
+
+void * sc_hash_map_insert(sc_hash_map * map, sc_uint64 key, void * value)
+{
+  if (value == null_ptr)
+    return sc_hash_map_remove(map, key);
+
+  sc_hash_map_item * item = _sc_hash_map_find_item(map, key);
+  if (item->value != null_ptr)
+  {
+    void * old_value = item->value;
+    item->value = value;
+    return old_value;
+  }
+
+  if (_sc_hash_map_is_full(map, map->size + 1))
+  {
+    _sc_hash_map_rehash(map, map->capacity << 1);
+    item = _sc_hash_map_find_item(map, key);
+  }
+
+  item->key = key;
+  item->value = value;
+  ++map->size;
+
+  return null_ptr;
+}
+
+void * sc_hash_map_get(sc_hash_map const * map, sc_uint64 key)
+{
+  return _sc_hash_map_find_item(map, key)->value;
+}
+
+void * sc_hash_map_remove(sc_hash_map * map, sc_uint64 key)
+{
+  sc_hash_map_item * item = _sc_hash_map_find_item(map, key);
+  void * value = item->value;
+  if (value == null_ptr)
+    return null_ptr;
+
+  // items after removed one are shifted back instead of marking it as removed, so probe sequences don't grow
+  sc_uint64 const mask = map->capacity - 1;
+  sc_uint64 empty_i = item - map->items;
+  for (sc_uint64 i = (empty_i + 1) & mask; map->items[i].value != null_ptr; i = (i + 1) & mask)
+  {
+    sc_uint64 const home_i = _sc_hash_map_get_index(map, map->items[i].key);
+    // item can be shifted if its home index isn't cyclically between empty and its current index
+    if (((i - home_i) & mask) >= ((i - empty_i) & mask))
+    {
+      map->items[empty_i] = map->items[i];
+      empty_i = i;
+    }
+  }
+
+  map->items[empty_i].value = null_ptr;
+  --map->size;
+
+  return value;
+}
+
+sc_bool sc_hash_map_visit(
+    sc_hash_map const * map,
+    sc_bool (*callable)(sc_uint64, void *, void **),
+    void ** arguments)
+{
+  for (sc_uint64 i = 0; i < map->capacity; ++i)
+  {
+    sc_hash_map_item const * item = &map->items[i];
+    if (item->value != null_ptr && !callable(item->key, item->value, arguments))
+      return SC_FALSE;
+  }
+
+  return SC_TRUE;
+}
+
+sc_uint64 sc_hash_map_get_memory_size(sc_hash_map const * map)
+{
+  return sizeof(sc_hash_map) + map->capacity * sizeof(sc_hash_map_item);
+}
@@ -0,0 +1,83 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_hash_map_h_
+#define _sc_hash_map_h_
+
+#include "sc-core/sc_types.h"
+
+typedef struct _sc_hash_map_item
+{
+  sc_uint64 key;
+  void * value;  // null_ptr if item is empty
+} sc_hash_map_item;
+
+//! Hash map with integer keys and open addressing: items are stored in one array and collisions are probed linearly
+typedef struct _sc_hash_map
+{
+  sc_hash_map_item * items;
+  sc_uint64 capacity;  // count of items, it is a power of two
+  sc_uint64 size;      // count of not empty items
+  sc_uint8 shift;      // count of low bits of key hash that aren't used for item index
+} sc_hash_map;
+
+/*! Initializes sc-hash-map
+ * @param[out] map Pointer to a sc-hash-map pointer to initialize
+ * @param[in] size Expected count of values in sc-hash-map, it is grown on demand
+ * @returns Returns SC_TRUE, if sc-hash-map is initialized.
+ */
+sc_bool sc_hash_map_initialize(sc_hash_map ** map, sc_uint64 size);
+
+/*! Destroys a sc-hash-map
+ * @param map A sc-hash-map pointer to destroy
+ * @param value_clear A pointer to function that clears each value in sc-hash-map, it may be null_ptr
+ * @returns Returns SC_TRUE, if a sc-hash-map exists; otherwise return SC_FALSE.
+ */
+sc_bool sc_hash_map_destroy(sc_hash_map * map, void (*value_clear)(void *));
+
+/*! Reserves place for values in sc-hash-map, so they are inserted without rehashing
+ * @param map A sc-hash-map pointer
+ * @param size Expected count of values in sc-hash-map
+ */
+void sc_hash_map_reserve(sc_hash_map * map, sc_uint64 size);
+
+/*! Inserts a value into sc-hash-map by key or replaces value stored by it
+ * @param map A sc-hash-map pointer
+ * @param key A key of value
+ * @param value A not null value to store
+ * @returns Returns a replaced value, if it exists; otherwise return null_ptr.
+ */
+void * sc_hash_map_insert(sc_hash_map * map, sc_uint64 key, void * value);
+
+/*! Gets a value from sc-hash-map by key
+ * @param map A sc-hash-map pointer
+ * @param key A key of value
+ * @returns Returns a value, if it exists; otherwise return null_ptr.
+ */
+void * sc_hash_map_get(sc_hash_map const * map, sc_uint64 key);
+
+/*! Removes a value from sc-hash-map by key
+ * @param map A sc-hash-map pointer
+ * @param key A key of value
+ * @returns Returns a removed value, if it exists; otherwise return null_ptr.
+ */
+void * sc_hash_map_remove(sc_hash_map * map, sc_uint64 key);
+
+/*! Visits all values in sc-hash-map in unspecified order
+ * @param map A sc-hash-map pointer
+ * @param callable A callback for each key and value, visit stops if it returns SC_FALSE
+ * @param arguments A callback params
+ * @returns Returns SC_TRUE, if all values are visited; otherwise return SC_FALSE.
+ */
+sc_bool sc_hash_map_visit(
+    sc_hash_map const * map,
+    sc_bool (*callable)(sc_uint64, void *, void **),
+    void ** arguments);
+
+//! Gets count of bytes allocated by sc-hash-map
+sc_uint64 sc_hash_map_get_memory_size(sc_hash_map const * map);
+
+#endif
@@ -9,7 +9,7 @@
 #include "sc-core/sc-base/sc_allocator.h"
 
 #define INITIAL_CAPACITY 4
-#define RESIZE_INCREMENT 12
+#define RESIZE_FACTOR 2
 
 void sc_queue_init(sc_queue * queue)
 {
@@ -31,7 +31,7 @@ void sc_queue_destroy(sc_queue * queue)
 
 void sc_queue_resize(sc_queue * queue)
 {
-  sc_int32 const new_capacity = queue->capacity + RESIZE_INCREMENT;
+  sc_int32 const new_capacity = queue->capacity > 0 ? queue->capacity * RESIZE_FACTOR : INITIAL_CAPACITY;
   void ** new_data = sc_mem_new(void *, new_capacity);
 
   if (queue->front <= queue->back)
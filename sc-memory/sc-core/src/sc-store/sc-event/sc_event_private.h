@@ -35,8 +35,39 @@ struct _sc_event_subscription
   sc_monitor monitor;
   //! Count of references (users) of this sc-event subscription
   sc_uint32 ref_count;
+  //! Mutex used to synchronize the serial lane of sc-events of this sc-event subscription
+  sc_mutex lane_mutex;
+  //! Flag indicating whether an sc-event of this sc-event subscription is queued or being processed by a worker
+  sc_bool is_lane_busy;
+  //! Queue of sc-events of this sc-event subscription waiting for the previous sc-event to be processed
+  sc_queue lane_events;
+  //! Priority class of sc-events of this sc-event subscription
+  sc_event_priority priority;
+  //! Number of not processed sc-events of this sc-event subscription, it is synchronized by `lane_mutex`
+  sc_uint32 events_count;
+  //! Flag indicating whether this sc-event subscription is destroyed and should be freed after its last sc-event
+  sc_bool is_destroyed;
 };
 
+/*! Creates an sc-event subscription of sc-memory itself (e.g. to keep permissions of sc-memory contexts in sync with
+ * knowledge base). Its sc-events have the high priority class, so they are never skipped or blocked when the queue of
+ * sc-events is full.
+ * @see sc_event_subscription_with_user_new
+ */
+sc_event_subscription * _sc_event_subscription_system_with_user_new(
+    sc_memory_context const * ctx,
+    sc_addr subscription_addr,
+    sc_event_type event_type_addr,
+    sc_type event_element_type,
+    sc_pointer data,
+    sc_event_callback_with_user callback,
+    sc_event_subscription_delete_function delete_callback);
+
+/*! Frees an sc-event subscription that isn't referenced by the events table and sc-events anymore.
+ * @param event_subscription Pointer to the sc-event subscription to be freed.
+ */
+void _sc_event_subscription_free(sc_event_subscription * event_subscription);
+
 /*! Notify about sc-element deletion.
  * @param addr sc-address of deleted sc-element
  * @remarks This function call deletion callback function for event.
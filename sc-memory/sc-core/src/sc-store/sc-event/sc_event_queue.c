@@ -14,13 +14,18 @@
 #include "sc_memory_private.h"
 #include "sc-core/sc_memory.h"
 
+#include "sc-core/sc_keynodes.h"
 #include "sc-core/sc-base/sc_allocator.h"
+#include "sc-core/sc-container/sc_string.h"
+
+#include "sc-store/sc-base/sc_atomic.h"
 
 /*! Structure representing elementary sc-event.
  * @note This structure holds information required for processing events in a worker thread.
  */
-typedef struct
+struct _sc_event
 {
+  sc_uint32 sequence;                          ///< An emission sequence number of the event.
   sc_event_subscription * event_subscription;  ///< A pointer to the sc-event subscription associated with the event.
   sc_addr user_addr;                           ///< A sc-address representing user that initiated this sc-event
   sc_addr connector_addr;               ///< A sc-address representing the sc-connector associated with the event.
@@ -29,9 +34,95 @@ typedef struct
   sc_event_do_after_callback callback;  ///< A pointer to function that is executed after the execution of a function
                                         ///< that was called on the initiated event.
   sc_addr event_addr;                   ///< An argument of callback.
-} sc_event;
+  sc_event * next_free_event;           ///< A pointer to the next free sc-event record in a pool.
+};
+
+//! Worker of the sc-event emission manager that runs on the current thread, if any
+static sc_thread_local current_worker = SC_THREAD_LOCAL_INIT;
+//! Number of a worker (increased by one) that receives sc-events emitted by the current thread outside workers
+static sc_thread_local current_emitter_worker_number = SC_THREAD_LOCAL_INIT;
+
+/*! Function that takes a free sc-event record from the pool of the current worker, from the shared pool, or allocates
+ * a new one if both pools are empty.
+ * @param manager Pointer to the sc_event_emission_manager owning the pools.
+ * @return Returns pointer to the sc-event record.
+ */
+sc_event * _sc_event_alloc(sc_event_emission_manager * manager)
+{
+  sc_event * event = null_ptr;
+
+  sc_event_emission_worker * worker = sc_thread_local_get(&current_worker);
+  if (worker != null_ptr && worker->manager == manager && worker->free_events != null_ptr)
+  {
+    event = worker->free_events;
+    worker->free_events = event->next_free_event;
+    --worker->free_events_count;
+    sc_atomic_uint64_fetch_and_add(&worker->events_pool_hits_count, 1);
+    return event;
+  }
+
+  sc_mutex_lock(&manager->free_events_mutex);
+  if (manager->free_events != null_ptr)
+  {
+    event = manager->free_events;
+    manager->free_events = event->next_free_event;
+    --manager->free_events_count;
+    sc_atomic_uint64_fetch_and_add(&manager->events_pool_hits_count, 1);
+  }
+  else
+    sc_atomic_uint64_fetch_and_add(&manager->events_pool_misses_count, 1);
+  sc_mutex_unlock(&manager->free_events_mutex);
+
+  if (event == null_ptr)
+    event = sc_mem_new(sc_event, 1);
+
+  return event;
+}
+
+/*! Function that returns an sc-event record to the pool of the current worker or to the shared pool. If both pools
+ * are full, then the record is freed.
+ * @param manager Pointer to the sc_event_emission_manager owning the pools.
+ * @param event Pointer to the sc-event record.
+ */
+void _sc_event_free(sc_event_emission_manager * manager, sc_event * event)
+{
+  sc_event_emission_worker * worker = sc_thread_local_get(&current_worker);
+  if (worker != null_ptr && worker->manager == manager && worker->free_events_count < SC_EVENTS_WORKER_POOL_MAX_SIZE)
+  {
+    event->next_free_event = worker->free_events;
+    worker->free_events = event;
+    ++worker->free_events_count;
+    return;
+  }
+
+  sc_mutex_lock(&manager->free_events_mutex);
+  if (manager->free_events_count < SC_EVENTS_POOL_MAX_SIZE)
+  {
+    event->next_free_event = manager->free_events;
+    manager->free_events = event;
+    ++manager->free_events_count;
+    event = null_ptr;
+  }
+  sc_mutex_unlock(&manager->free_events_mutex);
+
+  sc_mem_free(event);
+}
+
+/*! Function that frees all sc-event records of a pool.
+ * @param free_events Pointer to the first sc-event record of the pool.
+ */
+void _sc_event_pool_destroy(sc_event * free_events)
+{
+  while (free_events != null_ptr)
+  {
+    sc_event * next_free_event = free_events->next_free_event;
+    sc_mem_free(free_events);
+    free_events = next_free_event;
+  }
+}
 
 sc_event * _sc_event_new(
+    sc_event_emission_manager * manager,
     sc_event_subscription * event_subscription,
     sc_addr user_addr,
     sc_addr connector_addr,
@@ -40,7 +131,8 @@ sc_event * _sc_event_new(
     sc_event_do_after_callback callback,
     sc_addr event_addr)
 {
-  sc_event * event = sc_mem_new(sc_event, 1);
+  sc_event * event = _sc_event_alloc(manager);
+  event->next_free_event = null_ptr;
   event->event_subscription = event_subscription;
   event->user_addr = user_addr;
   event->connector_addr = connector_addr;
@@ -52,27 +144,262 @@ sc_event * _sc_event_new(
   return event;
 }
 
-void _sc_event_emission_pool_worker_data_destroy(sc_event * data)
+void _sc_event_destroy(sc_event_emission_manager * manager, sc_event * event)
+{
+  _sc_event_free(manager, event);
+}
+
+sc_event_priority _sc_event_priority_get(sc_event_type event_type_addr)
+{
+  if (SC_ADDR_IS_EQUAL(event_type_addr, sc_event_before_erase_element_addr)
+      || SC_ADDR_IS_EQUAL(event_type_addr, sc_event_before_erase_connector_addr)
+      || SC_ADDR_IS_EQUAL(event_type_addr, sc_event_before_erase_incoming_arc_addr)
+      || SC_ADDR_IS_EQUAL(event_type_addr, sc_event_before_erase_outgoing_arc_addr)
+      || SC_ADDR_IS_EQUAL(event_type_addr, sc_event_before_erase_edge_addr))
+    return SC_EVENT_PRIORITY_HIGH;
+
+  return SC_EVENT_PRIORITY_NORMAL;
+}
+
+sc_event_priority _sc_event_get_priority(sc_event const * event)
+{
+  return event->event_subscription != null_ptr ? event->event_subscription->priority : SC_EVENT_PRIORITY_NORMAL;
+}
+
+/*! Function that checks whether an sc-event has been emitted before another sc-event.
+ * @note Sequence numbers are compared with wrap-around, sc-events in queues are never 2^31 sc-events apart.
+ */
+static inline sc_bool _sc_event_is_earlier(sc_event const * event, sc_event const * other)
 {
-  sc_mem_free(data);
+  return (sc_int32)(event->sequence - other->sequence) < 0;
 }
 
-/*! Function that represents the work performed by a worker in the sc-event emission pool.
- * @param data Pointer to the sc_event containing information about the work.
- * @param user_data Pointer to the sc_event_emission_manager managing the sc-event emission.
+/*! Function that puts an sc-event into the binary heap of a worker.
+ * @param worker Pointer to the sc_event_emission_worker, its queue mutex must be locked.
+ * @param event Pointer to the sc_event to be put.
  */
-void _sc_event_emission_pool_worker(sc_pointer data, sc_pointer user_data)
+void _sc_event_emission_worker_queue_push(sc_event_emission_worker * worker, sc_event * event)
 {
-  sc_event * event = (sc_event *)data;
-  sc_event_emission_manager * queue = user_data;
+  if (worker->queue_size == worker->queue_capacity)
+  {
+    worker->queue_capacity = worker->queue_capacity > 0 ? worker->queue_capacity * 2 : 16;
+    sc_event ** queue = sc_mem_new(sc_event *, worker->queue_capacity);
+    if (worker->queue != null_ptr)
+      sc_mem_cpy(queue, worker->queue, worker->queue_size * sizeof(sc_event *));
+    sc_mem_free(worker->queue);
+    worker->queue = queue;
+  }
+
+  sc_uint32 index = worker->queue_size++;
+  while (index > 0)
+  {
+    sc_uint32 const parent_index = (index - 1) / 2;
+    if (!_sc_event_is_earlier(event, worker->queue[parent_index]))
+      break;
+    worker->queue[index] = worker->queue[parent_index];
+    index = parent_index;
+  }
+  worker->queue[index] = event;
+}
+
+/*! Function that takes the earliest emitted sc-event from the binary heap of a worker.
+ * @param worker Pointer to the sc_event_emission_worker, its queue mutex must be locked.
+ * @return Returns pointer to the sc_event or null_ptr if the queue is empty.
+ */
+sc_event * _sc_event_emission_worker_queue_pop(sc_event_emission_worker * worker)
+{
+  if (worker->queue_size == 0)
+    return null_ptr;
+
+  sc_event * event = worker->queue[0];
+  sc_event * last_event = worker->queue[--worker->queue_size];
+
+  sc_uint32 index = 0;
+  while (SC_TRUE)
+  {
+    sc_uint32 child_index = index * 2 + 1;
+    if (child_index >= worker->queue_size)
+      break;
+    if (child_index + 1 < worker->queue_size
+        && _sc_event_is_earlier(worker->queue[child_index + 1], worker->queue[child_index]))
+      ++child_index;
+    if (!_sc_event_is_earlier(worker->queue[child_index], last_event))
+      break;
+    worker->queue[index] = worker->queue[child_index];
+    index = child_index;
+  }
+  if (worker->queue_size > 0)
+    worker->queue[index] = last_event;
+
+  return event;
+}
+
+/*! Function that puts an sc-event into a queue of one of workers and wakes up an idle worker.
+ * @param manager Pointer to the sc_event_emission_manager managing the sc-event emission.
+ * @param event Pointer to the sc_event to be processed.
+ * @note Sc-events emitted by workers are put into queues of these workers. Threads emitting sc-events outside workers
+ * are distributed between workers by round-robin, and all sc-events of one thread are put into the queue of the same
+ * worker, so they start processing in emission order unless they are stolen by idle workers.
+ */
+void _sc_event_emission_manager_push(sc_event_emission_manager * manager, sc_event * event)
+{
+  sc_event_emission_worker * worker = sc_thread_local_get(&current_worker);
+  if (worker == null_ptr || worker->manager != manager)
+  {
+    sc_uint32 worker_number = GPOINTER_TO_UINT(sc_thread_local_get(&current_emitter_worker_number));
+    if (worker_number == 0)
+    {
+      worker_number = (sc_uint32)sc_atomic_int_add(&manager->next_worker_index, 1) + 1;
+      sc_thread_local_set(&current_emitter_worker_number, GUINT_TO_POINTER(worker_number));
+    }
+    worker = &manager->workers[(worker_number - 1) % manager->max_events_and_agents_threads];
+  }
+
+  sc_event_priority const priority = _sc_event_get_priority(event);
+
+  sc_mutex_lock(&worker->queue_mutex);
+  _sc_event_emission_worker_queue_push(worker, event);
+  sc_mutex_unlock(&worker->queue_mutex);
+
+  sc_atomic_int_inc(&manager->queued_priority_events_count[priority]);
+  sc_atomic_int_inc(&manager->queued_events_count);
+  if (sc_atomic_int_get(&manager->idle_workers_count) > 0)
+  {
+    sc_mutex_lock(&manager->idle_mutex);
+    sc_cond_signal(&manager->idle_condition);
+    sc_mutex_unlock(&manager->idle_mutex);
+  }
+}
+
+/*! Function that takes the earliest emitted sc-event from the queue of a worker or, if it is empty, steals the
+ * earliest emitted sc-event from queues of other workers.
+ * @param worker Pointer to the sc_event_emission_worker looking for an sc-event.
+ * @return Returns pointer to the sc_event or null_ptr if all queues are empty.
+ * @note Only the queue of the worker is locked while it has sc-events, queues of other workers are locked one by one
+ * while stealing.
+ */
+sc_event * _sc_event_emission_worker_pop(sc_event_emission_worker * worker)
+{
+  sc_event_emission_manager * manager = worker->manager;
+  sc_uint32 const workers_count = manager->max_events_and_agents_threads;
+  sc_uint32 const worker_index = worker - manager->workers;
+
+  sc_event * event = null_ptr;
+  for (sc_uint32 i = 0; i < workers_count && event == null_ptr; ++i)
+  {
+    sc_event_emission_worker * victim = &manager->workers[(worker_index + i) % workers_count];
+
+    sc_mutex_lock(&victim->queue_mutex);
+    event = _sc_event_emission_worker_queue_pop(victim);
+    sc_mutex_unlock(&victim->queue_mutex);
+  }
+
+  if (event != null_ptr)
+  {
+    sc_event_priority const priority = _sc_event_get_priority(event);
+    sc_atomic_int_add(&manager->queued_priority_events_count[priority], -1);
+    sc_atomic_int_add(&manager->queued_events_count, -1);
+  }
+
+  return event;
+}
 
+/*! Function that checks whether the number of not processed sc-events has reached the limit.
+ * @param manager Pointer to the sc_event_emission_manager managing the sc-event emission.
+ * @return Returns SC_TRUE if the limit is set and reached, otherwise SC_FALSE.
+ */
+sc_bool _sc_event_emission_manager_is_full(sc_event_emission_manager * manager)
+{
+  return manager->max_events_queue_size != 0
+         && (sc_uint32)sc_atomic_int_get(&manager->events_count) >= manager->max_events_queue_size;
+}
+
+/*! Function that makes the current thread back off until there is free space in the queue of sc-events.
+ * @param manager Pointer to the sc_event_emission_manager managing the sc-event emission.
+ * @note The thread waits at most `SC_EVENTS_QUEUE_MAX_BACKOFF_TIME` milliseconds, so the queue may overshoot its limit.
+ */
+void _sc_event_emission_manager_back_off(sc_event_emission_manager * manager)
+{
+  sc_mutex_lock(&manager->not_full_mutex);
+  sc_atomic_int_inc(&manager->backing_off_emitters_count);
+  while (_sc_event_emission_manager_is_full(manager) && manager->is_stopping == SC_FALSE)
+  {
+    if (sc_cond_wait_timeout(&manager->not_full_condition, &manager->not_full_mutex, SC_EVENTS_QUEUE_MAX_BACKOFF_TIME)
+        == SC_FALSE)
+      break;
+  }
+  sc_atomic_int_add(&manager->backing_off_emitters_count, -1);
+  sc_mutex_unlock(&manager->not_full_mutex);
+}
+
+/*! Function that counts a new not processed sc-event.
+ * @param manager Pointer to the sc_event_emission_manager managing the sc-event emission.
+ * @note The sc-event is counted as overflowed, if it exceeds the limit of not processed sc-events.
+ */
+void _sc_event_emission_manager_acquire_events_count(sc_event_emission_manager * manager)
+{
+  sc_int32 const events_count = sc_atomic_int_add(&manager->events_count, 1) + 1;
+  if (manager->max_events_queue_size != 0 && (sc_uint32)events_count > manager->max_events_queue_size)
+    sc_atomic_int_inc(&manager->overflowed_events_count);
+
+  sc_int32 max_reached_events_count = sc_atomic_int_get(&manager->max_reached_events_count);
+  while (events_count > max_reached_events_count
+         && !sc_atomic_int_compare_and_exchange(
+             &manager->max_reached_events_count, max_reached_events_count, events_count))
+    max_reached_events_count = sc_atomic_int_get(&manager->max_reached_events_count);
+}
+
+/*! Function that uncounts a processed sc-event and wakes up a blocked emitter.
+ * @param manager Pointer to the sc_event_emission_manager managing the sc-event emission.
+ */
+void _sc_event_emission_manager_release_events_count(sc_event_emission_manager * manager)
+{
+  sc_atomic_int_add(&manager->events_count, -1);
+  if (sc_atomic_int_get(&manager->backing_off_emitters_count) > 0)
+  {
+    sc_mutex_lock(&manager->not_full_mutex);
+    sc_cond_signal(&manager->not_full_condition);
+    sc_mutex_unlock(&manager->not_full_mutex);
+  }
+}
+
+/*! Function that finishes processing of an sc-event in the lane of its sc-event subscription.
+ * @param manager Pointer to the sc_event_emission_manager managing the sc-event emission.
+ * @param event_subscription Pointer to the sc-event subscription of the processed sc-event.
+ * @note The next sc-event of the lane, if any, is put into a queue of the current worker. The destroyed sc-event
+ * subscription is freed after its last sc-event.
+ */
+void _sc_event_emission_manager_release_lane(
+    sc_event_emission_manager * manager,
+    sc_event_subscription * event_subscription)
+{
+  sc_mutex_lock(&event_subscription->lane_mutex);
+  --event_subscription->events_count;
+  sc_event * next_event = sc_queue_pop(&event_subscription->lane_events);
+  if (next_event == null_ptr)
+    event_subscription->is_lane_busy = SC_FALSE;
+  sc_bool const is_reclaimable = event_subscription->is_destroyed && event_subscription->events_count == 0;
+  sc_mutex_unlock(&event_subscription->lane_mutex);
+
+  if (next_event != null_ptr)
+    _sc_event_emission_manager_push(manager, next_event);
+  else if (is_reclaimable)
+    _sc_event_subscription_free(event_subscription);
+}
+
+/*! Function that processes an sc-event by a worker of the sc-event emission manager.
+ * @param manager Pointer to the sc_event_emission_manager managing the sc-event emission.
+ * @param event Pointer to the sc_event containing information about the work.
+ */
+void _sc_event_emission_manager_process(sc_event_emission_manager * manager, sc_event * event)
+{
   sc_event_subscription * event_subscription = event->event_subscription;
   if (event_subscription == null_ptr)
     goto destroy;
 
-  sc_monitor_acquire_read(&queue->destroy_monitor);
+  sc_monitor_acquire_read(&manager->destroy_monitor);
 
-  if (queue->running == SC_FALSE)
+  if (manager->running == SC_FALSE)
     goto end;
 
   sc_monitor_acquire_read(&event_subscription->monitor);
@@ -98,7 +425,7 @@ void _sc_event_emission_pool_worker(sc_pointer data, sc_pointer user_data)
   sc_monitor_release_read(&event_subscription->monitor);
 
 end:
-  sc_monitor_release_read(&queue->destroy_monitor);
+  sc_monitor_release_read(&manager->destroy_monitor);
 destroy:
 {
   if (event->callback != null_ptr)
@@ -108,38 +435,123 @@ destroy:
     sc_memory_context_free(ctx);
   }
 
-  _sc_event_emission_pool_worker_data_destroy(event);
+  _sc_event_destroy(manager, event);
+  _sc_event_emission_manager_release_events_count(manager);
+
+  if (event_subscription != null_ptr)
+    _sc_event_emission_manager_release_lane(manager, event_subscription);
 }
 }
 
+/*! Function that represents the work performed by a worker of the sc-event emission manager.
+ * @param data Pointer to the sc_event_emission_worker.
+ * @return Returns null_ptr.
+ * @note The worker finishes when the manager is stopping and there are no queued sc-events.
+ */
+sc_pointer _sc_event_emission_worker_run(sc_pointer data)
+{
+  sc_event_emission_worker * worker = data;
+  sc_event_emission_manager * manager = worker->manager;
+  sc_thread_local_set(&current_worker, worker);
+
+  while (SC_TRUE)
+  {
+    sc_event * event = _sc_event_emission_worker_pop(worker);
+    if (event != null_ptr)
+    {
+      _sc_event_emission_manager_process(manager, event);
+      continue;
+    }
+
+    sc_mutex_lock(&manager->idle_mutex);
+    sc_atomic_int_inc(&manager->idle_workers_count);
+    while (sc_atomic_int_get(&manager->queued_events_count) == 0 && manager->is_stopping == SC_FALSE)
+      sc_cond_wait(&manager->idle_condition, &manager->idle_mutex);
+    sc_atomic_int_add(&manager->idle_workers_count, -1);
+    sc_bool const is_finished =
+        manager->is_stopping == SC_TRUE && sc_atomic_int_get(&manager->queued_events_count) == 0;
+    sc_mutex_unlock(&manager->idle_mutex);
+
+    if (is_finished)
+      break;
+  }
+
+  sc_thread_local_set(&current_worker, null_ptr);
+  return null_ptr;
+}
+
 void sc_event_emission_manager_initialize(sc_event_emission_manager ** manager, sc_memory_params const * params)
 {
   *manager = sc_mem_new(sc_event_emission_manager, 1);
-  sc_queue_init(&(*manager)->deletable_events_subscriptions);
 
   (*manager)->limit_max_threads_by_max_physical_cores = params->limit_max_threads_by_max_physical_cores;
   (*manager)->max_events_and_agents_threads =
       (*manager)->limit_max_threads_by_max_physical_cores
           ? sc_boundary(params->max_events_and_agents_threads, 1, g_get_num_processors())
           : sc_max(1, params->max_events_and_agents_threads);
+  (*manager)->max_events_queue_size = params->max_events_queue_size;
+  (*manager)->events_queue_overflow_policy =
+      params->events_queue_overflow_policy != null_ptr && sc_str_cmp(params->events_queue_overflow_policy, "Coalesce")
+          ? SC_EVENTS_QUEUE_OVERFLOW_POLICY_COALESCE
+          : SC_EVENTS_QUEUE_OVERFLOW_POLICY_BACKOFF;
   {
     sc_memory_info("Sc-event managers configuration:");
     sc_message(
         "\tLimit max threads by max physical cores: %s",
         (*manager)->limit_max_threads_by_max_physical_cores ? "On" : "Off");
     sc_message("\tMax events and agents threads: %d", (*manager)->max_events_and_agents_threads);
+    sc_message("\tMax events queue size: %d", (*manager)->max_events_queue_size);
+    sc_message(
+        "\tEvents queue overflow policy: %s",
+        (*manager)->events_queue_overflow_policy == SC_EVENTS_QUEUE_OVERFLOW_POLICY_COALESCE ? "Coalesce" : "Backoff");
   }
 
   (*manager)->running = SC_TRUE;
   sc_monitor_init(&(*manager)->destroy_monitor);
 
-  sc_monitor_init(&(*manager)->pool_monitor);
-  (*manager)->thread_pool = g_thread_pool_new(
-      _sc_event_emission_pool_worker,
-      *manager,
-      (sc_int32)(*manager)->max_events_and_agents_threads,
-      SC_FALSE,
-      null_ptr);
+  (*manager)->next_worker_index = 0;
+  (*manager)->next_event_sequence = 0;
+  (*manager)->queued_events_count = 0;
+  for (sc_uint32 priority = 0; priority < SC_EVENT_PRIORITY_COUNT; ++priority)
+    (*manager)->queued_priority_events_count[priority] = 0;
+  (*manager)->idle_workers_count = 0;
+  (*manager)->is_stopping = SC_FALSE;
+  sc_mutex_init(&(*manager)->idle_mutex);
+  sc_cond_init(&(*manager)->idle_condition);
+
+  (*manager)->events_count = 0;
+  (*manager)->max_reached_events_count = 0;
+  (*manager)->backing_off_emitters_count = 0;
+  (*manager)->coalesced_events_count = 0;
+  (*manager)->overflowed_events_count = 0;
+  sc_mutex_init(&(*manager)->not_full_mutex);
+  sc_cond_init(&(*manager)->not_full_condition);
+
+  (*manager)->free_events = null_ptr;
+  (*manager)->free_events_count = 0;
+  (*manager)->events_pool_hits_count = 0;
+  (*manager)->events_pool_misses_count = 0;
+  sc_mutex_init(&(*manager)->free_events_mutex);
+
+  (*manager)->workers = sc_mem_new(sc_event_emission_worker, (*manager)->max_events_and_agents_threads);
+  for (sc_uint32 i = 0; i < (*manager)->max_events_and_agents_threads; ++i)
+  {
+    sc_event_emission_worker * worker = &(*manager)->workers[i];
+    worker->manager = *manager;
+    sc_mutex_init(&worker->queue_mutex);
+    worker->queue = null_ptr;
+    worker->queue_size = 0;
+    worker->queue_capacity = 0;
+    worker->free_events = null_ptr;
+    worker->free_events_count = 0;
+    worker->events_pool_hits_count = 0;
+  }
+
+  for (sc_uint32 i = 0; i < (*manager)->max_events_and_agents_threads; ++i)
+  {
+    sc_event_emission_worker * worker = &(*manager)->workers[i];
+    worker->thread = sc_thread_new("sc-event-worker", _sc_event_emission_worker_run, worker);
+  }
 }
 
 void sc_event_emission_manager_stop(sc_event_emission_manager * manager)
@@ -166,29 +578,37 @@ void sc_event_emission_manager_shutdown(sc_event_emission_manager * manager)
   if (manager == null_ptr)
     return;
 
-  sc_monitor_acquire_write(&manager->pool_monitor);
-  if (manager->thread_pool)
-  {
-    g_thread_pool_free(manager->thread_pool, SC_FALSE, SC_TRUE);
-    manager->thread_pool = null_ptr;
-  }
+  sc_mutex_lock(&manager->idle_mutex);
+  manager->is_stopping = SC_TRUE;
+  sc_cond_broadcast(&manager->idle_condition);
+  sc_mutex_unlock(&manager->idle_mutex);
+
+  sc_mutex_lock(&manager->not_full_mutex);
+  sc_cond_broadcast(&manager->not_full_condition);
+  sc_mutex_unlock(&manager->not_full_mutex);
 
-  while (!sc_queue_empty(&manager->deletable_events_subscriptions))
+  for (sc_uint32 i = 0; i < manager->max_events_and_agents_threads; ++i)
   {
-    sc_event_subscription * event_subscription = sc_queue_pop(&manager->deletable_events_subscriptions);
-    sc_monitor_destroy(&event_subscription->monitor);
-    sc_mem_free(event_subscription);
+    sc_event_emission_worker * worker = &manager->workers[i];
+    sc_thread_join(worker->thread);
+    sc_mem_free(worker->queue);
+    sc_mutex_destroy(&worker->queue_mutex);
+    _sc_event_pool_destroy(worker->free_events);
   }
-  sc_queue_destroy(&manager->deletable_events_subscriptions);
-
-  sc_monitor_release_write(&manager->pool_monitor);
-
-  sc_monitor_destroy(&manager->pool_monitor);
+  sc_mem_free(manager->workers);
+  manager->workers = null_ptr;
+
+  _sc_event_pool_destroy(manager->free_events);
+  sc_mutex_destroy(&manager->free_events_mutex);
+  sc_cond_destroy(&manager->not_full_condition);
+  sc_mutex_destroy(&manager->not_full_mutex);
+  sc_cond_destroy(&manager->idle_condition);
+  sc_mutex_destroy(&manager->idle_mutex);
   sc_monitor_destroy(&manager->destroy_monitor);
   sc_mem_free(manager);
 }
 
-void _sc_event_emission_manager_add(
+sc_event * _sc_event_emission_manager_reserve(
     sc_event_emission_manager * manager,
     sc_event_subscription * event_subscription,
     sc_addr user_addr,
@@ -199,12 +619,110 @@ void _sc_event_emission_manager_add(
     sc_addr event_addr)
 {
   if (manager == null_ptr)
+    return null_ptr;
+
+  sc_event * event = _sc_event_new(
+      manager, event_subscription, user_addr, connector_addr, connector_type, other_addr, callback, event_addr);
+
+  if (event_subscription != null_ptr)
+  {
+    sc_mutex_lock(&event_subscription->lane_mutex);
+    ++event_subscription->events_count;
+    sc_mutex_unlock(&event_subscription->lane_mutex);
+  }
+
+  return event;
+}
+
+/*! Function that destroys a reserved sc-event skipped because the queue of sc-events is full.
+ * @param manager Pointer to the sc_event_emission_manager managing the sc-event emission.
+ * @param event Pointer to the skipped sc-event.
+ * @note The destroyed sc-event subscription is freed, if the skipped sc-event was its last one.
+ */
+void _sc_event_emission_manager_skip(sc_event_emission_manager * manager, sc_event * event)
+{
+  sc_event_subscription * event_subscription = event->event_subscription;
+  _sc_event_destroy(manager, event);
+
+  if (event_subscription == null_ptr)
+    return;
+
+  sc_mutex_lock(&event_subscription->lane_mutex);
+  --event_subscription->events_count;
+  sc_bool const is_reclaimable = event_subscription->is_destroyed && event_subscription->events_count == 0;
+  sc_mutex_unlock(&event_subscription->lane_mutex);
+
+  if (is_reclaimable)
+    _sc_event_subscription_free(event_subscription);
+}
+
+void _sc_event_emission_manager_add(sc_event_emission_manager * manager, sc_event * event)
+{
+  if (manager == null_ptr || event == null_ptr)
     return;
 
-  sc_event * event =
-      _sc_event_new(event_subscription, user_addr, connector_addr, connector_type, other_addr, callback, event_addr);
+  sc_event_subscription * event_subscription = event->event_subscription;
+  sc_event_priority const priority =
+      event_subscription != null_ptr ? event_subscription->priority : SC_EVENT_PRIORITY_NORMAL;
+  if (priority != SC_EVENT_PRIORITY_HIGH && _sc_event_emission_manager_is_full(manager))
+  {
+    if (manager->events_queue_overflow_policy == SC_EVENTS_QUEUE_OVERFLOW_POLICY_COALESCE)
+    {
+      if (event->callback == null_ptr)
+      {
+        sc_atomic_int_inc(&manager->coalesced_events_count);
+        _sc_event_emission_manager_skip(manager, event);
+        return;
+      }
+    }
+    else if (sc_thread_local_get(&current_worker) == null_ptr)
+      _sc_event_emission_manager_back_off(manager);
+  }
+
+  _sc_event_emission_manager_acquire_events_count(manager);
+
+  event->sequence = (sc_uint32)sc_atomic_int_add(&manager->next_event_sequence, 1);
+
+  if (event_subscription != null_ptr)
+  {
+    sc_mutex_lock(&event_subscription->lane_mutex);
+    if (event_subscription->is_lane_busy)
+    {
+      sc_queue_push(&event_subscription->lane_events, event);
+      sc_mutex_unlock(&event_subscription->lane_mutex);
+      return;
+    }
+    event_subscription->is_lane_busy = SC_TRUE;
+    sc_mutex_unlock(&event_subscription->lane_mutex);
+  }
+
+  _sc_event_emission_manager_push(manager, event);
+}
 
-  sc_monitor_acquire_write(&manager->pool_monitor);
-  g_thread_pool_push(manager->thread_pool, event, null_ptr);
-  sc_monitor_release_write(&manager->pool_monitor);
+sc_result sc_event_emission_manager_get_stat(sc_event_emission_manager * manager, sc_events_stat * stat)
+{
+  if (manager == null_ptr)
+    return SC_RESULT_ERROR_INVALID_STATE;
+
+  stat->events_count = sc_max(0, sc_atomic_int_get(&manager->events_count));
+  stat->high_priority_queued_events_count =
+      sc_max(0, sc_atomic_int_get(&manager->queued_priority_events_count[SC_EVENT_PRIORITY_HIGH]));
+  stat->normal_priority_queued_events_count =
+      sc_max(0, sc_atomic_int_get(&manager->queued_priority_events_count[SC_EVENT_PRIORITY_NORMAL]));
+  stat->max_reached_events_count = sc_atomic_int_get(&manager->max_reached_events_count);
+  stat->max_events_count = manager->max_events_queue_size;
+  stat->backing_off_emitters_count = sc_atomic_int_get(&manager->backing_off_emitters_count);
+  stat->coalesced_events_count = sc_atomic_int_get(&manager->coalesced_events_count);
+  stat->overflowed_events_count = sc_atomic_int_get(&manager->overflowed_events_count);
+  stat->overshoot_events_count =
+      manager->max_events_queue_size != 0 && stat->events_count > manager->max_events_queue_size
+          ? stat->events_count - manager->max_events_queue_size
+          : 0;
+
+  stat->events_pool_hits_count = sc_atomic_uint64_get(&manager->events_pool_hits_count);
+  stat->events_pool_misses_count = sc_atomic_uint64_get(&manager->events_pool_misses_count);
+  for (sc_uint32 i = 0; i < manager->max_events_and_agents_threads; ++i)
+    stat->events_pool_hits_count += sc_atomic_uint64_get(&manager->workers[i].events_pool_hits_count);
+
+  return SC_RESULT_OK;
 }
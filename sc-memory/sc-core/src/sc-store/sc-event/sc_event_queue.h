@@ -15,29 +15,103 @@
 
 #include "sc-store/sc-container/sc_hash_table.h"
 #include "sc-store/sc-base/sc_monitor_private.h"
+#include "sc-store/sc-base/sc_condition_private.h"
+#include "sc-store/sc-base/sc_thread.h"
 
 typedef sc_result (*sc_event_do_after_callback)(sc_memory_context const * ctx, sc_addr addr);
 
-/*! Structure representing an sc-event emission manager.
- * @note This structure manages the asynchronous processing of sc-events using a thread pool.
+typedef struct _sc_event_emission_manager sc_event_emission_manager;
+typedef struct _sc_event sc_event;
+
+//! Maximum number of free sc-event records kept by one worker of an sc-event emission manager.
+#define SC_EVENTS_WORKER_POOL_MAX_SIZE 256
+//! Maximum number of free sc-event records kept in the shared pool of an sc-event emission manager.
+#define SC_EVENTS_POOL_MAX_SIZE 8192
+
+//! Maximum time (in milliseconds) an emitter backs off waiting for free space in a full queue of sc-events. Emitters
+//! can hold monitors of sc-elements needed by workers, so they are not blocked until free space appears.
+#define SC_EVENTS_QUEUE_MAX_BACKOFF_TIME 100
+
+/*! Priority classes of sc-events.
+ * @note Sc-events of higher priority classes are admitted to a full queue of sc-events without blocking or skipping.
+ * Queued sc-events are processed in emission order regardless of their priority classes, because sc-events of erasing
+ * sc-connectors must not overtake sc-events of generating them.
+ */
+typedef enum
+{
+  SC_EVENT_PRIORITY_HIGH,    ///< Priority of sc-events of erasing sc-elements and of system sc-event subscriptions.
+  SC_EVENT_PRIORITY_NORMAL,  ///< Priority of other sc-events.
+  SC_EVENT_PRIORITY_COUNT
+} sc_event_priority;
+
+/*! Policies applied to emitted sc-events when the queue of sc-events is full.
+ */
+typedef enum
+{
+  SC_EVENTS_QUEUE_OVERFLOW_POLICY_BACKOFF,  ///< Emitter waits for free space in the queue for a limited time.
+  SC_EVENTS_QUEUE_OVERFLOW_POLICY_COALESCE  ///< Emitted sc-event is skipped and only counted.
+} sc_events_queue_overflow_policy;
+
+/*! Structure representing a worker of an sc-event emission manager.
+ * @note Each worker owns a queue of sc-events ready for processing ordered by emission. A worker takes sc-events from
+ * its own queue and steals them from queues of other workers only when its queue is empty.
  */
 typedef struct
+{
+  sc_event_emission_manager * manager;  ///< Pointer to the sc-event emission manager owning this worker.
+  sc_thread * thread;                   ///< Thread processing sc-events of this worker.
+  sc_mutex queue_mutex;                 ///< Mutex for synchronizing access to the worker queue.
+  sc_event ** queue;                    ///< Binary heap of sc-events ready for processing ordered by emission.
+  sc_uint32 queue_size;                 ///< Number of sc-events in the worker queue.
+  sc_uint32 queue_capacity;             ///< Capacity of the worker queue.
+  sc_event * free_events;               ///< List of free sc-event records used only by the worker thread.
+  sc_uint32 free_events_count;          ///< Number of free sc-event records of the worker.
+  sc_uint64 events_pool_hits_count;     ///< Number of sc-event records taken from the worker pool.
+} sc_event_emission_worker;
+
+/*! Structure representing an sc-event emission manager.
+ * @note This structure manages the asynchronous processing of sc-events using a pool of work-stealing workers.
+ * Sc-events of the same sc-event subscription are processed one by one in emission order. The number of sc-events
+ * waiting for processing is bounded by `max_events_queue_size`, if it is not 0.
+ */
+struct _sc_event_emission_manager
 {
   ///< Boolean indicating whether sc-memory limit `max_events_and_agents_threads` by maximum physical core number.
   sc_bool limit_max_threads_by_max_physical_cores;
   sc_uint32 max_events_and_agents_threads;  ///< Maximum number of threads for processing events and agents.
-  sc_queue deletable_events_subscriptions;  ///< Queue of sc-events subscriptions that need to be deleted after
-                                            ///< sc-memory shutdown.
-  sc_bool running;                          ///< Flag indicating whether the event emission manager is running.
-  sc_monitor destroy_monitor;               ///< Monitor for synchronizing access to the destruction process.
-  GThreadPool * thread_pool;                ///< Thread pool used for worker threads processing events.
-  sc_monitor pool_monitor;                  ///< Monitor for synchronizing access to the thread pool.
-} sc_event_emission_manager;
+  sc_bool running;                     ///< Flag indicating whether the event emission manager is running.
+  sc_monitor destroy_monitor;          ///< Monitor for synchronizing access to the destruction process.
+  sc_event_emission_worker * workers;  ///< Array of `max_events_and_agents_threads` workers processing sc-events.
+  sc_int32 next_worker_index;          ///< Index of a worker assigned to the next thread emitting outside workers.
+  sc_int32 next_event_sequence;        ///< Emission sequence number of the next sc-event.
+  sc_int32 queued_events_count;        ///< Number of sc-events in queues of workers.
+  ///< Number of sc-events of each priority class in queues of workers.
+  sc_int32 queued_priority_events_count[SC_EVENT_PRIORITY_COUNT];
+  sc_int32 idle_workers_count;         ///< Number of workers waiting for sc-events.
+  sc_mutex idle_mutex;                 ///< Mutex for synchronizing waiting of idle workers.
+  sc_condition idle_condition;         ///< Condition used to wake up idle workers.
+  sc_bool is_stopping;  ///< Flag indicating whether workers should finish after processing all queued sc-events.
+  sc_uint32 max_events_queue_size;  ///< Maximum number of not processed sc-events. If it is 0, then unlimited.
+  sc_events_queue_overflow_policy events_queue_overflow_policy;  ///< Policy applied when the limit is reached.
+  sc_int32 events_count;                ///< Number of not processed sc-events in queues of workers and lanes.
+  sc_int32 max_reached_events_count;    ///< Maximum number of not processed sc-events reached since initialization.
+  sc_int32 backing_off_emitters_count;  ///< Number of emitters waiting for free space in the queue.
+  sc_int32 coalesced_events_count;      ///< Number of sc-events skipped because the queue was full.
+  sc_int32 overflowed_events_count;     ///< Number of sc-events admitted to the full queue.
+  sc_mutex not_full_mutex;              ///< Mutex for synchronizing waiting of backing off emitters.
+  sc_condition not_full_condition;      ///< Condition used to wake up backing off emitters.
+  sc_event * free_events;               ///< List of free sc-event records shared between all threads.
+  sc_uint32 free_events_count;          ///< Number of free sc-event records in the shared pool.
+  sc_mutex free_events_mutex;           ///< Mutex for synchronizing access to the shared pool of sc-event records.
+  sc_uint64 events_pool_hits_count;    ///< Number of sc-event records taken from the shared pool.
+  sc_uint64 events_pool_misses_count;  ///< Number of sc-event records allocated because pools were empty.
+};
 
 /*! Function that initializes an sc-event emission manager.
  * @param manager Pointer to the sc_event_emission_manager to be initialized.
  * @param params Pointer to the sc-memory params.
- * @note This function initializes the event emission manager, creating a thread pool and necessary monitors.
+ * @note This function initializes the event emission manager, starting `max_events_and_agents_threads` workers and
+ * necessary monitors.
  */
 void sc_event_emission_manager_initialize(sc_event_emission_manager ** manager, sc_memory_params const * params);
 
@@ -49,11 +123,25 @@ void sc_event_emission_manager_stop(sc_event_emission_manager * manager);
 
 /*! Function that shuts down and frees resources associated with an sc-event emission manager.
  * @param manager Pointer to the sc_event_emission_manager to be shut down.
- * @note This function shuts down and frees resources associated with the event emission manager.
+ * @note This function waits until workers process all queued sc-events and frees resources associated with the
+ * event emission manager.
  */
 void sc_event_emission_manager_shutdown(sc_event_emission_manager * manager);
 
-/*! Function that adds an sc-event to the event emission manager for processing.
+/*! Function that returns a priority class of sc-events of specified type.
+ * @param event_type_addr A sc-address of sc-event class.
+ * @return Returns SC_EVENT_PRIORITY_HIGH for sc-events of erasing sc-elements, otherwise SC_EVENT_PRIORITY_NORMAL.
+ */
+sc_event_priority _sc_event_priority_get(sc_event_type event_type_addr);
+
+/*! Function that collects gauges of the queue of sc-events.
+ * @param manager Pointer to the sc_event_emission_manager.
+ * @param stat Pointer to the sc_events_stat to be filled.
+ * @return Returns SC_RESULT_ERROR_INVALID_STATE if the manager is not initialized, otherwise SC_RESULT_OK.
+ */
+sc_result sc_event_emission_manager_get_stat(sc_event_emission_manager * manager, sc_events_stat * stat);
+
+/*! Function that creates an sc-event of an sc-event subscription to add it to the event emission manager later.
  * @param manager Pointer to the sc_event_emission_manager managing event emission.
  * @param event_subscription A pointer to sc-event subscription.
  * @param connector_addr A sc-address of added/removed sc-connector (just for specified events).
@@ -63,9 +151,12 @@ void sc_event_emission_manager_shutdown(sc_event_emission_manager * manager);
  * @param callback A pointer function that is executed after the execution of a function that was called on the
  * initiated event (it is used for events of erasing sc-connectors and sc-elements and event of changing link content).
  * @param event_addr An argument of callback.
- * @note This function adds an sc-event to the event emission manager for asynchronous processing.
+ * @return Returns the created sc-event or null_ptr, if the manager is not initialized.
+ * @note The created sc-event is counted in the lane of \p event_subscription, so the sc-event subscription isn't freed
+ * until the sc-event is added by `_sc_event_emission_manager_add`. It allows to add sc-events after releasing the
+ * lock of the events table.
  */
-void _sc_event_emission_manager_add(
+sc_event * _sc_event_emission_manager_reserve(
     sc_event_emission_manager * manager,
     sc_event_subscription * event_subscription,
     sc_addr user_addr,
@@ -75,4 +166,18 @@ void _sc_event_emission_manager_add(
     sc_event_do_after_callback callback,
     sc_addr event_addr);
 
+/*! Function that adds an sc-event created by `_sc_event_emission_manager_reserve` to the event emission manager for
+ * processing.
+ * @param manager Pointer to the sc_event_emission_manager managing event emission.
+ * @param event A pointer to the reserved sc-event.
+ * @note This function adds an sc-event to the event emission manager for asynchronous processing. If an sc-event of
+ * the same sc-event subscription is being processed, then the sc-event waits in the lane of this subscription. If
+ * the queue of sc-events is full, then the emitter waits at most `SC_EVENTS_QUEUE_MAX_BACKOFF_TIME` milliseconds for
+ * free space and then admits the sc-event beyond the limit, or the sc-event is skipped, according to the overflow
+ * policy. Sc-events admitted beyond the limit are counted as overflowed. Workers and emitters of high priority
+ * sc-events are never blocked, high priority sc-events and sc-events with callback are never skipped. It must not be
+ * called under locks of the events table, because the emitter may back off.
+ */
+void _sc_event_emission_manager_add(sc_event_emission_manager * manager, sc_event * event);
+
 #endif
@@ -16,11 +16,20 @@
 #  include "sc-store/sc-container/sc_dictionary_private.h"
 #  include "sc-store/sc-container/sc_struct_node.h"
 
+#  include "sc-store/sc-base/sc_atomic.h"
+#  include "sc-store/sc-base/sc_thread.h"
+
 #  include "sc_file_system.h"
 #  include "sc_io.h"
 
+#  include <stdlib.h>
+#  include <string.h>
+
 #  define DEFAULT_STRING_INT_SIZE 20
 #  define DEFAULT_MAX_SEARCHABLE_STRING_SIZE 1000
+#  define DEFAULT_BLOB_CHUNK_SIZE 65536
+#  define SC_DICTIONARY_FS_MEMORY_MIN_STRINGS_PER_WORKER 256
+#  define SC_DICTIONARY_FS_MEMORY_STRINGS_BUFFER_SIZE 1048576
 
 typedef struct
 {
@@ -35,7 +44,7 @@ sc_io_channel * _sc_dictionary_fs_memory_get_strings_channel_by_offset(
 {
   *channel_monitor = null_ptr;
 
-  sc_uint64 const idx = strings_offset / memory->max_strings_channel_size;
+  sc_uint64 const idx = (strings_offset - memory->strings_offset) / memory->max_strings_channel_size;
   if (idx >= memory->max_strings_channels)
   {
     sc_fs_memory_info(
@@ -78,11 +87,15 @@ sc_io_channel * _sc_dictionary_fs_memory_get_strings_channel_by_offset(
 
   sc_monitor_acquire_write(&memory->monitor);
 
-  if (is_path == SC_FALSE || memory->clear == SC_TRUE)
-    memory->strings_channels[idx] = sc_io_new_write_channel(strings_path, null_ptr);
-  else
-    memory->strings_channels[idx] = sc_io_new_append_channel(strings_path, null_ptr);
-  sc_io_channel_set_encoding(memory->strings_channels[idx], null_ptr, null_ptr);
+  // channel may be opened by other writer, it mustn't be truncated again
+  if (memory->strings_channels[idx] == null_ptr)
+  {
+    if (is_path == SC_FALSE || memory->clear == SC_TRUE)
+      memory->strings_channels[idx] = sc_io_new_write_channel(strings_path, null_ptr);
+    else
+      memory->strings_channels[idx] = sc_io_new_append_channel(strings_path, null_ptr);
+    sc_io_channel_set_encoding(memory->strings_channels[idx], null_ptr, null_ptr);
+  }
 
   sc_monitor_release_write(&memory->monitor);
   *channel_monitor = sc_monitor_table_get_monitor_from_table(&memory->strings_channels_monitors_table, (sc_pointer)idx);
@@ -98,8 +111,76 @@ sc_io_channel * _sc_dictionary_fs_memory_get_strings_channel_by_offset(
 
 sc_uint64 _sc_dictionary_fs_memory_normalize_offset(sc_dictionary_fs_memory const * memory, sc_uint64 strings_offset)
 {
-  sc_uint64 const channel_idx = strings_offset / memory->max_strings_channel_size;
-  return strings_offset - memory->max_strings_channel_size * channel_idx;
+  sc_uint64 const channel_strings_offset = strings_offset - memory->strings_offset;
+  sc_uint64 const channel_idx = channel_strings_offset / memory->max_strings_channel_size;
+  return channel_strings_offset - memory->max_strings_channel_size * channel_idx;
+}
+
+/*! Reads chars from strings channel by offset. Written strings are never changed and written before their offsets
+ * are known, so strings are read by positional reads under read lock of strings channel and can be read in parallel.
+ */
+sc_bool _sc_dictionary_fs_memory_read_chars_by_offset(
+    sc_io_channel * strings_channel,
+    sc_uint64 const normalized_offset,
+    sc_char * chars,
+    sc_uint64 const count)
+{
+  sc_uint64 read_bytes = 0;
+  while (read_bytes < count)
+  {
+    sc_int64 const result = sc_io_channel_read_chars_by_offset(
+        strings_channel, chars + read_bytes, count - read_bytes, normalized_offset + read_bytes);
+    if (result <= 0)
+      return SC_FALSE;
+
+    read_bytes += result;
+  }
+
+  return SC_TRUE;
+}
+
+/*! Writes chars to strings channel by offset. Places of strings are reserved before writing and strings offsets are
+ * known only after strings are written, so strings are written by positional writes and can be written in parallel.
+ */
+sc_bool _sc_dictionary_fs_memory_write_chars_by_offset(
+    sc_io_channel * strings_channel,
+    sc_uint64 const normalized_offset,
+    sc_char const * chars,
+    sc_uint64 const count)
+{
+  sc_uint64 written_bytes = 0;
+  while (written_bytes < count)
+  {
+    sc_int64 const result = sc_io_channel_write_chars_by_offset(
+        strings_channel, chars + written_bytes, count - written_bytes, normalized_offset + written_bytes);
+    if (result <= 0)
+      return SC_FALSE;
+
+    written_bytes += result;
+  }
+
+  return SC_TRUE;
+}
+
+//! Gets hash of string to find equal strings, equal strings are shared only by links with the same searchability
+sc_uint64 _sc_dictionary_fs_memory_get_string_hash(
+    sc_char const * string,
+    sc_uint64 const string_size,
+    sc_bool const is_searchable_string)
+{
+  sc_uint64 string_hash = 14695981039346656037ull;
+  for (sc_uint64 i = 0; i < string_size; ++i)
+  {
+    string_hash ^= (sc_uchar)string[i];
+    string_hash *= 1099511628211ull;
+  }
+
+  return is_searchable_string ? ~string_hash : string_hash;
+}
+
+sc_monitor * _sc_dictionary_fs_memory_get_string_monitor(sc_dictionary_fs_memory * memory, sc_uint64 string_hash)
+{
+  return &memory->strings_monitors[string_hash % SC_DICTIONARY_FS_MEMORY_STRINGS_MONITORS_COUNT];
 }
 
 sc_dictionary_fs_memory_status sc_dictionary_fs_memory_initialize_ext(
@@ -141,6 +222,10 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_initialize_ext(
       (*memory)->search_by_substring = params->search_by_substring;
     }
     {
+      sc_terms_index_initialize(&(*memory)->terms_index);
+      static sc_char const * terms_index = "terms_index" SC_FS_EXT;
+      sc_fs_concat_path((*memory)->path, terms_index, &(*memory)->terms_index_path);
+
       _sc_uchar_dictionary_initialize(&(*memory)->terms_string_offsets_dictionary);
       static sc_char const * term_string_offsets = "term_string_offsets" SC_FS_EXT;
       sc_fs_concat_path((*memory)->path, term_string_offsets, &(*memory)->terms_string_offsets_path);
@@ -149,13 +234,49 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_initialize_ext(
       _sc_monitor_table_init(&(*memory)->strings_channels_monitors_table);
       (*memory)->last_string_offset = 0;
       sc_monitor_init(&(*memory)->monitor);
-      sc_monitor_init(&(*memory)->resolve_string_offset_monitor);
+      for (sc_uint32 i = 0; i < SC_DICTIONARY_FS_MEMORY_STRINGS_MONITORS_COUNT; ++i)
+        sc_monitor_init(&(*memory)->strings_monitors[i]);
+      sc_monitor_init(&(*memory)->terms_monitor);
+      sc_monitor_init(&(*memory)->links_monitor);
+      sc_monitor_init(&(*memory)->ngrams_monitor);
+      sc_monitor_init(&(*memory)->string_hashes_monitor);
+      sc_monitor_init(&(*memory)->blobs_monitor);
     }
 
-    _sc_number_dictionary_initialize(&(*memory)->link_hashes_string_offsets_dictionary);
     _sc_number_dictionary_initialize(&(*memory)->string_offsets_link_hashes_dictionary);
     static sc_char const * string_offsets_link_hashes = "string_offsets_link_hashes" SC_FS_EXT;
     sc_fs_concat_path((*memory)->path, string_offsets_link_hashes, &(*memory)->string_offsets_link_hashes_path);
+
+    sc_hash_map_initialize(&(*memory)->link_hashes_string_offsets_map, 0);
+    static sc_char const * link_hashes_string_offsets = "link_hashes_string_offsets" SC_FS_EXT;
+    sc_fs_concat_path((*memory)->path, link_hashes_string_offsets, &(*memory)->link_hashes_string_offsets_path);
+
+    sc_ngrams_index_initialize(&(*memory)->ngrams_index);
+    static sc_char const * ngrams_string_offsets = "ngrams_string_offsets" SC_FS_EXT;
+    sc_fs_concat_path((*memory)->path, ngrams_string_offsets, &(*memory)->ngrams_string_offsets_path);
+
+    sc_hash_map_initialize(&(*memory)->string_hashes_string_offsets_map, 0);
+    static sc_char const * string_hashes_string_offsets = "string_hashes_string_offsets" SC_FS_EXT;
+    sc_fs_concat_path(
+        (*memory)->path, string_hashes_string_offsets, &(*memory)->string_hashes_string_offsets_path);
+
+    sc_hash_map_initialize(&(*memory)->link_hashes_blobs_sizes_map, 0);
+    static sc_char const * blobs = "blobs";
+    sc_fs_concat_path((*memory)->path, blobs, &(*memory)->blobs_path);
+
+    sc_link_contents_cache_initialize(&(*memory)->link_contents_cache, params->max_link_contents_cache_size);
+
+    static sc_char const * strings_blocks = "strings_blocks" SC_FS_EXT;
+    sc_fs_concat_path((*memory)->path, strings_blocks, &(*memory)->strings_blocks_path);
+    static sc_char const * strings_blocks_index = "strings_blocks_index" SC_FS_EXT;
+    sc_fs_concat_path((*memory)->path, strings_blocks_index, &(*memory)->strings_blocks_index_path);
+    (*memory)->strings_offset = 0;
+    if (!sc_strings_blocks_initialize(&(*memory)->strings_blocks, (*memory)->strings_blocks_path))
+    {
+      sc_fs_memory_error("Path `%s` is not correct", (*memory)->strings_blocks_path);
+      sc_dictionary_fs_memory_shutdown(*memory);
+      goto error;
+    }
   }
   sc_fs_memory_info("Configuration:");
   sc_message("\tSc-dictionary node size: %zd", sizeof(sc_dictionary_node));
@@ -169,6 +290,13 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_initialize_ext(
   sc_message("\tMax strings channel size: %d", (*memory)->max_strings_channel_size);
   sc_message("\tMax searchable string size: %d", (*memory)->max_searchable_string_size);
   sc_message("\tTerm separators: \"%s\"", (*memory)->term_separators);
+  sc_message("\tMax link contents cache size: %" PRIu64, (*memory)->link_contents_cache->max_size);
+  sc_message("\tStrings block size: %d", SC_STRINGS_BLOCK_SIZE);
+#  ifdef SC_FS_MEMORY_COMPRESSION
+  sc_message("\tStrings blocks compression: LZ4");
+#  else
+  sc_message("\tStrings blocks compression: Off");
+#  endif
 
   sc_fs_memory_info("Successfully initialized");
 
@@ -206,6 +334,8 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_shutdown(sc_dictionary_fs
     sc_mem_free(memory->path);
 
     {
+      sc_terms_index_destroy(memory->terms_index);
+      sc_mem_free(memory->terms_index_path);
       sc_dictionary_destroy(memory->terms_string_offsets_dictionary, _sc_dictionary_fs_memory_node_clear);
       sc_mem_free(memory->terms_string_offsets_path);
 
@@ -216,12 +346,34 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_shutdown(sc_dictionary_fs
       sc_mem_free(memory->strings_channels);
       _sc_monitor_table_destroy(&memory->strings_channels_monitors_table);
       sc_monitor_destroy(&memory->monitor);
-      sc_monitor_destroy(&memory->resolve_string_offset_monitor);
+      for (sc_uint32 i = 0; i < SC_DICTIONARY_FS_MEMORY_STRINGS_MONITORS_COUNT; ++i)
+        sc_monitor_destroy(&memory->strings_monitors[i]);
+      sc_monitor_destroy(&memory->terms_monitor);
+      sc_monitor_destroy(&memory->links_monitor);
+      sc_monitor_destroy(&memory->ngrams_monitor);
+      sc_monitor_destroy(&memory->string_hashes_monitor);
+      sc_monitor_destroy(&memory->blobs_monitor);
     }
 
-    sc_dictionary_destroy(memory->link_hashes_string_offsets_dictionary, _sc_dictionary_fs_memory_string_node_clear);
     sc_dictionary_destroy(memory->string_offsets_link_hashes_dictionary, _sc_dictionary_fs_memory_link_node_clear);
     sc_mem_free(memory->string_offsets_link_hashes_path);
+    sc_hash_map_destroy(memory->link_hashes_string_offsets_map, _sc_dictionary_fs_memory_link_hash_content_clear);
+    sc_mem_free(memory->link_hashes_string_offsets_path);
+
+    sc_ngrams_index_destroy(memory->ngrams_index);
+    sc_mem_free(memory->ngrams_string_offsets_path);
+
+    sc_hash_map_destroy(memory->string_hashes_string_offsets_map, null_ptr);
+    sc_mem_free(memory->string_hashes_string_offsets_path);
+
+    sc_hash_map_destroy(memory->link_hashes_blobs_sizes_map, null_ptr);
+    sc_mem_free(memory->blobs_path);
+
+    sc_strings_blocks_destroy(memory->strings_blocks);
+    sc_mem_free(memory->strings_blocks_path);
+    sc_mem_free(memory->strings_blocks_index_path);
+
+    sc_link_contents_cache_destroy(memory->link_contents_cache);
   }
   sc_mem_free(memory);
 
@@ -229,11 +381,8 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_shutdown(sc_dictionary_fs
   return SC_FS_MEMORY_OK;
 }
 
-void _sc_dictionary_fs_memory_append(
-    sc_dictionary * dictionary,
-    sc_char const * key,
-    sc_uint64 const key_size,
-    void * data)
+//! Gets list of dictionary by key, list with copied key as the first item is appended if there is no such list
+sc_list * _sc_dictionary_fs_memory_get_list(sc_dictionary * dictionary, sc_char const * key, sc_uint64 const key_size)
 {
   sc_list * list = sc_dictionary_get_by_key(dictionary, key, key_size);
   if (list == null_ptr)
@@ -246,7 +395,16 @@ void _sc_dictionary_fs_memory_append(
     sc_list_push_back(list, copied_key);
   }
 
-  sc_list_push_back(list, data);
+  return list;
+}
+
+void _sc_dictionary_fs_memory_append(
+    sc_dictionary * dictionary,
+    sc_char const * key,
+    sc_uint64 const key_size,
+    void * data)
+{
+  sc_list_push_back(_sc_dictionary_fs_memory_get_list(dictionary, key, key_size), data);
 }
 
 sc_bool _sc_addr_hash_compare(void * addr_hash, void * other_addr_hash)
@@ -259,19 +417,15 @@ void _sc_dictionary_fs_memory_append_link_string_unique(
     sc_addr_hash const link_hash,
     sc_uint64 const string_offset)
 {
-  sc_char link_hash_str[DEFAULT_STRING_INT_SIZE];
-  sc_uint64 link_hash_str_size;
   sc_bool is_content_new;
   sc_link_hash_content * content;
   {
-    sc_int_to_str_int(link_hash, link_hash_str, link_hash_str_size);
-    content =
-        sc_dictionary_get_by_key(memory->link_hashes_string_offsets_dictionary, link_hash_str, link_hash_str_size);
+    content = sc_hash_map_get(memory->link_hashes_string_offsets_map, link_hash);
     is_content_new = (content == null_ptr);
     if (is_content_new)
     {
       content = sc_mem_new(sc_link_hash_content, 1);
-      sc_dictionary_append(memory->link_hashes_string_offsets_dictionary, link_hash_str, link_hash_str_size, content);
+      sc_hash_map_insert(memory->link_hashes_string_offsets_map, link_hash, content);
     }
   }
 
@@ -303,171 +457,230 @@ void _sc_dictionary_fs_memory_append_link_string_unique(
   }
 }
 
+/*! Copies string offsets by term from index with terms and from dictionary with terms added after index saving
+ * @param memory A sc-dictionary-fs-memory pointer
+ * @param term A term to find
+ * @returns Returns list with null_ptr in place of term and string offsets, or null_ptr if there is no such term.
+ */
 sc_list * _sc_dictionary_fs_memory_get_string_offsets_by_term(
     sc_dictionary_fs_memory const * memory,
     sc_char const * term)
 {
   sc_uint64 const term_size = sc_str_len(term);
-  return sc_dictionary_get_by_key(memory->terms_string_offsets_dictionary, term, term_size);
+
+  sc_uint64 const * index_string_offsets;
+  sc_uint64 index_string_offsets_count;
+  sc_bool const is_indexed = sc_terms_index_get_string_offsets(
+      memory->terms_index, term, term_size, &index_string_offsets, &index_string_offsets_count);
+  sc_list const * added_string_offsets =
+      sc_dictionary_get_by_key(memory->terms_string_offsets_dictionary, term, term_size);
+  if (!is_indexed && added_string_offsets == null_ptr)
+    return null_ptr;
+
+  sc_list * string_offsets;
+  sc_list_init(&string_offsets);
+  sc_list_push_back(string_offsets, null_ptr);
+  for (sc_uint64 i = 0; i < index_string_offsets_count; ++i)
+    sc_list_push_back(string_offsets, (void *)index_string_offsets[i]);
+
+  // the first item of list is term
+  sc_iterator * it = sc_list_iterator(added_string_offsets);
+  if (sc_iterator_next(it))
+  {
+    while (sc_iterator_next(it))
+      sc_list_push_back(string_offsets, sc_iterator_get(it));
+  }
+  sc_iterator_destroy(it);
+
+  return string_offsets;
+}
+
+sc_list * _sc_dictionary_fs_memory_copy_list(sc_list const * list)
+{
+  if (list == null_ptr)
+    return null_ptr;
+
+  sc_list * copied_list;
+  sc_list_init(&copied_list);
+
+  sc_iterator * it = sc_list_iterator(list);
+  while (sc_iterator_next(it))
+    sc_list_push_back(copied_list, sc_iterator_get(it));
+  sc_iterator_destroy(it);
+
+  return copied_list;
 }
 
-sc_dictionary_fs_memory_status _sc_dictionary_node_fs_memory_get_string_offset_by_string(
+//! Copies string offsets by term, so strings can be read without lock of dictionary with terms.
+sc_list * _sc_dictionary_fs_memory_copy_string_offsets_by_term(
     sc_dictionary_fs_memory * memory,
-    sc_char const * string,
-    sc_uint64 const string_size,
-    sc_list const * string_offsets,
-    sc_uint64 * found_string_offset)
+    sc_char const * term)
 {
-  sc_iterator * string_offset_it = sc_list_iterator(string_offsets);
-  if (!sc_iterator_next(string_offset_it))
-  {
-    sc_iterator_destroy(string_offset_it);
-    return SC_FS_MEMORY_READ_ERROR;
-  }
+  sc_monitor_acquire_read(&memory->terms_monitor);
+  sc_list * string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_term(memory, term);
+  sc_monitor_release_read(&memory->terms_monitor);
+  return string_offsets;
+}
 
-  while (sc_iterator_next(string_offset_it))
+//! Copies link hashes by string offset, so link handlers are called without lock of dictionaries with link hashes.
+sc_list * _sc_dictionary_fs_memory_copy_link_hashes_by_string_offset(
+    sc_dictionary_fs_memory * memory,
+    sc_uint64 const string_offset)
+{
+  sc_char string_offset_str[DEFAULT_STRING_INT_SIZE];
+  sc_uint64 string_offset_str_size;
+  sc_int_to_str_int(string_offset, string_offset_str, string_offset_str_size);
+
+  sc_monitor_acquire_read(&memory->links_monitor);
+  sc_list * link_hashes = _sc_dictionary_fs_memory_copy_list(sc_dictionary_get_by_key(
+      memory->string_offsets_link_hashes_dictionary, string_offset_str, string_offset_str_size));
+  sc_monitor_release_read(&memory->links_monitor);
+  return link_hashes;
+}
+
+/*! Reads string from strings blocks or strings channel by offset. Strings with sizes out of range aren't read, so
+ * strings of other sizes are skipped without reading them from strings channels.
+ * @returns Returns SC_FS_MEMORY_OK, if string is read or skipped, in last case string is null_ptr.
+ */
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_read_string_by_offset_ext(
+    sc_dictionary_fs_memory * memory,
+    sc_uint64 const string_offset,
+    sc_uint64 const min_string_size,
+    sc_uint64 const max_string_size,
+    sc_char ** string,
+    sc_uint64 * string_size)
+{
+  *string = null_ptr;
+  *string_size = 0;
+
+  if (string_offset < memory->strings_offset)
   {
-    sc_uint64 const string_offset = (sc_uint64)sc_iterator_get(string_offset_it);
+    if (!sc_strings_blocks_read(memory->strings_blocks, string_offset, string, string_size))
+    {
+      sc_fs_memory_error("Error while string reading from strings blocks");
+      return SC_FS_MEMORY_READ_ERROR;
+    }
 
-    // read string with size from fs-memory
-    sc_uint64 read_bytes;
-    sc_monitor * channel_monitor;
-    sc_io_channel * strings_channel =
-        _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, string_offset, &channel_monitor);
-    sc_monitor_acquire_read(channel_monitor);
-    sc_uint64 const normalized_string_offset = _sc_dictionary_fs_memory_normalize_offset(memory, string_offset);
-    sc_io_channel_seek(strings_channel, normalized_string_offset, SC_FS_IO_SEEK_SET, null_ptr);
+    if (*string_size < min_string_size || *string_size > max_string_size)
     {
-      sc_uint64 other_string_size;
-      if (sc_io_channel_read_chars(
-              strings_channel, (sc_char *)&other_string_size, sizeof(sc_uint64), &read_bytes, null_ptr)
-              != SC_FS_IO_STATUS_NORMAL
-          || sizeof(sc_uint64) != read_bytes)
-      {
-        sc_monitor_release_read(channel_monitor);
-        goto error;
-      }
+      sc_mem_free(*string);
+      *string = null_ptr;
+    }
+    return SC_FS_MEMORY_OK;
+  }
 
-      if (other_string_size != string_size)
-      {
-        sc_monitor_release_read(channel_monitor);
-        continue;
-      }
+  sc_monitor * channel_monitor;
+  sc_io_channel * strings_channel =
+      _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, string_offset, &channel_monitor);
+  if (strings_channel == null_ptr)
+  {
+    sc_fs_memory_error("Path `%s` doesn't exist", "path");
+    return SC_FS_MEMORY_READ_ERROR;
+  }
 
-      sc_char other_string[other_string_size + 1];
-      if (sc_io_channel_read_chars(strings_channel, other_string, other_string_size, &read_bytes, null_ptr)
-              != SC_FS_IO_STATUS_NORMAL
-          || other_string_size != read_bytes)
-      {
-        sc_monitor_release_read(channel_monitor);
-        goto error;
-      }
-      other_string[other_string_size] = '\0';
+  // read string with size from fs-memory
+  sc_uint64 const normalized_string_offset = _sc_dictionary_fs_memory_normalize_offset(memory, string_offset);
+  sc_monitor_acquire_read(channel_monitor);
+  {
+    if (!_sc_dictionary_fs_memory_read_chars_by_offset(
+            strings_channel, normalized_string_offset, (sc_char *)string_size, sizeof(sc_uint64)))
+      goto error;
 
-      if (sc_str_cmp(string, other_string) == SC_FALSE)
-      {
-        sc_monitor_release_read(channel_monitor);
-        continue;
-      }
-    }
+    if (*string_size < min_string_size || *string_size > max_string_size)
+      goto exit;
 
-    *found_string_offset = string_offset;
-    sc_monitor_release_read(channel_monitor);
-    break;
+    *string = sc_mem_new(sc_char, *string_size + 1);
+    if (!_sc_dictionary_fs_memory_read_chars_by_offset(
+            strings_channel, normalized_string_offset + sizeof(sc_uint64), *string, *string_size))
+    {
+      sc_mem_free(*string);
+      *string = null_ptr;
+      goto error;
+    }
   }
 
-  sc_iterator_destroy(string_offset_it);
+exit:
+  sc_monitor_release_read(channel_monitor);
   return SC_FS_MEMORY_OK;
 
 error:
-  sc_iterator_destroy(string_offset_it);
+  sc_monitor_release_read(channel_monitor);
+  *string_size = 0;
   return SC_FS_MEMORY_READ_ERROR;
 }
 
+//! Finds string equal to string by its hash, returns INVALID_STRING_OFFSET if there is no such string
 sc_uint64 _sc_dictionary_fs_memory_get_string_offset_by_string(
     sc_dictionary_fs_memory * memory,
     sc_char const * string,
     sc_uint64 const string_size,
-    sc_char const * term)
+    sc_uint64 const string_hash)
 {
-  sc_list * string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_term(memory, term);
-
-  sc_uint64 string_offset = INVALID_STRING_OFFSET;
-  _sc_dictionary_node_fs_memory_get_string_offset_by_string(
-      memory, string, string_size, string_offsets, &string_offset);
-  return string_offset;
+  sc_monitor_acquire_read(&memory->string_hashes_monitor);
+  sc_uint64 const string_offset = (sc_uint64)sc_hash_map_get(memory->string_hashes_string_offsets_map, string_hash);
+  sc_monitor_release_read(&memory->string_hashes_monitor);
+  if (string_offset == 0)
+    return INVALID_STRING_OFFSET;
+
+  // strings with equal hashes may differ
+  sc_char * other_string;
+  sc_uint64 other_string_size;
+  if (_sc_dictionary_fs_memory_read_string_by_offset_ext(
+          memory, string_offset - 1, string_size, string_size, &other_string, &other_string_size)
+          != SC_FS_MEMORY_OK
+      || other_string == null_ptr)
+    return INVALID_STRING_OFFSET;
+
+  sc_bool const is_equal = memcmp(string, other_string, string_size) == 0;
+  sc_mem_free(other_string);
+  return is_equal ? string_offset - 1 : INVALID_STRING_OFFSET;
 }
 
 sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_write_string(
     sc_dictionary_fs_memory * memory,
-    sc_addr_hash const link_hash,
     sc_char const * string,
     sc_uint64 const string_size,
-    sc_list const * string_terms,
-    sc_bool is_searchable_string,
+    sc_uint64 const string_hash,
     sc_uint64 * string_offset,
     sc_bool * is_not_exist)
 {
+  // find string if it exists in fs-memory
+  *string_offset = _sc_dictionary_fs_memory_get_string_offset_by_string(memory, string, string_size, string_hash);
+
+  *is_not_exist = (*string_offset == INVALID_STRING_OFFSET);
+  if (!*is_not_exist)
+    return SC_FS_MEMORY_OK;
+
+  // reserve place for string in fs-memory, so other strings are written in parallel
+  *string_offset = sc_atomic_uint64_fetch_and_add(&memory->last_string_offset, sizeof(string_size) + string_size);
+
   sc_monitor * channel_monitor;
-  sc_monitor_acquire_write(&memory->resolve_string_offset_monitor);
   sc_io_channel * strings_channel =
-      _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, memory->last_string_offset, &channel_monitor);
-  *string_offset = INVALID_STRING_OFFSET;
+      _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, *string_offset, &channel_monitor);
   if (strings_channel == null_ptr)
-    goto no_last_channel_error;
+    return SC_FS_MEMORY_WRITE_ERROR;
 
-  // find string if it exists in fs-memory
-  if (is_searchable_string)
+  // save string in fs-memory
+  sc_uint64 const normalized_string_offset = _sc_dictionary_fs_memory_normalize_offset(memory, *string_offset);
+  if (!_sc_dictionary_fs_memory_write_chars_by_offset(
+          strings_channel, normalized_string_offset, (sc_char const *)&string_size, sizeof(string_size)))
   {
-    *string_offset =
-        _sc_dictionary_fs_memory_get_string_offset_by_string(memory, string, string_size, string_terms->begin->data);
+    sc_fs_memory_error("Error while attribute `size` writing");
+    return SC_FS_MEMORY_WRITE_ERROR;
   }
 
-  sc_monitor_acquire_write(&memory->monitor);
-  sc_monitor_acquire_write(channel_monitor);
-  *is_not_exist = (*string_offset == INVALID_STRING_OFFSET);
-  // save string in fs-memory
-  if (*is_not_exist)
+  if (!_sc_dictionary_fs_memory_write_chars_by_offset(
+          strings_channel, normalized_string_offset + sizeof(string_size), string, string_size))
   {
-    *string_offset = memory->last_string_offset;
-
-    sc_uint64 const normalized_string_offset = _sc_dictionary_fs_memory_normalize_offset(memory, *string_offset);
-    sc_io_channel_seek(strings_channel, normalized_string_offset, SC_FS_IO_SEEK_SET, null_ptr);
-
-    sc_uint64 written_bytes = 0;
-    if (sc_io_channel_write_chars(strings_channel, &string_size, sizeof(string_size), &written_bytes, null_ptr)
-            != SC_FS_IO_STATUS_NORMAL
-        || sizeof(string_size) != written_bytes)
-    {
-      sc_fs_memory_error("Error while attribute `size` writing");
-      goto write_error;
-    }
-
-    memory->last_string_offset += written_bytes;
-
-    if (sc_io_channel_write_chars(strings_channel, string, string_size, &written_bytes, null_ptr)
-            != SC_FS_IO_STATUS_NORMAL
-        || string_size != written_bytes)
-    {
-      sc_fs_memory_error("Error while attribute `string` writing");
-      goto write_error;
-    }
-
-    memory->last_string_offset += written_bytes;
+    sc_fs_memory_error("Error while attribute `string` writing");
+    return SC_FS_MEMORY_WRITE_ERROR;
   }
 
-  sc_monitor_release_write(channel_monitor);
-  sc_monitor_release_write(&memory->monitor);
-  sc_monitor_release_write(&memory->resolve_string_offset_monitor);
-  return SC_FS_MEMORY_OK;
-
-write_error:
-  sc_monitor_release_write(channel_monitor);
-  sc_monitor_release_write(&memory->monitor);
+  sc_monitor_acquire_write(&memory->string_hashes_monitor);
+  sc_hash_map_insert(memory->string_hashes_string_offsets_map, string_hash, (void *)(*string_offset + 1));
+  sc_monitor_release_write(&memory->string_hashes_monitor);
 
-no_last_channel_error:
-  sc_monitor_release_write(&memory->resolve_string_offset_monitor);
-  return SC_FS_MEMORY_WRITE_ERROR;
+  return SC_FS_MEMORY_OK;
 }
 
 sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_write_string_terms_string_offset(
@@ -475,6 +688,7 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_write_string_terms_strin
     sc_uint64 const string_offset,
     sc_list * string_terms)
 {
+  sc_monitor_acquire_write(&memory->terms_monitor);
   sc_iterator * term_it = sc_list_iterator(string_terms);
   while (sc_iterator_next(term_it))
   {
@@ -490,10 +704,89 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_write_string_terms_strin
       break;
   }
   sc_iterator_destroy(term_it);
+  sc_monitor_release_write(&memory->terms_monitor);
 
   return SC_FS_MEMORY_OK;
 }
 
+void _sc_dictionary_fs_memory_write_string_ngrams_string_offset(
+    sc_dictionary_fs_memory * memory,
+    sc_char const * string,
+    sc_uint64 const string_size,
+    sc_uint64 const string_offset)
+{
+  sc_monitor_acquire_write(&memory->ngrams_monitor);
+  sc_ngrams_index_append(memory->ngrams_index, string, string_size, string_offset);
+  sc_monitor_release_write(&memory->ngrams_monitor);
+}
+
+void _sc_dictionary_fs_memory_get_blob_path(
+    sc_dictionary_fs_memory const * memory,
+    sc_addr_hash const link_hash,
+    sc_char ** blob_path)
+{
+  sc_char link_hash_str[DEFAULT_STRING_INT_SIZE];
+  sc_uint64 link_hash_str_size;
+  sc_int_to_str_int(link_hash, link_hash_str, link_hash_str_size);
+  (void)link_hash_str_size;
+  sc_fs_concat_path_ext(memory->blobs_path, link_hash_str, SC_FS_EXT, blob_path);
+}
+
+//! Gets size of blob of link, returns SC_FALSE if link content has no appended parts and isn't stored as blob
+sc_bool _sc_dictionary_fs_memory_get_blob_size(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash const link_hash,
+    sc_uint64 * blob_size)
+{
+  sc_monitor_acquire_read(&memory->blobs_monitor);
+  sc_uint64 const size = (sc_uint64)sc_hash_map_get(memory->link_hashes_blobs_sizes_map, link_hash);
+  sc_monitor_release_read(&memory->blobs_monitor);
+
+  *blob_size = size == 0 ? 0 : size - 1;
+  return size != 0;
+}
+
+void _sc_dictionary_fs_memory_remove_blob(sc_dictionary_fs_memory * memory, sc_addr_hash const link_hash)
+{
+  // most of links have no blobs, so map is locked for writing only for links with them
+  sc_uint64 blob_size;
+  if (!_sc_dictionary_fs_memory_get_blob_size(memory, link_hash, &blob_size))
+    return;
+
+  sc_monitor_acquire_write(&memory->blobs_monitor);
+  sc_bool const is_removed = sc_hash_map_remove(memory->link_hashes_blobs_sizes_map, link_hash) != null_ptr;
+  sc_monitor_release_write(&memory->blobs_monitor);
+
+  if (!is_removed)
+    return;
+
+  sc_char * blob_path;
+  _sc_dictionary_fs_memory_get_blob_path(memory, link_hash, &blob_path);
+  sc_fs_remove_file(blob_path);
+  sc_mem_free(blob_path);
+}
+
+//! Reads part of blob of link, blobs are only appended, so parts are read by positional reads without locks
+sc_bool _sc_dictionary_fs_memory_read_blob(
+    sc_dictionary_fs_memory const * memory,
+    sc_addr_hash const link_hash,
+    sc_uint64 const position,
+    sc_char * data,
+    sc_uint64 const data_size)
+{
+  sc_char * blob_path;
+  _sc_dictionary_fs_memory_get_blob_path(memory, link_hash, &blob_path);
+  sc_io_channel * channel = sc_io_new_read_channel(blob_path, null_ptr);
+  sc_mem_free(blob_path);
+  if (channel == null_ptr)
+    return SC_FALSE;
+  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+  sc_bool const is_read = _sc_dictionary_fs_memory_read_chars_by_offset(channel, position, data, data_size);
+  sc_io_channel_shutdown(channel, SC_FALSE, null_ptr);
+  return is_read;
+}
+
 sc_dictionary_fs_memory_status sc_dictionary_fs_memory_link_string(
     sc_dictionary_fs_memory * memory,
     sc_addr_hash const link_hash,
@@ -516,6 +809,13 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_link_string_ext(
     return SC_FS_MEMORY_NO;
   }
 
+  // equal strings have equal hashes, so they are written one by one and aren't duplicated in fs-memory
+  sc_uint64 const string_hash = _sc_dictionary_fs_memory_get_string_hash(string, string_size, is_searchable_string);
+  sc_monitor * string_monitor = _sc_dictionary_fs_memory_get_string_monitor(memory, string_hash);
+  sc_monitor_acquire_write(string_monitor);
+
+  // strings of any size are found by substrings by n-grams, but only small strings are found by terms
+  sc_bool const is_ngrams_searchable_string = is_searchable_string && memory->search_by_substring;
   is_searchable_string &= string_size < memory->max_searchable_string_size;
   sc_list * string_terms = null_ptr;
   // don't divide into terms big strings if you don't need to search them
@@ -524,107 +824,463 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_link_string_ext(
 
   sc_bool is_not_exist = SC_TRUE;
   sc_uint64 string_offset;
-  sc_dictionary_fs_memory_status status = _sc_dictionary_fs_memory_write_string(
-      memory, link_hash, string, string_size, string_terms, is_searchable_string, &string_offset, &is_not_exist);
+  sc_dictionary_fs_memory_status status =
+      _sc_dictionary_fs_memory_write_string(memory, string, string_size, string_hash, &string_offset, &is_not_exist);
   if (status != SC_FS_MEMORY_OK)
     goto exit;
 
   // cache string offset and link hash data
   {
+    sc_monitor_acquire_write(&memory->links_monitor);
     _sc_dictionary_fs_memory_append_link_string_unique(memory, link_hash, string_offset);
+    sc_monitor_release_write(&memory->links_monitor);
   }
 
   if (is_searchable_string && is_not_exist)
     status = _sc_dictionary_fs_memory_write_string_terms_string_offset(memory, string_offset, string_terms);
 
+  if (is_ngrams_searchable_string && is_not_exist)
+    _sc_dictionary_fs_memory_write_string_ngrams_string_offset(memory, string, string_size, string_offset);
+
 exit:
+  sc_monitor_release_write(string_monitor);
+
   sc_list_clear(string_terms);
   sc_list_destroy(string_terms);
 
+  // new content replaces content with appended parts
+  if (status == SC_FS_MEMORY_OK)
+    _sc_dictionary_fs_memory_remove_blob(memory, link_hash);
+  sc_link_contents_cache_remove(memory->link_contents_cache, link_hash);
+
   return status;
 }
 
-sc_dictionary_fs_memory_status sc_dictionary_fs_memory_unlink_string(
-    sc_dictionary_fs_memory * memory,
-    sc_addr_hash const link_hash)
+//! String of linked strings, it is hashed and divided into terms by workers in parallel
+typedef struct
 {
-  if (memory == null_ptr)
+  sc_uint64 string_hash;
+  sc_list * string_terms;
+  sc_uint64 string_offset;
+  sc_uint64 written_string_idx;  // index of string with the same content to write, or INVALID_STRING_OFFSET
+} sc_linked_string;
+
+typedef struct
+{
+  sc_dictionary_fs_memory const * memory;
+  sc_char const * const * strings;
+  sc_uint64 const * strings_sizes;
+  sc_linked_string * linked_strings;
+  sc_uint64 begin;
+  sc_uint64 end;
+  sc_bool is_searchable_string;
+} sc_linked_strings_worker;
+
+//! Term of linked string, terms are sorted to append offsets of all strings with term by one search of term
+typedef struct
+{
+  sc_char const * term;
+  sc_uint64 term_size;
+  sc_uint64 string_offset;
+} sc_term_string_offset;
+
+sc_pointer _sc_dictionary_fs_memory_prepare_linked_strings(sc_pointer data)
+{
+  sc_linked_strings_worker const * worker = data;
+  sc_dictionary_fs_memory const * memory = worker->memory;
+
+  for (sc_uint64 i = worker->begin; i < worker->end; ++i)
   {
-    sc_fs_memory_info("Memory is empty to unlink string");
-    return SC_FS_MEMORY_NO;
+    sc_linked_string * linked_string = &worker->linked_strings[i];
+    linked_string->string_hash = _sc_dictionary_fs_memory_get_string_hash(
+        worker->strings[i], worker->strings_sizes[i], worker->is_searchable_string);
+    if (worker->is_searchable_string && worker->strings_sizes[i] < memory->max_searchable_string_size)
+      linked_string->string_terms =
+          _sc_dictionary_fs_memory_get_string_terms(worker->strings[i], memory->term_separators);
   }
 
-  sc_monitor_acquire_write(&memory->monitor);
+  return null_ptr;
+}
 
-  sc_char link_hash_str[DEFAULT_STRING_INT_SIZE];
-  sc_uint64 link_hash_str_size;
-  sc_int_to_str_int(link_hash, link_hash_str, link_hash_str_size);
+//! Hashes strings and divides them into terms by workers, the last part of strings is prepared by current thread
+void _sc_dictionary_fs_memory_prepare_linked_strings_in_parallel(
+    sc_dictionary_fs_memory const * memory,
+    sc_char const * const * strings,
+    sc_uint64 const * strings_sizes,
+    sc_uint64 const strings_count,
+    sc_bool const is_searchable_string,
+    sc_linked_string * linked_strings)
+{
+  sc_uint64 const max_workers_count = (strings_count + SC_DICTIONARY_FS_MEMORY_MIN_STRINGS_PER_WORKER - 1)
+                                      / SC_DICTIONARY_FS_MEMORY_MIN_STRINGS_PER_WORKER;
+  sc_uint64 const workers_count = sc_boundary(max_workers_count, 1, g_get_num_processors());
 
-  // remove link for current string
+  sc_linked_strings_worker * workers = sc_mem_new(sc_linked_strings_worker, workers_count);
+  sc_thread ** threads = sc_mem_new(sc_thread *, workers_count);
+  for (sc_uint64 i = 0; i < workers_count; ++i)
   {
-    sc_link_hash_content * link_hash_content =
-        sc_dictionary_get_by_key(memory->link_hashes_string_offsets_dictionary, link_hash_str, link_hash_str_size);
-    if (link_hash_content == null_ptr)
-      goto result;
-
-    sc_list_remove_if(link_hash_content->link_hashes, (sc_addr_hash_to_sc_pointer)link_hash, _sc_addr_hash_compare);
-    sc_mem_free(link_hash_content);
+    workers[i] = (sc_linked_strings_worker){
+        .memory = memory,
+        .strings = strings,
+        .strings_sizes = strings_sizes,
+        .linked_strings = linked_strings,
+        .begin = strings_count * i / workers_count,
+        .end = strings_count * (i + 1) / workers_count,
+        .is_searchable_string = is_searchable_string,
+    };
+
+    if (i + 1 < workers_count)
+      threads[i] = sc_thread_new("sc-fs-memory-terms", _sc_dictionary_fs_memory_prepare_linked_strings, &workers[i]);
   }
 
-  // set empty link
-  sc_dictionary_append(memory->link_hashes_string_offsets_dictionary, link_hash_str, link_hash_str_size, null_ptr);
+  _sc_dictionary_fs_memory_prepare_linked_strings(&workers[workers_count - 1]);
+  for (sc_uint64 i = 0; i + 1 < workers_count; ++i)
+    sc_thread_join(threads[i]);
 
-result:
-  sc_monitor_release_write(&memory->monitor);
+  sc_mem_free(threads);
+  sc_mem_free(workers);
+}
 
-  return SC_FS_MEMORY_OK;
+/*! Finds strings equal to linked strings in fs-memory and among previous linked strings, and calculates offsets of
+ * other strings relative to the beginning of place for them.
+ * @returns Returns count of bytes of strings to write with their sizes.
+ */
+sc_uint64 _sc_dictionary_fs_memory_find_linked_strings(
+    sc_dictionary_fs_memory * memory,
+    sc_char const * const * strings,
+    sc_uint64 const * strings_sizes,
+    sc_uint64 const strings_count,
+    sc_linked_string * linked_strings)
+{
+  sc_hash_map * written_strings_map;
+  sc_hash_map_initialize(&written_strings_map, strings_count);
+
+  sc_uint64 written_strings_size = 0;
+  for (sc_uint64 i = 0; i < strings_count; ++i)
+  {
+    sc_linked_string * linked_string = &linked_strings[i];
+    linked_string->written_string_idx = INVALID_STRING_OFFSET;
+    linked_string->string_offset = _sc_dictionary_fs_memory_get_string_offset_by_string(
+        memory, strings[i], strings_sizes[i], linked_string->string_hash);
+    if (linked_string->string_offset != INVALID_STRING_OFFSET)
+      continue;
+
+    sc_uint64 const other_string_idx = (sc_uint64)sc_hash_map_get(written_strings_map, linked_string->string_hash);
+    if (other_string_idx != 0 && strings_sizes[other_string_idx - 1] == strings_sizes[i]
+        && memcmp(strings[other_string_idx - 1], strings[i], strings_sizes[i]) == 0)
+    {
+      linked_string->written_string_idx = other_string_idx - 1;
+      continue;
+    }
+
+    sc_hash_map_insert(written_strings_map, linked_string->string_hash, (void *)(i + 1));
+    linked_string->written_string_idx = i;
+    linked_string->string_offset = written_strings_size;
+    written_strings_size += sizeof(sc_uint64) + strings_sizes[i];
+  }
+
+  sc_hash_map_destroy(written_strings_map, null_ptr);
+  return written_strings_size;
 }
 
-sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_read_string_by_offset(
+sc_bool _sc_dictionary_fs_memory_write_strings_buffer(
     sc_dictionary_fs_memory * memory,
-    sc_uint64 const string_offset,
-    sc_char ** string)
+    sc_uint64 const buffer_string_offset,
+    sc_char const * buffer,
+    sc_uint64 const buffer_size)
 {
+  if (buffer_size == 0)
+    return SC_TRUE;
+
   sc_monitor * channel_monitor;
   sc_io_channel * strings_channel =
-      _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, string_offset, &channel_monitor);
+      _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, buffer_string_offset, &channel_monitor);
   if (strings_channel == null_ptr)
+    return SC_FALSE;
+
+  return _sc_dictionary_fs_memory_write_chars_by_offset(
+      strings_channel, _sc_dictionary_fs_memory_normalize_offset(memory, buffer_string_offset), buffer, buffer_size);
+}
+
+/*! Writes new linked strings into reserved place. Strings of one strings channel follow each other, so they are
+ * gathered into buffer and written by one positional write of buffer.
+ */
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_write_linked_strings(
+    sc_dictionary_fs_memory * memory,
+    sc_char const * const * strings,
+    sc_uint64 const * strings_sizes,
+    sc_uint64 const strings_count,
+    sc_linked_string * linked_strings)
+{
+  sc_char * buffer = sc_mem_new(sc_char, SC_DICTIONARY_FS_MEMORY_STRINGS_BUFFER_SIZE);
+  sc_uint64 buffer_size = 0;
+  sc_uint64 buffer_string_offset = 0;
+
+  sc_dictionary_fs_memory_status status = SC_FS_MEMORY_OK;
+  for (sc_uint64 i = 0; i < strings_count; ++i)
   {
-    sc_fs_memory_error("Path `%s` doesn't exist", "path");
-    return SC_FS_MEMORY_READ_ERROR;
+    if (linked_strings[i].written_string_idx != i)
+      continue;
+
+    sc_uint64 const string_offset = linked_strings[i].string_offset;
+    sc_uint64 const string_size = strings_sizes[i];
+    sc_uint64 const size = sizeof(string_size) + string_size;
+
+    sc_uint64 const channel_idx = (string_offset - memory->strings_offset) / memory->max_strings_channel_size;
+    sc_uint64 const buffer_channel_idx =
+        (buffer_string_offset - memory->strings_offset) / memory->max_strings_channel_size;
+    sc_bool const is_other_channel = channel_idx != buffer_channel_idx;
+    if (buffer_size != 0 && (is_other_channel || buffer_size + size > SC_DICTIONARY_FS_MEMORY_STRINGS_BUFFER_SIZE))
+    {
+      if (!_sc_dictionary_fs_memory_write_strings_buffer(memory, buffer_string_offset, buffer, buffer_size))
+        goto error;
+      buffer_size = 0;
+    }
+
+    // big strings are written without copying into buffer
+    if (size > SC_DICTIONARY_FS_MEMORY_STRINGS_BUFFER_SIZE)
+    {
+      if (!_sc_dictionary_fs_memory_write_strings_buffer(
+              memory, string_offset, (sc_char const *)&string_size, sizeof(string_size))
+          || !_sc_dictionary_fs_memory_write_strings_buffer(
+              memory, string_offset + sizeof(string_size), strings[i], string_size))
+        goto error;
+      continue;
+    }
+
+    if (buffer_size == 0)
+      buffer_string_offset = string_offset;
+    sc_mem_cpy(buffer + buffer_size, &string_size, sizeof(string_size));
+    sc_mem_cpy(buffer + buffer_size + sizeof(string_size), strings[i], string_size);
+    buffer_size += size;
   }
 
-  // read string with size from fs-memory
-  sc_uint64 read_bytes;
-  sc_uint64 const normalized_string_offset = _sc_dictionary_fs_memory_normalize_offset(memory, string_offset);
-  sc_monitor_acquire_write(channel_monitor);
-  sc_io_channel_seek(strings_channel, normalized_string_offset, SC_FS_IO_SEEK_SET, null_ptr);
+  if (!_sc_dictionary_fs_memory_write_strings_buffer(memory, buffer_string_offset, buffer, buffer_size))
+    goto error;
+
+  goto exit;
+
+error:
+  sc_fs_memory_error("Error while strings writing");
+  status = SC_FS_MEMORY_WRITE_ERROR;
+exit:
+  sc_mem_free(buffer);
+  return status;
+}
+
+sc_int32 _sc_dictionary_fs_memory_compare_linked_strings_terms(void const * term, void const * other_term)
+{
+  sc_term_string_offset const * first = term;
+  sc_term_string_offset const * second = other_term;
+  sc_int32 const result =
+      sc_terms_index_compare_terms(first->term, first->term_size, second->term, second->term_size);
+  if (result != 0)
+    return result;
+
+  return (first->string_offset > second->string_offset) - (first->string_offset < second->string_offset);
+}
+
+/*! Appends offsets of new linked strings to terms. Terms are sorted with offsets, so every term is found in
+ * dictionary once and offsets of strings with it are appended in increasing order.
+ */
+void _sc_dictionary_fs_memory_write_linked_strings_terms(
+    sc_dictionary_fs_memory * memory,
+    sc_uint64 const strings_count,
+    sc_linked_string const * linked_strings)
+{
+  sc_uint64 terms_count = 0;
+  for (sc_uint64 i = 0; i < strings_count; ++i)
   {
-    sc_uint64 string_size;
-    if (sc_io_channel_read_chars(strings_channel, (sc_char *)&string_size, sizeof(sc_uint64), &read_bytes, null_ptr)
-            != SC_FS_IO_STATUS_NORMAL
-        || sizeof(sc_uint64) != read_bytes)
+    if (linked_strings[i].written_string_idx == i && linked_strings[i].string_terms != null_ptr)
+      terms_count += memory->search_by_substring ? linked_strings[i].string_terms->size : 1;
+  }
+
+  if (terms_count == 0)
+    return;
+
+  sc_term_string_offset * terms_string_offsets = sc_mem_new(sc_term_string_offset, terms_count);
+  sc_uint64 k = 0;
+  for (sc_uint64 i = 0; i < strings_count; ++i)
+  {
+    if (linked_strings[i].written_string_idx != i || linked_strings[i].string_terms == null_ptr)
+      continue;
+
+    sc_iterator * term_it = sc_list_iterator(linked_strings[i].string_terms);
+    while (sc_iterator_next(term_it))
     {
-      *string = null_ptr;
-      goto error;
+      sc_char const * term = sc_iterator_get(term_it);
+      terms_string_offsets[k++] = (sc_term_string_offset){
+          .term = term,
+          .term_size = sc_str_len(term),
+          .string_offset = linked_strings[i].string_offset,
+      };
+
+      if (!memory->search_by_substring)
+        break;
     }
+    sc_iterator_destroy(term_it);
+  }
+
+  qsort(
+      terms_string_offsets,
+      terms_count,
+      sizeof(sc_term_string_offset),
+      _sc_dictionary_fs_memory_compare_linked_strings_terms);
+
+  sc_monitor_acquire_write(&memory->terms_monitor);
+  sc_list * string_offsets = null_ptr;
+  for (sc_uint64 i = 0; i < terms_count; ++i)
+  {
+    sc_term_string_offset const * term_string_offset = &terms_string_offsets[i];
+    sc_term_string_offset const * previous_term_string_offset = term_string_offset - 1;
+    if (i == 0
+        || sc_terms_index_compare_terms(
+               term_string_offset->term,
+               term_string_offset->term_size,
+               previous_term_string_offset->term,
+               previous_term_string_offset->term_size)
+               != 0)
+      string_offsets = _sc_dictionary_fs_memory_get_list(
+          memory->terms_string_offsets_dictionary, term_string_offset->term, term_string_offset->term_size);
+
+    sc_list_push_back(string_offsets, (void *)term_string_offset->string_offset);
+  }
+  sc_monitor_release_write(&memory->terms_monitor);
+
+  sc_mem_free(terms_string_offsets);
+}
+
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_link_strings(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash const * link_hashes,
+    sc_char const * const * strings,
+    sc_uint64 const * strings_sizes,
+    sc_uint64 strings_count,
+    sc_bool is_searchable_string)
+{
+  if (memory == null_ptr)
+  {
+    sc_fs_memory_info("Memory is empty to link strings");
+    return SC_FS_MEMORY_NO;
+  }
+
+  if (strings_count == 0)
+    return SC_FS_MEMORY_OK;
+
+  sc_linked_string * linked_strings = sc_mem_new(sc_linked_string, strings_count);
+  _sc_dictionary_fs_memory_prepare_linked_strings_in_parallel(
+      memory, strings, strings_sizes, strings_count, is_searchable_string, linked_strings);
+
+  // strings equal to linked strings can be written by other writers, so they are locked by all strings monitors
+  for (sc_uint32 i = 0; i < SC_DICTIONARY_FS_MEMORY_STRINGS_MONITORS_COUNT; ++i)
+    sc_monitor_acquire_write(&memory->strings_monitors[i]);
+
+  // reserve one place for all new strings, so they are written one by one
+  sc_uint64 const written_strings_size =
+      _sc_dictionary_fs_memory_find_linked_strings(memory, strings, strings_sizes, strings_count, linked_strings);
+  sc_uint64 const strings_offset = sc_atomic_uint64_fetch_and_add(&memory->last_string_offset, written_strings_size);
+  for (sc_uint64 i = 0; i < strings_count; ++i)
+  {
+    sc_linked_string * linked_string = &linked_strings[i];
+    if (linked_string->written_string_idx == i)
+      linked_string->string_offset += strings_offset;
+    else if (linked_string->written_string_idx != INVALID_STRING_OFFSET)
+      linked_string->string_offset = linked_strings[linked_string->written_string_idx].string_offset;
+  }
+
+  sc_dictionary_fs_memory_status const status =
+      _sc_dictionary_fs_memory_write_linked_strings(memory, strings, strings_sizes, strings_count, linked_strings);
+  if (status != SC_FS_MEMORY_OK)
+    goto exit;
+
+  sc_monitor_acquire_write(&memory->string_hashes_monitor);
+  for (sc_uint64 i = 0; i < strings_count; ++i)
+  {
+    if (linked_strings[i].written_string_idx == i)
+      sc_hash_map_insert(
+          memory->string_hashes_string_offsets_map,
+          linked_strings[i].string_hash,
+          (void *)(linked_strings[i].string_offset + 1));
+  }
+  sc_monitor_release_write(&memory->string_hashes_monitor);
+
+  sc_monitor_acquire_write(&memory->links_monitor);
+  for (sc_uint64 i = 0; i < strings_count; ++i)
+    _sc_dictionary_fs_memory_append_link_string_unique(memory, link_hashes[i], linked_strings[i].string_offset);
+  sc_monitor_release_write(&memory->links_monitor);
 
-    *string = sc_mem_new(sc_char, string_size + 1);
-    if (sc_io_channel_read_chars(strings_channel, *string, string_size, &read_bytes, null_ptr) != SC_FS_IO_STATUS_NORMAL
-        || string_size != read_bytes)
+  _sc_dictionary_fs_memory_write_linked_strings_terms(memory, strings_count, linked_strings);
+
+  if (is_searchable_string && memory->search_by_substring)
+  {
+    sc_monitor_acquire_write(&memory->ngrams_monitor);
+    for (sc_uint64 i = 0; i < strings_count; ++i)
     {
-      sc_mem_free(*string);
-      *string = null_ptr;
-      goto error;
+      if (linked_strings[i].written_string_idx == i)
+        sc_ngrams_index_append(memory->ngrams_index, strings[i], strings_sizes[i], linked_strings[i].string_offset);
     }
+    sc_monitor_release_write(&memory->ngrams_monitor);
+  }
+
+exit:
+  for (sc_uint32 i = SC_DICTIONARY_FS_MEMORY_STRINGS_MONITORS_COUNT; i > 0; --i)
+    sc_monitor_release_write(&memory->strings_monitors[i - 1]);
+
+  for (sc_uint64 i = 0; i < strings_count; ++i)
+  {
+    sc_list_clear(linked_strings[i].string_terms);
+    sc_list_destroy(linked_strings[i].string_terms);
+
+    // new content replaces content with appended parts
+    if (status == SC_FS_MEMORY_OK)
+      _sc_dictionary_fs_memory_remove_blob(memory, link_hashes[i]);
+    sc_link_contents_cache_remove(memory->link_contents_cache, link_hashes[i]);
+  }
+  sc_mem_free(linked_strings);
+
+  return status;
+}
+
+void _sc_dictionary_fs_memory_unlink_link_string(sc_dictionary_fs_memory * memory, sc_addr_hash const link_hash)
+{
+  sc_monitor_acquire_write(&memory->links_monitor);
+
+  // remove link for current string
+  sc_link_hash_content * link_hash_content = sc_hash_map_remove(memory->link_hashes_string_offsets_map, link_hash);
+  if (link_hash_content != null_ptr)
+  {
+    sc_list_remove_if(link_hash_content->link_hashes, (sc_addr_hash_to_sc_pointer)link_hash, _sc_addr_hash_compare);
+    sc_mem_free(link_hash_content);
+  }
+
+  sc_monitor_release_write(&memory->links_monitor);
+}
+
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_unlink_string(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash const link_hash)
+{
+  if (memory == null_ptr)
+  {
+    sc_fs_memory_info("Memory is empty to unlink string");
+    return SC_FS_MEMORY_NO;
   }
 
-  sc_monitor_release_write(channel_monitor);
+  _sc_dictionary_fs_memory_unlink_link_string(memory, link_hash);
+  _sc_dictionary_fs_memory_remove_blob(memory, link_hash);
+  sc_link_contents_cache_remove(memory->link_contents_cache, link_hash);
+
   return SC_FS_MEMORY_OK;
+}
 
-error:
-  sc_monitor_release_write(channel_monitor);
-  return SC_FS_MEMORY_READ_ERROR;
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_read_string_by_offset(
+    sc_dictionary_fs_memory * memory,
+    sc_uint64 const string_offset,
+    sc_char ** string)
+{
+  sc_uint64 string_size;
+  return _sc_dictionary_fs_memory_read_string_by_offset_ext(
+      memory, string_offset, 0, INVALID_STRING_OFFSET, string, &string_size);
 }
 
 void _sc_dictionary_fs_memory_read_file(sc_char * file_path, sc_char ** content, sc_uint32 * size)
@@ -640,6 +1296,111 @@ void _sc_dictionary_fs_memory_read_file(sc_char * file_path, sc_char ** content,
     sc_fs_get_file_content(file_path, content, size);
 }
 
+/*! Reads part of string from strings blocks or strings channel by offset, only this part is read
+ * @returns Returns SC_FS_MEMORY_OK, if string is found, read bytes count is 0 if position is at the end of string.
+ */
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_read_string_part_by_offset(
+    sc_dictionary_fs_memory * memory,
+    sc_uint64 const string_offset,
+    sc_uint64 const position,
+    sc_char * data,
+    sc_uint64 const data_size,
+    sc_uint64 * read_bytes,
+    sc_uint64 * string_size)
+{
+  *read_bytes = 0;
+  *string_size = 0;
+
+  if (string_offset < memory->strings_offset)
+  {
+    if (!sc_strings_blocks_read_part(
+            memory->strings_blocks, string_offset, position, data, data_size, read_bytes, string_size))
+    {
+      sc_fs_memory_error("Error while string part reading from strings blocks");
+      return SC_FS_MEMORY_READ_ERROR;
+    }
+    return SC_FS_MEMORY_OK;
+  }
+
+  sc_monitor * channel_monitor;
+  sc_io_channel * strings_channel =
+      _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, string_offset, &channel_monitor);
+  if (strings_channel == null_ptr)
+  {
+    sc_fs_memory_error("Path `%s` doesn't exist", "path");
+    return SC_FS_MEMORY_READ_ERROR;
+  }
+
+  sc_uint64 const normalized_string_offset = _sc_dictionary_fs_memory_normalize_offset(memory, string_offset);
+  sc_monitor_acquire_read(channel_monitor);
+  sc_bool is_read = _sc_dictionary_fs_memory_read_chars_by_offset(
+      strings_channel, normalized_string_offset, (sc_char *)string_size, sizeof(sc_uint64));
+  if (is_read && position < *string_size)
+  {
+    *read_bytes = sc_min(data_size, *string_size - position);
+    is_read = _sc_dictionary_fs_memory_read_chars_by_offset(
+        strings_channel, normalized_string_offset + sizeof(sc_uint64) + position, data, *read_bytes);
+  }
+  sc_monitor_release_read(channel_monitor);
+
+  if (!is_read)
+  {
+    *read_bytes = 0;
+    *string_size = 0;
+    sc_fs_memory_error("Error while string part reading");
+    return SC_FS_MEMORY_READ_ERROR;
+  }
+
+  return SC_FS_MEMORY_OK;
+}
+
+sc_bool _sc_dictionary_fs_memory_get_string_offset_by_link_hash(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash const link_hash,
+    sc_uint64 * string_offset)
+{
+  sc_monitor_acquire_read(&memory->links_monitor);
+  sc_link_hash_content * content = sc_hash_map_get(memory->link_hashes_string_offsets_map, link_hash);
+  *string_offset = content == null_ptr ? INVALID_STRING_OFFSET : (sc_uint64)content->string_offset - 1;
+  sc_monitor_release_read(&memory->links_monitor);
+
+  return content != null_ptr;
+}
+
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_read_string_part_by_link_hash(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash const link_hash,
+    sc_uint64 const position,
+    sc_char * data,
+    sc_uint64 const data_size,
+    sc_uint64 * read_bytes,
+    sc_uint64 * string_size)
+{
+  *read_bytes = 0;
+  *string_size = 0;
+
+  sc_uint64 string_offset;
+  if (_sc_dictionary_fs_memory_get_string_offset_by_link_hash(memory, link_hash, &string_offset))
+    return _sc_dictionary_fs_memory_read_string_part_by_offset(
+        memory, string_offset, position, data, data_size, read_bytes, string_size);
+
+  if (!_sc_dictionary_fs_memory_get_blob_size(memory, link_hash, string_size))
+    return SC_FS_MEMORY_NO_STRING;
+
+  if (position >= *string_size)
+    return SC_FS_MEMORY_OK;
+
+  sc_uint64 const size = sc_min(data_size, *string_size - position);
+  if (!_sc_dictionary_fs_memory_read_blob(memory, link_hash, position, data, size))
+  {
+    sc_fs_memory_error("Error while blob part reading");
+    return SC_FS_MEMORY_READ_ERROR;
+  }
+
+  *read_bytes = size;
+  return SC_FS_MEMORY_OK;
+}
+
 sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_by_link_hash(
     sc_dictionary_fs_memory * memory,
     sc_addr_hash const link_hash,
@@ -652,22 +1413,33 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_by_link_hash(
     return SC_FS_MEMORY_NO;
   }
 
-  sc_char link_hash_str[DEFAULT_STRING_INT_SIZE];
-  sc_uint64 link_hash_str_size;
-  sc_int_to_str_int(link_hash, link_hash_str, link_hash_str_size);
-  sc_link_hash_content * content =
-      sc_dictionary_get_by_key(memory->link_hashes_string_offsets_dictionary, link_hash_str, link_hash_str_size);
+  sc_uint64 cache_version;
+  if (sc_link_contents_cache_get(memory->link_contents_cache, link_hash, string, string_size, &cache_version))
+    return SC_FS_MEMORY_OK;
 
-  if (content == null_ptr)
+  sc_uint64 string_offset;
+  if (!_sc_dictionary_fs_memory_get_string_offset_by_link_hash(memory, link_hash, &string_offset))
   {
-    *string = null_ptr;
-    *string_size = 0;
-    return SC_FS_MEMORY_NO_STRING;
+    // content with appended parts is read from blob
+    sc_uint64 blob_size;
+    if (!_sc_dictionary_fs_memory_get_blob_size(memory, link_hash, &blob_size))
+      return SC_FS_MEMORY_NO_STRING;
+
+    *string = sc_mem_new(sc_char, blob_size + 1);
+    if (!_sc_dictionary_fs_memory_read_blob(memory, link_hash, 0, *string, blob_size))
+    {
+      sc_mem_free(*string);
+      *string = null_ptr;
+      sc_fs_memory_error("Error while blob reading");
+      return SC_FS_MEMORY_READ_ERROR;
+    }
+
+    *string_size = blob_size;
+    return SC_FS_MEMORY_OK;
   }
 
-  sc_uint64 const string_offset = (sc_uint64)content->string_offset - 1;
-  sc_dictionary_fs_memory_status const status =
-      _sc_dictionary_fs_memory_read_string_by_offset(memory, string_offset, string);
+  sc_dictionary_fs_memory_status const status = _sc_dictionary_fs_memory_read_string_by_offset_ext(
+      memory, string_offset, 0, INVALID_STRING_OFFSET, string, string_size);
   if (status != SC_FS_MEMORY_OK)
   {
     *string = null_ptr;
@@ -675,109 +1447,346 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_by_link_hash(
     return SC_FS_MEMORY_READ_ERROR;
   }
 
+  // binary contents may contain zeros, so only contents with file paths are measured as strings
   if ((sc_str_find(*string, ".") || sc_str_find(*string, "/")) && sc_fs_is_file(*string))
   {
     sc_char * file_path = *string;
     sc_uint32 size;
     _sc_dictionary_fs_memory_read_file(file_path, string, &size);
-    *string_size = size;
+    *string_size = sc_str_len(*string);
     sc_mem_free(file_path);
+    return SC_FS_MEMORY_OK;
   }
 
-  *string_size = sc_str_len(*string);
-
+  // contents of files and blobs aren't cached, files may be changed out of fs-memory and blobs are big
+  sc_link_contents_cache_put(memory->link_contents_cache, link_hash, *string, *string_size, cache_version);
   return SC_FS_MEMORY_OK;
 }
 
-sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_link_hashes_by_string_term(
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_link_contents_cache_stat(
     sc_dictionary_fs_memory * memory,
-    sc_char const * string,
-    sc_uint64 const string_size,
-    sc_bool const is_substring,
-    sc_bool const to_search_as_prefix,
-    sc_list const * string_offsets,
-    sc_link_handler * link_handler)
+    sc_link_contents_cache_stat * stat)
 {
-  sc_iterator * string_offset_it = sc_list_iterator(string_offsets);
-  if (!sc_iterator_next(string_offset_it))
-    return SC_FS_MEMORY_NO_STRING;
+  if (memory == null_ptr)
+  {
+    sc_fs_memory_info("Memory is empty to get link contents cache statistics");
+    return SC_FS_MEMORY_NO;
+  }
 
-  sc_monitor * channel_monitor;
-  while (sc_iterator_next(string_offset_it))
+  sc_link_contents_cache_get_stat(memory->link_contents_cache, stat);
+  return SC_FS_MEMORY_OK;
+}
+
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_size_by_link_hash(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash const link_hash,
+    sc_uint64 * string_size)
+{
+  if (memory == null_ptr)
   {
-    sc_pair * pair;
-    sc_uint64 string_offset;
-    if (is_substring)
-    {
-      pair = (sc_pair *)sc_iterator_get(string_offset_it);
-      string_offset = (sc_uint64)pair->first;
-    }
-    else
-      string_offset = (sc_uint64)sc_iterator_get(string_offset_it);
+    sc_fs_memory_info("Memory is empty to get string size by link hash");
+    return SC_FS_MEMORY_NO;
+  }
+
+  sc_uint64 read_bytes;
+  return _sc_dictionary_fs_memory_read_string_part_by_link_hash(
+      memory, link_hash, 0, null_ptr, 0, &read_bytes, string_size);
+}
+
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_read_string_by_link_hash(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash const link_hash,
+    sc_uint64 const offset,
+    sc_char * data,
+    sc_uint64 const size,
+    sc_uint64 * read_bytes)
+{
+  if (memory == null_ptr)
+  {
+    sc_fs_memory_info("Memory is empty to read string by link hash");
+    return SC_FS_MEMORY_NO;
+  }
+
+  sc_uint64 string_size;
+  return _sc_dictionary_fs_memory_read_string_part_by_link_hash(
+      memory, link_hash, offset, data, size, read_bytes, &string_size);
+}
+
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_location_by_link_hash(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash const link_hash,
+    sc_uint64 * string_location,
+    sc_uint64 * string_size)
+{
+  *string_location = INVALID_STRING_OFFSET;
+  *string_size = 0;
+
+  if (memory == null_ptr)
+  {
+    sc_fs_memory_info("Memory is empty to get string location by link hash");
+    return SC_FS_MEMORY_NO;
+  }
+
+  // string location is its offset, contents with appended parts are located in blobs by link hashes
+  sc_uint64 read_bytes;
+  if (_sc_dictionary_fs_memory_get_string_offset_by_link_hash(memory, link_hash, string_location))
+    return _sc_dictionary_fs_memory_read_string_part_by_offset(
+        memory, *string_location, 0, null_ptr, 0, &read_bytes, string_size);
+
+  return _sc_dictionary_fs_memory_get_blob_size(memory, link_hash, string_size) ? SC_FS_MEMORY_OK
+                                                                                : SC_FS_MEMORY_NO_STRING;
+}
+
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_read_string_by_location(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash const link_hash,
+    sc_uint64 const string_location,
+    sc_uint64 const offset,
+    sc_char * data,
+    sc_uint64 const size,
+    sc_uint64 * read_bytes)
+{
+  *read_bytes = 0;
+
+  if (memory == null_ptr)
+  {
+    sc_fs_memory_info("Memory is empty to read string by location");
+    return SC_FS_MEMORY_NO;
+  }
+
+  if (string_location != INVALID_STRING_OFFSET)
+  {
+    sc_uint64 string_size;
+    return _sc_dictionary_fs_memory_read_string_part_by_offset(
+        memory, string_location, offset, data, size, read_bytes, &string_size);
+  }
+
+  if (size != 0 && !_sc_dictionary_fs_memory_read_blob(memory, link_hash, offset, data, size))
+  {
+    sc_fs_memory_error("Error while blob part reading");
+    return SC_FS_MEMORY_READ_ERROR;
+  }
+
+  *read_bytes = size;
+  return SC_FS_MEMORY_OK;
+}
+
+//! Copies string of link to blob by chunks, so big strings aren't read into memory entirely
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_copy_string_to_blob(
+    sc_dictionary_fs_memory * memory,
+    sc_uint64 const string_offset,
+    sc_io_channel * blob_channel,
+    sc_uint64 * blob_size)
+{
+  sc_dictionary_fs_memory_status status = SC_FS_MEMORY_OK;
+  sc_char * chunk = sc_mem_new(sc_char, DEFAULT_BLOB_CHUNK_SIZE);
+
+  *blob_size = 0;
+  sc_uint64 read_bytes;
+  sc_uint64 string_size;
+  do
+  {
+    status = _sc_dictionary_fs_memory_read_string_part_by_offset(
+        memory, string_offset, *blob_size, chunk, DEFAULT_BLOB_CHUNK_SIZE, &read_bytes, &string_size);
+    if (status != SC_FS_MEMORY_OK)
+      break;
 
-    sc_io_channel * strings_channel =
-        _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, string_offset, &channel_monitor);
-    if (strings_channel == null_ptr)
+    if (!_sc_dictionary_fs_memory_write_chars_by_offset(blob_channel, *blob_size, chunk, read_bytes))
     {
-      sc_fs_memory_error("Path `%s` doesn't exist", "path");
-      return SC_FS_MEMORY_READ_ERROR;
+      status = SC_FS_MEMORY_WRITE_ERROR;
+      break;
     }
 
-    // read string with size from fs-memory
-    sc_uint64 read_bytes;
-    sc_uint64 const normalized_string_offset = _sc_dictionary_fs_memory_normalize_offset(memory, string_offset);
+    *blob_size += read_bytes;
+  } while (read_bytes != 0);
 
-    sc_bool go_to_next = SC_FALSE;
-    sc_monitor_acquire_write(channel_monitor);
-    sc_io_channel_seek(strings_channel, normalized_string_offset, SC_FS_IO_SEEK_SET, null_ptr);
-    {
-      sc_uint64 other_string_size;
-      if (sc_io_channel_read_chars(
-              strings_channel, (sc_char *)&other_string_size, sizeof(sc_uint64), &read_bytes, null_ptr)
-              != SC_FS_IO_STATUS_NORMAL
-          || sizeof(sc_uint64) != read_bytes)
-        goto error;
+  sc_mem_free(chunk);
+  return status;
+}
 
-      // optimize needed string search
-      if ((is_substring && other_string_size < string_size) || (!is_substring && other_string_size != string_size))
-      {
-        go_to_next = SC_TRUE;
-        goto cont;
-      }
+//! Checks whether string is text that can be found by terms, binary strings contain zero bytes
+sc_bool _sc_dictionary_fs_memory_is_text(sc_char const * string, sc_uint64 const string_size)
+{
+  for (sc_uint64 i = 0; i < string_size; ++i)
+  {
+    if (string[i] == '\0')
+      return SC_FALSE;
+  }
+  return SC_TRUE;
+}
 
-      sc_char other_string[other_string_size + 1];
-      if (sc_io_channel_read_chars(strings_channel, other_string, other_string_size, &read_bytes, null_ptr)
-              != SC_FS_IO_STATUS_NORMAL
-          || other_string_size != read_bytes)
-        goto error;
+/*! Links string of link concatenated with appended string as new searchable string, if they are small texts.
+ * @returns Returns SC_FALSE, if string of link with appended string must be stored as blob.
+ */
+sc_bool _sc_dictionary_fs_memory_link_appended_text(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash const link_hash,
+    sc_bool const is_string,
+    sc_uint64 const string_offset,
+    sc_char const * string,
+    sc_uint64 const string_size,
+    sc_dictionary_fs_memory_status * status)
+{
+  if (string_size >= memory->max_searchable_string_size || !_sc_dictionary_fs_memory_is_text(string, string_size))
+    return SC_FALSE;
+
+  // bigger strings of link aren't read, their contents are moved to blobs
+  sc_char * linked_string = null_ptr;
+  sc_uint64 linked_string_size = 0;
+  if (is_string
+      && (_sc_dictionary_fs_memory_read_string_by_offset_ext(
+              memory,
+              string_offset,
+              0,
+              memory->max_searchable_string_size - string_size - 1,
+              &linked_string,
+              &linked_string_size)
+              != SC_FS_MEMORY_OK
+          || linked_string == null_ptr || !_sc_dictionary_fs_memory_is_text(linked_string, linked_string_size)))
+  {
+    sc_mem_free(linked_string);
+    return SC_FALSE;
+  }
 
-      other_string[other_string_size] = '\0';
+  sc_char * text = sc_mem_new(sc_char, linked_string_size + string_size + 1);
+  if (linked_string != null_ptr)
+    sc_mem_cpy(text, linked_string, linked_string_size);
+  sc_mem_cpy(text + linked_string_size, string, string_size);
+  sc_mem_free(linked_string);
 
-      if ((is_substring
-           && ((to_search_as_prefix && sc_str_has_prefix(other_string, string) == SC_FALSE)
-               || (!to_search_as_prefix && sc_str_find(other_string, string) == SC_FALSE)))
-          || (!is_substring && sc_str_cmp(string, other_string) == SC_FALSE))
-      {
-        go_to_next = SC_TRUE;
-        goto cont;
-      }
+  *status = sc_dictionary_fs_memory_link_string_ext(memory, link_hash, text, linked_string_size + string_size, SC_TRUE);
+  sc_mem_free(text);
+  return SC_TRUE;
+}
+
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_append_string(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash const link_hash,
+    sc_char const * string,
+    sc_uint64 const string_size)
+{
+  if (memory == null_ptr)
+  {
+    sc_fs_memory_info("Memory is empty to append string");
+    return SC_FS_MEMORY_NO;
+  }
+
+  sc_uint64 blob_size;
+  sc_bool const is_blob = _sc_dictionary_fs_memory_get_blob_size(memory, link_hash, &blob_size);
+  sc_uint64 string_offset;
+  sc_bool const is_string =
+      !is_blob && _sc_dictionary_fs_memory_get_string_offset_by_link_hash(memory, link_hash, &string_offset);
+
+  // small texts are rewritten as new strings to be found by their contents, other contents are moved to blobs
+  sc_dictionary_fs_memory_status status = SC_FS_MEMORY_OK;
+  if (!is_blob
+      && _sc_dictionary_fs_memory_link_appended_text(
+          memory, link_hash, is_string, string_offset, string, string_size, &status))
+    return status;
+
+  if (!is_blob && !sc_fs_is_directory(memory->blobs_path) && !sc_fs_create_directory(memory->blobs_path))
+  {
+    sc_fs_memory_error("Path `%s` is not correct", memory->blobs_path);
+    return SC_FS_MEMORY_WRITE_ERROR;
+  }
+
+  // blob is created with previous string of link, next parts are written to its end
+  sc_char * blob_path;
+  _sc_dictionary_fs_memory_get_blob_path(memory, link_hash, &blob_path);
+  sc_io_channel * blob_channel =
+      is_blob ? sc_io_new_append_channel(blob_path, null_ptr) : sc_io_new_write_channel(blob_path, null_ptr);
+  if (blob_channel == null_ptr)
+  {
+    sc_fs_memory_error("Path `%s` is not correct", blob_path);
+    sc_mem_free(blob_path);
+    return SC_FS_MEMORY_WRITE_ERROR;
+  }
+  sc_io_channel_set_encoding(blob_channel, null_ptr, null_ptr);
+
+  if (is_string)
+    status = _sc_dictionary_fs_memory_copy_string_to_blob(memory, string_offset, blob_channel, &blob_size);
+
+  if (status == SC_FS_MEMORY_OK
+      && !_sc_dictionary_fs_memory_write_chars_by_offset(blob_channel, blob_size, string, string_size))
+    status = SC_FS_MEMORY_WRITE_ERROR;
+
+  sc_io_channel_shutdown(blob_channel, SC_TRUE, null_ptr);
+
+  if (status != SC_FS_MEMORY_OK)
+  {
+    sc_fs_memory_error("Error while string appending to blob");
+    if (!is_blob)
+      sc_fs_remove_file(blob_path);
+    sc_mem_free(blob_path);
+    return status;
+  }
+  sc_mem_free(blob_path);
+
+  sc_monitor_acquire_write(&memory->blobs_monitor);
+  sc_hash_map_insert(memory->link_hashes_blobs_sizes_map, link_hash, (void *)(blob_size + string_size + 1));
+  sc_monitor_release_write(&memory->blobs_monitor);
+
+  // string of link is replaced by blob, it isn't found by link content anymore
+  if (is_string)
+    _sc_dictionary_fs_memory_unlink_link_string(memory, link_hash);
+  sc_link_contents_cache_remove(memory->link_contents_cache, link_hash);
+
+  return SC_FS_MEMORY_OK;
+}
+
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_link_hashes_by_string_term(
+    sc_dictionary_fs_memory * memory,
+    sc_char const * string,
+    sc_uint64 const string_size,
+    sc_bool const is_substring,
+    sc_bool const to_search_as_prefix,
+    sc_list const * string_offsets,
+    sc_link_handler * link_handler)
+{
+  sc_iterator * string_offset_it = sc_list_iterator(string_offsets);
+  if (!sc_iterator_next(string_offset_it))
+    return SC_FS_MEMORY_NO_STRING;
+
+  while (sc_iterator_next(string_offset_it))
+  {
+    sc_pair * pair;
+    sc_uint64 string_offset;
+    if (is_substring)
+    {
+      pair = (sc_pair *)sc_iterator_get(string_offset_it);
+      string_offset = (sc_uint64)pair->first;
     }
+    else
+      string_offset = (sc_uint64)sc_iterator_get(string_offset_it);
 
-  cont:
-    sc_monitor_release_write(channel_monitor);
+    // optimize needed string search, strings of other sizes aren't read
+    sc_char * other_string;
+    sc_uint64 other_string_size;
+    if (_sc_dictionary_fs_memory_read_string_by_offset_ext(
+            memory,
+            string_offset,
+            string_size,
+            is_substring ? INVALID_STRING_OFFSET : string_size,
+            &other_string,
+            &other_string_size)
+        != SC_FS_MEMORY_OK)
+      goto error;
+
+    // strings of any size may be found by n-grams, so they are read into heap
+    sc_bool const go_to_next = other_string == null_ptr
+                               || (is_substring
+                                   && ((to_search_as_prefix && sc_str_has_prefix(other_string, string) == SC_FALSE)
+                                       || (!to_search_as_prefix && sc_str_find(other_string, string) == SC_FALSE)))
+                               || (!is_substring && sc_str_cmp(string, other_string) == SC_FALSE);
+    sc_mem_free(other_string);
     if (go_to_next)
       continue;
 
-    sc_char string_offset_str[DEFAULT_STRING_INT_SIZE];
-    sc_uint64 string_offset_str_size;
-    sc_int_to_str_int(string_offset, string_offset_str, string_offset_str_size);
-
     sc_list * link_hashes_list;
     if (is_substring)
       link_hashes_list = pair->second;
     else
-      link_hashes_list = sc_dictionary_get_by_key(
-          memory->string_offsets_link_hashes_dictionary, string_offset_str, string_offset_str_size);
+      link_hashes_list = _sc_dictionary_fs_memory_copy_link_hashes_by_string_offset(memory, string_offset);
 
     sc_iterator * data_it = sc_list_iterator(link_hashes_list);
     while (sc_iterator_next(data_it))
@@ -789,13 +1798,15 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_link_hashes_by_strin
         link_handler->push_link_callback(link_handler->push_link_callback_data, link_addr);
     }
     sc_iterator_destroy(data_it);
+
+    if (!is_substring)
+      sc_list_destroy(link_hashes_list);
   }
   sc_iterator_destroy(string_offset_it);
 
   return SC_FS_MEMORY_OK;
 
 error:
-  sc_monitor_release_write(channel_monitor);
   sc_iterator_destroy(string_offset_it);
   return SC_FS_MEMORY_READ_ERROR;
 }
@@ -805,30 +1816,59 @@ sc_bool _sc_dictionary_fs_memory_visit_string_offsets_by_term_prefix(sc_dictiona
   if (node->data == null_ptr)
     return SC_TRUE;
 
-  sc_dictionary_fs_memory * memory = arguments[0];
-  sc_list * string_offsets = arguments[1];
-  sc_link_handler * link_handler = arguments[2];
-  sc_iterator * it = sc_list_iterator(node->data);
+  sc_list * terms_string_offsets = arguments[0];
+  sc_list_push_back(terms_string_offsets, _sc_dictionary_fs_memory_copy_list(node->data));
+
+  return SC_TRUE;
+}
+
+sc_bool _sc_dictionary_fs_memory_visit_index_string_offsets_by_term_prefix(
+    sc_char const * term,
+    sc_uint32 term_size,
+    sc_uint64 const * string_offsets,
+    sc_uint64 string_offsets_count,
+    void ** arguments)
+{
+  (void)term;
+  (void)term_size;
+  sc_list * terms_string_offsets = arguments[0];
+
+  // the first item is skipped as term in lists of term string offsets
+  sc_list * term_string_offsets;
+  sc_list_init(&term_string_offsets);
+  sc_list_push_back(term_string_offsets, null_ptr);
+  for (sc_uint64 i = 0; i < string_offsets_count; ++i)
+    sc_list_push_back(term_string_offsets, (void *)string_offsets[i]);
+  sc_list_push_back(terms_string_offsets, term_string_offsets);
+
+  return SC_TRUE;
+}
+
+void _sc_dictionary_fs_memory_filter_link_hashes_by_term_string_offsets(
+    sc_dictionary_fs_memory * memory,
+    sc_list const * term_string_offsets,
+    sc_list * string_offsets,
+    sc_link_handler * link_handler)
+{
+  sc_iterator * it = sc_list_iterator(term_string_offsets);
   if (!sc_iterator_next(it))
   {
     sc_iterator_destroy(it);
-    return SC_TRUE;
+    return;
   }
 
   sc_bool is_stopped_to_search_link = SC_FALSE;
   while (sc_iterator_next(it))
   {
     sc_uint64 const string_offset = (sc_uint64)sc_iterator_get(it);
-    sc_char string_offset_str[DEFAULT_STRING_INT_SIZE];
-    sc_uint64 string_offset_str_size;
-    sc_int_to_str_int(string_offset, string_offset_str, string_offset_str_size);
 
     // skip strings without links
-    sc_list * link_hashes = sc_dictionary_get_by_key(
-        memory->string_offsets_link_hashes_dictionary, string_offset_str, string_offset_str_size);
-
+    sc_list * link_hashes = _sc_dictionary_fs_memory_copy_link_hashes_by_string_offset(memory, string_offset);
     if (link_hashes == null_ptr || link_hashes->size == 0)
+    {
+      sc_list_destroy(link_hashes);
       continue;
+    }
 
     sc_list * filtered_link_hashes;
     sc_list_init(&filtered_link_hashes);
@@ -871,6 +1911,8 @@ sc_bool _sc_dictionary_fs_memory_visit_string_offsets_by_term_prefix(sc_dictiona
       }
       sc_iterator_destroy(link_hashes_it);
     }
+    sc_list_destroy(link_hashes);
+
     if (filtered_link_hashes->size == 0)
     {
       sc_list_destroy(filtered_link_hashes);
@@ -881,12 +1923,10 @@ sc_bool _sc_dictionary_fs_memory_visit_string_offsets_by_term_prefix(sc_dictiona
       break;
   }
   sc_iterator_destroy(it);
-
-  return SC_TRUE;
 }
 
 sc_list * _sc_dictionary_fs_memory_get_string_offsets_by_term_prefix(
-    sc_dictionary_fs_memory const * memory,
+    sc_dictionary_fs_memory * memory,
     sc_char const * term,
     sc_link_handler * link_handler)
 {
@@ -895,17 +1935,83 @@ sc_list * _sc_dictionary_fs_memory_get_string_offsets_by_term_prefix(
   sc_list_init(&string_offsets);
   sc_list_push_back(string_offsets, null_ptr);
 
-  void * arguments[3];
-  arguments[0] = (void *)memory;
-  arguments[1] = string_offsets;
-  arguments[2] = (void *)link_handler;
+  // string offsets of terms are copied, so link handlers are called without lock of dictionary with terms
+  sc_list * terms_string_offsets;
+  sc_list_init(&terms_string_offsets);
+
+  void * arguments[1];
+  arguments[0] = terms_string_offsets;
 
+  sc_monitor_acquire_read(&memory->terms_monitor);
+  sc_terms_index_visit_by_prefix(
+      memory->terms_index,
+      term,
+      term_size,
+      _sc_dictionary_fs_memory_visit_index_string_offsets_by_term_prefix,
+      arguments);
   sc_dictionary_get_by_key_prefix(
       memory->terms_string_offsets_dictionary,
       term,
       term_size,
       _sc_dictionary_fs_memory_visit_string_offsets_by_term_prefix,
       arguments);
+  sc_monitor_release_read(&memory->terms_monitor);
+
+  sc_iterator * it = sc_list_iterator(terms_string_offsets);
+  while (sc_iterator_next(it))
+  {
+    sc_list * term_string_offsets = sc_iterator_get(it);
+    _sc_dictionary_fs_memory_filter_link_hashes_by_term_string_offsets(
+        memory, term_string_offsets, string_offsets, link_handler);
+    sc_list_destroy(term_string_offsets);
+  }
+  sc_iterator_destroy(it);
+  sc_list_destroy(terms_string_offsets);
+
+  return string_offsets;
+}
+
+sc_list * _sc_dictionary_fs_memory_get_string_offsets_by_substring(
+    sc_dictionary_fs_memory * memory,
+    sc_char const * string,
+    sc_uint64 const string_size,
+    sc_link_handler * link_handler)
+{
+  if (memory->search_by_substring)
+  {
+    sc_uint64 * ngrams_string_offsets = null_ptr;
+    sc_uint64 ngrams_string_offsets_count = 0;
+
+    sc_monitor_acquire_read(&memory->ngrams_monitor);
+    sc_bool const is_found_by_ngrams = sc_ngrams_index_get_string_offsets(
+        memory->ngrams_index, string, string_size, &ngrams_string_offsets, &ngrams_string_offsets_count);
+    sc_monitor_release_read(&memory->ngrams_monitor);
+
+    // substrings shorter than n-gram are found by prefixes of terms
+    if (is_found_by_ngrams)
+    {
+      // the first item is skipped as term in lists of term string offsets
+      sc_list * ngrams_string_offsets_list;
+      sc_list_init(&ngrams_string_offsets_list);
+      sc_list_push_back(ngrams_string_offsets_list, null_ptr);
+      for (sc_uint64 i = 0; i < ngrams_string_offsets_count; ++i)
+        sc_list_push_back(ngrams_string_offsets_list, (void *)ngrams_string_offsets[i]);
+      sc_mem_free(ngrams_string_offsets);
+
+      sc_list * string_offsets;
+      sc_list_init(&string_offsets);
+      sc_list_push_back(string_offsets, null_ptr);
+      _sc_dictionary_fs_memory_filter_link_hashes_by_term_string_offsets(
+          memory, ngrams_string_offsets_list, string_offsets, link_handler);
+      sc_list_destroy(ngrams_string_offsets_list);
+
+      return string_offsets;
+    }
+  }
+
+  sc_char * term = _sc_dictionary_fs_memory_get_first_term(string, memory->term_separators);
+  sc_list * string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_term_prefix(memory, term, link_handler);
+  sc_mem_free(term);
 
   return string_offsets;
 }
@@ -924,13 +2030,16 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_link_hashes_by_string
     return SC_FS_MEMORY_NO;
   }
 
-  sc_char * term = _sc_dictionary_fs_memory_get_first_term(string, memory->term_separators);
   sc_list * string_offsets = null_ptr;
   if (is_substring)
-    string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_term_prefix(memory, term, link_handler);
+    string_offsets =
+        _sc_dictionary_fs_memory_get_string_offsets_by_substring(memory, string, string_size, link_handler);
   else
-    string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_term(memory, term);
-  sc_mem_free(term);
+  {
+    sc_char * term = _sc_dictionary_fs_memory_get_first_term(string, memory->term_separators);
+    string_offsets = _sc_dictionary_fs_memory_copy_string_offsets_by_term(memory, term);
+    sc_mem_free(term);
+  }
 
   sc_dictionary_fs_memory_status const status = _sc_dictionary_fs_memory_get_link_hashes_by_string_term(
       memory, string, string_size, is_substring, to_search_as_prefix, string_offsets, link_handler);
@@ -948,9 +2057,8 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_link_hashes_by_string
       sc_mem_free(value);
     }
     sc_iterator_destroy(it);
-
-    sc_list_destroy(string_offsets);
   }
+  sc_list_destroy(string_offsets);
 
   return status;
 }
@@ -998,75 +2106,36 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_strings_by_substring
   if (!sc_iterator_next(string_offset_it))
     return SC_FS_MEMORY_READ_ERROR;
 
-  sc_monitor * channel_monitor;
   while (sc_iterator_next(string_offset_it))
   {
     sc_pair * pair = (sc_pair *)sc_iterator_get(string_offset_it);
     sc_uint64 const string_offset = (sc_uint64)pair->first;
 
-    sc_io_channel * strings_channel =
-        _sc_dictionary_fs_memory_get_strings_channel_by_offset(memory, string_offset, &channel_monitor);
-    if (strings_channel == null_ptr)
-    {
-      sc_fs_memory_error("Path `%s` doesn't exist", "path");
-      return SC_FS_MEMORY_READ_ERROR;
-    }
-
-    // read string with size from fs-memory
-    sc_uint64 read_bytes;
-    sc_uint64 const normalized_string_offset = _sc_dictionary_fs_memory_normalize_offset(memory, string_offset);
+    // strings shorter than substring aren't read
+    sc_char * other_string;
+    sc_uint64 other_string_size;
+    if (_sc_dictionary_fs_memory_read_string_by_offset_ext(
+            memory, string_offset, string_size, INVALID_STRING_OFFSET, &other_string, &other_string_size)
+        != SC_FS_MEMORY_OK)
+      goto error;
 
-    sc_bool go_to_next = SC_FALSE;
-    sc_monitor_acquire_write(channel_monitor);
-    sc_io_channel_seek(strings_channel, normalized_string_offset, SC_FS_IO_SEEK_SET, null_ptr);
+    if (other_string == null_ptr || (to_search_as_prefix && sc_str_has_prefix(other_string, string) == SC_FALSE)
+        || (!to_search_as_prefix && sc_str_find(other_string, string) == SC_FALSE))
     {
-      sc_uint64 other_string_size;
-      if (sc_io_channel_read_chars(
-              strings_channel, (sc_char *)&other_string_size, sizeof(sc_uint64), &read_bytes, null_ptr)
-              != SC_FS_IO_STATUS_NORMAL
-          || sizeof(sc_uint64) != read_bytes)
-        goto error;
-
-      if (other_string_size < string_size)
-      {
-        go_to_next = SC_TRUE;
-        goto cont;
-      }
-
-      sc_char * other_string = sc_mem_new(sc_char, other_string_size + 1);
-      if (sc_io_channel_read_chars(strings_channel, other_string, other_string_size, &read_bytes, null_ptr)
-              != SC_FS_IO_STATUS_NORMAL
-          || other_string_size != read_bytes)
-      {
-        sc_mem_free(other_string);
-        goto error;
-      }
-
-      if ((to_search_as_prefix && sc_str_has_prefix(other_string, string) == SC_FALSE)
-          || (!to_search_as_prefix && sc_str_find(other_string, string) == SC_FALSE))
-      {
-        sc_mem_free(other_string);
-        go_to_next = SC_TRUE;
-        goto cont;
-      }
-
-    cont:
-      sc_monitor_release_write(channel_monitor);
-      if (go_to_next)
-        continue;
-
-      if (link_handler->push_link_content_callback != null_ptr)
-        link_handler->push_link_content_callback(
-            link_handler->push_link_content_callback_data, SC_ADDR_EMPTY, other_string);
       sc_mem_free(other_string);
+      continue;
     }
+
+    if (link_handler->push_link_content_callback != null_ptr)
+      link_handler->push_link_content_callback(
+          link_handler->push_link_content_callback_data, SC_ADDR_EMPTY, other_string);
+    sc_mem_free(other_string);
   }
   sc_iterator_destroy(string_offset_it);
 
   return SC_FS_MEMORY_OK;
 
 error:
-  sc_monitor_release_write(channel_monitor);
   sc_iterator_destroy(string_offset_it);
   return SC_FS_MEMORY_READ_ERROR;
 }
@@ -1084,9 +2153,8 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_strings_by_substring
     return SC_FS_MEMORY_NO;
   }
 
-  sc_char * term = _sc_dictionary_fs_memory_get_first_term(string, memory->term_separators);
-  sc_list * string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_term_prefix(memory, term, link_handler);
-  sc_mem_free(term);
+  sc_list * string_offsets =
+      _sc_dictionary_fs_memory_get_string_offsets_by_substring(memory, string, string_size, link_handler);
 
   sc_dictionary_fs_memory_status const status = _sc_dictionary_fs_memory_get_strings_by_substring_term(
       memory, string, string_size, to_search_as_prefix, string_offsets, link_handler);
@@ -1167,13 +2235,14 @@ void _sc_dictionary_fs_memory_get_string_offsets_by_terms(
   while (sc_iterator_next(term_it))
   {
     sc_char const * term = sc_iterator_get(term_it);
-    sc_uint64 const term_size = sc_str_len(term);
 
-    sc_list * string_offsets = sc_dictionary_get_by_key(memory->terms_string_offsets_dictionary, term, term_size);
+    sc_list * string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_term(memory, term);
     sc_iterator * string_offsets_it = sc_list_iterator(string_offsets);
     if (!sc_iterator_next(string_offsets_it))
     {
       sc_iterator_destroy(string_offsets_it);
+      sc_list_destroy(string_offsets);
+      sc_iterator_destroy(term_it);
       return;
     }
 
@@ -1188,6 +2257,7 @@ void _sc_dictionary_fs_memory_get_string_offsets_by_terms(
           *string_offsets_terms_dictionary, string_offset_str, string_offset_str_size, (void *)term);
     }
     sc_iterator_destroy(string_offsets_it);
+    sc_list_destroy(string_offsets);
   }
   sc_iterator_destroy(term_it);
 }
@@ -1209,14 +2279,18 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_link_hashes_by_terms
     return SC_FS_MEMORY_OK;
 
   sc_dictionary * string_offsets_terms_dictionary;
+  sc_monitor_acquire_read((sc_monitor *)&memory->terms_monitor);
   _sc_dictionary_fs_memory_get_string_offsets_by_terms(memory, terms, &string_offsets_terms_dictionary);
+  sc_monitor_release_read((sc_monitor *)&memory->terms_monitor);
 
   void * arguments[3];
   arguments[0] = (void *)memory;
   arguments[1] = intersect ? (sc_addr_hash_to_sc_pointer)terms->size : 0;
   arguments[2] = *link_hashes;
+  sc_monitor_acquire_read((sc_monitor *)&memory->links_monitor);
   sc_dictionary_fs_memory_status const status = sc_dictionary_visit_down_nodes(
       string_offsets_terms_dictionary, _sc_dictionary_fs_memory_get_link_hashes_by_string_offsets, arguments);
+  sc_monitor_release_read((sc_monitor *)&memory->links_monitor);
   sc_dictionary_destroy(string_offsets_terms_dictionary, _sc_dictionary_fs_memory_node_clear);
   return status;
 }
@@ -1283,7 +2357,9 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_strings_by_terms(
     return SC_FS_MEMORY_OK;
 
   sc_dictionary * term_string_offsets_dictionary;
+  sc_monitor_acquire_read((sc_monitor *)&memory->terms_monitor);
   _sc_dictionary_fs_memory_get_string_offsets_by_terms(memory, terms, &term_string_offsets_dictionary);
+  sc_monitor_release_read((sc_monitor *)&memory->terms_monitor);
 
   void * arguments[3];
   arguments[0] = (void *)memory;
@@ -1349,10 +2425,32 @@ void _sc_dictionary_fs_memory_read_terms_string_offsets(sc_dictionary_fs_memory
   }
 }
 
-sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_load_terms_offsets(sc_dictionary_fs_memory * memory)
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_load_terms_index(sc_dictionary_fs_memory * memory)
 {
-  sc_fs_memory_info("Load `term - offsets` dictionary from %s", memory->terms_string_offsets_path);
-  sc_io_channel * terms_offsets_channel = sc_io_new_read_channel(memory->terms_string_offsets_path, null_ptr);
+  sc_fs_memory_info("Map `term - offsets` index from %s", memory->terms_index_path);
+  if (sc_fs_is_file(memory->terms_index_path) == SC_FALSE)
+  {
+    sc_fs_memory_info("Path `%s` doesn't exist", memory->terms_index_path);
+    return SC_FS_MEMORY_NO;
+  }
+
+  // index is queried in mapped file, so its terms aren't read on load
+  if (!sc_terms_index_open(memory->terms_index, memory->terms_index_path))
+  {
+    sc_fs_memory_warning("Index `term - offsets` is broken");
+    return SC_FS_MEMORY_READ_ERROR;
+  }
+  memory->last_string_offset = memory->terms_index->last_string_offset;
+
+  sc_message("\tTerms count: %" PRIu64, memory->terms_index->terms_count);
+  sc_fs_memory_info("Index `term - offsets` mapped");
+  return SC_FS_MEMORY_OK;
+}
+
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_load_terms_offsets(sc_dictionary_fs_memory * memory)
+{
+  sc_fs_memory_info("Load deprecated `term - offsets` dictionary from %s", memory->terms_string_offsets_path);
+  sc_io_channel * terms_offsets_channel = sc_io_new_read_channel(memory->terms_string_offsets_path, null_ptr);
   if (terms_offsets_channel == null_ptr)
   {
     sc_fs_memory_info("Path `%s` doesn't exist. Nothing to load", memory->terms_string_offsets_path);
@@ -1366,138 +2464,1015 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_load_terms_offsets(sc_di
           != SC_FS_IO_STATUS_NORMAL
       || sizeof(sc_uint64) != read_bytes)
   {
-    sc_io_channel_shutdown(terms_offsets_channel, SC_TRUE, null_ptr);
-    memory->last_string_offset = 0;
-    return SC_FS_MEMORY_OK;
+    sc_io_channel_shutdown(terms_offsets_channel, SC_TRUE, null_ptr);
+    memory->last_string_offset = 0;
+    return SC_FS_MEMORY_OK;
+  }
+
+  _sc_dictionary_fs_memory_read_terms_string_offsets(memory, terms_offsets_channel);
+
+  sc_io_channel_shutdown(terms_offsets_channel, SC_TRUE, null_ptr);
+
+  sc_fs_memory_info("Dictionary `term - offsets` loaded");
+  return SC_FS_MEMORY_OK;
+}
+
+void _sc_dictionary_fs_memory_read_string_offsets_link_hashes(sc_dictionary_fs_memory * memory, sc_io_channel * channel)
+{
+  sc_uint64 read_bytes = 0;
+  while (SC_TRUE)
+  {
+    sc_uint64 string_offset;
+    if (sc_io_channel_read_chars(channel, (sc_char *)&string_offset, sizeof(sc_uint64), &read_bytes, null_ptr)
+            != SC_FS_IO_STATUS_NORMAL
+        || sizeof(sc_uint64) != read_bytes)
+      break;
+
+    sc_uint64 link_hashes_count;
+    if (sc_io_channel_read_chars(channel, (sc_char *)&link_hashes_count, sizeof(sc_uint64), &read_bytes, null_ptr)
+            != SC_FS_IO_STATUS_NORMAL
+        || sizeof(sc_uint64) != read_bytes)
+      break;
+
+    for (sc_uint64 i = 0; i < link_hashes_count; ++i)
+    {
+      sc_addr_hash link_hash;
+      if (sc_io_channel_read_chars(channel, (sc_char *)&link_hash, sizeof(sc_addr_hash), &read_bytes, null_ptr)
+              != SC_FS_IO_STATUS_NORMAL
+          || sizeof(sc_addr_hash) != read_bytes)
+        break;
+
+      _sc_dictionary_fs_memory_append_link_string_unique(memory, link_hash, string_offset);
+    }
+  }
+}
+
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_load_string_offsets_link_hashes(
+    sc_dictionary_fs_memory * memory)
+{
+  sc_fs_memory_info(
+      "Load deprecated `string offsets - link hashes` dictionary from %s", memory->string_offsets_link_hashes_path);
+  sc_io_channel * channel = sc_io_new_read_channel(memory->string_offsets_link_hashes_path, null_ptr);
+  if (channel == null_ptr)
+  {
+    sc_fs_memory_info("Path `%s` doesn't exist. Nothing to load", memory->string_offsets_link_hashes_path);
+    return SC_FS_MEMORY_NO;
+  }
+  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+  _sc_dictionary_fs_memory_read_string_offsets_link_hashes(memory, channel);
+
+  sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
+  sc_fs_memory_info("Dictionary `string offsets - link hashes` loaded");
+
+  return SC_FS_MEMORY_OK;
+}
+
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_load_link_hashes_string_offsets(
+    sc_dictionary_fs_memory * memory)
+{
+  sc_fs_memory_info("Load `link hashes - string offsets` map from %s", memory->link_hashes_string_offsets_path);
+  sc_io_channel * channel = sc_io_new_read_channel(memory->link_hashes_string_offsets_path, null_ptr);
+  if (channel == null_ptr)
+  {
+    sc_fs_memory_info("Path `%s` doesn't exist. Nothing to load", memory->link_hashes_string_offsets_path);
+    return SC_FS_MEMORY_NO;
+  }
+  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+  sc_uint64 read_bytes = 0;
+  sc_uint64 links_count = 0;
+  if (sc_io_channel_read_chars(channel, (sc_char *)&links_count, sizeof(sc_uint64), &read_bytes, null_ptr)
+          != SC_FS_IO_STATUS_NORMAL
+      || sizeof(sc_uint64) != read_bytes)
+    links_count = 0;
+
+  sc_hash_map_reserve(memory->link_hashes_string_offsets_map, links_count);
+  for (sc_uint64 i = 0; i < links_count; ++i)
+  {
+    sc_addr_hash link_hash;
+    if (sc_io_channel_read_chars(channel, (sc_char *)&link_hash, sizeof(sc_addr_hash), &read_bytes, null_ptr)
+            != SC_FS_IO_STATUS_NORMAL
+        || sizeof(sc_addr_hash) != read_bytes)
+      break;
+
+    sc_uint64 string_offset;
+    if (sc_io_channel_read_chars(channel, (sc_char *)&string_offset, sizeof(sc_uint64), &read_bytes, null_ptr)
+            != SC_FS_IO_STATUS_NORMAL
+        || sizeof(sc_uint64) != read_bytes)
+      break;
+
+    _sc_dictionary_fs_memory_append_link_string_unique(memory, link_hash, string_offset);
+  }
+
+  sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
+  sc_fs_memory_info("Map `link hashes - string offsets` loaded");
+
+  return SC_FS_MEMORY_OK;
+}
+
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_load_strings_blocks(sc_dictionary_fs_memory * memory)
+{
+  sc_fs_memory_info("Load strings blocks index from %s", memory->strings_blocks_index_path);
+  sc_io_channel * channel = sc_io_new_read_channel(memory->strings_blocks_index_path, null_ptr);
+  if (channel == null_ptr)
+  {
+    sc_fs_memory_info("Path `%s` doesn't exist. Nothing to load", memory->strings_blocks_index_path);
+    return SC_FS_MEMORY_NO;
+  }
+  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+  sc_bool const is_read = sc_strings_blocks_read_index(memory->strings_blocks, channel);
+  sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
+  if (!is_read)
+  {
+    sc_fs_memory_error("Strings blocks index is broken");
+    return SC_FS_MEMORY_READ_ERROR;
+  }
+
+  // strings in strings channels follow strings in blocks
+  memory->strings_offset = memory->strings_blocks->strings_size;
+
+  sc_fs_memory_info("Strings blocks index loaded");
+  return SC_FS_MEMORY_OK;
+}
+
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_load_string_hashes_string_offsets(
+    sc_dictionary_fs_memory * memory)
+{
+  sc_fs_memory_info("Load `string hashes - string offsets` map from %s", memory->string_hashes_string_offsets_path);
+  sc_io_channel * channel = sc_io_new_read_channel(memory->string_hashes_string_offsets_path, null_ptr);
+  if (channel == null_ptr)
+  {
+    sc_fs_memory_info("Path `%s` doesn't exist. Nothing to load", memory->string_hashes_string_offsets_path);
+    return SC_FS_MEMORY_NO;
+  }
+  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+  sc_uint64 read_bytes = 0;
+  sc_uint64 strings_count = 0;
+  if (sc_io_channel_read_chars(channel, (sc_char *)&strings_count, sizeof(sc_uint64), &read_bytes, null_ptr)
+          != SC_FS_IO_STATUS_NORMAL
+      || sizeof(sc_uint64) != read_bytes)
+    strings_count = 0;
+
+  sc_hash_map_reserve(memory->string_hashes_string_offsets_map, strings_count);
+  for (sc_uint64 i = 0; i < strings_count; ++i)
+  {
+    sc_uint64 string_hash;
+    if (sc_io_channel_read_chars(channel, (sc_char *)&string_hash, sizeof(sc_uint64), &read_bytes, null_ptr)
+            != SC_FS_IO_STATUS_NORMAL
+        || sizeof(sc_uint64) != read_bytes)
+      break;
+
+    sc_uint64 string_offset;
+    if (sc_io_channel_read_chars(channel, (sc_char *)&string_offset, sizeof(sc_uint64), &read_bytes, null_ptr)
+            != SC_FS_IO_STATUS_NORMAL
+        || sizeof(sc_uint64) != read_bytes)
+      break;
+
+    sc_hash_map_insert(memory->string_hashes_string_offsets_map, string_hash, (void *)(string_offset + 1));
+  }
+
+  sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
+  sc_fs_memory_info("Map `string hashes - string offsets` loaded");
+
+  return SC_FS_MEMORY_OK;
+}
+
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_load_blobs_sizes(sc_dictionary_fs_memory * memory)
+{
+  if (sc_fs_is_directory(memory->blobs_path) == SC_FALSE)
+    return SC_FS_MEMORY_OK;
+
+  GDir * directory = g_dir_open(memory->blobs_path, 0, null_ptr);
+  if (directory == null_ptr)
+  {
+    sc_fs_memory_error("Path `%s` is not correct", memory->blobs_path);
+    return SC_FS_MEMORY_READ_ERROR;
+  }
+
+  sc_char const * file_name;
+  while ((file_name = g_dir_read_name(directory)) != null_ptr)
+  {
+    // blobs are named by link hashes
+    sc_char * file_name_end;
+    sc_addr_hash const link_hash = strtoul(file_name, &file_name_end, 10);
+    if (file_name_end == file_name || strcmp(file_name_end, SC_FS_EXT) != 0)
+      continue;
+
+    sc_char * blob_path;
+    sc_fs_concat_path(memory->blobs_path, file_name, &blob_path);
+    sc_uint64 blob_size;
+    if (sc_fs_get_file_size(blob_path, &blob_size))
+      sc_hash_map_insert(memory->link_hashes_blobs_sizes_map, link_hash, (void *)(blob_size + 1));
+    sc_mem_free(blob_path);
+  }
+  g_dir_close(directory);
+
+  sc_message("\tBlobs count: %" PRIu64, memory->link_hashes_blobs_sizes_map->size);
+  return SC_FS_MEMORY_OK;
+}
+
+sc_fs_memory_status _sc_dictionary_fs_memory_load_deprecated_dictionaries(sc_dictionary_fs_memory * memory)
+{
+  sc_char * strings_path;
+  {
+    static sc_char const * strings_channel_name = "strings";
+    sc_fs_concat_path_ext(memory->path, strings_channel_name, SC_FS_EXT, &strings_path);
+  }
+
+  if (sc_fs_is_file(strings_path) == SC_FALSE)
+  {
+    sc_mem_free(strings_path);
+    return SC_FS_MEMORY_WRONG_PATH;
+  }
+
+  sc_fs_memory_warning("Load deprecated file memory dictionary from %s", strings_path);
+  sc_io_channel * channel = sc_io_new_read_channel(strings_path, null_ptr);
+  if (channel == null_ptr)
+  {
+    sc_fs_memory_error("Can't open strings from: %s", strings_path);
+    return SC_FS_MEMORY_WRONG_PATH;
+  }
+  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+  sc_uint64 read_bytes = 0;
+  while (SC_TRUE)
+  {
+    sc_uint8 hashes_size = 0;
+    if (sc_io_channel_read_chars(channel, (sc_char *)&hashes_size, sizeof(hashes_size), &read_bytes, null_ptr)
+        != SC_FS_IO_STATUS_NORMAL)
+      break;
+
+    sc_addr_hash * hashes = sc_mem_new(sc_addr_hash, hashes_size);
+    if (sc_io_channel_read_chars(channel, (sc_char *)hashes, sizeof(sc_addr_hash) * hashes_size, &read_bytes, null_ptr)
+        != SC_FS_IO_STATUS_NORMAL)
+      break;
+
+    sc_uint32 string_size = 0;
+    if (sc_io_channel_read_chars(channel, (sc_char *)&string_size, sizeof(string_size), &read_bytes, null_ptr)
+        != SC_FS_IO_STATUS_NORMAL)
+      break;
+
+    sc_char * string = sc_mem_new(sc_char, string_size + 1);
+    if (sc_io_channel_read_chars(channel, (sc_char *)string, string_size, &read_bytes, null_ptr)
+        != SC_FS_IO_STATUS_NORMAL)
+      break;
+
+    sc_uint8 i;
+    for (i = 0; i < hashes_size; ++i)
+    {
+      if (hashes[i] == 0)
+        continue;
+
+      sc_dictionary_fs_memory_link_string(memory, hashes[i], string, string_size);
+    }
+
+    sc_mem_free(hashes);
+    sc_mem_free(string);
+  }
+
+  sc_io_channel_shutdown(channel, SC_FALSE, null_ptr);
+
+  sc_fs_remove_file(strings_path);
+  sc_mem_free(strings_path);
+
+  sc_fs_memory_warning("Deprecated file memory dictionary loaded");
+
+  return SC_FS_MEMORY_OK;
+}
+
+sc_bool _sc_dictionary_fs_memory_collect_term_string_offsets(sc_dictionary_node * node, void ** arguments)
+{
+  if (node->data == null_ptr)
+    return SC_TRUE;
+
+  sc_hash_map * string_offsets = arguments[0];
+
+  // the first item of list is term
+  sc_iterator * it = sc_list_iterator(node->data);
+  sc_iterator_next(it);
+  while (sc_iterator_next(it))
+    sc_hash_map_insert(string_offsets, (sc_uint64)sc_iterator_get(it), (void *)SC_TRUE);
+  sc_iterator_destroy(it);
+
+  return SC_TRUE;
+}
+
+sc_bool _sc_dictionary_fs_memory_collect_index_term_string_offsets(
+    sc_char const * term,
+    sc_uint32 term_size,
+    sc_uint64 const * string_offsets,
+    sc_uint64 string_offsets_count,
+    void ** arguments)
+{
+  (void)term;
+  (void)term_size;
+  sc_hash_map * string_offsets_set = arguments[0];
+
+  for (sc_uint64 i = 0; i < string_offsets_count; ++i)
+    sc_hash_map_insert(string_offsets_set, string_offsets[i], (void *)SC_TRUE);
+
+  return SC_TRUE;
+}
+
+//! Collects offsets of strings with terms from index with terms and from dictionary with terms added after its saving
+void _sc_dictionary_fs_memory_collect_terms_string_offsets(
+    sc_dictionary_fs_memory const * memory,
+    sc_hash_map * string_offsets)
+{
+  sc_terms_index_visit_by_prefix(
+      memory->terms_index,
+      "",
+      0,
+      _sc_dictionary_fs_memory_collect_index_term_string_offsets,
+      (void **)&string_offsets);
+  sc_dictionary_visit_down_nodes(
+      memory->terms_string_offsets_dictionary,
+      _sc_dictionary_fs_memory_collect_term_string_offsets,
+      (void **)&string_offsets);
+}
+
+sc_bool _sc_dictionary_fs_memory_push_string_offset(sc_uint64 string_offset, void * value, void ** arguments)
+{
+  (void)value;
+  sc_uint64 * string_offsets = arguments[0];
+  sc_uint64 * string_offsets_count = arguments[1];
+  string_offsets[(*string_offsets_count)++] = string_offset;
+  return SC_TRUE;
+}
+
+int _sc_dictionary_fs_memory_compare_string_offsets(void const * string_offset, void const * other_string_offset)
+{
+  sc_uint64 const first = *(sc_uint64 const *)string_offset;
+  sc_uint64 const second = *(sc_uint64 const *)other_string_offset;
+  return (first > second) - (first < second);
+}
+
+void _sc_dictionary_fs_memory_rebuild_ngrams_string_offsets(sc_dictionary_fs_memory * memory)
+{
+  sc_fs_memory_info("Build n-grams index by strings from `term - offsets` dictionary");
+
+  sc_hash_map * string_offsets_map;
+  sc_hash_map_initialize(&string_offsets_map, 0);
+  _sc_dictionary_fs_memory_collect_terms_string_offsets(memory, string_offsets_map);
+
+  // strings are appended in order of their offsets, so postings are only appended
+  sc_uint64 string_offsets_count = 0;
+  sc_uint64 * string_offsets = sc_mem_new(sc_uint64, string_offsets_map->size + 1);
+  void * arguments[2];
+  arguments[0] = string_offsets;
+  arguments[1] = &string_offsets_count;
+  sc_hash_map_visit(string_offsets_map, _sc_dictionary_fs_memory_push_string_offset, arguments);
+  sc_hash_map_destroy(string_offsets_map, null_ptr);
+  qsort(string_offsets, string_offsets_count, sizeof(sc_uint64), _sc_dictionary_fs_memory_compare_string_offsets);
+
+  for (sc_uint64 i = 0; i < string_offsets_count; ++i)
+  {
+    sc_char * string;
+    if (_sc_dictionary_fs_memory_read_string_by_offset(memory, string_offsets[i], &string) != SC_FS_MEMORY_OK)
+      continue;
+
+    sc_ngrams_index_append(memory->ngrams_index, string, sc_str_len(string), string_offsets[i]);
+    sc_mem_free(string);
+  }
+  sc_mem_free(string_offsets);
+
+  sc_fs_memory_info("N-grams index built by %" PRIu64 " strings", string_offsets_count);
+}
+
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_load_ngrams_string_offsets(sc_dictionary_fs_memory * memory)
+{
+  if (!memory->search_by_substring)
+    return SC_FS_MEMORY_NO;
+
+  sc_fs_memory_info("Load `n-grams - string offsets` index from %s", memory->ngrams_string_offsets_path);
+  sc_io_channel * channel = sc_io_new_read_channel(memory->ngrams_string_offsets_path, null_ptr);
+  if (channel != null_ptr)
+  {
+    sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+    sc_bool const is_read = sc_ngrams_index_read(memory->ngrams_index, channel);
+    sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
+
+    if (is_read)
+    {
+      sc_fs_memory_info("Index `n-grams - string offsets` loaded");
+      return SC_FS_MEMORY_OK;
+    }
+
+    sc_fs_memory_warning("Index `n-grams - string offsets` is broken");
+    sc_ngrams_index_destroy(memory->ngrams_index);
+    sc_ngrams_index_initialize(&memory->ngrams_index);
+  }
+  else
+    sc_fs_memory_info("Path `%s` doesn't exist", memory->ngrams_string_offsets_path);
+
+  // index may be absent in fs-memory saved by previous versions, so it is built by terms dictionary
+  _sc_dictionary_fs_memory_rebuild_ngrams_string_offsets(memory);
+  return SC_FS_MEMORY_OK;
+}
+
+sc_bool _sc_dictionary_fs_memory_collect_link_string_offset(sc_uint64 link_hash, void * data, void ** arguments)
+{
+  (void)link_hash;
+  sc_hash_map * string_offsets = arguments[0];
+  sc_link_hash_content const * content = data;
+  sc_hash_map_insert(string_offsets, content->string_offset - 1, (void *)SC_TRUE);
+  return SC_TRUE;
+}
+
+sc_bool _sc_dictionary_fs_memory_collect_string_hash_string_offset(
+    sc_uint64 string_hash,
+    void * data,
+    void ** arguments)
+{
+  (void)string_hash;
+  sc_hash_map * string_offsets = arguments[0];
+  sc_hash_map_insert(string_offsets, (sc_uint64)data - 1, (void *)SC_TRUE);
+  return SC_TRUE;
+}
+
+sc_bool _sc_dictionary_fs_memory_collect_added_terms(sc_dictionary_node * node, void ** arguments)
+{
+  if (node->data == null_ptr)
+    return SC_TRUE;
+
+  sc_list * terms_string_offsets = arguments[0];
+  sc_list_push_back(terms_string_offsets, node->data);
+  return SC_TRUE;
+}
+
+int _sc_dictionary_fs_memory_compare_terms_string_offsets(
+    void const * term_string_offsets,
+    void const * other_term_string_offsets)
+{
+  // the first item of list is term
+  sc_char const * term = (*(sc_list * const *)term_string_offsets)->begin->data;
+  sc_char const * other_term = (*(sc_list * const *)other_term_string_offsets)->begin->data;
+  return sc_terms_index_compare_terms(term, sc_str_len(term), other_term, sc_str_len(other_term));
+}
+
+/*! Writes term with string offsets from index with terms and from dictionary with terms added after its saving
+ * @param writer A sc-terms-index-writer pointer
+ * @param term A term to write
+ * @param term_size A term size
+ * @param index_string_offsets Offsets of strings with term from index with terms
+ * @param index_string_offsets_count A count of offsets of strings with term from index with terms
+ * @param added_string_offsets A list with term and offsets of strings added after index saving, it may be null_ptr
+ * @param string_offsets_map A map with string offsets and their new offsets + 1, it may be null_ptr to write offsets
+ * as is. String offsets without new ones are removed, terms without string offsets aren't written.
+ * @returns Returns SC_TRUE, if term is written.
+ */
+sc_bool _sc_dictionary_fs_memory_write_index_term(
+    sc_terms_index_writer * writer,
+    sc_char const * term,
+    sc_uint64 term_size,
+    sc_uint64 const * index_string_offsets,
+    sc_uint64 index_string_offsets_count,
+    sc_list const * added_string_offsets,
+    sc_hash_map const * string_offsets_map)
+{
+  sc_uint64 const added_string_offsets_count = added_string_offsets == null_ptr ? 0 : added_string_offsets->size - 1;
+  sc_uint64 * string_offsets = sc_mem_new(sc_uint64, (index_string_offsets_count + added_string_offsets_count + 1));
+  sc_uint64 string_offsets_count = 0;
+
+  for (sc_uint64 i = 0; i < index_string_offsets_count; ++i)
+    string_offsets[string_offsets_count++] = index_string_offsets[i];
+
+  sc_iterator * it = sc_list_iterator(added_string_offsets);
+  if (sc_iterator_next(it))
+  {
+    while (sc_iterator_next(it))
+      string_offsets[string_offsets_count++] = (sc_uint64)sc_iterator_get(it);
+  }
+  sc_iterator_destroy(it);
+
+  if (string_offsets_map != null_ptr)
+  {
+    sc_uint64 remapped_string_offsets_count = 0;
+    for (sc_uint64 i = 0; i < string_offsets_count; ++i)
+    {
+      sc_uint64 const string_offset = (sc_uint64)sc_hash_map_get(string_offsets_map, string_offsets[i]);
+      if (string_offset != 0)
+        string_offsets[remapped_string_offsets_count++] = string_offset - 1;
+    }
+    string_offsets_count = remapped_string_offsets_count;
+  }
+
+  sc_bool const is_written =
+      string_offsets_count == 0
+      || sc_terms_index_writer_append(writer, term, term_size, string_offsets, string_offsets_count);
+  sc_mem_free(string_offsets);
+  return is_written;
+}
+
+sc_bool _sc_dictionary_fs_memory_merge_index_term_with_added_terms(
+    sc_char const * term,
+    sc_uint32 term_size,
+    sc_uint64 const * string_offsets,
+    sc_uint64 string_offsets_count,
+    void ** arguments)
+{
+  sc_terms_index_writer * writer = arguments[0];
+  sc_list ** added_terms = arguments[1];
+  sc_uint64 const added_terms_count = *(sc_uint64 *)arguments[2];
+  sc_uint64 * added_term_i = arguments[3];
+  sc_hash_map const * string_offsets_map = arguments[4];
+
+  // added terms are sorted as terms of index, so they are merged in one pass
+  sc_list const * added_string_offsets = null_ptr;
+  for (; *added_term_i < added_terms_count; ++*added_term_i)
+  {
+    sc_list const * added_term_string_offsets = added_terms[*added_term_i];
+    sc_char const * added_term = added_term_string_offsets->begin->data;
+    sc_uint64 const added_term_size = sc_str_len(added_term);
+
+    sc_int32 const result = sc_terms_index_compare_terms(added_term, added_term_size, term, term_size);
+    if (result > 0)
+      break;
+
+    if (result == 0)
+    {
+      added_string_offsets = added_term_string_offsets;
+      ++*added_term_i;
+      break;
+    }
+
+    if (!_sc_dictionary_fs_memory_write_index_term(
+            writer, added_term, added_term_size, null_ptr, 0, added_term_string_offsets, string_offsets_map))
+      return SC_FALSE;
+  }
+
+  return _sc_dictionary_fs_memory_write_index_term(
+      writer, term, term_size, string_offsets, string_offsets_count, added_string_offsets, string_offsets_map);
+}
+
+/*! Writes new index with terms from index with terms and from dictionary with terms added after its saving, maps it
+ * and clears dictionary with added terms. Memory must be locked by terms monitor for writing.
+ * @param memory A sc-dictionary-fs-memory pointer
+ * @param string_offsets_map A map with string offsets and their new offsets + 1, it may be null_ptr to write offsets
+ * as is
+ * @returns Returns SC_FS_MEMORY_OK, if index is written and mapped.
+ */
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_write_terms_index(
+    sc_dictionary_fs_memory * memory,
+    sc_hash_map const * string_offsets_map)
+{
+  sc_list * added_terms_list;
+  sc_list_init(&added_terms_list);
+  sc_dictionary_visit_down_nodes(
+      memory->terms_string_offsets_dictionary,
+      _sc_dictionary_fs_memory_collect_added_terms,
+      (void **)&added_terms_list);
+
+  sc_uint64 const last_string_offset = sc_atomic_uint64_get(&memory->last_string_offset);
+
+  // mapped index is rewritten only if it is changed
+  if (added_terms_list->size == 0 && string_offsets_map == null_ptr && memory->terms_index->file != null_ptr
+      && memory->terms_index->last_string_offset == last_string_offset)
+  {
+    sc_list_destroy(added_terms_list);
+    return SC_FS_MEMORY_OK;
+  }
+
+  sc_uint64 added_terms_count = 0;
+  sc_list ** added_terms = sc_mem_new(sc_list *, (added_terms_list->size + 1));
+  sc_iterator * it = sc_list_iterator(added_terms_list);
+  while (sc_iterator_next(it))
+    added_terms[added_terms_count++] = sc_iterator_get(it);
+  sc_iterator_destroy(it);
+  sc_list_destroy(added_terms_list);
+  qsort(added_terms, added_terms_count, sizeof(sc_list *), _sc_dictionary_fs_memory_compare_terms_string_offsets);
+
+  sc_char * new_terms_index_path;
+  static sc_char const * new_terms_index = "new_terms_index" SC_FS_EXT;
+  sc_fs_concat_path(memory->path, new_terms_index, &new_terms_index_path);
+
+  sc_terms_index_writer * writer;
+  if (!sc_terms_index_writer_initialize(&writer, new_terms_index_path))
+  {
+    sc_fs_memory_error("Path `%s` is not correct", new_terms_index_path);
+    sc_mem_free(new_terms_index_path);
+    sc_mem_free(added_terms);
+    return SC_FS_MEMORY_WRITE_ERROR;
+  }
+
+  sc_uint64 added_term_i = 0;
+  void * arguments[5];
+  arguments[0] = writer;
+  arguments[1] = added_terms;
+  arguments[2] = &added_terms_count;
+  arguments[3] = &added_term_i;
+  arguments[4] = (void *)string_offsets_map;
+  sc_bool is_written = sc_terms_index_visit_by_prefix(
+      memory->terms_index, "", 0, _sc_dictionary_fs_memory_merge_index_term_with_added_terms, arguments);
+  for (; is_written && added_term_i < added_terms_count; ++added_term_i)
+  {
+    sc_char const * added_term = added_terms[added_term_i]->begin->data;
+    is_written = _sc_dictionary_fs_memory_write_index_term(
+        writer, added_term, sc_str_len(added_term), null_ptr, 0, added_terms[added_term_i], string_offsets_map);
+  }
+  sc_mem_free(added_terms);
+
+  if (!sc_terms_index_writer_destroy(writer, last_string_offset, is_written))
+  {
+    sc_fs_memory_error("Error while index `term - offsets` writing");
+    sc_fs_remove_file(new_terms_index_path);
+    sc_mem_free(new_terms_index_path);
+    return SC_FS_MEMORY_WRITE_ERROR;
+  }
+
+  // previous index is unmapped before its file is replaced
+  sc_terms_index_close(memory->terms_index);
+  sc_fs_rename_file(new_terms_index_path, memory->terms_index_path);
+  sc_mem_free(new_terms_index_path);
+  if (!sc_terms_index_open(memory->terms_index, memory->terms_index_path))
+  {
+    sc_fs_memory_error("Index `term - offsets` can't be mapped from %s", memory->terms_index_path);
+    return SC_FS_MEMORY_READ_ERROR;
+  }
+
+  sc_dictionary_destroy(memory->terms_string_offsets_dictionary, _sc_dictionary_fs_memory_node_clear);
+  _sc_uchar_dictionary_initialize(&memory->terms_string_offsets_dictionary);
+
+  // terms are loaded from deprecated dictionary file only if there is no index file
+  if (sc_fs_is_file(memory->terms_string_offsets_path))
+    sc_fs_remove_file(memory->terms_string_offsets_path);
+
+  return SC_FS_MEMORY_OK;
+}
+
+sc_bool _sc_dictionary_fs_memory_remap_link_string_offset(sc_uint64 link_hash, void * data, void ** arguments)
+{
+  sc_hash_map const * string_offsets_map = arguments[0];
+  sc_dictionary * string_offsets_link_hashes_dictionary = arguments[1];
+  sc_link_hash_content * content = data;
+
+  content->string_offset = (sc_uint64)sc_hash_map_get(string_offsets_map, content->string_offset - 1);
+
+  sc_char string_offset_str[DEFAULT_STRING_INT_SIZE];
+  sc_uint64 string_offset_str_size;
+  sc_int_to_str_int(content->string_offset - 1, string_offset_str, string_offset_str_size);
+  sc_list * link_hashes =
+      sc_dictionary_get_by_key(string_offsets_link_hashes_dictionary, string_offset_str, string_offset_str_size);
+  if (link_hashes == null_ptr)
+  {
+    sc_list_init(&link_hashes);
+    sc_dictionary_append(
+        string_offsets_link_hashes_dictionary, string_offset_str, string_offset_str_size, link_hashes);
+  }
+
+  content->link_hashes = link_hashes;
+  sc_list_push_back(link_hashes, (sc_addr_hash_to_sc_pointer)link_hash);
+  return SC_TRUE;
+}
+
+sc_bool _sc_dictionary_fs_memory_remap_string_hash_string_offset(
+    sc_uint64 string_hash,
+    void * data,
+    void ** arguments)
+{
+  sc_hash_map const * string_offsets_map = arguments[0];
+  sc_hash_map * string_hashes_string_offsets_map = arguments[1];
+
+  sc_uint64 const string_offset = (sc_uint64)sc_hash_map_get(string_offsets_map, (sc_uint64)data - 1);
+  if (string_offset != 0)
+    sc_hash_map_insert(string_hashes_string_offsets_map, string_hash, (void *)string_offset);
+  return SC_TRUE;
+}
+
+/*! Replaces offsets of packed strings in all dictionaries by their offsets in strings blocks, offsets of not linked
+ * strings are removed.
+ * @param memory A sc-dictionary-fs-memory pointer
+ * @param string_offsets_map A map with string offsets and their new offsets + 1
+ * @param string_hashes_string_offsets_map A map with hashes of strings, that haven't had hashes, and their offsets + 1
+ * @returns Returns SC_FS_MEMORY_OK, if index with terms is rewritten with new string offsets.
+ */
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_remap_string_offsets(
+    sc_dictionary_fs_memory * memory,
+    sc_hash_map const * string_offsets_map,
+    sc_hash_map * string_hashes_string_offsets_map)
+{
+  // index with terms is read-only, so it is rewritten with new string offsets
+  sc_dictionary_fs_memory_status const status = _sc_dictionary_fs_memory_write_terms_index(memory, string_offsets_map);
+  if (status != SC_FS_MEMORY_OK)
+  {
+    sc_hash_map_destroy(string_hashes_string_offsets_map, null_ptr);
+    return status;
   }
 
-  _sc_dictionary_fs_memory_read_terms_string_offsets(memory, terms_offsets_channel);
+  void * arguments[2];
+  arguments[0] = (void *)string_offsets_map;
 
-  sc_io_channel_shutdown(terms_offsets_channel, SC_TRUE, null_ptr);
+  sc_dictionary * string_offsets_link_hashes_dictionary;
+  _sc_number_dictionary_initialize(&string_offsets_link_hashes_dictionary);
+  arguments[1] = string_offsets_link_hashes_dictionary;
+  sc_hash_map_visit(
+      memory->link_hashes_string_offsets_map, _sc_dictionary_fs_memory_remap_link_string_offset, arguments);
+  sc_dictionary_destroy(memory->string_offsets_link_hashes_dictionary, _sc_dictionary_fs_memory_link_node_clear);
+  memory->string_offsets_link_hashes_dictionary = string_offsets_link_hashes_dictionary;
 
-  sc_fs_memory_info("Dictionary `term - offsets` loaded");
+  sc_ngrams_index_remap(memory->ngrams_index, string_offsets_map);
+
+  arguments[1] = string_hashes_string_offsets_map;
+  sc_hash_map_visit(
+      memory->string_hashes_string_offsets_map,
+      _sc_dictionary_fs_memory_remap_string_hash_string_offset,
+      arguments);
+  sc_hash_map_destroy(memory->string_hashes_string_offsets_map, null_ptr);
+  memory->string_hashes_string_offsets_map = string_hashes_string_offsets_map;
   return SC_FS_MEMORY_OK;
 }
 
-void _sc_dictionary_fs_memory_read_string_offsets_link_hashes(sc_dictionary_fs_memory * memory, sc_io_channel * channel)
+//! Closes strings channels and removes their files, all their linked strings must be packed into strings blocks
+void _sc_dictionary_fs_memory_remove_strings_channels(sc_dictionary_fs_memory * memory)
 {
-  sc_uint64 read_bytes = 0;
-  while (SC_TRUE)
+  for (sc_uint64 i = 0; i < memory->max_strings_channels; ++i)
   {
-    sc_uint64 string_offset;
-    if (sc_io_channel_read_chars(channel, (sc_char *)&string_offset, sizeof(sc_uint64), &read_bytes, null_ptr)
-            != SC_FS_IO_STATUS_NORMAL
-        || sizeof(sc_uint64) != read_bytes)
-      break;
+    if (memory->strings_channels[i] != null_ptr)
+    {
+      sc_io_channel_shutdown(memory->strings_channels[i], SC_TRUE, null_ptr);
+      memory->strings_channels[i] = null_ptr;
+    }
 
-    sc_uint64 link_hashes_count;
-    if (sc_io_channel_read_chars(channel, (sc_char *)&link_hashes_count, sizeof(sc_uint64), &read_bytes, null_ptr)
-            != SC_FS_IO_STATUS_NORMAL
-        || sizeof(sc_uint64) != read_bytes)
-      break;
+    sc_char strings_channel_name[DEFAULT_STRING_INT_SIZE + 8];
+    snprintf(strings_channel_name, sizeof(strings_channel_name), "strings%" PRIu64, i + 1);
+    sc_char * strings_path;
+    sc_fs_concat_path_ext(memory->path, strings_channel_name, SC_FS_EXT, &strings_path);
 
-    for (sc_uint64 i = 0; i < link_hashes_count; ++i)
-    {
-      sc_addr_hash link_hash;
-      if (sc_io_channel_read_chars(channel, (sc_char *)&link_hash, sizeof(sc_addr_hash), &read_bytes, null_ptr)
-              != SC_FS_IO_STATUS_NORMAL
-          || sizeof(sc_addr_hash) != read_bytes)
-        break;
+    // strings channels are created one by one
+    sc_bool const is_path = sc_fs_is_file(strings_path);
+    if (is_path)
+      sc_fs_remove_file(strings_path);
+    sc_mem_free(strings_path);
 
-      _sc_dictionary_fs_memory_append_link_string_unique(memory, link_hash, string_offset);
-    }
+    if (!is_path)
+      break;
   }
 }
 
-sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_load_string_offsets_link_hashes(
-    sc_dictionary_fs_memory * memory)
+//! Gets path of file with the same name as file by path, but prefixed by `packed_`, to write it while packing
+void _sc_dictionary_fs_memory_get_packed_path(
+    sc_dictionary_fs_memory const * memory,
+    sc_char const * path,
+    sc_char ** packed_path)
 {
-  sc_fs_memory_info("Load `term - offsets` dictionary from %s", memory->string_offsets_link_hashes_path);
-  sc_io_channel * channel = sc_io_new_read_channel(memory->string_offsets_link_hashes_path, null_ptr);
-  if (channel == null_ptr)
-  {
-    sc_fs_memory_info("Path `%s` doesn't exist. Nothing to load", memory->string_offsets_link_hashes_path);
-    return SC_FS_MEMORY_NO;
-  }
-  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
-
-  _sc_dictionary_fs_memory_read_string_offsets_link_hashes(memory, channel);
-
-  sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
-  sc_fs_memory_info("Dictionary `string offsets - link hashes` loaded");
-
-  return SC_FS_MEMORY_OK;
+  sc_char const * name = path + sc_str_len(memory->path) + 1;
+  sc_fs_concat_path_ext(memory->path, "packed_", name, packed_path);
 }
 
-sc_fs_memory_status _sc_dictionary_fs_memory_load_deprecated_dictionaries(sc_dictionary_fs_memory * memory)
+/*! Packs linked strings from strings channels into strings blocks and removes strings channels. If most of strings
+ * in strings blocks aren't linked, all linked strings are packed into new strings blocks. Dictionaries with new
+ * string offsets and new strings blocks are written into packed files, that replace previous files only after all of
+ * them are written, and previous strings blocks are replaced last.
+ * @param memory A sc-dictionary-fs-memory pointer with loaded dictionaries
+ * @returns Returns SC_FS_MEMORY_OK, if strings are packed, or SC_FS_MEMORY_NO, if there is nothing to pack.
+ */
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_pack_strings(sc_dictionary_fs_memory * memory)
 {
-  sc_char * strings_path;
+  sc_strings_blocks * blocks = memory->strings_blocks;
+  sc_uint64 const strings_offset = memory->strings_offset;
+
+  // strings are packed in order of their offsets, so order of string offsets in dictionaries isn't changed
+  sc_uint64 string_offsets_count = 0;
+  sc_uint64 * string_offsets;
   {
-    static sc_char const * strings_channel_name = "strings";
-    sc_fs_concat_path_ext(memory->path, strings_channel_name, SC_FS_EXT, &strings_path);
+    sc_hash_map * string_offsets_set;
+    sc_hash_map_initialize(&string_offsets_set, 0);
+    sc_hash_map_visit(
+        memory->link_hashes_string_offsets_map,
+        _sc_dictionary_fs_memory_collect_link_string_offset,
+        (void **)&string_offsets_set);
+
+    string_offsets = sc_mem_new(sc_uint64, string_offsets_set->size + 1);
+    void * arguments[2];
+    arguments[0] = string_offsets;
+    arguments[1] = &string_offsets_count;
+    sc_hash_map_visit(string_offsets_set, _sc_dictionary_fs_memory_push_string_offset, arguments);
+    sc_hash_map_destroy(string_offsets_set, null_ptr);
+    qsort(string_offsets, string_offsets_count, sizeof(sc_uint64), _sc_dictionary_fs_memory_compare_string_offsets);
   }
 
-  if (sc_fs_is_file(strings_path) == SC_FALSE)
+  sc_uint64 blocks_strings_count = 0;
+  for (sc_uint64 i = 0; i < blocks->blocks_count; ++i)
+    blocks_strings_count += blocks->blocks[i].strings_count;
+  sc_uint64 linked_blocks_strings_count = 0;
+  while (linked_blocks_strings_count < string_offsets_count
+         && string_offsets[linked_blocks_strings_count] < strings_offset)
+    ++linked_blocks_strings_count;
+
+  sc_bool const to_repack = (blocks_strings_count - linked_blocks_strings_count) * 4 > blocks_strings_count;
+  if (!to_repack && memory->last_string_offset == strings_offset)
   {
-    sc_mem_free(strings_path);
-    return SC_FS_MEMORY_WRONG_PATH;
+    sc_mem_free(string_offsets);
+    return SC_FS_MEMORY_NO;
   }
 
-  sc_fs_memory_warning("Load deprecated file memory dictionary from %s", strings_path);
-  sc_io_channel * channel = sc_io_new_read_channel(strings_path, null_ptr);
-  if (channel == null_ptr)
+  sc_fs_memory_info(
+      "Pack %" PRIu64 " strings into %s strings blocks",
+      to_repack ? string_offsets_count : string_offsets_count - linked_blocks_strings_count,
+      to_repack ? "new" : "existing");
+
+  sc_strings_blocks * new_blocks = blocks;
+  sc_char * new_blocks_path = null_ptr;
+  if (to_repack)
   {
-    sc_fs_memory_error("Can't open strings from: %s", strings_path);
-    return SC_FS_MEMORY_WRONG_PATH;
+    _sc_dictionary_fs_memory_get_packed_path(memory, memory->strings_blocks_path, &new_blocks_path);
+    if (sc_fs_is_file(new_blocks_path))
+      sc_fs_remove_file(new_blocks_path);
+
+    if (!sc_strings_blocks_initialize(&new_blocks, new_blocks_path))
+    {
+      sc_fs_memory_error("Path `%s` is not correct", new_blocks_path);
+      sc_mem_free(new_blocks_path);
+      sc_mem_free(string_offsets);
+      return SC_FS_MEMORY_WRITE_ERROR;
+    }
   }
-  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
 
-  sc_uint64 read_bytes = 0;
-  while (SC_TRUE)
+  // strings without hashes in fs-memory of previous versions are hashed as searchable if they have terms
+  sc_hash_map * hashed_string_offsets;
+  sc_hash_map_initialize(&hashed_string_offsets, 0);
+  sc_hash_map_visit(
+      memory->string_hashes_string_offsets_map,
+      _sc_dictionary_fs_memory_collect_string_hash_string_offset,
+      (void **)&hashed_string_offsets);
+  sc_hash_map * term_string_offsets;
+  sc_hash_map_initialize(&term_string_offsets, 0);
+  _sc_dictionary_fs_memory_collect_terms_string_offsets(memory, term_string_offsets);
+
+  sc_hash_map * string_offsets_map;
+  sc_hash_map_initialize(&string_offsets_map, string_offsets_count);
+  sc_hash_map * string_hashes_string_offsets_map;
+  sc_hash_map_initialize(&string_hashes_string_offsets_map, 0);
+
+  sc_uint64 const blocks_count = blocks->blocks_count;
+  sc_uint64 const blocks_strings_size = blocks->strings_size;
+  sc_uint64 const blocks_size = blocks->size;
+
+  sc_dictionary_fs_memory_status status = SC_FS_MEMORY_OK;
+  for (sc_uint64 i = 0; i < string_offsets_count; ++i)
   {
-    sc_uint8 hashes_size = 0;
-    if (sc_io_channel_read_chars(channel, (sc_char *)&hashes_size, sizeof(hashes_size), &read_bytes, null_ptr)
-        != SC_FS_IO_STATUS_NORMAL)
-      break;
-
-    sc_addr_hash * hashes = sc_mem_new(sc_addr_hash, hashes_size);
-    if (sc_io_channel_read_chars(channel, (sc_char *)hashes, sizeof(sc_addr_hash) * hashes_size, &read_bytes, null_ptr)
-        != SC_FS_IO_STATUS_NORMAL)
-      break;
+    sc_uint64 const string_offset = string_offsets[i];
+    if (!to_repack && string_offset < strings_offset)
+    {
+      sc_hash_map_insert(string_offsets_map, string_offset, (void *)(string_offset + 1));
+      continue;
+    }
 
-    sc_uint32 string_size = 0;
-    if (sc_io_channel_read_chars(channel, (sc_char *)&string_size, sizeof(string_size), &read_bytes, null_ptr)
-        != SC_FS_IO_STATUS_NORMAL)
+    sc_char * string;
+    sc_uint64 string_size;
+    status = _sc_dictionary_fs_memory_read_string_by_offset_ext(
+        memory, string_offset, 0, INVALID_STRING_OFFSET, &string, &string_size);
+    if (status != SC_FS_MEMORY_OK)
       break;
 
-    sc_char * string = sc_mem_new(sc_char, string_size + 1);
-    if (sc_io_channel_read_chars(channel, (sc_char *)string, string_size, &read_bytes, null_ptr)
-        != SC_FS_IO_STATUS_NORMAL)
+    sc_uint64 new_string_offset;
+    if (!sc_strings_blocks_append(new_blocks, string, string_size, &new_string_offset))
+    {
+      sc_mem_free(string);
+      status = SC_FS_MEMORY_WRITE_ERROR;
       break;
+    }
+    sc_hash_map_insert(string_offsets_map, string_offset, (void *)(new_string_offset + 1));
 
-    sc_uint8 i;
-    for (i = 0; i < hashes_size; ++i)
+    if (sc_hash_map_get(hashed_string_offsets, string_offset) == null_ptr)
     {
-      if (hashes[i] == 0)
-        continue;
+      sc_bool const is_searchable_string = sc_hash_map_get(term_string_offsets, string_offset) != null_ptr;
+      sc_hash_map_insert(
+          string_hashes_string_offsets_map,
+          _sc_dictionary_fs_memory_get_string_hash(string, string_size, is_searchable_string),
+          (void *)(new_string_offset + 1));
+    }
+    sc_mem_free(string);
+  }
+  sc_mem_free(string_offsets);
+  sc_hash_map_destroy(hashed_string_offsets, null_ptr);
+  sc_hash_map_destroy(term_string_offsets, null_ptr);
 
-      sc_dictionary_fs_memory_link_string(memory, hashes[i], string, string_size);
+  if (status == SC_FS_MEMORY_OK && !sc_strings_blocks_flush(new_blocks))
+    status = SC_FS_MEMORY_WRITE_ERROR;
+
+  if (status != SC_FS_MEMORY_OK)
+  {
+    sc_fs_memory_error("Error while strings packing");
+    sc_hash_map_destroy(string_offsets_map, null_ptr);
+    sc_hash_map_destroy(string_hashes_string_offsets_map, null_ptr);
+
+    // strings remain in strings channels and existing strings blocks
+    if (to_repack)
+    {
+      sc_strings_blocks_destroy(new_blocks);
+      sc_fs_remove_file(new_blocks_path);
+      sc_mem_free(new_blocks_path);
+    }
+    else
+    {
+      blocks->blocks_count = blocks_count;
+      blocks->strings_size = blocks_strings_size;
+      blocks->size = blocks_size;
+      blocks->buffer_size = 0;
+      blocks->buffer_strings_count = 0;
     }
+    return status;
+  }
 
-    sc_mem_free(hashes);
-    sc_mem_free(string);
+  // previous strings blocks file isn't changed by closing, it is replaced only after dictionaries are saved
+  if (to_repack)
+  {
+    sc_strings_blocks_destroy(blocks);
+    memory->strings_blocks = new_blocks;
   }
 
-  sc_io_channel_shutdown(channel, SC_FALSE, null_ptr);
+  // dictionaries are saved into packed files by their paths, files of deprecated dictionaries, that aren't saved,
+  // are removed after previous files are replaced
+  sc_char ** paths[] = {
+      &memory->terms_index_path,
+      &memory->terms_string_offsets_path,
+      &memory->string_offsets_link_hashes_path,
+      &memory->link_hashes_string_offsets_path,
+      &memory->ngrams_string_offsets_path,
+      &memory->string_hashes_string_offsets_path,
+      &memory->strings_blocks_index_path,
+  };
+  sc_uint32 const paths_count = sizeof(paths) / sizeof(paths[0]);
+  sc_char * previous_paths[sizeof(paths) / sizeof(paths[0])];
+  for (sc_uint32 i = 0; i < paths_count; ++i)
+  {
+    previous_paths[i] = *paths[i];
+    _sc_dictionary_fs_memory_get_packed_path(memory, previous_paths[i], paths[i]);
+    if (sc_fs_is_file(*paths[i]))
+      sc_fs_remove_file(*paths[i]);
+  }
 
-  sc_fs_remove_file(strings_path);
-  sc_mem_free(strings_path);
+  // index with terms is written with last string offset while remapping, so it isn't rewritten while saving
+  memory->strings_offset = new_blocks->strings_size;
+  memory->last_string_offset = new_blocks->strings_size;
+  status = _sc_dictionary_fs_memory_remap_string_offsets(memory, string_offsets_map, string_hashes_string_offsets_map);
+  sc_hash_map_destroy(string_offsets_map, null_ptr);
+  if (status == SC_FS_MEMORY_OK)
+    status = sc_dictionary_fs_memory_save(memory);
 
-  sc_fs_memory_warning("Deprecated file memory dictionary loaded");
+  for (sc_uint32 i = 0; i < paths_count; ++i)
+  {
+    sc_char * packed_path = *paths[i];
+    *paths[i] = previous_paths[i];
+
+    if (status != SC_FS_MEMORY_OK)
+    {
+      if (sc_fs_is_file(packed_path))
+        sc_fs_remove_file(packed_path);
+    }
+    else if (sc_fs_is_file(packed_path))
+      sc_fs_rename_file(packed_path, *paths[i]);
+    else if (sc_fs_is_file(*paths[i]))
+      sc_fs_remove_file(*paths[i]);
+    sc_mem_free(packed_path);
+  }
+
+  if (to_repack)
+  {
+    if (status == SC_FS_MEMORY_OK)
+      sc_fs_rename_file(new_blocks_path, memory->strings_blocks_path);
+    sc_mem_free(new_blocks_path);
+  }
+  if (status != SC_FS_MEMORY_OK)
+    return status;
+
+  // strings channels are removed only after dictionaries with new string offsets replace previous ones
+  _sc_dictionary_fs_memory_remove_strings_channels(memory);
 
+  sc_fs_memory_info("Strings packed");
   return SC_FS_MEMORY_OK;
 }
 
+void _sc_dictionary_fs_memory_print_dictionaries_memory_sizes(sc_dictionary_fs_memory const * memory)
+{
+  sc_message(
+      "\tIndex `terms - string offsets` mapped size: %" PRIu64, sc_terms_index_get_mapped_size(memory->terms_index));
+  sc_message(
+      "\tDictionary `terms - string offsets` memory size: %" PRIu64,
+      sc_dictionary_get_memory_size(memory->terms_string_offsets_dictionary));
+  sc_message(
+      "\tDictionary `string offsets - link hashes` memory size: %" PRIu64,
+      sc_dictionary_get_memory_size(memory->string_offsets_link_hashes_dictionary));
+  sc_message(
+      "\tMap `link hashes - string offsets` memory size: %" PRIu64,
+      sc_hash_map_get_memory_size(memory->link_hashes_string_offsets_map));
+  sc_message(
+      "\tIndex `n-grams - string offsets` memory size: %" PRIu64,
+      sc_ngrams_index_get_memory_size(memory->ngrams_index));
+  sc_message(
+      "\tMap `string hashes - string offsets` memory size: %" PRIu64,
+      sc_hash_map_get_memory_size(memory->string_hashes_string_offsets_map));
+  sc_message(
+      "\tStrings blocks: %" PRIu64 ", strings size: %" PRIu64 ", file size: %" PRIu64,
+      memory->strings_blocks->blocks_count,
+      memory->strings_blocks->strings_size,
+      memory->strings_blocks->size);
+}
+
 sc_dictionary_fs_memory_status sc_dictionary_fs_memory_load(sc_dictionary_fs_memory * memory)
 {
   if (memory == null_ptr)
@@ -1508,105 +3483,82 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_load(sc_dictionary_fs_mem
 
   sc_fs_memory_info("Load sc-fs-memory dictionaries");
 
-  if (_sc_dictionary_fs_memory_load_deprecated_dictionaries(memory) != SC_FS_MEMORY_OK)
+  if (_sc_dictionary_fs_memory_load_strings_blocks(memory) == SC_FS_MEMORY_READ_ERROR)
+    return SC_FS_MEMORY_READ_ERROR;
+
+  // dictionary with terms of previous versions is loaded as terms added after index saving
+  if (_sc_dictionary_fs_memory_load_deprecated_dictionaries(memory) != SC_FS_MEMORY_OK
+      && _sc_dictionary_fs_memory_load_terms_index(memory) != SC_FS_MEMORY_OK)
     _sc_dictionary_fs_memory_load_terms_offsets(memory);
+  if (memory->last_string_offset < memory->strings_offset)
+    memory->last_string_offset = memory->strings_offset;
 
+  sc_message("\tStrings offset: %" PRIu64, memory->strings_offset);
   sc_message("\tLast string offset: %" PRIu64, memory->last_string_offset);
 
-  _sc_dictionary_fs_memory_load_string_offsets_link_hashes(memory);
+  if (_sc_dictionary_fs_memory_load_link_hashes_string_offsets(memory) != SC_FS_MEMORY_OK)
+    _sc_dictionary_fs_memory_load_string_offsets_link_hashes(memory);
+  _sc_dictionary_fs_memory_load_string_hashes_string_offsets(memory);
+  _sc_dictionary_fs_memory_load_ngrams_string_offsets(memory);
+  if (_sc_dictionary_fs_memory_load_blobs_sizes(memory) != SC_FS_MEMORY_OK)
+    return SC_FS_MEMORY_READ_ERROR;
+
+  // strings written after previous load are packed, so strings channels are empty after load
+  if (_sc_dictionary_fs_memory_pack_strings(memory) == SC_FS_MEMORY_NO)
+    _sc_dictionary_fs_memory_print_dictionaries_memory_sizes(memory);
 
   sc_fs_memory_info("All sc-fs-memory dictionaries loaded");
 
   return SC_FS_MEMORY_OK;
 }
 
-sc_bool _sc_dictionary_fs_memory_write_term_string_offsets(sc_dictionary_node * node, void ** arguments)
+sc_bool _sc_dictionary_fs_memory_write_link_hash_string_offset(sc_uint64 key, void * data, void ** arguments)
 {
-  if (node->data == null_ptr)
-    return SC_TRUE;
-
   sc_io_channel * channel = arguments[0];
+  sc_link_hash_content const * content = data;
 
-  sc_list * list = node->data;
-  sc_iterator * data_it = sc_list_iterator(list);
-
-  // save term and string offsets in fs-memory
   sc_uint64 written_bytes = 0;
-  if (sc_iterator_next(data_it))
+  sc_addr_hash const link_hash = key;
+  if (sc_io_channel_write_chars(channel, (sc_char *)&link_hash, sizeof(sc_addr_hash), &written_bytes, null_ptr)
+          != SC_FS_IO_STATUS_NORMAL
+      || sizeof(sc_addr_hash) != written_bytes)
   {
-    sc_char * term = sc_iterator_get(data_it);
-    sc_uint64 const term_size = sc_str_len(term);
-    if (sc_io_channel_write_chars(channel, (sc_char *)&term_size, sizeof(sc_uint64), &written_bytes, null_ptr)
-            != SC_FS_IO_STATUS_NORMAL
-        || sizeof(sc_uint64) != written_bytes)
-    {
-      sc_fs_memory_error("Error while attribute `term_size` writing");
-      goto error;
-    }
-
-    if (sc_io_channel_write_chars(channel, (sc_char *)term, term_size, &written_bytes, null_ptr)
-            != SC_FS_IO_STATUS_NORMAL
-        || term_size != written_bytes)
-    {
-      sc_mem_free(term);
-      sc_fs_memory_error("Error while attribute `term` writing");
-      goto error;
-    }
-
-    sc_uint64 const string_offsets_count = list->size - 1;
-    if (sc_io_channel_write_chars(
-            channel, (sc_char *)&string_offsets_count, sizeof(sc_uint64), &written_bytes, null_ptr)
-            != SC_FS_IO_STATUS_NORMAL
-        || sizeof(sc_uint64) != written_bytes)
-    {
-      sc_mem_free(term);
-      sc_fs_memory_error("Error while attribute `string_offsets_count` writing");
-      goto error;
-    }
+    sc_fs_memory_error("Error while attribute `link_hash` writing");
+    return SC_FALSE;
+  }
 
-    while (sc_iterator_next(data_it))
-    {
-      sc_uint64 const string_offset = (sc_uint64)sc_iterator_get(data_it);
-      if (sc_io_channel_write_chars(channel, (sc_char *)&string_offset, sizeof(string_offset), &written_bytes, null_ptr)
-              != SC_FS_IO_STATUS_NORMAL
-          || sizeof(sc_uint64) != written_bytes)
-      {
-        sc_mem_free(term);
-        sc_fs_memory_error("Error while attribute `string_offset` writing");
-        goto error;
-      }
-    }
+  sc_uint64 const string_offset = content->string_offset - 1;
+  if (sc_io_channel_write_chars(channel, (sc_char *)&string_offset, sizeof(sc_uint64), &written_bytes, null_ptr)
+          != SC_FS_IO_STATUS_NORMAL
+      || sizeof(sc_uint64) != written_bytes)
+  {
+    sc_fs_memory_error("Error while attribute `string_offset` writing");
+    return SC_FALSE;
   }
 
-  sc_iterator_destroy(data_it);
   return SC_TRUE;
-
-error:
-{
-  sc_iterator_destroy(data_it);
-  return SC_FALSE;
-}
 }
 
-sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_save_term_string_offsets(sc_dictionary_fs_memory const * memory)
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_save_link_hashes_string_offsets(
+    sc_dictionary_fs_memory const * memory)
 {
-  sc_io_channel * channel = sc_io_new_write_channel(memory->terms_string_offsets_path, null_ptr);
+  sc_io_channel * channel = sc_io_new_write_channel(memory->link_hashes_string_offsets_path, null_ptr);
   sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
 
   sc_uint64 written_bytes = 0;
-  if (sc_io_channel_write_chars(
-          channel, (sc_char *)&memory->last_string_offset, sizeof(sc_uint64), &written_bytes, null_ptr)
+  sc_uint64 const links_count = memory->link_hashes_string_offsets_map->size;
+  if (sc_io_channel_write_chars(channel, (sc_char *)&links_count, sizeof(sc_uint64), &written_bytes, null_ptr)
           != SC_FS_IO_STATUS_NORMAL
       || sizeof(sc_uint64) != written_bytes)
   {
-    sc_fs_memory_error("Error while attribute `last_string_offset` writing");
+    sc_fs_memory_error("Error while attribute `links_count` writing");
     sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
     return SC_FS_MEMORY_WRITE_ERROR;
   }
 
-  if (!sc_dictionary_visit_down_nodes(
-          memory->terms_string_offsets_dictionary,
-          _sc_dictionary_fs_memory_write_term_string_offsets,
+  if (!sc_hash_map_visit(
+          memory->link_hashes_string_offsets_map,
+          _sc_dictionary_fs_memory_write_link_hash_string_offset,
           (void **)&channel))
   {
     sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
@@ -1614,70 +3566,106 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_save_term_string_offsets
   }
 
   sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
-  sc_fs_memory_info("Dictionary `term - offsets` written");
+
+  // links are loaded from deprecated dictionary file only if there is no map file
+  if (sc_fs_is_file(memory->string_offsets_link_hashes_path))
+    sc_fs_remove_file(memory->string_offsets_link_hashes_path);
+
+  sc_fs_memory_info("Map `link hashes - string offsets` written");
   return SC_FS_MEMORY_OK;
 }
 
-sc_bool _sc_dictionary_fs_memory_write_string_offsets_link_hashes(sc_dictionary_node * node, void ** arguments)
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_save_ngrams_string_offsets(
+    sc_dictionary_fs_memory const * memory)
 {
-  if (node->data == null_ptr)
-    return SC_TRUE;
+  // index isn't updated without substring search, so it is removed to be rebuilt when search is enabled
+  if (!memory->search_by_substring)
+  {
+    if (sc_fs_is_file(memory->ngrams_string_offsets_path))
+      sc_fs_remove_file(memory->ngrams_string_offsets_path);
+    return SC_FS_MEMORY_OK;
+  }
 
-  sc_io_channel * channel = arguments[0];
+  sc_io_channel * channel = sc_io_new_write_channel(memory->ngrams_string_offsets_path, null_ptr);
+  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+  if (!sc_ngrams_index_write(memory->ngrams_index, channel))
+  {
+    sc_fs_memory_error("Error while index `n-grams - string offsets` writing");
+    sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
+    return SC_FS_MEMORY_WRITE_ERROR;
+  }
 
-  sc_link_hash_content * content = node->data;
-  sc_iterator * data_it = sc_list_iterator(content->link_hashes);
+  sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
 
-  sc_uint64 written_bytes = 0;
-  sc_uint64 const string_offset = content->string_offset - 1;
-  if (sc_io_channel_write_chars(channel, (sc_char *)&string_offset, sizeof(sc_uint64), &written_bytes, null_ptr)
-          != SC_FS_IO_STATUS_NORMAL
-      || sizeof(sc_uint64) != written_bytes)
+  sc_fs_memory_info("Index `n-grams - string offsets` written");
+  return SC_FS_MEMORY_OK;
+}
+
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_save_strings_blocks(sc_dictionary_fs_memory const * memory)
+{
+  sc_io_channel * channel = sc_io_new_write_channel(memory->strings_blocks_index_path, null_ptr);
+  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+  // strings blocks are changed only on load, so they are written without lock
+  if (!sc_strings_blocks_write_index(memory->strings_blocks, channel))
   {
-    sc_fs_memory_error("Error while attribute `string_offset` writing");
-    goto error;
+    sc_fs_memory_error("Error while strings blocks index writing");
+    sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
+    return SC_FS_MEMORY_WRITE_ERROR;
   }
 
-  sc_uint64 const link_hashes_count = content->link_hashes->size;
-  if (sc_io_channel_write_chars(channel, (sc_char *)&link_hashes_count, sizeof(sc_uint64), &written_bytes, null_ptr)
+  sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
+  sc_fs_memory_info("Strings blocks index written");
+  return SC_FS_MEMORY_OK;
+}
+
+sc_bool _sc_dictionary_fs_memory_write_string_hash_string_offset(sc_uint64 key, void * data, void ** arguments)
+{
+  sc_io_channel * channel = arguments[0];
+
+  sc_uint64 written_bytes = 0;
+  sc_uint64 const string_hash = key;
+  if (sc_io_channel_write_chars(channel, (sc_char *)&string_hash, sizeof(sc_uint64), &written_bytes, null_ptr)
           != SC_FS_IO_STATUS_NORMAL
       || sizeof(sc_uint64) != written_bytes)
   {
-    sc_fs_memory_error("Error while attribute `link_hashes_count` writing");
-    goto error;
+    sc_fs_memory_error("Error while attribute `string_hash` writing");
+    return SC_FALSE;
   }
 
-  while (sc_iterator_next(data_it))
+  sc_uint64 const string_offset = (sc_uint64)data - 1;
+  if (sc_io_channel_write_chars(channel, (sc_char *)&string_offset, sizeof(sc_uint64), &written_bytes, null_ptr)
+          != SC_FS_IO_STATUS_NORMAL
+      || sizeof(sc_uint64) != written_bytes)
   {
-    sc_addr_hash const link_hash = (sc_uint64)sc_iterator_get(data_it);
-    if (sc_io_channel_write_chars(channel, (sc_char *)&link_hash, sizeof(sc_addr_hash), &written_bytes, null_ptr)
-            != SC_FS_IO_STATUS_NORMAL
-        || sizeof(sc_addr_hash) != written_bytes)
-    {
-      sc_fs_memory_error("Error while attribute `link_hash` writing");
-      goto error;
-    }
+    sc_fs_memory_error("Error while attribute `string_offset` writing");
+    return SC_FALSE;
   }
 
-  sc_iterator_destroy(data_it);
   return SC_TRUE;
-
-error:
-{
-  sc_iterator_destroy(data_it);
-  return SC_FALSE;
-}
 }
 
-sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_save_string_offsets_link_hashes(
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_save_string_hashes_string_offsets(
     sc_dictionary_fs_memory const * memory)
 {
-  sc_io_channel * channel = sc_io_new_write_channel(memory->string_offsets_link_hashes_path, null_ptr);
+  sc_io_channel * channel = sc_io_new_write_channel(memory->string_hashes_string_offsets_path, null_ptr);
   sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
 
-  if (!sc_dictionary_visit_down_nodes(
-          memory->link_hashes_string_offsets_dictionary,
-          _sc_dictionary_fs_memory_write_string_offsets_link_hashes,
+  sc_uint64 written_bytes = 0;
+  sc_uint64 const strings_count = memory->string_hashes_string_offsets_map->size;
+  if (sc_io_channel_write_chars(channel, (sc_char *)&strings_count, sizeof(sc_uint64), &written_bytes, null_ptr)
+          != SC_FS_IO_STATUS_NORMAL
+      || sizeof(sc_uint64) != written_bytes)
+  {
+    sc_fs_memory_error("Error while attribute `strings_count` writing");
+    sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
+    return SC_FS_MEMORY_WRITE_ERROR;
+  }
+
+  if (!sc_hash_map_visit(
+          memory->string_hashes_string_offsets_map,
+          _sc_dictionary_fs_memory_write_string_hash_string_offset,
           (void **)&channel))
   {
     sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
@@ -1685,7 +3673,7 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_save_string_offsets_link
   }
 
   sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
-  sc_fs_memory_info("Dictionary `string offsets - link hashes` written");
+  sc_fs_memory_info("Map `string hashes - string offsets` written");
   return SC_FS_MEMORY_OK;
 }
 
@@ -1698,15 +3686,38 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_save(sc_dictionary_fs_mem
   }
 
   sc_fs_memory_info("Save sc-fs-memory dictionaries");
-  sc_dictionary_fs_memory_status status = _sc_dictionary_fs_memory_save_term_string_offsets(memory);
+  sc_dictionary_fs_memory_status status = _sc_dictionary_fs_memory_save_strings_blocks(memory);
+  if (status != SC_FS_MEMORY_OK)
+    return status;
+
+  // added terms are merged into index with terms, so dictionary with them is cleared
+  sc_monitor_acquire_write((sc_monitor *)&memory->terms_monitor);
+  status = _sc_dictionary_fs_memory_write_terms_index((sc_dictionary_fs_memory *)memory, null_ptr);
+  sc_monitor_release_write((sc_monitor *)&memory->terms_monitor);
+  if (status != SC_FS_MEMORY_OK)
+    return status;
+  sc_fs_memory_info("Index `term - offsets` written");
+
+  sc_monitor_acquire_read((sc_monitor *)&memory->links_monitor);
+  status = _sc_dictionary_fs_memory_save_link_hashes_string_offsets(memory);
+  sc_monitor_release_read((sc_monitor *)&memory->links_monitor);
+  if (status != SC_FS_MEMORY_OK)
+    return status;
+
+  sc_monitor_acquire_read((sc_monitor *)&memory->ngrams_monitor);
+  status = _sc_dictionary_fs_memory_save_ngrams_string_offsets(memory);
+  sc_monitor_release_read((sc_monitor *)&memory->ngrams_monitor);
   if (status != SC_FS_MEMORY_OK)
     return status;
 
-  status = _sc_dictionary_fs_memory_save_string_offsets_link_hashes(memory);
+  sc_monitor_acquire_read((sc_monitor *)&memory->string_hashes_monitor);
+  status = _sc_dictionary_fs_memory_save_string_hashes_string_offsets(memory);
+  sc_monitor_release_read((sc_monitor *)&memory->string_hashes_monitor);
   if (status != SC_FS_MEMORY_OK)
     return status;
 
   sc_message("\tLast string offset: %" PRIu64, memory->last_string_offset);
+  _sc_dictionary_fs_memory_print_dictionaries_memory_sizes(memory);
 
   sc_fs_memory_info("All sc-fs-memory dictionaries saved");
   return status;
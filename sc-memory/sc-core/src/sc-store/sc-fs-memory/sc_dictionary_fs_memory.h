@@ -74,6 +74,25 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_link_string_ext(
     sc_uint64 string_size,
     sc_bool is_searchable_string);
 
+/*! Appends sc-link hashes to file system memory with their string contents at once. Strings are divided into terms in
+ * parallel, new strings are written into strings channels by big sequential writes, and terms of all strings are
+ * appended to dictionary of terms in one pass.
+ * @param memory A pointer to file memory
+ * @param link_hashes Appendable sc-link hashes
+ * @param strings Sc-link string contents ended by zero
+ * @param strings_sizes Sc-link string contents sizes
+ * @param strings_count A count of sc-link hashes and their string contents
+ * @param is_searchable_string Ability to search for sc-links on these content strings
+ * @returns SC_FS_MEMORY_OK, if are no reading and writing errors.
+ */
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_link_strings(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash const * link_hashes,
+    sc_char const * const * strings,
+    sc_uint64 const * strings_sizes,
+    sc_uint64 strings_count,
+    sc_bool is_searchable_string);
+
 /*! Removes sc-link content string from file system memory.
  * @param memory A pointer to file memory
  * @param link_hash A sc-link hash
@@ -96,6 +115,93 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_by_link_hash(
     sc_char ** string,
     sc_uint64 * string_size);
 
+/*! Appends string to the end of sc-link content. Texts with appended parts smaller than max searchable string size are
+ * linked as new strings and found by their contents. Other contents with appended parts are stored as blobs out of
+ * dictionaries, so they aren't rewritten on appending and can't be found by strings and substrings.
+ * @param memory A pointer to file memory
+ * @param link_hash A sc-link hash
+ * @param string A string to append
+ * @param string_size A string size
+ * @returns SC_FS_MEMORY_OK, if are no reading and writing errors.
+ * @note Appends to the same sc-link and its content changes must not be called in parallel.
+ */
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_append_string(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash link_hash,
+    sc_char const * string,
+    sc_uint64 string_size);
+
+/*! Gets size of sc-link content string without reading it.
+ * @param memory A pointer to file memory
+ * @param link_hash A sc-link hash
+ * @param[out] string_size A sc-link content string size
+ * @returns SC_FS_MEMORY_OK, if are no reading errors; SC_FS_MEMORY_NO_STRING, if sc-link has no content.
+ */
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_size_by_link_hash(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash link_hash,
+    sc_uint64 * string_size);
+
+/*! Reads part of sc-link content string by offset, only this part is read from file memory.
+ * @param memory A pointer to file memory
+ * @param link_hash A sc-link hash
+ * @param offset An offset of part in sc-link content string
+ * @param data A buffer to read part
+ * @param size A size of buffer
+ * @param[out] read_bytes A count of read bytes, it is 0 if offset is at the end of sc-link content string
+ * @returns SC_FS_MEMORY_OK, if are no reading errors; SC_FS_MEMORY_NO_STRING, if sc-link has no content.
+ */
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_read_string_by_link_hash(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash link_hash,
+    sc_uint64 offset,
+    sc_char * data,
+    sc_uint64 size,
+    sc_uint64 * read_bytes);
+
+/*! Gets location of sc-link content string to read its parts without finding it by sc-link hash on each reading.
+ * @param memory A pointer to file memory
+ * @param link_hash A sc-link hash
+ * @param[out] string_location A location of sc-link content string in file memory
+ * @param[out] string_size A sc-link content string size
+ * @returns SC_FS_MEMORY_OK, if are no reading errors; SC_FS_MEMORY_NO_STRING, if sc-link has no content.
+ * @remarks Location is valid until sc-link content is changed or file memory is loaded again.
+ */
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_location_by_link_hash(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash link_hash,
+    sc_uint64 * string_location,
+    sc_uint64 * string_size);
+
+/*! Reads part of sc-link content string by its location got by
+ * sc_dictionary_fs_memory_get_string_location_by_link_hash, only this part is read from file memory.
+ * @param memory A pointer to file memory
+ * @param link_hash A sc-link hash
+ * @param string_location A location of sc-link content string
+ * @param offset An offset of part in sc-link content string
+ * @param data A buffer to read part
+ * @param size A size of buffer, it must not be bigger than size of string after offset
+ * @param[out] read_bytes A count of read bytes
+ * @returns SC_FS_MEMORY_OK, if are no reading errors.
+ */
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_read_string_by_location(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash link_hash,
+    sc_uint64 string_location,
+    sc_uint64 offset,
+    sc_char * data,
+    sc_uint64 size,
+    sc_uint64 * read_bytes);
+
+/*! Gets statistics of cache of sc-link contents read from file memory.
+ * @param memory A pointer to file memory
+ * @param[out] stat A pointer to statistics to fill
+ * @returns SC_FS_MEMORY_OK, if file memory exists.
+ */
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_link_contents_cache_stat(
+    sc_dictionary_fs_memory * memory,
+    sc_link_contents_cache_stat * stat);
+
 /*! Function that retrieves sc-link hashes by a full string term from the file memory.
  * @param memory Pointer to the file memory.
  * @param string Pointer to the full string term.
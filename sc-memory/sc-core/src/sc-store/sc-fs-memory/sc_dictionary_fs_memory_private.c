@@ -69,12 +69,8 @@ void _sc_dictionary_fs_memory_link_node_clear(sc_dictionary_node * node)
   sc_list_destroy(link_hashes);
 }
 
-void _sc_dictionary_fs_memory_string_node_clear(sc_dictionary_node * node)
+void _sc_dictionary_fs_memory_link_hash_content_clear(void * content)
 {
-  void * content = node->data;
-  if (content == null_ptr)
-    return;
-
   sc_mem_free(content);
 }
 
@@ -88,6 +84,7 @@ sc_memory_params * _sc_dictionary_fs_memory_get_default_params(sc_char const * p
   params->max_searchable_string_size = DEFAULT_MAX_SEARCHABLE_STRING_SIZE;
   params->term_separators = DEFAULT_TERM_SEPARATORS;
   params->search_by_substring = DEFAULT_SEARCH_BY_SUBSTRING;
+  params->max_link_contents_cache_size = DEFAULT_MAX_LINK_CONTENTS_CACHE_SIZE;
 
   return params;
 }
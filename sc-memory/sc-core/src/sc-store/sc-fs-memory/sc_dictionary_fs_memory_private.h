@@ -12,6 +12,13 @@
 #include "sc-core/sc-container/sc_list.h"
 #include "sc-core/sc-container/sc_dictionary.h"
 
+#include "sc-store/sc-container/sc_hash_map.h"
+
+#include "sc_ngrams_index.h"
+#include "sc_strings_blocks.h"
+#include "sc_terms_index.h"
+#include "sc_link_contents_cache.h"
+
 #include "sc-core/sc_memory_params.h"
 
 #include "sc-store/sc-base/sc_monitor_private.h"
@@ -20,6 +27,7 @@
 
 #define SC_FS_EXT ".scdb"
 #define INVALID_STRING_OFFSET LONG_MAX
+#define SC_DICTIONARY_FS_MEMORY_STRINGS_MONITORS_COUNT 64
 
 #define SC_FS_MEMORY_PREFIX "[sc-fs-memory] "
 #define sc_fs_memory_info(...) sc_message(SC_FS_MEMORY_PREFIX __VA_ARGS__)
@@ -39,18 +47,42 @@ struct _sc_dictionary_fs_memory
 
   void ** strings_channels;
   sc_monitor_table strings_channels_monitors_table;
-  sc_uint64 last_string_offset;  // last offset of string in 'string_path`
-  sc_monitor monitor;
-  sc_monitor resolve_string_offset_monitor;
-
-  sc_char * terms_string_offsets_path;              // path to dictionary file with terms and its strings offsets
-  sc_dictionary * terms_string_offsets_dictionary;  // dictionary instance with terms and its strings offsets
-
-  sc_char * string_offsets_link_hashes_path;  // path to dictionary file with strings offsets and its link hashes
+  sc_uint64 strings_offset;      // offset of the first string in strings channels, strings before it are in blocks
+  sc_uint64 last_string_offset;  // last offset of string in 'string_path`, it is reserved by writers atomically
+  sc_monitor monitor;            // monitor for strings channels opening
+  sc_monitor strings_monitors[SC_DICTIONARY_FS_MEMORY_STRINGS_MONITORS_COUNT];  // monitors for strings by hashes
+  sc_monitor terms_monitor;          // monitor for index and dictionary with terms and its strings offsets
+  sc_monitor links_monitor;          // monitor for dictionaries with strings offsets and link hashes
+  sc_monitor ngrams_monitor;         // monitor for index of strings by n-grams
+  sc_monitor string_hashes_monitor;  // monitor for map with hashes of strings and their offsets
+  sc_monitor blobs_monitor;          // monitor for map with link hashes and sizes of their blobs
+
+  sc_char * strings_blocks_path;        // path to file with compressed blocks of strings
+  sc_char * strings_blocks_index_path;  // path to index file with blocks of strings
+  sc_strings_blocks * strings_blocks;   // blocks with strings packed on load, they aren't changed after load
+
+  sc_char * terms_index_path;   // path to mapped index file with terms and its strings offsets
+  sc_terms_index * terms_index;  // index with terms and its strings offsets saved in fs-memory, it isn't changed
+  sc_char * terms_string_offsets_path;              // path to deprecated dictionary file with terms and its offsets
+  sc_dictionary * terms_string_offsets_dictionary;  // dictionary with terms and its strings offsets added after save
+
+  sc_char * string_offsets_link_hashes_path;  // path to deprecated dictionary file with strings offsets and link hashes
   sc_dictionary *
       string_offsets_link_hashes_dictionary;  // dictionary instance with strings offsets and its link hashes
-  sc_dictionary *
-      link_hashes_string_offsets_dictionary;  // dictionary instance with link hashes and its strings offsets
+
+  sc_char * link_hashes_string_offsets_path;     // path to map file with link hashes and its strings offsets
+  sc_hash_map * link_hashes_string_offsets_map;  // map instance with link hashes and its strings offsets
+
+  sc_char * ngrams_string_offsets_path;  // path to index file with n-grams and offsets of strings with them
+  sc_ngrams_index * ngrams_index;        // index of strings by n-grams, it is filled if search by substring is on
+
+  sc_char * string_hashes_string_offsets_path;     // path to map file with hashes of strings and their offsets
+  sc_hash_map * string_hashes_string_offsets_map;  // map instance with hashes of strings and their offsets + 1
+
+  sc_char * blobs_path;                       // path to directory with blobs, contents of links with appended parts
+  sc_hash_map * link_hashes_blobs_sizes_map;  // map instance with link hashes and sizes of their blobs + 1
+
+  sc_link_contents_cache * link_contents_cache;  // cache of the most recently read strings of links
 };
 
 sc_bool _sc_uchar_dictionary_initialize(sc_dictionary ** dictionary);
@@ -61,7 +93,7 @@ void _sc_dictionary_fs_memory_node_clear(sc_dictionary_node * node);
 
 void _sc_dictionary_fs_memory_link_node_clear(sc_dictionary_node * node);
 
-void _sc_dictionary_fs_memory_string_node_clear(sc_dictionary_node * node);
+void _sc_dictionary_fs_memory_link_hash_content_clear(void * content);
 
 sc_memory_params * _sc_dictionary_fs_memory_get_default_params(sc_char const * path, sc_bool clear);
 
@@ -87,6 +87,19 @@ sc_bool sc_fs_is_file(sc_char const * path)
   return g_file_test(path, G_FILE_TEST_IS_REGULAR);
 }
 
+sc_bool sc_fs_get_file_size(sc_char const * path, sc_uint64 * size)
+{
+  GStatBuf file_stat;
+  if (g_stat(path, &file_stat) == -1)
+  {
+    *size = 0;
+    return SC_FALSE;
+  }
+
+  *size = file_stat.st_size;
+  return SC_TRUE;
+}
+
 sc_bool sc_fs_is_binary_file(sc_char const * file_path)
 {
   sc_char command_prefix[] = SC_FS_FILE_COMMAND;
@@ -79,6 +79,17 @@ sc_fs_memory_status sc_fs_memory_link_string_ext(
   return manager->link_string(manager->fs_memory, link_hash, string, string_size, is_searchable_string);
 }
 
+sc_fs_memory_status sc_fs_memory_link_strings(
+    sc_addr_hash const * link_hashes,
+    sc_char const * const * strings,
+    sc_uint64 const * strings_sizes,
+    sc_uint64 strings_count,
+    sc_bool is_searchable_string)
+{
+  return manager->link_strings(
+      manager->fs_memory, link_hashes, strings, strings_sizes, strings_count, is_searchable_string);
+}
+
 sc_fs_memory_status sc_fs_memory_get_string_by_link_hash(
     sc_addr_hash const link_hash,
     sc_char ** string,
@@ -90,6 +101,39 @@ sc_fs_memory_status sc_fs_memory_get_string_by_link_hash(
   return result;
 }
 
+sc_fs_memory_status sc_fs_memory_append_string(
+    sc_addr_hash const link_hash,
+    sc_char const * string,
+    sc_uint64 const string_size)
+{
+  return manager->append_string(manager->fs_memory, link_hash, string, string_size);
+}
+
+sc_fs_memory_status sc_fs_memory_get_string_location_by_link_hash(
+    sc_addr_hash const link_hash,
+    sc_uint64 * string_location,
+    sc_uint64 * string_size)
+{
+  return manager->get_string_location_by_link_hash(manager->fs_memory, link_hash, string_location, string_size);
+}
+
+sc_fs_memory_status sc_fs_memory_read_string_by_location(
+    sc_addr_hash const link_hash,
+    sc_uint64 const string_location,
+    sc_uint64 const offset,
+    sc_char * data,
+    sc_uint64 const size,
+    sc_uint64 * read_bytes)
+{
+  return manager->read_string_by_location(
+      manager->fs_memory, link_hash, string_location, offset, data, size, read_bytes);
+}
+
+sc_fs_memory_status sc_fs_memory_get_link_contents_cache_stat(sc_link_contents_cache_stat * stat)
+{
+  return manager->get_link_contents_cache_stat(manager->fs_memory, stat);
+}
+
 sc_fs_memory_status sc_fs_memory_get_link_hashes_by_string(
     sc_char const * string,
     sc_uint32 const string_size,
@@ -40,6 +40,13 @@ typedef struct _sc_fs_memory_manager
       sc_char const * string,
       sc_uint64 const string_size,
       sc_bool is_searchable_string);
+  sc_fs_memory_status (*link_strings)(
+      sc_fs_memory * memory,
+      sc_addr_hash const * link_hashes,
+      sc_char const * const * strings,
+      sc_uint64 const * strings_sizes,
+      sc_uint64 strings_count,
+      sc_bool is_searchable_string);
   sc_fs_memory_status (*get_string_by_link_hash)(
       sc_fs_memory * memory,
       sc_addr_hash const link_hash,
@@ -63,6 +70,25 @@ typedef struct _sc_fs_memory_manager
       sc_uint32 const max_length_to_search_as_prefix,
       sc_link_handler * link_handler);
   sc_fs_memory_status (*unlink_string)(sc_fs_memory * memory, sc_addr_hash const link_hash);
+  sc_fs_memory_status (*append_string)(
+      sc_fs_memory * memory,
+      sc_addr_hash const link_hash,
+      sc_char const * string,
+      sc_uint64 const string_size);
+  sc_fs_memory_status (*get_string_location_by_link_hash)(
+      sc_fs_memory * memory,
+      sc_addr_hash const link_hash,
+      sc_uint64 * string_location,
+      sc_uint64 * string_size);
+  sc_fs_memory_status (*read_string_by_location)(
+      sc_fs_memory * memory,
+      sc_addr_hash const link_hash,
+      sc_uint64 const string_location,
+      sc_uint64 const offset,
+      sc_char * data,
+      sc_uint64 const size,
+      sc_uint64 * read_bytes);
+  sc_fs_memory_status (*get_link_contents_cache_stat)(sc_fs_memory * memory, sc_link_contents_cache_stat * stat);
 } sc_fs_memory_manager;
 
 /*! Initialize file system memory in specified path.
@@ -104,6 +130,21 @@ sc_fs_memory_status sc_fs_memory_link_string_ext(
     sc_uint32 string_size,
     sc_bool is_searchable_string);
 
+/*! Appends sc-link hashes to file system memory with their string contents at once.
+ * @param link_hashes Appendable sc-link hashes
+ * @param strings Sc-link string contents ended by zero
+ * @param strings_sizes Sc-link string contents sizes
+ * @param strings_count A count of sc-link hashes and their string contents
+ * @param is_searchable_string Ability to search for sc-links on these content strings
+ * @returns SC_TRUE, if are no writing errors.
+ */
+sc_fs_memory_status sc_fs_memory_link_strings(
+    sc_addr_hash const * link_hashes,
+    sc_char const * const * strings,
+    sc_uint64 const * strings_sizes,
+    sc_uint64 strings_count,
+    sc_bool is_searchable_string);
+
 /*! Removes sc-link content string from file system memory.
  * @param link_hash A sc-link hash
  * @returns SC_TRUE, if such sc-string content exists.
@@ -121,6 +162,48 @@ sc_fs_memory_status sc_fs_memory_get_string_by_link_hash(
     sc_char ** string,
     sc_uint32 * string_size);
 
+/*! Appends string to the end of sc-link content without rewriting its previous parts.
+ * @param link_hash A sc-link hash
+ * @param string A string to append
+ * @param string_size A string size
+ * @returns SC_FS_MEMORY_OK, if are no writing errors.
+ */
+sc_fs_memory_status sc_fs_memory_append_string(sc_addr_hash link_hash, sc_char const * string, sc_uint64 string_size);
+
+/*! Gets location and size of sc-link content string by sc-link hash without reading content.
+ * @param link_hash A sc-link hash
+ * @param[out] string_location A location of sc-link content string to read its parts
+ * @param[out] string_size A sc-link content string size
+ * @returns SC_FS_MEMORY_OK, if sc-link content exists.
+ */
+sc_fs_memory_status sc_fs_memory_get_string_location_by_link_hash(
+    sc_addr_hash link_hash,
+    sc_uint64 * string_location,
+    sc_uint64 * string_size);
+
+/*! Reads part of sc-link content string by its location without finding it by sc-link hash.
+ * @param link_hash A sc-link hash
+ * @param string_location A location of sc-link content string
+ * @param offset An offset of part in sc-link content string
+ * @param data A buffer to read part
+ * @param size A size of buffer, it must not be bigger than size of string after offset
+ * @param[out] read_bytes A count of read bytes
+ * @returns SC_FS_MEMORY_OK, if part is read.
+ */
+sc_fs_memory_status sc_fs_memory_read_string_by_location(
+    sc_addr_hash link_hash,
+    sc_uint64 string_location,
+    sc_uint64 offset,
+    sc_char * data,
+    sc_uint64 size,
+    sc_uint64 * read_bytes);
+
+/*! Gets statistics of cache of sc-link contents.
+ * @param[out] stat A pointer to statistics to fill
+ * @returns SC_FS_MEMORY_OK, if file system memory is initialized.
+ */
+sc_fs_memory_status sc_fs_memory_get_link_contents_cache_stat(sc_link_contents_cache_stat * stat);
+
 /*! Gets sc-link hashes from file system memory by its string content.
  * @param string A sc-links content string
  * @param string_size A sc-links content string size
@@ -21,11 +21,16 @@ sc_fs_memory_manager * sc_fs_memory_build()
   manager->load = sc_dictionary_fs_memory_load;
   manager->save = sc_dictionary_fs_memory_save;
   manager->link_string = sc_dictionary_fs_memory_link_string_ext;
+  manager->link_strings = sc_dictionary_fs_memory_link_strings;
   manager->get_link_hashes_by_string = sc_dictionary_fs_memory_get_link_hashes_by_string;
   manager->get_link_hashes_by_substring = sc_dictionary_fs_memory_get_link_hashes_by_substring_ext;
   manager->get_strings_by_substring = sc_dictionary_fs_memory_get_strings_by_substring_ext;
   manager->get_string_by_link_hash = sc_dictionary_fs_memory_get_string_by_link_hash;
   manager->unlink_string = sc_dictionary_fs_memory_unlink_string;
+  manager->append_string = sc_dictionary_fs_memory_append_string;
+  manager->get_string_location_by_link_hash = sc_dictionary_fs_memory_get_string_location_by_link_hash;
+  manager->read_string_by_location = sc_dictionary_fs_memory_read_string_by_location;
+  manager->get_link_contents_cache_stat = sc_dictionary_fs_memory_get_link_contents_cache_stat;
 #endif
 
   return manager;
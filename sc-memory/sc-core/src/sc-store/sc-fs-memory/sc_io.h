@@ -8,6 +8,7 @@
 #define _sc_io_h_
 
 #include <glib.h>
+#include <unistd.h>
 
 #include "sc-core/sc_types.h"
 
@@ -43,4 +44,14 @@ typedef GIOChannel sc_io_channel;
 
 #define sc_io_channel_seek(channel, offset, type, errors) g_io_channel_seek_position(channel, offset, type, errors)
 
+#define sc_io_channel_get_fd(channel) g_io_channel_unix_get_fd(channel)
+
+/// reads chars by offset in file of channel without changing its position, so it can be called concurrently
+#define sc_io_channel_read_chars_by_offset(channel, chars, count, offset) \
+  pread(sc_io_channel_get_fd(channel), chars, count, (off_t)(offset))
+
+/// writes chars by offset in file of channel without changing its position, so it can be called concurrently
+#define sc_io_channel_write_chars_by_offset(channel, chars, count, offset) \
+  pwrite(sc_io_channel_get_fd(channel), chars, count, (off_t)(offset))
+
 #endif
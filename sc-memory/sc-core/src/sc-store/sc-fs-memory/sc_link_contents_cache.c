@@ -0,0 +1,203 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_link_contents_cache.h"
+
+#include "sc-core/sc-base/sc_allocator.h"
+
+#define _sc_link_contents_cache_entry_size(string_size) (sizeof(sc_link_contents_cache_entry) + (string_size) + 1)
+
+sc_link_contents_cache_shard * _sc_link_contents_cache_get_shard(
+    sc_link_contents_cache * cache,
+    sc_addr_hash const link_hash)
+{
+  return &cache->shards[link_hash % SC_LINK_CONTENTS_CACHE_SHARDS_COUNT];
+}
+
+void _sc_link_contents_cache_entry_free(void * data)
+{
+  sc_link_contents_cache_entry * entry = data;
+  sc_mem_free(entry->string);
+  sc_mem_free(entry);
+}
+
+void _sc_link_contents_cache_unlink_entry(sc_link_contents_cache_shard * shard, sc_link_contents_cache_entry * entry)
+{
+  if (entry->prev != null_ptr)
+    entry->prev->next = entry->next;
+  else
+    shard->head = entry->next;
+
+  if (entry->next != null_ptr)
+    entry->next->prev = entry->prev;
+  else
+    shard->tail = entry->prev;
+
+  entry->prev = null_ptr;
+  entry->next = null_ptr;
+}
+
+void _sc_link_contents_cache_push_entry(sc_link_contents_cache_shard * shard, sc_link_contents_cache_entry * entry)
+{
+  entry->next = shard->head;
+  if (shard->head != null_ptr)
+    shard->head->prev = entry;
+  shard->head = entry;
+
+  if (shard->tail == null_ptr)
+    shard->tail = entry;
+}
+
+void _sc_link_contents_cache_remove_entry(sc_link_contents_cache_shard * shard, sc_link_contents_cache_entry * entry)
+{
+  _sc_link_contents_cache_unlink_entry(shard, entry);
+  sc_hash_map_remove(shard->entries, entry->link_hash);
+  shard->size -= _sc_link_contents_cache_entry_size(entry->string_size);
+  _sc_link_contents_cache_entry_free(entry);
+}
+
+sc_bool sc_link_contents_cache_initialize(sc_link_contents_cache ** cache, sc_uint64 max_size)
+{
+  *cache = sc_mem_new(sc_link_contents_cache, 1);
+  (*cache)->max_size = max_size;
+  (*cache)->max_shard_size = max_size / SC_LINK_CONTENTS_CACHE_SHARDS_COUNT;
+
+  for (sc_uint32 i = 0; i < SC_LINK_CONTENTS_CACHE_SHARDS_COUNT; ++i)
+  {
+    sc_link_contents_cache_shard * shard = &(*cache)->shards[i];
+    sc_mutex_init(&shard->mutex);
+    sc_hash_map_initialize(&shard->entries, 0);
+  }
+
+  return SC_TRUE;
+}
+
+sc_bool sc_link_contents_cache_destroy(sc_link_contents_cache * cache)
+{
+  if (cache == null_ptr)
+    return SC_FALSE;
+
+  for (sc_uint32 i = 0; i < SC_LINK_CONTENTS_CACHE_SHARDS_COUNT; ++i)
+  {
+    sc_link_contents_cache_shard * shard = &cache->shards[i];
+    sc_hash_map_destroy(shard->entries, _sc_link_contents_cache_entry_free);
+    sc_mutex_destroy(&shard->mutex);
+  }
+  sc_mem_free(cache);
+
+  return SC_TRUE;
+}
+
+sc_bool sc_link_contents_cache_get(
+    sc_link_contents_cache * cache,
+    sc_addr_hash link_hash,
+    sc_char ** string,
+    sc_uint64 * string_size,
+    sc_uint64 * version)
+{
+  *string = null_ptr;
+  *string_size = 0;
+  *version = 0;
+
+  if (cache->max_shard_size == 0)
+    return SC_FALSE;
+
+  sc_link_contents_cache_shard * shard = _sc_link_contents_cache_get_shard(cache, link_hash);
+  sc_mutex_lock(&shard->mutex);
+
+  sc_link_contents_cache_entry * entry = sc_hash_map_get(shard->entries, link_hash);
+  if (entry == null_ptr)
+  {
+    ++shard->misses_count;
+    *version = shard->version;
+    sc_mutex_unlock(&shard->mutex);
+    return SC_FALSE;
+  }
+
+  ++shard->hits_count;
+  _sc_link_contents_cache_unlink_entry(shard, entry);
+  _sc_link_contents_cache_push_entry(shard, entry);
+
+  *string = sc_mem_new(sc_char, entry->string_size + 1);
+  sc_mem_cpy(*string, entry->string, entry->string_size);
+  *string_size = entry->string_size;
+
+  sc_mutex_unlock(&shard->mutex);
+  return SC_TRUE;
+}
+
+void sc_link_contents_cache_put(
+    sc_link_contents_cache * cache,
+    sc_addr_hash link_hash,
+    sc_char const * string,
+    sc_uint64 string_size,
+    sc_uint64 version)
+{
+  // contents bigger than shard would evict all other contents
+  sc_uint64 const size = _sc_link_contents_cache_entry_size(string_size);
+  if (size > cache->max_shard_size)
+    return;
+
+  sc_link_contents_cache_shard * shard = _sc_link_contents_cache_get_shard(cache, link_hash);
+  sc_mutex_lock(&shard->mutex);
+
+  if (shard->version != version || sc_hash_map_get(shard->entries, link_hash) != null_ptr)
+    goto exit;
+
+  while (shard->size + size > cache->max_shard_size)
+  {
+    _sc_link_contents_cache_remove_entry(shard, shard->tail);
+    ++shard->evictions_count;
+  }
+
+  sc_link_contents_cache_entry * entry = sc_mem_new(sc_link_contents_cache_entry, 1);
+  entry->link_hash = link_hash;
+  entry->string = sc_mem_new(sc_char, string_size + 1);
+  sc_mem_cpy(entry->string, string, string_size);
+  entry->string_size = string_size;
+
+  sc_hash_map_insert(shard->entries, link_hash, entry);
+  _sc_link_contents_cache_push_entry(shard, entry);
+  shard->size += size;
+
+exit:
+  sc_mutex_unlock(&shard->mutex);
+}
+
+void sc_link_contents_cache_remove(sc_link_contents_cache * cache, sc_addr_hash link_hash)
+{
+  if (cache->max_shard_size == 0)
+    return;
+
+  sc_link_contents_cache_shard * shard = _sc_link_contents_cache_get_shard(cache, link_hash);
+  sc_mutex_lock(&shard->mutex);
+
+  // contents read before removal may be already changed, so they aren't cached after it
+  ++shard->version;
+  sc_link_contents_cache_entry * entry = sc_hash_map_get(shard->entries, link_hash);
+  if (entry != null_ptr)
+    _sc_link_contents_cache_remove_entry(shard, entry);
+
+  sc_mutex_unlock(&shard->mutex);
+}
+
+void sc_link_contents_cache_get_stat(sc_link_contents_cache * cache, sc_link_contents_cache_stat * stat)
+{
+  sc_mem_set(stat, 0, sizeof(sc_link_contents_cache_stat));
+  stat->max_size = cache->max_size;
+
+  for (sc_uint32 i = 0; i < SC_LINK_CONTENTS_CACHE_SHARDS_COUNT; ++i)
+  {
+    sc_link_contents_cache_shard * shard = &cache->shards[i];
+    sc_mutex_lock(&shard->mutex);
+    stat->hits_count += shard->hits_count;
+    stat->misses_count += shard->misses_count;
+    stat->evictions_count += shard->evictions_count;
+    stat->contents_count += shard->entries->size;
+    stat->size += shard->size;
+    sc_mutex_unlock(&shard->mutex);
+  }
+}
@@ -0,0 +1,106 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_link_contents_cache_h_
+#define _sc_link_contents_cache_h_
+
+#include "sc-core/sc_types.h"
+
+#include "sc-store/sc-container/sc_hash_map.h"
+#include "sc-store/sc-base/sc_mutex_private.h"
+
+//! Count of shards of cache, contents of links of different shards are read and cached in parallel
+#define SC_LINK_CONTENTS_CACHE_SHARDS_COUNT 16
+
+//! Cached content of link, entries of shard are linked from the most recently used to the least recently used one
+typedef struct _sc_link_contents_cache_entry
+{
+  sc_addr_hash link_hash;
+  sc_char * string;  // copied content ended by zero
+  sc_uint64 string_size;
+  struct _sc_link_contents_cache_entry * prev;
+  struct _sc_link_contents_cache_entry * next;
+} sc_link_contents_cache_entry;
+
+typedef struct _sc_link_contents_cache_shard
+{
+  sc_mutex mutex;
+  sc_hash_map * entries;                // link hashes and their entries
+  sc_link_contents_cache_entry * head;  // the most recently used entry
+  sc_link_contents_cache_entry * tail;  // the least recently used entry, it is evicted first
+  sc_uint64 size;                       // count of bytes of cached contents and their entries
+  sc_uint64 version;                    // it is increased on every removal of content
+  sc_uint64 hits_count;
+  sc_uint64 misses_count;
+  sc_uint64 evictions_count;
+} sc_link_contents_cache_shard;
+
+/*! Bounded LRU cache of link contents by link hashes. Links are distributed among shards by their hashes, every shard
+ * has its own lock and evicts its least recently used contents when its part of cache size is exceeded.
+ */
+typedef struct _sc_link_contents_cache
+{
+  sc_link_contents_cache_shard shards[SC_LINK_CONTENTS_CACHE_SHARDS_COUNT];
+  sc_uint64 max_size;        // count of bytes of all shards, cache is disabled if it is 0
+  sc_uint64 max_shard_size;  // count of bytes of one shard
+} sc_link_contents_cache;
+
+/*! Initializes sc-link-contents-cache
+ * @param[out] cache Pointer to a sc-link-contents-cache pointer to initialize
+ * @param max_size A count of bytes of cached contents with their entries, cache is disabled if it is 0
+ * @returns Returns SC_TRUE, if sc-link-contents-cache is initialized.
+ */
+sc_bool sc_link_contents_cache_initialize(sc_link_contents_cache ** cache, sc_uint64 max_size);
+
+/*! Destroys a sc-link-contents-cache with all cached contents
+ * @param cache A sc-link-contents-cache pointer to destroy
+ * @returns Returns SC_TRUE, if a sc-link-contents-cache exists; otherwise return SC_FALSE.
+ */
+sc_bool sc_link_contents_cache_destroy(sc_link_contents_cache * cache);
+
+/*! Gets copy of cached content of link, found content becomes the most recently used one
+ * @param cache A sc-link-contents-cache pointer
+ * @param link_hash A link hash
+ * @param[out] string A copy of content ended by zero, it must be freed
+ * @param[out] string_size A content size
+ * @param[out] version A version of shard of link, it is passed to sc_link_contents_cache_put if content isn't found
+ * @returns Returns SC_TRUE, if content is found.
+ */
+sc_bool sc_link_contents_cache_get(
+    sc_link_contents_cache * cache,
+    sc_addr_hash link_hash,
+    sc_char ** string,
+    sc_uint64 * string_size,
+    sc_uint64 * version);
+
+/*! Caches copy of content of link read after sc_link_contents_cache_get. Content isn't cached if content of any link
+ * of its shard has been removed since version was got, because read content may be already changed.
+ * @param cache A sc-link-contents-cache pointer
+ * @param link_hash A link hash
+ * @param string A content
+ * @param string_size A content size
+ * @param version A version of shard of link got by sc_link_contents_cache_get
+ */
+void sc_link_contents_cache_put(
+    sc_link_contents_cache * cache,
+    sc_addr_hash link_hash,
+    sc_char const * string,
+    sc_uint64 string_size,
+    sc_uint64 version);
+
+/*! Removes cached content of link, it must be called after content of link is changed
+ * @param cache A sc-link-contents-cache pointer
+ * @param link_hash A link hash
+ */
+void sc_link_contents_cache_remove(sc_link_contents_cache * cache, sc_addr_hash link_hash);
+
+/*! Gets counters of sc-link-contents-cache
+ * @param cache A sc-link-contents-cache pointer
+ * @param[out] stat A pointer to statistics of sc-link-contents-cache
+ */
+void sc_link_contents_cache_get_stat(sc_link_contents_cache * cache, sc_link_contents_cache_stat * stat);
+
+#endif
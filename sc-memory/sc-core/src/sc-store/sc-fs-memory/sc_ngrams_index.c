@@ -0,0 +1,481 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_ngrams_index.h"
+
+#include "sc-core/sc-base/sc_allocator.h"
+
+#define SC_NGRAM_POSTINGS_MIN_CAPACITY 8
+//! Max count of bytes of one encoded string offset: 64 bits by 7-bit groups
+#define SC_NGRAM_POSTINGS_MAX_ENCODED_SIZE 10
+//! Min count of string offsets appended not in order after which they are merged into encoded ones
+#define SC_NGRAM_POSTINGS_MIN_UNSORTED_COUNT 64
+
+sc_uint64 _sc_ngram_get_key(sc_char const * ngram)
+{
+  sc_uint64 key = 0;
+  for (sc_uint32 i = 0; i < SC_NGRAM_SIZE; ++i)
+    key = (key << 8) | (sc_uint8)ngram[i];
+  return key;
+}
+
+void _sc_ngram_postings_destroy(void * postings)
+{
+  sc_mem_free(((sc_ngram_postings *)postings)->bytes);
+  sc_mem_free(((sc_ngram_postings *)postings)->unsorted_string_offsets);
+  sc_mem_free(postings);
+}
+
+sc_uint64 _sc_ngram_postings_get_memory_size(sc_ngram_postings const * postings)
+{
+  return sizeof(sc_ngram_postings) + postings->capacity + postings->unsorted_capacity * sizeof(sc_uint64);
+}
+
+sc_bool sc_ngrams_index_initialize(sc_ngrams_index ** index)
+{
+  *index = sc_mem_new(sc_ngrams_index, 1);
+  sc_hash_map_initialize(&(*index)->ngrams_postings, 0);
+  (*index)->postings_size = 0;
+
+  return SC_TRUE;
+}
+
+sc_bool sc_ngrams_index_destroy(sc_ngrams_index * index)
+{
+  if (index == null_ptr)
+    return SC_FALSE;
+
+  sc_hash_map_destroy(index->ngrams_postings, _sc_ngram_postings_destroy);
+  sc_mem_free(index);
+
+  return SC_TRUE;
+}
+
+void _sc_ngram_postings_reserve(sc_ngrams_index * index, sc_ngram_postings * postings, sc_uint32 size)
+{
+  if (size <= postings->capacity)
+    return;
+
+  sc_uint32 capacity = postings->capacity == 0 ? SC_NGRAM_POSTINGS_MIN_CAPACITY : postings->capacity;
+  while (capacity < size)
+    capacity <<= 1;
+
+  sc_uint8 * bytes = sc_mem_new(sc_uint8, capacity);
+  if (postings->bytes != null_ptr)
+    sc_mem_cpy(bytes, postings->bytes, postings->size);
+  sc_mem_free(postings->bytes);
+
+  if (index != null_ptr)
+    index->postings_size += capacity - postings->capacity;
+  postings->bytes = bytes;
+  postings->capacity = capacity;
+}
+
+void _sc_ngram_postings_encode(sc_ngrams_index * index, sc_ngram_postings * postings, sc_uint64 value)
+{
+  _sc_ngram_postings_reserve(index, postings, postings->size + SC_NGRAM_POSTINGS_MAX_ENCODED_SIZE);
+
+  for (; value >= 0x80; value >>= 7)
+    postings->bytes[postings->size++] = (sc_uint8)(value & 0x7F) | 0x80;
+  postings->bytes[postings->size++] = (sc_uint8)value;
+}
+
+sc_uint64 _sc_ngram_postings_decode(sc_uint8 const * bytes, sc_uint32 * position)
+{
+  sc_uint64 value = 0;
+  for (sc_uint32 shift = 0;; shift += 7)
+  {
+    sc_uint8 const byte = bytes[(*position)++];
+    value |= (sc_uint64)(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0)
+      return value;
+  }
+}
+
+int _sc_ngram_postings_compare_string_offsets(void const * first, void const * second)
+{
+  sc_uint64 const first_string_offset = *(sc_uint64 const *)first;
+  sc_uint64 const second_string_offset = *(sc_uint64 const *)second;
+  return (first_string_offset > second_string_offset) - (first_string_offset < second_string_offset);
+}
+
+sc_uint64 * _sc_ngram_postings_decode_all(sc_ngram_postings const * postings, sc_uint64 * string_offsets_count)
+{
+  sc_uint64 const all_count = postings->count + postings->unsorted_count;
+  sc_uint64 * string_offsets = sc_mem_new(sc_uint64, all_count);
+
+  sc_uint32 position = 0;
+  sc_uint64 string_offset = 0;
+  for (sc_uint64 i = 0; i < postings->count; ++i)
+  {
+    string_offset += _sc_ngram_postings_decode(postings->bytes, &position);
+    string_offsets[i] = string_offset;
+  }
+
+  *string_offsets_count = postings->count;
+  if (postings->unsorted_count == 0)
+    return string_offsets;
+
+  sc_uint64 * unsorted_string_offsets = string_offsets + postings->count;
+  sc_mem_cpy(
+      unsorted_string_offsets,
+      postings->unsorted_string_offsets,
+      postings->unsorted_count * sizeof(sc_uint64));
+  qsort(
+      unsorted_string_offsets,
+      postings->unsorted_count,
+      sizeof(sc_uint64),
+      _sc_ngram_postings_compare_string_offsets);
+
+  // encoded and unsorted string offsets are merged without duplicates
+  sc_uint64 * merged_string_offsets = sc_mem_new(sc_uint64, all_count);
+  sc_uint64 merged_count = 0;
+  for (sc_uint64 i = 0, j = 0; i < postings->count || j < postings->unsorted_count;)
+  {
+    if (j == postings->unsorted_count || (i < postings->count && string_offsets[i] <= unsorted_string_offsets[j]))
+      string_offset = string_offsets[i++];
+    else
+      string_offset = unsorted_string_offsets[j++];
+
+    if (merged_count == 0 || merged_string_offsets[merged_count - 1] != string_offset)
+      merged_string_offsets[merged_count++] = string_offset;
+  }
+  sc_mem_free(string_offsets);
+
+  *string_offsets_count = merged_count;
+  return merged_string_offsets;
+}
+
+void _sc_ngram_postings_clear_unsorted(sc_ngrams_index * index, sc_ngram_postings * postings)
+{
+  index->postings_size -= postings->unsorted_capacity * sizeof(sc_uint64);
+  sc_mem_free(postings->unsorted_string_offsets);
+  postings->unsorted_string_offsets = null_ptr;
+  postings->unsorted_count = 0;
+  postings->unsorted_capacity = 0;
+}
+
+void _sc_ngram_postings_append(sc_ngrams_index * index, sc_ngram_postings * postings, sc_uint64 string_offset);
+
+void _sc_ngram_postings_merge(sc_ngrams_index * index, sc_ngram_postings * postings)
+{
+  sc_uint64 string_offsets_count;
+  sc_uint64 * string_offsets = _sc_ngram_postings_decode_all(postings, &string_offsets_count);
+  _sc_ngram_postings_clear_unsorted(index, postings);
+
+  postings->size = 0;
+  postings->count = 0;
+  for (sc_uint64 i = 0; i < string_offsets_count; ++i)
+    _sc_ngram_postings_append(index, postings, string_offsets[i]);
+
+  sc_mem_free(string_offsets);
+}
+
+void _sc_ngram_postings_append(sc_ngrams_index * index, sc_ngram_postings * postings, sc_uint64 string_offset)
+{
+  if (postings->count == 0 || string_offset > postings->last_string_offset)
+  {
+    _sc_ngram_postings_encode(
+        index, postings, string_offset - (postings->count == 0 ? 0 : postings->last_string_offset));
+    postings->last_string_offset = string_offset;
+    ++postings->count;
+    return;
+  }
+
+  if (string_offset == postings->last_string_offset)
+    return;
+
+  // strings written in parallel may be indexed not in order of their offsets, such string offsets are collected
+  // and merged into encoded ones together, when there are enough of them
+  if (postings->unsorted_count == postings->unsorted_capacity)
+  {
+    sc_uint32 const capacity =
+        postings->unsorted_capacity == 0 ? SC_NGRAM_POSTINGS_MIN_CAPACITY : postings->unsorted_capacity << 1;
+    sc_uint64 * unsorted_string_offsets = sc_mem_new(sc_uint64, capacity);
+    if (postings->unsorted_string_offsets != null_ptr)
+      sc_mem_cpy(
+          unsorted_string_offsets, postings->unsorted_string_offsets, postings->unsorted_count * sizeof(sc_uint64));
+    sc_mem_free(postings->unsorted_string_offsets);
+
+    index->postings_size += (capacity - postings->unsorted_capacity) * sizeof(sc_uint64);
+    postings->unsorted_string_offsets = unsorted_string_offsets;
+    postings->unsorted_capacity = capacity;
+  }
+  postings->unsorted_string_offsets[postings->unsorted_count++] = string_offset;
+
+  if (postings->unsorted_count >= SC_NGRAM_POSTINGS_MIN_UNSORTED_COUNT
+      && postings->unsorted_count >= postings->count / 8)
+    _sc_ngram_postings_merge(index, postings);
+}
+
+void sc_ngrams_index_append(
+    sc_ngrams_index * index,
+    sc_char const * string,
+    sc_uint64 string_size,
+    sc_uint64 string_offset)
+{
+  if (string_size < SC_NGRAM_SIZE)
+    return;
+
+  sc_uint64 const ngrams_count = string_size - SC_NGRAM_SIZE + 1;
+
+  // string offset is appended once to postings of repeated n-grams of string
+  sc_hash_map * string_ngrams;
+  sc_hash_map_initialize(&string_ngrams, ngrams_count);
+
+  for (sc_uint64 i = 0; i < ngrams_count; ++i)
+  {
+    sc_uint64 const key = _sc_ngram_get_key(string + i);
+    if (sc_hash_map_insert(string_ngrams, key, (void *)SC_TRUE) != null_ptr)
+      continue;
+
+    sc_ngram_postings * postings = sc_hash_map_get(index->ngrams_postings, key);
+    if (postings == null_ptr)
+    {
+      postings = sc_mem_new(sc_ngram_postings, 1);
+      sc_hash_map_insert(index->ngrams_postings, key, postings);
+      index->postings_size += sizeof(sc_ngram_postings);
+    }
+
+    _sc_ngram_postings_append(index, postings, string_offset);
+  }
+
+  sc_hash_map_destroy(string_ngrams, null_ptr);
+}
+
+sc_uint64 _sc_ngram_postings_intersect(
+    sc_ngram_postings const * postings,
+    sc_uint64 * string_offsets,
+    sc_uint64 string_offsets_count)
+{
+  sc_uint64 intersected_count = 0;
+  sc_uint64 i = 0;
+
+  if (postings->unsorted_count != 0)
+  {
+    sc_uint64 postings_string_offsets_count;
+    sc_uint64 * postings_string_offsets = _sc_ngram_postings_decode_all(postings, &postings_string_offsets_count);
+    for (sc_uint64 j = 0; j < postings_string_offsets_count && i < string_offsets_count; ++j)
+    {
+      for (; i < string_offsets_count && string_offsets[i] < postings_string_offsets[j]; ++i)
+        ;
+
+      if (i < string_offsets_count && string_offsets[i] == postings_string_offsets[j])
+        string_offsets[intersected_count++] = string_offsets[i++];
+    }
+    sc_mem_free(postings_string_offsets);
+    return intersected_count;
+  }
+
+  sc_uint32 position = 0;
+  sc_uint64 string_offset = 0;
+  for (sc_uint64 j = 0; j < postings->count && i < string_offsets_count; ++j)
+  {
+    string_offset += _sc_ngram_postings_decode(postings->bytes, &position);
+    for (; i < string_offsets_count && string_offsets[i] < string_offset; ++i)
+      ;
+
+    if (i < string_offsets_count && string_offsets[i] == string_offset)
+      string_offsets[intersected_count++] = string_offsets[i++];
+  }
+
+  return intersected_count;
+}
+
+sc_bool sc_ngrams_index_get_string_offsets(
+    sc_ngrams_index const * index,
+    sc_char const * substring,
+    sc_uint64 substring_size,
+    sc_uint64 ** string_offsets,
+    sc_uint64 * string_offsets_count)
+{
+  *string_offsets = null_ptr;
+  *string_offsets_count = 0;
+
+  if (substring_size < SC_NGRAM_SIZE)
+    return SC_FALSE;
+
+  sc_uint64 const ngrams_count = substring_size - SC_NGRAM_SIZE + 1;
+  sc_ngram_postings ** ngrams_postings = sc_mem_new(sc_ngram_postings *, ngrams_count);
+
+  for (sc_uint64 i = 0; i < ngrams_count; ++i)
+  {
+    sc_ngram_postings * postings = sc_hash_map_get(index->ngrams_postings, _sc_ngram_get_key(substring + i));
+    if (postings == null_ptr)
+      goto result;
+
+    // postings are intersected from the shortest ones, so less string offsets are decoded
+    sc_uint64 j = i;
+    for (; j > 0
+           && ngrams_postings[j - 1]->count + ngrams_postings[j - 1]->unsorted_count
+                  > postings->count + postings->unsorted_count;
+         --j)
+      ngrams_postings[j] = ngrams_postings[j - 1];
+    ngrams_postings[j] = postings;
+  }
+
+  *string_offsets = _sc_ngram_postings_decode_all(ngrams_postings[0], string_offsets_count);
+  for (sc_uint64 i = 1; i < ngrams_count && *string_offsets_count > 0; ++i)
+  {
+    if (ngrams_postings[i] == ngrams_postings[i - 1])
+      continue;
+
+    *string_offsets_count = _sc_ngram_postings_intersect(ngrams_postings[i], *string_offsets, *string_offsets_count);
+  }
+
+  if (*string_offsets_count == 0)
+  {
+    sc_mem_free(*string_offsets);
+    *string_offsets = null_ptr;
+  }
+
+result:
+  sc_mem_free(ngrams_postings);
+  return SC_TRUE;
+}
+
+sc_bool _sc_ngrams_index_remap_postings(sc_uint64 key, void * data, void ** arguments)
+{
+  sc_ngrams_index * index = arguments[0];
+  sc_hash_map const * string_offsets_map = arguments[1];
+  sc_hash_map * ngrams_postings = arguments[2];
+  sc_ngram_postings * postings = data;
+
+  // string offsets are mapped in the same order, so postings are only appended
+  sc_uint64 count;
+  sc_uint64 * string_offsets = _sc_ngram_postings_decode_all(postings, &count);
+  _sc_ngram_postings_clear_unsorted(index, postings);
+  postings->size = 0;
+  postings->count = 0;
+  for (sc_uint64 i = 0; i < count; ++i)
+  {
+    sc_uint64 const string_offset = (sc_uint64)sc_hash_map_get(string_offsets_map, string_offsets[i]);
+    if (string_offset != 0)
+      _sc_ngram_postings_append(index, postings, string_offset - 1);
+  }
+  sc_mem_free(string_offsets);
+
+  if (postings->count == 0)
+  {
+    index->postings_size -= _sc_ngram_postings_get_memory_size(postings);
+    _sc_ngram_postings_destroy(postings);
+  }
+  else
+    sc_hash_map_insert(ngrams_postings, key, postings);
+
+  return SC_TRUE;
+}
+
+void sc_ngrams_index_remap(sc_ngrams_index * index, sc_hash_map const * string_offsets_map)
+{
+  sc_hash_map * ngrams_postings;
+  sc_hash_map_initialize(&ngrams_postings, index->ngrams_postings->size);
+
+  void * arguments[3];
+  arguments[0] = index;
+  arguments[1] = (void *)string_offsets_map;
+  arguments[2] = ngrams_postings;
+  sc_hash_map_visit(index->ngrams_postings, _sc_ngrams_index_remap_postings, arguments);
+
+  sc_hash_map_destroy(index->ngrams_postings, null_ptr);
+  index->ngrams_postings = ngrams_postings;
+}
+
+sc_bool _sc_ngrams_index_write_chars(sc_io_channel * channel, void const * chars, sc_uint64 size)
+{
+  sc_uint64 written_bytes = 0;
+  return sc_io_channel_write_chars(channel, chars, size, &written_bytes, null_ptr) == SC_FS_IO_STATUS_NORMAL
+         && written_bytes == size;
+}
+
+sc_bool _sc_ngrams_index_read_chars(sc_io_channel * channel, void * chars, sc_uint64 size)
+{
+  sc_uint64 read_bytes = 0;
+  return sc_io_channel_read_chars(channel, (sc_char *)chars, size, &read_bytes, null_ptr) == SC_FS_IO_STATUS_NORMAL
+         && read_bytes == size;
+}
+
+sc_bool _sc_ngrams_index_write_postings(sc_uint64 key, void * data, void ** arguments)
+{
+  sc_io_channel * channel = arguments[0];
+  sc_ngram_postings const * postings = data;
+
+  // sc-ngrams-index isn't changed while it is written, so unsorted string offsets are merged into a copy of postings
+  sc_ngram_postings merged_postings = {0};
+  if (postings->unsorted_count != 0)
+  {
+    sc_uint64 string_offsets_count;
+    sc_uint64 * string_offsets = _sc_ngram_postings_decode_all(postings, &string_offsets_count);
+    for (sc_uint64 i = 0; i < string_offsets_count; ++i)
+      _sc_ngram_postings_append(null_ptr, &merged_postings, string_offsets[i]);
+    sc_mem_free(string_offsets);
+    postings = &merged_postings;
+  }
+
+  sc_bool const result =
+      _sc_ngrams_index_write_chars(channel, &key, sizeof(key))
+      && _sc_ngrams_index_write_chars(channel, &postings->count, sizeof(postings->count))
+      && _sc_ngrams_index_write_chars(channel, &postings->last_string_offset, sizeof(postings->last_string_offset))
+      && _sc_ngrams_index_write_chars(channel, &postings->size, sizeof(postings->size))
+      && _sc_ngrams_index_write_chars(channel, postings->bytes, postings->size);
+
+  sc_mem_free(merged_postings.bytes);
+  return result;
+}
+
+sc_bool sc_ngrams_index_write(sc_ngrams_index const * index, sc_io_channel * channel)
+{
+  sc_uint64 const ngrams_count = index->ngrams_postings->size;
+  if (!_sc_ngrams_index_write_chars(channel, &ngrams_count, sizeof(ngrams_count)))
+    return SC_FALSE;
+
+  return sc_hash_map_visit(index->ngrams_postings, _sc_ngrams_index_write_postings, (void **)&channel);
+}
+
+sc_bool sc_ngrams_index_read(sc_ngrams_index * index, sc_io_channel * channel)
+{
+  sc_uint64 ngrams_count;
+  if (!_sc_ngrams_index_read_chars(channel, &ngrams_count, sizeof(ngrams_count)))
+    return SC_FALSE;
+
+  sc_hash_map_reserve(index->ngrams_postings, ngrams_count);
+  for (sc_uint64 i = 0; i < ngrams_count; ++i)
+  {
+    sc_uint64 key;
+    sc_ngram_postings * postings = sc_mem_new(sc_ngram_postings, 1);
+    if (!_sc_ngrams_index_read_chars(channel, &key, sizeof(key))
+        || !_sc_ngrams_index_read_chars(channel, &postings->count, sizeof(postings->count))
+        || !_sc_ngrams_index_read_chars(channel, &postings->last_string_offset, sizeof(postings->last_string_offset))
+        || !_sc_ngrams_index_read_chars(channel, &postings->size, sizeof(postings->size)))
+    {
+      sc_mem_free(postings);
+      return SC_FALSE;
+    }
+
+    postings->capacity = postings->size;
+    postings->bytes = sc_mem_new(sc_uint8, postings->capacity);
+    if (!_sc_ngrams_index_read_chars(channel, postings->bytes, postings->size))
+    {
+      _sc_ngram_postings_destroy(postings);
+      return SC_FALSE;
+    }
+
+    index->postings_size += _sc_ngram_postings_get_memory_size(postings);
+    postings = sc_hash_map_insert(index->ngrams_postings, key, postings);
+    if (postings != null_ptr)
+    {
+      index->postings_size -= _sc_ngram_postings_get_memory_size(postings);
+      _sc_ngram_postings_destroy(postings);
+    }
+  }
+
+  return SC_TRUE;
+}
+
+sc_uint64 sc_ngrams_index_get_memory_size(sc_ngrams_index const * index)
+{
+  return sizeof(sc_ngrams_index) + sc_hash_map_get_memory_size(index->ngrams_postings) + index->postings_size;
+}
@@ -0,0 +1,103 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_ngrams_index_h_
+#define _sc_ngrams_index_h_
+
+#include "sc-core/sc_types.h"
+
+#include "sc-store/sc-container/sc_hash_map.h"
+
+#include "sc_io.h"
+
+//! Size of substrings of strings by which strings are indexed
+#define SC_NGRAM_SIZE 3
+
+//! Sorted offsets of strings with n-gram. They are stored as differences between neighbour offsets by 7-bit groups.
+//! String offsets appended not in order are kept unsorted and merged into encoded ones by batches.
+typedef struct _sc_ngram_postings
+{
+  sc_uint8 * bytes;                     // encoded differences between string offsets
+  sc_uint32 size;                       // count of used bytes
+  sc_uint32 capacity;                   // count of allocated bytes
+  sc_uint64 count;                      // count of encoded string offsets
+  sc_uint64 last_string_offset;         // the biggest encoded string offset, new strings are appended after it
+  sc_uint64 * unsorted_string_offsets;  // string offsets less than last string offset, they may repeat encoded ones
+  sc_uint32 unsorted_count;             // count of unsorted string offsets
+  sc_uint32 unsorted_capacity;          // count of allocated unsorted string offsets
+} sc_ngram_postings;
+
+//! Inverted index of strings by their n-grams to find strings by substrings
+typedef struct _sc_ngrams_index
+{
+  sc_hash_map * ngrams_postings;  // n-grams and postings of strings with them
+  sc_uint64 postings_size;        // count of bytes allocated by postings
+} sc_ngrams_index;
+
+/*! Initializes sc-ngrams-index
+ * @param[out] index Pointer to a sc-ngrams-index pointer to initialize
+ * @returns Returns SC_TRUE, if sc-ngrams-index is initialized.
+ */
+sc_bool sc_ngrams_index_initialize(sc_ngrams_index ** index);
+
+/*! Destroys a sc-ngrams-index
+ * @param index A sc-ngrams-index pointer to destroy
+ * @returns Returns SC_TRUE, if a sc-ngrams-index exists; otherwise return SC_FALSE.
+ */
+sc_bool sc_ngrams_index_destroy(sc_ngrams_index * index);
+
+/*! Appends string offset to postings of all n-grams of string
+ * @param index A sc-ngrams-index pointer
+ * @param string A string to index
+ * @param string_size A string size
+ * @param string_offset An offset of string in fs-memory
+ */
+void sc_ngrams_index_append(
+    sc_ngrams_index * index,
+    sc_char const * string,
+    sc_uint64 string_size,
+    sc_uint64 string_offset);
+
+/*! Gets sorted offsets of strings that contain all n-grams of substring, these strings may contain substring
+ * @param index A sc-ngrams-index pointer
+ * @param substring A substring to find strings by it
+ * @param substring_size A substring size
+ * @param[out] string_offsets A pointer to array of found string offsets, it must be freed
+ * @param[out] string_offsets_count A count of found string offsets
+ * @returns Returns SC_FALSE, if substring is shorter than n-gram and can't be found by sc-ngrams-index.
+ */
+sc_bool sc_ngrams_index_get_string_offsets(
+    sc_ngrams_index const * index,
+    sc_char const * substring,
+    sc_uint64 substring_size,
+    sc_uint64 ** string_offsets,
+    sc_uint64 * string_offsets_count);
+
+/*! Replaces string offsets in postings by new ones, postings without new string offsets are removed
+ * @param index A sc-ngrams-index pointer
+ * @param string_offsets_map A map with string offsets and new string offsets + 1, new string offsets must be in the
+ * same order as string offsets
+ */
+void sc_ngrams_index_remap(sc_ngrams_index * index, sc_hash_map const * string_offsets_map);
+
+/*! Writes sc-ngrams-index with encoded postings into channel
+ * @param index A sc-ngrams-index pointer
+ * @param channel A channel to write
+ * @returns Returns SC_TRUE, if sc-ngrams-index is written.
+ */
+sc_bool sc_ngrams_index_write(sc_ngrams_index const * index, sc_io_channel * channel);
+
+/*! Reads sc-ngrams-index written by sc_ngrams_index_write from channel
+ * @param index A sc-ngrams-index pointer
+ * @param channel A channel to read
+ * @returns Returns SC_TRUE, if sc-ngrams-index is read.
+ */
+sc_bool sc_ngrams_index_read(sc_ngrams_index * index, sc_io_channel * channel);
+
+//! Gets count of bytes allocated by sc-ngrams-index
+sc_uint64 sc_ngrams_index_get_memory_size(sc_ngrams_index const * index);
+
+#endif
@@ -0,0 +1,423 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_strings_blocks.h"
+
+#include "sc-core/sc-base/sc_allocator.h"
+
+#include "sc_file_system.h"
+
+#ifdef SC_FS_MEMORY_COMPRESSION
+#  include <lz4.h>
+#endif
+
+#define SC_STRINGS_BLOCKS_MIN_CAPACITY 16
+
+sc_bool sc_strings_blocks_initialize(sc_strings_blocks ** blocks, sc_char const * path)
+{
+  sc_io_channel * channel = sc_fs_is_file(path) ? sc_io_new_append_channel(path, null_ptr)
+                                                : sc_io_new_write_channel(path, null_ptr);
+  if (channel == null_ptr)
+  {
+    *blocks = null_ptr;
+    return SC_FALSE;
+  }
+  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+  *blocks = sc_mem_new(sc_strings_blocks, 1);
+  (*blocks)->channel = channel;
+  (*blocks)->buffer = sc_mem_new(sc_char, SC_STRINGS_BLOCK_SIZE);
+
+  return SC_TRUE;
+}
+
+sc_bool sc_strings_blocks_destroy(sc_strings_blocks * blocks)
+{
+  if (blocks == null_ptr)
+    return SC_FALSE;
+
+  sc_io_channel_shutdown(blocks->channel, SC_TRUE, null_ptr);
+  sc_mem_free(blocks->blocks);
+  sc_mem_free(blocks->buffer);
+  sc_mem_free(blocks);
+
+  return SC_TRUE;
+}
+
+sc_strings_block * _sc_strings_blocks_push_block(sc_strings_blocks * blocks)
+{
+  if (blocks->blocks_count == blocks->blocks_capacity)
+  {
+    sc_uint64 const capacity =
+        blocks->blocks_capacity == 0 ? SC_STRINGS_BLOCKS_MIN_CAPACITY : blocks->blocks_capacity << 1;
+    sc_strings_block * new_blocks = sc_mem_new(sc_strings_block, capacity);
+    if (blocks->blocks != null_ptr)
+      sc_mem_cpy(new_blocks, blocks->blocks, blocks->blocks_count * sizeof(sc_strings_block));
+    sc_mem_free(blocks->blocks);
+
+    blocks->blocks = new_blocks;
+    blocks->blocks_capacity = capacity;
+  }
+
+  return &blocks->blocks[blocks->blocks_count++];
+}
+
+sc_bool _sc_strings_blocks_write_chars(
+    sc_io_channel * channel,
+    sc_uint64 const file_offset,
+    sc_char const * chars,
+    sc_uint64 const count)
+{
+  sc_uint64 written_bytes = 0;
+  while (written_bytes < count)
+  {
+    sc_int64 const result = sc_io_channel_write_chars_by_offset(
+        channel, chars + written_bytes, count - written_bytes, file_offset + written_bytes);
+    if (result <= 0)
+      return SC_FALSE;
+
+    written_bytes += result;
+  }
+
+  return SC_TRUE;
+}
+
+sc_bool _sc_strings_blocks_read_chars(
+    sc_io_channel * channel,
+    sc_uint64 const file_offset,
+    sc_char * chars,
+    sc_uint64 const count)
+{
+  sc_uint64 read_bytes = 0;
+  while (read_bytes < count)
+  {
+    sc_int64 const result =
+        sc_io_channel_read_chars_by_offset(channel, chars + read_bytes, count - read_bytes, file_offset + read_bytes);
+    if (result <= 0)
+      return SC_FALSE;
+
+    read_bytes += result;
+  }
+
+  return SC_TRUE;
+}
+
+sc_bool _sc_strings_blocks_write_block(
+    sc_strings_blocks * blocks,
+    sc_uint64 const string_offset,
+    sc_char const * strings,
+    sc_uint32 const strings_size,
+    sc_uint32 const strings_count)
+{
+  sc_char const * chars = strings;
+  sc_uint32 size = strings_size;
+  sc_uint8 codec = SC_STRINGS_BLOCK_CODEC_NONE;
+
+#ifdef SC_FS_MEMORY_COMPRESSION
+  // block is stored as is if it can't be compressed, strings bigger than block are stored as is to read them by parts
+  sc_char * compressed = null_ptr;
+  if (strings_size <= SC_STRINGS_BLOCK_SIZE)
+  {
+    sc_uint32 const compressed_capacity = LZ4_compressBound((int)strings_size);
+    compressed = sc_mem_new(sc_char, compressed_capacity);
+    int const compressed_size =
+        LZ4_compress_default(strings, compressed, (int)strings_size, (int)compressed_capacity);
+    if (compressed_size > 0 && (sc_uint32)compressed_size < strings_size)
+    {
+      chars = compressed;
+      size = compressed_size;
+      codec = SC_STRINGS_BLOCK_CODEC_LZ4;
+    }
+  }
+#endif
+
+  sc_bool const is_written = _sc_strings_blocks_write_chars(blocks->channel, blocks->size, chars, size);
+
+#ifdef SC_FS_MEMORY_COMPRESSION
+  sc_mem_free(compressed);
+#endif
+
+  if (!is_written)
+    return SC_FALSE;
+
+  sc_strings_block * block = _sc_strings_blocks_push_block(blocks);
+  block->string_offset = string_offset;
+  block->file_offset = blocks->size;
+  block->size = size;
+  block->strings_size = strings_size;
+  block->strings_count = strings_count;
+  block->codec = codec;
+
+  blocks->size += size;
+  return SC_TRUE;
+}
+
+sc_bool sc_strings_blocks_flush(sc_strings_blocks * blocks)
+{
+  if (blocks->buffer_size == 0)
+    return SC_TRUE;
+
+  sc_uint64 const string_offset = blocks->strings_size - blocks->buffer_size;
+  if (!_sc_strings_blocks_write_block(
+          blocks, string_offset, blocks->buffer, blocks->buffer_size, blocks->buffer_strings_count))
+    return SC_FALSE;
+
+  blocks->buffer_size = 0;
+  blocks->buffer_strings_count = 0;
+  return SC_TRUE;
+}
+
+sc_bool sc_strings_blocks_append(
+    sc_strings_blocks * blocks,
+    sc_char const * string,
+    sc_uint64 string_size,
+    sc_uint64 * string_offset)
+{
+  sc_uint64 const size = sizeof(string_size) + string_size;
+  if (blocks->buffer_size + size > SC_STRINGS_BLOCK_SIZE && !sc_strings_blocks_flush(blocks))
+    return SC_FALSE;
+
+  *string_offset = blocks->strings_size;
+
+  if (size > SC_STRINGS_BLOCK_SIZE)
+  {
+    sc_char * strings = sc_mem_new(sc_char, size);
+    sc_mem_cpy(strings, &string_size, sizeof(string_size));
+    sc_mem_cpy(strings + sizeof(string_size), string, string_size);
+
+    sc_bool const is_written = _sc_strings_blocks_write_block(blocks, *string_offset, strings, size, 1);
+    sc_mem_free(strings);
+
+    if (is_written)
+      blocks->strings_size += size;
+    return is_written;
+  }
+
+  sc_mem_cpy(blocks->buffer + blocks->buffer_size, &string_size, sizeof(string_size));
+  sc_mem_cpy(blocks->buffer + blocks->buffer_size + sizeof(string_size), string, string_size);
+  blocks->buffer_size += size;
+  ++blocks->buffer_strings_count;
+  blocks->strings_size += size;
+
+  return SC_TRUE;
+}
+
+sc_strings_block const * sc_strings_blocks_get_block(sc_strings_blocks const * blocks, sc_uint64 string_offset)
+{
+  sc_uint64 begin = 0;
+  sc_uint64 end = blocks->blocks_count;
+  while (begin < end)
+  {
+    sc_uint64 const middle = begin + (end - begin) / 2;
+    sc_strings_block const * block = &blocks->blocks[middle];
+    if (string_offset < block->string_offset)
+      end = middle;
+    else if (string_offset >= block->string_offset + block->strings_size)
+      begin = middle + 1;
+    else
+      return block;
+  }
+
+  return null_ptr;
+}
+
+/*! Reads part of string from written block by offset. If buffer for part is allocated, it is allocated after size of
+ * string is read, for the rest of string after position and zero, so string is read with one reading of its block.
+ */
+sc_bool _sc_strings_blocks_read_part(
+    sc_strings_blocks const * blocks,
+    sc_uint64 string_offset,
+    sc_uint64 position,
+    sc_char ** data,
+    sc_uint64 data_size,
+    sc_bool is_data_allocated,
+    sc_uint64 * read_bytes,
+    sc_uint64 * string_size)
+{
+  *read_bytes = 0;
+  *string_size = 0;
+
+  sc_strings_block const * block = sc_strings_blocks_get_block(blocks, string_offset);
+  if (block == null_ptr)
+    return SC_FALSE;
+
+  sc_uint32 const block_string_offset = string_offset - block->string_offset;
+  if (block_string_offset + sizeof(sc_uint64) > block->strings_size)
+    return SC_FALSE;
+
+  // strings of not compressed block are read without other strings of block
+  if (block->codec == SC_STRINGS_BLOCK_CODEC_NONE)
+  {
+    sc_uint64 const file_offset = block->file_offset + block_string_offset;
+    if (!_sc_strings_blocks_read_chars(blocks->channel, file_offset, (sc_char *)string_size, sizeof(sc_uint64)))
+      return SC_FALSE;
+
+    if (block_string_offset + sizeof(sc_uint64) + *string_size > block->strings_size)
+    {
+      *string_size = 0;
+      return SC_FALSE;
+    }
+
+    if (is_data_allocated)
+    {
+      data_size = position < *string_size ? *string_size - position : 0;
+      *data = sc_mem_new(sc_char, data_size + 1);
+    }
+
+    if (position >= *string_size)
+      return SC_TRUE;
+
+    *read_bytes = sc_min(data_size, *string_size - position);
+    if (!_sc_strings_blocks_read_chars(
+            blocks->channel, file_offset + sizeof(sc_uint64) + position, *data, *read_bytes))
+    {
+      *read_bytes = 0;
+      return SC_FALSE;
+    }
+
+    return SC_TRUE;
+  }
+
+#ifdef SC_FS_MEMORY_COMPRESSION
+  if (block->codec == SC_STRINGS_BLOCK_CODEC_LZ4)
+  {
+    sc_char * compressed = sc_mem_new(sc_char, block->size);
+    sc_char * strings = sc_mem_new(sc_char, block->strings_size);
+
+    sc_bool is_read = _sc_strings_blocks_read_chars(blocks->channel, block->file_offset, compressed, block->size)
+                      && LZ4_decompress_safe(compressed, strings, (int)block->size, (int)block->strings_size)
+                             == (int)block->strings_size;
+    sc_mem_free(compressed);
+
+    if (is_read)
+    {
+      sc_mem_cpy(string_size, strings + block_string_offset, sizeof(sc_uint64));
+      is_read = block_string_offset + sizeof(sc_uint64) + *string_size <= block->strings_size;
+    }
+
+    if (is_read && is_data_allocated)
+    {
+      data_size = position < *string_size ? *string_size - position : 0;
+      *data = sc_mem_new(sc_char, data_size + 1);
+    }
+
+    if (is_read && position < *string_size)
+    {
+      *read_bytes = sc_min(data_size, *string_size - position);
+      sc_mem_cpy(*data, strings + block_string_offset + sizeof(sc_uint64) + position, *read_bytes);
+    }
+    else if (!is_read)
+      *string_size = 0;
+
+    sc_mem_free(strings);
+    return is_read;
+  }
+#endif
+
+  return SC_FALSE;
+}
+
+sc_bool sc_strings_blocks_read_part(
+    sc_strings_blocks const * blocks,
+    sc_uint64 string_offset,
+    sc_uint64 position,
+    sc_char * data,
+    sc_uint64 data_size,
+    sc_uint64 * read_bytes,
+    sc_uint64 * string_size)
+{
+  return _sc_strings_blocks_read_part(
+      blocks, string_offset, position, &data, data_size, SC_FALSE, read_bytes, string_size);
+}
+
+sc_bool sc_strings_blocks_read(
+    sc_strings_blocks const * blocks,
+    sc_uint64 string_offset,
+    sc_char ** string,
+    sc_uint64 * string_size)
+{
+  *string = null_ptr;
+
+  sc_uint64 read_bytes;
+  if (!_sc_strings_blocks_read_part(blocks, string_offset, 0, string, 0, SC_TRUE, &read_bytes, string_size)
+      || read_bytes != *string_size)
+  {
+    sc_mem_free(*string);
+    *string = null_ptr;
+    *string_size = 0;
+    return SC_FALSE;
+  }
+
+  return SC_TRUE;
+}
+
+sc_bool sc_strings_blocks_write_index(sc_strings_blocks const * blocks, sc_io_channel * channel)
+{
+  sc_uint64 written_bytes = 0;
+  if (sc_io_channel_write_chars(
+          channel, (sc_char *)&blocks->blocks_count, sizeof(blocks->blocks_count), &written_bytes, null_ptr)
+          != SC_FS_IO_STATUS_NORMAL
+      || sizeof(blocks->blocks_count) != written_bytes)
+    return SC_FALSE;
+
+  sc_uint64 const size = blocks->blocks_count * sizeof(sc_strings_block);
+  return sc_io_channel_write_chars(channel, (sc_char *)blocks->blocks, size, &written_bytes, null_ptr)
+             == SC_FS_IO_STATUS_NORMAL
+         && size == written_bytes;
+}
+
+sc_bool sc_strings_blocks_read_index(sc_strings_blocks * blocks, sc_io_channel * channel)
+{
+  sc_uint64 read_bytes = 0;
+  sc_uint64 blocks_count;
+  if (sc_io_channel_read_chars(channel, (sc_char *)&blocks_count, sizeof(blocks_count), &read_bytes, null_ptr)
+          != SC_FS_IO_STATUS_NORMAL
+      || sizeof(blocks_count) != read_bytes)
+    return SC_FALSE;
+
+  if (blocks_count == 0)
+    return SC_TRUE;
+
+  sc_strings_block * read_blocks = sc_mem_new(sc_strings_block, blocks_count);
+  sc_uint64 const size = blocks_count * sizeof(sc_strings_block);
+  if (sc_io_channel_read_chars(channel, (sc_char *)read_blocks, size, &read_bytes, null_ptr) != SC_FS_IO_STATUS_NORMAL
+      || size != read_bytes)
+  {
+    sc_mem_free(read_blocks);
+    return SC_FALSE;
+  }
+
+  // blocks must follow one by one and the last block must be in file
+  sc_uint64 strings_size = 0;
+  sc_uint64 file_size = 0;
+  for (sc_uint64 i = 0; i < blocks_count; ++i)
+  {
+    if (read_blocks[i].string_offset != strings_size || read_blocks[i].file_offset != file_size)
+    {
+      sc_mem_free(read_blocks);
+      return SC_FALSE;
+    }
+
+    strings_size += read_blocks[i].strings_size;
+    file_size += read_blocks[i].size;
+  }
+
+  sc_char last_char;
+  if (file_size > 0 && !_sc_strings_blocks_read_chars(blocks->channel, file_size - 1, &last_char, 1))
+  {
+    sc_mem_free(read_blocks);
+    return SC_FALSE;
+  }
+
+  sc_mem_free(blocks->blocks);
+  blocks->blocks = read_blocks;
+  blocks->blocks_count = blocks_count;
+  blocks->blocks_capacity = blocks_count;
+  blocks->strings_size = strings_size;
+  blocks->size = file_size;
+
+  return SC_TRUE;
+}
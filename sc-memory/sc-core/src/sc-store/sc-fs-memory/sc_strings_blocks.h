@@ -0,0 +1,133 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_strings_blocks_h_
+#define _sc_strings_blocks_h_
+
+#include "sc-core/sc_types.h"
+
+#include "sc_io.h"
+
+//! Size of uncompressed strings in one block, a string is read by decompressing only its block
+#define SC_STRINGS_BLOCK_SIZE 16384
+
+typedef enum _sc_strings_block_codec
+{
+  SC_STRINGS_BLOCK_CODEC_NONE = 0,  // strings of block are stored as is
+  SC_STRINGS_BLOCK_CODEC_LZ4 = 1,   // strings of block are compressed by LZ4
+} sc_strings_block_codec;
+
+//! Strings with their sizes stored in file as one compressed block
+typedef struct _sc_strings_block
+{
+  sc_uint64 string_offset;  // offset of the first string of block among uncompressed strings of all blocks
+  sc_uint64 file_offset;    // offset of block in file
+  sc_uint32 size;           // count of bytes of block in file
+  sc_uint32 strings_size;   // count of bytes of uncompressed strings with their sizes
+  sc_uint32 strings_count;  // count of strings in block
+  sc_uint8 codec;           // sc_strings_block_codec of block
+} sc_strings_block;
+
+/*! Append-only file of strings compressed by blocks. Strings have offsets among uncompressed strings of all blocks, as
+ * if they were written one by one with their sizes, and are found by these offsets in sorted array of blocks.
+ */
+typedef struct _sc_strings_blocks
+{
+  sc_io_channel * channel;    // channel of file with blocks
+  sc_strings_block * blocks;  // blocks sorted by their string offsets
+  sc_uint64 blocks_count;
+  sc_uint64 blocks_capacity;
+  sc_uint64 strings_size;  // count of bytes of uncompressed strings of all blocks and not written block
+  sc_uint64 size;          // count of bytes of file with blocks
+  sc_char * buffer;        // strings of not written block
+  sc_uint32 buffer_size;   // count of bytes of strings of not written block
+  sc_uint32 buffer_strings_count;
+} sc_strings_blocks;
+
+/*! Initializes sc-strings-blocks with empty index of blocks
+ * @param[out] blocks Pointer to a sc-strings-blocks pointer to initialize
+ * @param path A path to file with blocks, it is created if it doesn't exist
+ * @returns Returns SC_TRUE, if file with blocks is opened.
+ */
+sc_bool sc_strings_blocks_initialize(sc_strings_blocks ** blocks, sc_char const * path);
+
+/*! Destroys a sc-strings-blocks and closes its file, not written block is lost
+ * @param blocks A sc-strings-blocks pointer to destroy
+ * @returns Returns SC_TRUE, if a sc-strings-blocks exists; otherwise return SC_FALSE.
+ */
+sc_bool sc_strings_blocks_destroy(sc_strings_blocks * blocks);
+
+/*! Appends string with its size to not written block, the block is written when it is full. Strings bigger than block
+ * are written as separate blocks.
+ * @param blocks A sc-strings-blocks pointer
+ * @param string A string to append
+ * @param string_size A string size
+ * @param[out] string_offset An offset of appended string
+ * @returns Returns SC_TRUE, if string is appended and full blocks are written.
+ */
+sc_bool sc_strings_blocks_append(
+    sc_strings_blocks * blocks,
+    sc_char const * string,
+    sc_uint64 string_size,
+    sc_uint64 * string_offset);
+
+/*! Compresses and writes not written block to file
+ * @param blocks A sc-strings-blocks pointer
+ * @returns Returns SC_TRUE, if block is written.
+ */
+sc_bool sc_strings_blocks_flush(sc_strings_blocks * blocks);
+
+//! Gets a written block with string by its offset, returns null_ptr if there is no such block
+sc_strings_block const * sc_strings_blocks_get_block(sc_strings_blocks const * blocks, sc_uint64 string_offset);
+
+/*! Reads part of string from written block by offset, only its block is read and decompressed. Strings bigger than
+ * block aren't compressed, so their parts are read without other parts.
+ * @param blocks A sc-strings-blocks pointer
+ * @param string_offset An offset of string
+ * @param position A position of part in string
+ * @param data A buffer to read part
+ * @param data_size A size of buffer
+ * @param[out] read_bytes A count of read bytes, it is 0 if position is at the end of string
+ * @param[out] string_size A size of string
+ * @returns Returns SC_TRUE, if string is found and its part is read.
+ */
+sc_bool sc_strings_blocks_read_part(
+    sc_strings_blocks const * blocks,
+    sc_uint64 string_offset,
+    sc_uint64 position,
+    sc_char * data,
+    sc_uint64 data_size,
+    sc_uint64 * read_bytes,
+    sc_uint64 * string_size);
+
+/*! Reads string from written block by offset, only its block is read and decompressed
+ * @param blocks A sc-strings-blocks pointer
+ * @param string_offset An offset of string
+ * @param[out] string A pointer to read string ended by zero, it must be freed
+ * @param[out] string_size A size of read string
+ * @returns Returns SC_TRUE, if string is read.
+ */
+sc_bool sc_strings_blocks_read(
+    sc_strings_blocks const * blocks,
+    sc_uint64 string_offset,
+    sc_char ** string,
+    sc_uint64 * string_size);
+
+/*! Writes index of written blocks into channel
+ * @param blocks A sc-strings-blocks pointer
+ * @param channel A channel to write
+ * @returns Returns SC_TRUE, if index is written.
+ */
+sc_bool sc_strings_blocks_write_index(sc_strings_blocks const * blocks, sc_io_channel * channel);
+
+/*! Reads index of blocks written by sc_strings_blocks_write_index from channel
+ * @param blocks A sc-strings-blocks pointer without blocks
+ * @param channel A channel to read
+ * @returns Returns SC_TRUE, if index is read and its blocks are in file.
+ */
+sc_bool sc_strings_blocks_read_index(sc_strings_blocks * blocks, sc_io_channel * channel);
+
+#endif
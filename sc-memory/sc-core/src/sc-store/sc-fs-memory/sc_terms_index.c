@@ -0,0 +1,283 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_terms_index.h"
+
+#include <glib.h>
+
+#include "sc-core/sc-base/sc_allocator.h"
+
+#define SC_TERMS_INDEX_MIN_CAPACITY 64
+#define SC_TERMS_INDEX_ALIGNMENT sizeof(sc_uint64)
+
+#define _sc_terms_index_align(size) \
+  (((size) + SC_TERMS_INDEX_ALIGNMENT - 1) / SC_TERMS_INDEX_ALIGNMENT * SC_TERMS_INDEX_ALIGNMENT)
+
+sc_int32 sc_terms_index_compare_terms(
+    sc_char const * term,
+    sc_uint64 term_size,
+    sc_char const * other_term,
+    sc_uint64 other_term_size)
+{
+  sc_uint64 const size = term_size < other_term_size ? term_size : other_term_size;
+  sc_int32 const result = size == 0 ? 0 : memcmp(term, other_term, size);
+  if (result != 0)
+    return result;
+
+  return (term_size > other_term_size) - (term_size < other_term_size);
+}
+
+sc_bool sc_terms_index_initialize(sc_terms_index ** index)
+{
+  *index = sc_mem_new(sc_terms_index, 1);
+  return SC_TRUE;
+}
+
+sc_bool sc_terms_index_destroy(sc_terms_index * index)
+{
+  if (index == null_ptr)
+    return SC_FALSE;
+
+  sc_terms_index_close(index);
+  sc_mem_free(index);
+
+  return SC_TRUE;
+}
+
+void sc_terms_index_close(sc_terms_index * index)
+{
+  if (index->file != null_ptr)
+    g_mapped_file_unref(index->file);
+
+  *index = (sc_terms_index){0};
+}
+
+sc_bool sc_terms_index_open(sc_terms_index * index, sc_char const * path)
+{
+  sc_terms_index_close(index);
+
+  GMappedFile * file = g_mapped_file_new(path, FALSE, null_ptr);
+  if (file == null_ptr)
+    return SC_FALSE;
+
+  sc_char const * data = g_mapped_file_get_contents(file);
+  sc_uint64 const size = g_mapped_file_get_length(file);
+  if (data == null_ptr || size < sizeof(sc_terms_index_footer))
+    goto error;
+
+  // footer is copied, because file size may be not aligned if file is broken
+  sc_terms_index_footer footer;
+  sc_mem_cpy(&footer, data + size - sizeof(sc_terms_index_footer), sizeof(sc_terms_index_footer));
+  if (footer.magic != SC_TERMS_INDEX_MAGIC || footer.version != SC_TERMS_INDEX_VERSION
+      || footer.entries_offset % SC_TERMS_INDEX_ALIGNMENT != 0
+      || footer.entries_offset > size - sizeof(sc_terms_index_footer)
+      || footer.terms_count
+             != (size - sizeof(sc_terms_index_footer) - footer.entries_offset) / sizeof(sc_terms_index_entry)
+      || (size - sizeof(sc_terms_index_footer) - footer.entries_offset) % sizeof(sc_terms_index_entry) != 0)
+    goto error;
+
+  index->file = file;
+  index->data = data;
+  index->size = size;
+  index->entries = (sc_terms_index_entry const *)(data + footer.entries_offset);
+  index->terms_count = footer.terms_count;
+  index->last_string_offset = footer.last_string_offset;
+  return SC_TRUE;
+
+error:
+  g_mapped_file_unref(file);
+  return SC_FALSE;
+}
+
+//! Gets term and string offsets of entry, term records are checked lazily when they are read
+sc_bool _sc_terms_index_get_record(
+    sc_terms_index const * index,
+    sc_terms_index_entry const * entry,
+    sc_char const ** term,
+    sc_uint64 const ** string_offsets)
+{
+  sc_uint64 const string_offsets_offset = entry->record_offset + _sc_terms_index_align(entry->term_size);
+  sc_uint64 const entries_offset = (sc_char const *)index->entries - index->data;
+  if (entry->record_offset % SC_TERMS_INDEX_ALIGNMENT != 0 || string_offsets_offset > entries_offset
+      || entry->string_offsets_count > (entries_offset - string_offsets_offset) / sizeof(sc_uint64))
+    return SC_FALSE;
+
+  *term = index->data + entry->record_offset;
+  *string_offsets = (sc_uint64 const *)(index->data + string_offsets_offset);
+  return SC_TRUE;
+}
+
+//! Finds index of the first entry with term not less than term, terms of broken records are less than all terms
+sc_uint64 _sc_terms_index_lower_bound(sc_terms_index const * index, sc_char const * term, sc_uint64 term_size)
+{
+  sc_uint64 begin = 0;
+  sc_uint64 end = index->terms_count;
+  while (begin < end)
+  {
+    sc_uint64 const middle = begin + (end - begin) / 2;
+    sc_terms_index_entry const * entry = &index->entries[middle];
+
+    sc_char const * other_term;
+    sc_uint64 const * string_offsets;
+    if (!_sc_terms_index_get_record(index, entry, &other_term, &string_offsets)
+        || sc_terms_index_compare_terms(other_term, entry->term_size, term, term_size) < 0)
+      begin = middle + 1;
+    else
+      end = middle;
+  }
+
+  return begin;
+}
+
+sc_bool sc_terms_index_get_string_offsets(
+    sc_terms_index const * index,
+    sc_char const * term,
+    sc_uint64 term_size,
+    sc_uint64 const ** string_offsets,
+    sc_uint64 * string_offsets_count)
+{
+  *string_offsets = null_ptr;
+  *string_offsets_count = 0;
+
+  sc_uint64 const i = _sc_terms_index_lower_bound(index, term, term_size);
+  if (i == index->terms_count)
+    return SC_FALSE;
+
+  sc_terms_index_entry const * entry = &index->entries[i];
+  sc_char const * found_term;
+  if (!_sc_terms_index_get_record(index, entry, &found_term, string_offsets)
+      || sc_terms_index_compare_terms(found_term, entry->term_size, term, term_size) != 0)
+  {
+    *string_offsets = null_ptr;
+    return SC_FALSE;
+  }
+
+  *string_offsets_count = entry->string_offsets_count;
+  return SC_TRUE;
+}
+
+sc_bool sc_terms_index_visit_by_prefix(
+    sc_terms_index const * index,
+    sc_char const * prefix,
+    sc_uint64 prefix_size,
+    sc_terms_index_visit_callback callback,
+    void ** arguments)
+{
+  // terms with prefix follow each other in sorted entries
+  for (sc_uint64 i = _sc_terms_index_lower_bound(index, prefix, prefix_size); i < index->terms_count; ++i)
+  {
+    sc_terms_index_entry const * entry = &index->entries[i];
+    sc_char const * term;
+    sc_uint64 const * string_offsets;
+    if (!_sc_terms_index_get_record(index, entry, &term, &string_offsets))
+      return SC_FALSE;
+
+    if (entry->term_size < prefix_size || (prefix_size != 0 && memcmp(term, prefix, prefix_size) != 0))
+      break;
+
+    if (!callback(term, entry->term_size, string_offsets, entry->string_offsets_count, arguments))
+      return SC_FALSE;
+  }
+
+  return SC_TRUE;
+}
+
+sc_uint64 sc_terms_index_get_mapped_size(sc_terms_index const * index)
+{
+  return index->size;
+}
+
+sc_bool _sc_terms_index_writer_write_chars(sc_terms_index_writer * writer, void const * chars, sc_uint64 count)
+{
+  if (count == 0)
+    return SC_TRUE;
+
+  sc_uint64 written_bytes = 0;
+  if (sc_io_channel_write_chars(writer->channel, (sc_char *)chars, count, &written_bytes, null_ptr)
+          != SC_FS_IO_STATUS_NORMAL
+      || count != written_bytes)
+    return SC_FALSE;
+
+  writer->size += count;
+  return SC_TRUE;
+}
+
+sc_bool sc_terms_index_writer_initialize(sc_terms_index_writer ** writer, sc_char const * path)
+{
+  sc_io_channel * channel = sc_io_new_write_channel(path, null_ptr);
+  if (channel == null_ptr)
+  {
+    *writer = null_ptr;
+    return SC_FALSE;
+  }
+  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+  *writer = sc_mem_new(sc_terms_index_writer, 1);
+  (*writer)->channel = channel;
+
+  return SC_TRUE;
+}
+
+sc_bool sc_terms_index_writer_append(
+    sc_terms_index_writer * writer,
+    sc_char const * term,
+    sc_uint64 term_size,
+    sc_uint64 const * string_offsets,
+    sc_uint64 string_offsets_count)
+{
+  if (term_size > SC_MAXUINT32)
+    return SC_FALSE;
+
+  if (writer->terms_count == writer->terms_capacity)
+  {
+    sc_uint64 const capacity =
+        writer->terms_capacity == 0 ? SC_TERMS_INDEX_MIN_CAPACITY : writer->terms_capacity << 1;
+    sc_terms_index_entry * entries = sc_mem_new(sc_terms_index_entry, capacity);
+    if (writer->entries != null_ptr)
+      sc_mem_cpy(entries, writer->entries, writer->terms_count * sizeof(sc_terms_index_entry));
+    sc_mem_free(writer->entries);
+
+    writer->entries = entries;
+    writer->terms_capacity = capacity;
+  }
+
+  sc_terms_index_entry * entry = &writer->entries[writer->terms_count++];
+  entry->record_offset = writer->size;
+  entry->string_offsets_count = string_offsets_count;
+  entry->term_size = term_size;
+
+  static sc_char const padding[SC_TERMS_INDEX_ALIGNMENT] = {0};
+  return _sc_terms_index_writer_write_chars(writer, term, term_size)
+         && _sc_terms_index_writer_write_chars(writer, padding, _sc_terms_index_align(term_size) - term_size)
+         && _sc_terms_index_writer_write_chars(writer, string_offsets, string_offsets_count * sizeof(sc_uint64));
+}
+
+sc_bool sc_terms_index_writer_destroy(sc_terms_index_writer * writer, sc_uint64 last_string_offset, sc_bool to_write)
+{
+  if (writer == null_ptr)
+    return SC_FALSE;
+
+  sc_bool is_written = SC_FALSE;
+  if (to_write)
+  {
+    sc_terms_index_footer const footer = {
+        .magic = SC_TERMS_INDEX_MAGIC,
+        .version = SC_TERMS_INDEX_VERSION,
+        .entries_offset = writer->size,
+        .terms_count = writer->terms_count,
+        .last_string_offset = last_string_offset,
+    };
+    is_written =
+        _sc_terms_index_writer_write_chars(writer, writer->entries, writer->terms_count * sizeof(sc_terms_index_entry))
+        && _sc_terms_index_writer_write_chars(writer, &footer, sizeof(sc_terms_index_footer));
+  }
+
+  sc_io_channel_shutdown(writer->channel, SC_TRUE, null_ptr);
+  sc_mem_free(writer->entries);
+  sc_mem_free(writer);
+
+  return is_written;
+}
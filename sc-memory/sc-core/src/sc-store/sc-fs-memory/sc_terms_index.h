@@ -0,0 +1,170 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_terms_index_h_
+#define _sc_terms_index_h_
+
+#include "sc-core/sc_types.h"
+
+#include "sc_io.h"
+
+#define SC_TERMS_INDEX_MAGIC 0x31534d5245544353  // "SCTERMS1"
+#define SC_TERMS_INDEX_VERSION 1
+
+/*! Term of sc-terms-index in file. Term record with term and its string offsets is placed at record offset, term
+ * is padded by zeros to 8 bytes, so string offsets are aligned in mapped file.
+ */
+typedef struct _sc_terms_index_entry
+{
+  sc_uint64 record_offset;         // offset of term record in file
+  sc_uint64 string_offsets_count;  // count of string offsets in term record
+  sc_uint32 term_size;             // count of bytes of term
+  sc_uint32 reserved;
+} sc_terms_index_entry;
+
+//! Footer at the end of file with sc-terms-index, it is written after all term records and entries
+typedef struct _sc_terms_index_footer
+{
+  sc_uint64 magic;
+  sc_uint64 version;
+  sc_uint64 entries_offset;      // offset of entries sorted by terms in file
+  sc_uint64 terms_count;         // count of entries
+  sc_uint64 last_string_offset;  // last string offset in fs-memory when sc-terms-index was written
+} sc_terms_index_footer;
+
+/*! Read-only index of terms and offsets of strings with them in file mapped into memory. Its offsets are relative to
+ * the beginning of file, so it is queried in place without building of dictionary on load, and only read pages of file
+ * are loaded into memory.
+ */
+typedef struct _sc_terms_index
+{
+  void * file;                           // mapped file with sc-terms-index, it is null_ptr if there is no file
+  sc_char const * data;                  // contents of mapped file
+  sc_uint64 size;                        // count of bytes of mapped file
+  sc_terms_index_entry const * entries;  // entries sorted by terms
+  sc_uint64 terms_count;
+  sc_uint64 last_string_offset;
+} sc_terms_index;
+
+//! Writer of sc-terms-index into file, terms must be appended in order of sc_terms_index_compare_terms
+typedef struct _sc_terms_index_writer
+{
+  sc_io_channel * channel;         // channel of file to write
+  sc_terms_index_entry * entries;  // entries of appended terms
+  sc_uint64 terms_count;
+  sc_uint64 terms_capacity;
+  sc_uint64 size;  // count of written bytes
+} sc_terms_index_writer;
+
+/*! Callback to visit terms of sc-terms-index
+ * @param term A term, it isn't ended by zero
+ * @param term_size A term size
+ * @param string_offsets Offsets of strings with term in mapped file
+ * @param string_offsets_count A count of string offsets
+ * @param arguments Arguments of visiting
+ * @returns Returns SC_FALSE to stop visiting.
+ */
+typedef sc_bool (*sc_terms_index_visit_callback)(
+    sc_char const * term,
+    sc_uint32 term_size,
+    sc_uint64 const * string_offsets,
+    sc_uint64 string_offsets_count,
+    void ** arguments);
+
+//! Compares terms by their bytes, a term is less than terms it is prefix of
+sc_int32 sc_terms_index_compare_terms(
+    sc_char const * term,
+    sc_uint64 term_size,
+    sc_char const * other_term,
+    sc_uint64 other_term_size);
+
+/*! Initializes sc-terms-index without file
+ * @param[out] index Pointer to a sc-terms-index pointer to initialize
+ * @returns Returns SC_TRUE, if sc-terms-index is initialized.
+ */
+sc_bool sc_terms_index_initialize(sc_terms_index ** index);
+
+/*! Destroys a sc-terms-index and unmaps its file
+ * @param index A sc-terms-index pointer to destroy
+ * @returns Returns SC_TRUE, if a sc-terms-index exists; otherwise return SC_FALSE.
+ */
+sc_bool sc_terms_index_destroy(sc_terms_index * index);
+
+/*! Maps file with sc-terms-index written by sc-terms-index-writer into memory, previous file is unmapped. Term records
+ * aren't read, they are loaded by pages when they are found.
+ * @param index A sc-terms-index pointer
+ * @param path A path to file with sc-terms-index
+ * @returns Returns SC_TRUE, if file is mapped and its footer and entries are correct.
+ */
+sc_bool sc_terms_index_open(sc_terms_index * index, sc_char const * path);
+
+//! Unmaps file of sc-terms-index, sc-terms-index becomes empty
+void sc_terms_index_close(sc_terms_index * index);
+
+/*! Gets offsets of strings with term, they are pointed in mapped file without copying
+ * @param index A sc-terms-index pointer
+ * @param term A term to find
+ * @param term_size A term size
+ * @param[out] string_offsets A pointer to string offsets in mapped file, they are valid until file is unmapped
+ * @param[out] string_offsets_count A count of string offsets
+ * @returns Returns SC_TRUE, if term is found.
+ */
+sc_bool sc_terms_index_get_string_offsets(
+    sc_terms_index const * index,
+    sc_char const * term,
+    sc_uint64 term_size,
+    sc_uint64 const ** string_offsets,
+    sc_uint64 * string_offsets_count);
+
+/*! Visits terms with prefix in order of sc_terms_index_compare_terms, all terms are visited by empty prefix
+ * @param index A sc-terms-index pointer
+ * @param prefix A prefix of terms
+ * @param prefix_size A prefix size
+ * @param callback A callback to visit terms
+ * @param arguments Arguments of callback
+ * @returns Returns SC_FALSE, if visiting is stopped by callback or file is broken.
+ */
+sc_bool sc_terms_index_visit_by_prefix(
+    sc_terms_index const * index,
+    sc_char const * prefix,
+    sc_uint64 prefix_size,
+    sc_terms_index_visit_callback callback,
+    void ** arguments);
+
+/*! Initializes sc-terms-index-writer, file is rewritten
+ * @param[out] writer Pointer to a sc-terms-index-writer pointer to initialize
+ * @param path A path to file to write sc-terms-index
+ * @returns Returns SC_TRUE, if file is opened to write.
+ */
+sc_bool sc_terms_index_writer_initialize(sc_terms_index_writer ** writer, sc_char const * path);
+
+/*! Writes term record with term and its string offsets
+ * @param writer A sc-terms-index-writer pointer
+ * @param term A term greater than previous appended term
+ * @param term_size A term size
+ * @param string_offsets Offsets of strings with term
+ * @param string_offsets_count A count of string offsets
+ * @returns Returns SC_TRUE, if term record is written.
+ */
+sc_bool sc_terms_index_writer_append(
+    sc_terms_index_writer * writer,
+    sc_char const * term,
+    sc_uint64 term_size,
+    sc_uint64 const * string_offsets,
+    sc_uint64 string_offsets_count);
+
+/*! Writes entries and footer of sc-terms-index, closes file and destroys sc-terms-index-writer
+ * @param writer A sc-terms-index-writer pointer to destroy
+ * @param last_string_offset A last string offset in fs-memory
+ * @param to_write SC_FALSE to destroy sc-terms-index-writer without finishing of file
+ * @returns Returns SC_TRUE, if entries and footer are written.
+ */
+sc_bool sc_terms_index_writer_destroy(sc_terms_index_writer * writer, sc_uint64 last_string_offset, sc_bool to_write);
+
+//! Gets count of bytes of mapped file of sc-terms-index
+sc_uint64 sc_terms_index_get_mapped_size(sc_terms_index const * index);
+
+#endif
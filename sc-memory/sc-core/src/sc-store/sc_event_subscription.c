@@ -19,16 +19,30 @@
 #include "sc_memory_context_manager.h"
 #include "sc_memory_context_private.h"
 
+//! Number of buckets of the events table, each bucket is synchronized by its own monitor
+#define SC_EVENTS_TABLE_BUCKETS_COUNT 64
+
+/*! Structure representing a bucket of the events table.
+ */
+typedef struct
+{
+  sc_hash_table * events_table;     ///< Hash table containing registered events of sc-elements of the bucket.
+  sc_monitor events_table_monitor;  ///< Monitor for synchronizing access to the events table of the bucket.
+} sc_event_subscriptions_bucket;
+
 /*! Structure representing an sc-event_subscription registration manager.
- * @note This structure manages the registration and removal of sc-events associated with sc-elements.
+ * @note This structure manages the registration and removal of sc-events associated with sc-elements. Sc-elements
+ * are distributed between buckets, so registering, emitting and removing sc-events of one sc-element don't block
+ * sc-events of sc-elements from other buckets.
  */
 struct _sc_event_subscription_manager
 {
-  sc_hash_table * events_table;     ///< Hash table containing registered events.
-  sc_monitor events_table_monitor;  ///< Monitor for synchronizing access to the events table.
+  sc_event_subscriptions_bucket buckets[SC_EVENTS_TABLE_BUCKETS_COUNT];  ///< Buckets of the events table.
 };
 
 #define TABLE_KEY(__Addr) GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(__Addr))
+#define TABLE_BUCKET(__Manager, __Addr) \
+  (&(__Manager)->buckets[SC_ADDR_LOCAL_TO_INT(__Addr) % SC_EVENTS_TABLE_BUCKETS_COUNT])
 
 // Pointer to hash table that contains events
 
@@ -57,22 +71,23 @@ sc_result _sc_event_subscription_manager_add(
   if (manager == null_ptr)
     return SC_RESULT_NO;
 
-  sc_monitor_acquire_write(&manager->events_table_monitor);
+  sc_event_subscriptions_bucket * bucket = TABLE_BUCKET(manager, event_subscription->subscription_addr);
+  sc_monitor_acquire_write(&bucket->events_table_monitor);
 
-  if (manager->events_table == null_ptr)
+  if (bucket->events_table == null_ptr)
   {
-    sc_monitor_release_write(&manager->events_table_monitor);
+    sc_monitor_release_write(&bucket->events_table_monitor);
     return SC_RESULT_NO;
   }
 
   // if there are no events for specified sc-element, then generate new events list
   element_events_list =
-      (sc_hash_table_list *)sc_hash_table_get(manager->events_table, TABLE_KEY(event_subscription->subscription_addr));
+      (sc_hash_table_list *)sc_hash_table_get(bucket->events_table, TABLE_KEY(event_subscription->subscription_addr));
   element_events_list = sc_hash_table_list_append(element_events_list, (sc_pointer)event_subscription);
   sc_hash_table_insert(
-      manager->events_table, TABLE_KEY(event_subscription->subscription_addr), (sc_pointer)element_events_list);
+      bucket->events_table, TABLE_KEY(event_subscription->subscription_addr), (sc_pointer)element_events_list);
 
-  sc_monitor_release_write(&manager->events_table_monitor);
+  sc_monitor_release_write(&bucket->events_table_monitor);
 
   return SC_RESULT_OK;
 }
@@ -92,41 +107,50 @@ sc_result _sc_event_subscription_manager_remove(
   if (manager == null_ptr)
     return SC_RESULT_NO;
 
-  sc_monitor_acquire_write(&manager->events_table_monitor);
-  element_events_list =
-      (sc_hash_table_list *)sc_hash_table_get(manager->events_table, TABLE_KEY(event_subscription->subscription_addr));
-  if (element_events_list == null_ptr)
+  sc_event_subscriptions_bucket * bucket = TABLE_BUCKET(manager, event_subscription->subscription_addr);
+  sc_monitor_acquire_write(&bucket->events_table_monitor);
+  if (bucket->events_table == null_ptr)
     goto error;
 
-  if (manager->events_table == null_ptr)
+  element_events_list =
+      (sc_hash_table_list *)sc_hash_table_get(bucket->events_table, TABLE_KEY(event_subscription->subscription_addr));
+  if (element_events_list == null_ptr)
     goto error;
 
   // remove event_subscription from list of events for specified sc-element
   element_events_list = sc_hash_table_list_remove(element_events_list, (sc_const_pointer)event_subscription);
   if (element_events_list == null_ptr)
-    sc_hash_table_remove(manager->events_table, TABLE_KEY(event_subscription->subscription_addr));
+    sc_hash_table_remove(bucket->events_table, TABLE_KEY(event_subscription->subscription_addr));
   else
     sc_hash_table_insert(
-        manager->events_table, TABLE_KEY(event_subscription->subscription_addr), (sc_pointer)element_events_list);
+        bucket->events_table, TABLE_KEY(event_subscription->subscription_addr), (sc_pointer)element_events_list);
 
-  sc_monitor_release_write(&manager->events_table_monitor);
+  sc_monitor_release_write(&bucket->events_table_monitor);
   return SC_RESULT_OK;
 error:
-  sc_monitor_release_write(&manager->events_table_monitor);
+  sc_monitor_release_write(&bucket->events_table_monitor);
   return SC_RESULT_ERROR_INVALID_PARAMS;
 }
 
 void sc_event_subscription_manager_initialize(sc_event_subscription_manager ** manager)
 {
   (*manager) = sc_mem_new(sc_event_subscription_manager, 1);
-  (*manager)->events_table = sc_hash_table_init(events_table_hash_func, events_table_equal_func, null_ptr, null_ptr);
-  sc_monitor_init(&(*manager)->events_table_monitor);
+  for (sc_uint32 i = 0; i < SC_EVENTS_TABLE_BUCKETS_COUNT; ++i)
+  {
+    sc_event_subscriptions_bucket * bucket = &(*manager)->buckets[i];
+    bucket->events_table = sc_hash_table_init(events_table_hash_func, events_table_equal_func, null_ptr, null_ptr);
+    sc_monitor_init(&bucket->events_table_monitor);
+  }
 }
 
 void sc_event_subscription_manager_shutdown(sc_event_subscription_manager * manager)
 {
-  sc_monitor_destroy(&manager->events_table_monitor);
-  sc_hash_table_destroy(manager->events_table);
+  for (sc_uint32 i = 0; i < SC_EVENTS_TABLE_BUCKETS_COUNT; ++i)
+  {
+    sc_event_subscriptions_bucket * bucket = &manager->buckets[i];
+    sc_monitor_destroy(&bucket->events_table_monitor);
+    sc_hash_table_destroy(bucket->events_table);
+  }
   sc_mem_free(manager);
 }
 
@@ -156,6 +180,12 @@ sc_event_subscription * sc_event_subscription_new(
   event_subscription->data = data;
   event_subscription->ref_count = 1;
   sc_monitor_init(&event_subscription->monitor);
+  sc_mutex_init(&event_subscription->lane_mutex);
+  event_subscription->is_lane_busy = SC_FALSE;
+  sc_queue_init(&event_subscription->lane_events);
+  event_subscription->priority = _sc_event_priority_get(event_type_addr);
+  event_subscription->events_count = 0;
+  event_subscription->is_destroyed = SC_FALSE;
 
   // register generated event_subscription
   sc_event_subscription_manager * manager = sc_storage_get_event_subscription_manager();
@@ -164,14 +194,17 @@ sc_event_subscription * sc_event_subscription_new(
   return event_subscription;
 }
 
-sc_event_subscription * sc_event_subscription_with_user_new(
+/*! Creates an sc-event subscription with callback with user and specified priority class of its sc-events.
+ */
+sc_event_subscription * _sc_event_subscription_with_user_new_ext(
     sc_memory_context const * ctx,
     sc_addr subscription_addr,
     sc_event_type event_type_addr,
     sc_type event_element_type,
     sc_pointer data,
     sc_event_callback_with_user callback,
-    sc_event_subscription_delete_function delete_callback)
+    sc_event_subscription_delete_function delete_callback,
+    sc_event_priority priority)
 {
   sc_unused(ctx);
 
@@ -191,6 +224,12 @@ sc_event_subscription * sc_event_subscription_with_user_new(
   event_subscription->data = data;
   event_subscription->ref_count = 1;
   sc_monitor_init(&event_subscription->monitor);
+  sc_mutex_init(&event_subscription->lane_mutex);
+  event_subscription->is_lane_busy = SC_FALSE;
+  sc_queue_init(&event_subscription->lane_events);
+  event_subscription->priority = priority;
+  event_subscription->events_count = 0;
+  event_subscription->is_destroyed = SC_FALSE;
 
   // register generated event_subscription
   sc_event_subscription_manager * manager = sc_storage_get_event_subscription_manager();
@@ -199,21 +238,54 @@ sc_event_subscription * sc_event_subscription_with_user_new(
   return event_subscription;
 }
 
-sc_result sc_event_subscription_destroy(sc_event_subscription * event_subscription)
+sc_event_subscription * sc_event_subscription_with_user_new(
+    sc_memory_context const * ctx,
+    sc_addr subscription_addr,
+    sc_event_type event_type_addr,
+    sc_type event_element_type,
+    sc_pointer data,
+    sc_event_callback_with_user callback,
+    sc_event_subscription_delete_function delete_callback)
 {
-  if (event_subscription == null_ptr)
-    return SC_RESULT_NO;
-
-  sc_event_subscription_manager * subscription_manager = sc_storage_get_event_subscription_manager();
-  sc_event_emission_manager * emission_manager = sc_storage_get_event_emission_manager();
+  return _sc_event_subscription_with_user_new_ext(
+      ctx,
+      subscription_addr,
+      event_type_addr,
+      event_element_type,
+      data,
+      callback,
+      delete_callback,
+      _sc_event_priority_get(event_type_addr));
+}
 
-  sc_monitor_acquire_write(&event_subscription->monitor);
-  if (_sc_event_subscription_manager_remove(subscription_manager, event_subscription) != SC_RESULT_OK)
-  {
-    sc_monitor_release_write(&event_subscription->monitor);
-    return SC_RESULT_ERROR;
-  }
+sc_event_subscription * _sc_event_subscription_system_with_user_new(
+    sc_memory_context const * ctx,
+    sc_addr subscription_addr,
+    sc_event_type event_type_addr,
+    sc_type event_element_type,
+    sc_pointer data,
+    sc_event_callback_with_user callback,
+    sc_event_subscription_delete_function delete_callback)
+{
+  return _sc_event_subscription_with_user_new_ext(
+      ctx,
+      subscription_addr,
+      event_type_addr,
+      event_element_type,
+      data,
+      callback,
+      delete_callback,
+      SC_EVENT_PRIORITY_HIGH);
+}
 
+/*! Releases an sc-event subscription detached from the events table: calls its delete callback, marks it as
+ * deletable and frees it, if it has no not processed sc-events. Otherwise, it is freed by the last worker processing
+ * its sc-events.
+ * @param event_subscription Pointer to the detached sc-event subscription.
+ * @note The monitor of the sc-event subscription must be acquired for writing. It is released by this function.
+ */
+static void _sc_event_subscription_release(sc_event_subscription * event_subscription)
+{
   if (event_subscription->delete_callback != null_ptr)
     event_subscription->delete_callback(event_subscription);
 
@@ -226,61 +298,80 @@ sc_result sc_event_subscription_destroy(sc_event_subscription * event_subscripti
   event_subscription->delete_callback = null_ptr;
   event_subscription->data = null_ptr;
 
-  sc_storage * storage = sc_storage_get();
-  if (storage != null_ptr)
+  sc_monitor_release_write(&event_subscription->monitor);
+
+  // The sc-event subscription is not registered anymore, so new sc-events can't reference it. It is freed by the last
+  // worker processing its sc-events, if there are such sc-events.
+  sc_mutex_lock(&event_subscription->lane_mutex);
+  event_subscription->is_destroyed = SC_TRUE;
+  sc_bool const is_reclaimable = event_subscription->events_count == 0;
+  sc_mutex_unlock(&event_subscription->lane_mutex);
+
+  if (is_reclaimable)
+    _sc_event_subscription_free(event_subscription);
+}
+
+sc_result sc_event_subscription_destroy(sc_event_subscription * event_subscription)
+{
+  if (event_subscription == null_ptr)
+    return SC_RESULT_NO;
+
+  sc_event_subscription_manager * subscription_manager = sc_storage_get_event_subscription_manager();
+
+  sc_monitor_acquire_write(&event_subscription->monitor);
+  if (_sc_event_subscription_manager_remove(subscription_manager, event_subscription) != SC_RESULT_OK)
   {
-    sc_monitor_acquire_write(&emission_manager->pool_monitor);
-    sc_queue_push(&emission_manager->deletable_events_subscriptions, event_subscription);
-    sc_monitor_release_write(&emission_manager->pool_monitor);
+    sc_monitor_release_write(&event_subscription->monitor);
+    return SC_RESULT_ERROR;
   }
-  sc_monitor_release_write(&event_subscription->monitor);
 
+  _sc_event_subscription_release(event_subscription);
   return SC_RESULT_OK;
 }
 
+void _sc_event_subscription_free(sc_event_subscription * event_subscription)
+{
+  sc_monitor_destroy(&event_subscription->monitor);
+  sc_mutex_destroy(&event_subscription->lane_mutex);
+  sc_queue_destroy(&event_subscription->lane_events);
+  sc_mem_free(event_subscription);
+}
+
 sc_result sc_event_notify_element_deleted(sc_addr element)
 {
   sc_hash_table_list * element_events_list = null_ptr;
   sc_event_subscription * event_subscription = null_ptr;
 
   sc_event_subscription_manager * subscription_manager = sc_storage_get_event_subscription_manager();
-  sc_event_emission_manager * emission_manager = sc_storage_get_event_emission_manager();
 
   // do nothing, if there are no registered events
-  if (subscription_manager == null_ptr || subscription_manager->events_table == null_ptr)
+  if (subscription_manager == null_ptr)
     goto result;
 
   // TODO(NikitaZotov): Implement monitor for `subscription_manager` to synchronize its freeing.
-  // lookup for all registered to specified sc-element events
-  sc_monitor_acquire_write(&subscription_manager->events_table_monitor);
-  if (subscription_manager != null_ptr)
+  // lookup for all registered to specified sc-element events, only the bucket of this sc-element is locked
+  sc_event_subscriptions_bucket * bucket = TABLE_BUCKET(subscription_manager, element);
+  sc_monitor_acquire_write(&bucket->events_table_monitor);
+  if (bucket->events_table != null_ptr)
   {
-    element_events_list =
-        (sc_hash_table_list *)sc_hash_table_get(subscription_manager->events_table, TABLE_KEY(element));
+    element_events_list = (sc_hash_table_list *)sc_hash_table_get(bucket->events_table, TABLE_KEY(element));
     if (element_events_list != null_ptr)
-      sc_hash_table_remove(subscription_manager->events_table, TABLE_KEY(element));
+      sc_hash_table_remove(bucket->events_table, TABLE_KEY(element));
   }
+  sc_monitor_release_write(&bucket->events_table_monitor);
 
-  if (element_events_list != null_ptr)
+  // sc-event subscriptions are detached from the events table, so waiting for their processed sc-events doesn't block
+  // other emitters
+  while (element_events_list != null_ptr)
   {
-    while (element_events_list != null_ptr)
-    {
-      event_subscription = (sc_event_subscription *)element_events_list->data;
-
-      // mark event_subscription for deletion
-      sc_monitor_acquire_write(&event_subscription->monitor);
-
-      sc_monitor_acquire_write(&emission_manager->pool_monitor);
-      sc_queue_push(&emission_manager->deletable_events_subscriptions, event_subscription);
-      sc_monitor_release_write(&emission_manager->pool_monitor);
+    event_subscription = (sc_event_subscription *)element_events_list->data;
 
-      sc_monitor_release_write(&event_subscription->monitor);
+    // release event_subscription after its running callbacks, it is freed after its last queued sc-event
+    sc_monitor_acquire_write(&event_subscription->monitor);
+    _sc_event_subscription_release(event_subscription);
 
-      element_events_list = sc_hash_table_list_remove_sublist(element_events_list, element_events_list);
-    }
-    sc_hash_table_list_destroy(element_events_list);
+    element_events_list = sc_hash_table_list_remove_sublist(element_events_list, element_events_list);
   }
-  sc_monitor_release_write(&subscription_manager->events_table_monitor);
 
 result:
   return SC_RESULT_OK;
@@ -324,21 +415,24 @@ sc_result sc_event_emit_impl(
 {
   sc_hash_table_list * element_events_list = null_ptr;
   sc_event_subscription * event_subscription = null_ptr;
+  // the queue allocates memory only for the first reserved sc-event
+  sc_queue reserved_events = {null_ptr, 0, -1, 0, 0};
+  sc_event * event = null_ptr;
 
   sc_event_subscription_manager * subscription_manager = sc_storage_get_event_subscription_manager();
   sc_event_emission_manager * emission_manager = sc_storage_get_event_emission_manager();
 
   // if table is empty, then do nothing
   sc_result result = SC_RESULT_NO;
-  if (subscription_manager == null_ptr || subscription_manager->events_table == null_ptr)
+  if (subscription_manager == null_ptr)
     goto result;
 
   // TODO(NikitaZotov): Implement monitor for `subscription_manager` to synchronize its freeing.
   // lookup for all registered to specified sc-element events
-  sc_monitor_acquire_read(&subscription_manager->events_table_monitor);
-  if (subscription_manager != null_ptr)
-    element_events_list =
-        (sc_hash_table_list *)sc_hash_table_get(subscription_manager->events_table, TABLE_KEY(subscription_addr));
+  sc_event_subscriptions_bucket * bucket = TABLE_BUCKET(subscription_manager, subscription_addr);
+  sc_monitor_acquire_read(&bucket->events_table_monitor);
+  if (bucket->events_table != null_ptr)
+    element_events_list = (sc_hash_table_list *)sc_hash_table_get(bucket->events_table, TABLE_KEY(subscription_addr));
 
   while (element_events_list != null_ptr)
   {
@@ -347,7 +441,7 @@ sc_result sc_event_emit_impl(
     if (SC_ADDR_IS_EQUAL(event_subscription->event_type_addr, event_type_addr)
         && ((event_subscription->event_element_type & connector_type) == event_subscription->event_element_type))
     {
-      _sc_event_emission_manager_add(
+      event = _sc_event_emission_manager_reserve(
           emission_manager,
           event_subscription,
           ctx->user_addr,
@@ -356,13 +450,21 @@ sc_result sc_event_emit_impl(
           other_addr,
           callback,
           event_addr);
+      if (event != null_ptr)
+        sc_queue_push(&reserved_events, event);
 
       result = SC_RESULT_OK;
     }
 
     element_events_list = element_events_list->next;
   }
-  sc_monitor_release_read(&subscription_manager->events_table_monitor);
+  sc_monitor_release_read(&bucket->events_table_monitor);
+
+  // sc-events are added after releasing the bucket, because the emitter may back off while the queue of sc-events is
+  // full, and reserved sc-events keep their sc-event subscriptions until then
+  while ((event = sc_queue_pop(&reserved_events)) != null_ptr)
+    _sc_event_emission_manager_add(emission_manager, event);
+  sc_queue_destroy(&reserved_events);
 
 result:
   return result;
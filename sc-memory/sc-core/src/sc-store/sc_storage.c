@@ -16,12 +16,18 @@
 
 #include "sc_segment.h"
 #include "sc_element.h"
+#include "sc_stream_link.h"
 
 #include "sc-fs-memory/sc_fs_memory.h"
 
+#include "sc-store/sc-base/sc_monitor_private.h"
+
 #include "sc_storage_private.h"
 #include "sc_memory_private.h"
 
+//! Size of parts of stream by which sc-link content is appended
+#define SC_STORAGE_LINK_CONTENT_CHUNK_SIZE 65536
+
 sc_storage * storage = null_ptr;
 
 sc_result sc_storage_initialize(sc_memory_params const * params)
@@ -416,6 +422,75 @@ sc_element * sc_storage_allocate_new_element(sc_memory_context const * ctx, sc_a
   return element;
 }
 
+sc_uint32 _sc_storage_get_elements(sc_uint32 count, sc_addr * addrs, sc_element ** elements)
+{
+  sc_uint32 got_count = 0;
+
+  sc_segment * segment = _sc_storage_get_segment();
+  if (segment == null_ptr)
+    goto error;
+
+  sc_monitor_acquire_write(&segment->monitor);
+
+  for (; got_count < count; ++got_count)
+  {
+    sc_addr_offset element_offset;
+    if (segment->last_engaged_offset + 1 != SC_SEGMENT_ELEMENTS_COUNT)
+      element_offset = ++segment->last_engaged_offset;
+    else if (segment->last_released_offset != 0)
+    {
+      element_offset = segment->last_released_offset;
+      segment->last_released_offset = segment->elements[element_offset].flags.type;
+      segment->elements[element_offset].flags.type = 0;
+    }
+    else
+      break;
+
+    elements[got_count] = &segment->elements[element_offset];
+    addrs[got_count] = (sc_addr){segment->num, element_offset};
+  }
+
+  sc_monitor_release_write(&segment->monitor);
+
+error:
+  return got_count;
+}
+
+sc_result sc_storage_allocate_new_elements(sc_uint32 count, sc_addr * addrs, sc_element ** elements)
+{
+  sc_uint32 allocated_count = 0;
+  while (allocated_count < count)
+  {
+    sc_uint32 got_count =
+        _sc_storage_get_elements(count - allocated_count, addrs + allocated_count, elements + allocated_count);
+    if (got_count == 0)
+    {
+      elements[allocated_count] = _sc_storage_get_released_element(&addrs[allocated_count]);
+      if (elements[allocated_count] == null_ptr)
+      {
+        sc_memory_error(
+            "Max segments count is %d. SC-memory is full. Please, extends or swap sc-memory",
+            storage->max_segments_count);
+        break;
+      }
+      got_count = 1;
+    }
+
+    for (sc_uint32 i = allocated_count; i < allocated_count + got_count; ++i)
+      elements[i]->flags.states |= SC_STATE_ELEMENT_EXIST;
+    allocated_count += got_count;
+  }
+
+  if (allocated_count == count)
+    return SC_RESULT_OK;
+
+  for (sc_uint32 i = 0; i < allocated_count; ++i)
+    sc_storage_free_element(addrs[i]);
+  for (sc_uint32 i = 0; i < count; ++i)
+    addrs[i] = SC_ADDR_EMPTY;
+  return SC_RESULT_ERROR_FULL_MEMORY;
+}
+
 void sc_storage_start_new_process()
 {
   if (storage == null_ptr)
@@ -716,6 +791,10 @@ sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr)
 
     if ((el->flags.states & SC_STATE_IS_ERASABLE) != SC_STATE_IS_ERASABLE)
     {
+      // sc-element is marked before emitting, because emitted sc-events can be processed and erase it again before
+      // this thread continues
+      el->flags.states |= SC_STATE_IS_ERASABLE;
+
       if ((type & sc_type_connector_mask) != 0)
       {
         erase_incoming_connector_result = sc_event_emit(
@@ -790,8 +869,6 @@ sc_result sc_storage_element_erase(sc_memory_context const * ctx, sc_addr addr)
           SC_ADDR_EMPTY,
           sc_storage_element_erase,
           element_addr);
-
-      el->flags.states |= SC_STATE_IS_ERASABLE;
     }
 
     if (erase_incoming_connector_result == SC_RESULT_OK || erase_outgoing_connector_result == SC_RESULT_OK
@@ -920,6 +997,31 @@ sc_addr sc_storage_link_new_ext(sc_memory_context const * ctx, sc_type type, sc_
   return addr;
 }
 
+sc_result sc_storage_nodes_new(sc_memory_context const * ctx, sc_type const * types, sc_uint32 count, sc_addr * addrs)
+{
+  sc_unused(ctx);
+
+  for (sc_uint32 i = 0; i < count; ++i)
+    addrs[i] = SC_ADDR_EMPTY;
+
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    if (sc_type_is_not_node(types[i]) && (!sc_type_is(types[i], sc_type_const) && !sc_type_is(types[i], sc_type_var)))
+      return SC_RESULT_ERROR_ELEMENT_IS_NOT_NODE;
+  }
+
+  sc_element ** elements = sc_mem_new(sc_element *, count);
+  sc_result const result = sc_storage_allocate_new_elements(count, addrs, elements);
+  if (result == SC_RESULT_OK)
+  {
+    for (sc_uint32 i = 0; i < count; ++i)
+      elements[i]->flags.type = sc_type_node | types[i];
+  }
+  sc_mem_free(elements);
+
+  return result;
+}
+
 void _sc_storage_make_elements_incident_to_arc(
     sc_addr connector_addr,
     sc_element * arc_el,
@@ -1028,36 +1130,17 @@ sc_addr sc_storage_arc_new(sc_memory_context const * ctx, sc_type type, sc_addr
   return sc_storage_arc_new_ext(ctx, type, beg_addr, end_addr, &result);
 }
 
-sc_addr sc_storage_arc_new_ext(
+sc_result _sc_storage_connect_arc(
     sc_memory_context const * ctx,
     sc_type type,
     sc_addr beg_addr,
     sc_addr end_addr,
-    sc_result * result)
+    sc_addr connector_addr,
+    sc_element * arc_el)
 {
-  sc_addr connector_addr = SC_ADDR_EMPTY;
-
-  if (sc_type_is_not_connector(type))
-  {
-    *result = SC_RESULT_ERROR_ELEMENT_IS_NOT_CONNECTOR;
-    return connector_addr;
-  }
-
-  if (SC_ADDR_IS_EMPTY(beg_addr) || SC_ADDR_IS_EMPTY(end_addr))
-  {
-    *result = SC_RESULT_ERROR_ADDR_IS_NOT_VALID;
-    return connector_addr;
-  }
-
+  sc_result result;
   sc_element *beg_el = null_ptr, *end_el = null_ptr;
 
-  sc_element * arc_el = sc_storage_allocate_new_element(ctx, &connector_addr);
-  if (arc_el == null_ptr)
-  {
-    *result = SC_RESULT_ERROR_FULL_MEMORY;
-    return connector_addr;
-  }
-
   arc_el->flags.type = type;
   arc_el->arc.begin = beg_addr;
   arc_el->arc.end = end_addr;
@@ -1070,12 +1153,12 @@ sc_addr sc_storage_arc_new_ext(
   sc_monitor * end_monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, end_addr);
   sc_monitor_acquire_write_n(2, beg_monitor, end_monitor);
 
-  *result = sc_storage_get_element_by_addr(beg_addr, &beg_el);
-  if (*result != SC_RESULT_OK)
+  result = sc_storage_get_element_by_addr(beg_addr, &beg_el);
+  if (result != SC_RESULT_OK)
     goto error;
 
-  *result = sc_storage_get_element_by_addr(end_addr, &end_el);
-  if (*result != SC_RESULT_OK)
+  result = sc_storage_get_element_by_addr(end_addr, &end_el);
+  if (result != SC_RESULT_OK)
     goto error;
 
   // lock arcs to change output/input list
@@ -1127,12 +1210,85 @@ sc_addr sc_storage_arc_new_ext(
 
   sc_monitor_release_write_n(2, beg_monitor, end_monitor);
 
-  *result = SC_RESULT_OK;
-  return connector_addr;
+  return SC_RESULT_OK;
 error:
   sc_storage_free_element(connector_addr);
   sc_monitor_release_write_n(2, beg_monitor, end_monitor);
-  return SC_ADDR_EMPTY;
+  return result;
+}
+
+sc_addr sc_storage_arc_new_ext(
+    sc_memory_context const * ctx,
+    sc_type type,
+    sc_addr beg_addr,
+    sc_addr end_addr,
+    sc_result * result)
+{
+  sc_addr connector_addr = SC_ADDR_EMPTY;
+
+  if (sc_type_is_not_connector(type))
+  {
+    *result = SC_RESULT_ERROR_ELEMENT_IS_NOT_CONNECTOR;
+    return connector_addr;
+  }
+
+  if (SC_ADDR_IS_EMPTY(beg_addr) || SC_ADDR_IS_EMPTY(end_addr))
+  {
+    *result = SC_RESULT_ERROR_ADDR_IS_NOT_VALID;
+    return connector_addr;
+  }
+
+  sc_element * arc_el = sc_storage_allocate_new_element(ctx, &connector_addr);
+  if (arc_el == null_ptr)
+  {
+    *result = SC_RESULT_ERROR_FULL_MEMORY;
+    return connector_addr;
+  }
+
+  *result = _sc_storage_connect_arc(ctx, type, beg_addr, end_addr, connector_addr, arc_el);
+  return *result == SC_RESULT_OK ? connector_addr : SC_ADDR_EMPTY;
+}
+
+sc_result sc_storage_arcs_new(
+    sc_memory_context const * ctx,
+    sc_type const * types,
+    sc_addr const * beg_addrs,
+    sc_addr const * end_addrs,
+    sc_uint32 count,
+    sc_addr * addrs)
+{
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    addrs[i] = SC_ADDR_EMPTY;
+    if (sc_type_is_not_connector(types[i]))
+      return SC_RESULT_ERROR_ELEMENT_IS_NOT_CONNECTOR;
+
+    if (SC_ADDR_IS_EMPTY(beg_addrs[i]) || SC_ADDR_IS_EMPTY(end_addrs[i]))
+      return SC_RESULT_ERROR_ADDR_IS_NOT_VALID;
+  }
+
+  sc_element ** elements = sc_mem_new(sc_element *, count);
+  sc_result result = sc_storage_allocate_new_elements(count, addrs, elements);
+  if (result != SC_RESULT_OK)
+    goto error;
+
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    result = _sc_storage_connect_arc(ctx, types[i], beg_addrs[i], end_addrs[i], addrs[i], elements[i]);
+    if (result != SC_RESULT_OK)
+    {
+      // the failed sc-arc is freed by connecting, the rest of sc-arcs aren't connected yet
+      for (sc_uint32 j = i + 1; j < count; ++j)
+        sc_storage_free_element(addrs[j]);
+      for (sc_uint32 j = i; j < count; ++j)
+        addrs[j] = SC_ADDR_EMPTY;
+      break;
+    }
+  }
+
+error:
+  sc_mem_free(elements);
+  return result;
 }
 
 sc_uint32 sc_storage_get_element_outgoing_arcs_count(sc_memory_context const * ctx, sc_addr addr, sc_result * result)
@@ -1442,6 +1598,110 @@ error:
   return result;
 }
 
+sc_int32 _sc_storage_compare_monitors(void const * monitor, void const * other_monitor)
+{
+  sc_uint32 const id = (*(sc_monitor * const *)monitor)->id;
+  sc_uint32 const other_id = (*(sc_monitor * const *)other_monitor)->id;
+  return (id > other_id) - (id < other_id);
+}
+
+sc_result sc_storage_set_links_contents(
+    sc_memory_context const * ctx,
+    sc_addr const * addrs,
+    sc_stream const * const * streams,
+    sc_uint32 count,
+    sc_bool is_searchable_string)
+{
+  sc_result result = SC_RESULT_OK;
+
+  sc_addr_hash * link_hashes = sc_mem_new(sc_addr_hash, count);
+  sc_char ** strings = sc_mem_new(sc_char *, count);
+  sc_uint64 * strings_sizes = sc_mem_new(sc_uint64, count);
+  sc_monitor ** monitors = sc_mem_new(sc_monitor *, count);
+  sc_uint32 monitors_count = 0;
+
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    sc_uint32 string_size = 0;
+    if (sc_stream_get_data(streams[i], &strings[i], &string_size) == SC_FALSE)
+    {
+      result = SC_RESULT_ERROR_STREAM_IO;
+      goto exit;
+    }
+
+    if (strings[i] == null_ptr)
+      sc_string_empty(strings[i]);
+    strings_sizes[i] = string_size;
+    link_hashes[i] = SC_ADDR_LOCAL_TO_INT(addrs[i]);
+  }
+
+  // sc-links are locked in order of their monitors, so they are locked with other sc-elements without deadlocks
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addrs[i]);
+    if (monitor != null_ptr)
+      monitors[monitors_count++] = monitor;
+  }
+  qsort(monitors, monitors_count, sizeof(sc_monitor *), _sc_storage_compare_monitors);
+
+  sc_uint32 unique_monitors_count = 0;
+  for (sc_uint32 i = 0; i < monitors_count; ++i)
+  {
+    if (unique_monitors_count == 0 || monitors[unique_monitors_count - 1] != monitors[i])
+      monitors[unique_monitors_count++] = monitors[i];
+  }
+  monitors_count = unique_monitors_count;
+
+  for (sc_uint32 i = 0; i < monitors_count; ++i)
+    sc_monitor_acquire_write(monitors[i]);
+
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    sc_element * el = null_ptr;
+    result = sc_storage_get_element_by_addr(addrs[i], &el);
+    if (result != SC_RESULT_OK)
+      goto error;
+
+    if (sc_type_is_not_node_link(el->flags.type))
+    {
+      result = SC_RESULT_ERROR_ELEMENT_IS_NOT_LINK;
+      goto error;
+    }
+  }
+
+  if (sc_fs_memory_link_strings(
+          link_hashes, (sc_char const * const *)strings, strings_sizes, count, is_searchable_string)
+      != SC_FS_MEMORY_OK)
+  {
+    result = SC_RESULT_ERROR_FILE_MEMORY_IO;
+    goto error;
+  }
+
+  for (sc_uint32 i = 0; i < count; ++i)
+    sc_event_emit(
+        ctx,
+        addrs[i],
+        sc_event_before_change_link_content_addr,
+        SC_ADDR_EMPTY,
+        0,
+        SC_ADDR_EMPTY,
+        null_ptr,
+        SC_ADDR_EMPTY);
+
+error:
+  for (sc_uint32 i = monitors_count; i > 0; --i)
+    sc_monitor_release_write(monitors[i - 1]);
+exit:
+  for (sc_uint32 i = 0; i < count; ++i)
+    sc_mem_free(strings[i]);
+  sc_mem_free(monitors);
+  sc_mem_free(strings_sizes);
+  sc_mem_free(strings);
+  sc_mem_free(link_hashes);
+
+  return result;
+}
+
 sc_result sc_storage_get_link_content(sc_memory_context const * ctx, sc_addr addr, sc_stream ** stream)
 {
   *stream = null_ptr;
@@ -1488,6 +1748,110 @@ error:
   return result;
 }
 
+sc_result sc_storage_append_link_content(sc_memory_context const * ctx, sc_addr addr, sc_stream const * stream)
+{
+  sc_result result;
+
+  sc_element * el = null_ptr;
+
+  sc_uint32 length = 0;
+  if (sc_stream_seek(stream, SC_STREAM_SEEK_SET, 0) != SC_RESULT_OK
+      || sc_stream_get_length(stream, &length) != SC_RESULT_OK)
+    return SC_RESULT_ERROR_STREAM_IO;
+
+  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addr);
+  sc_monitor_acquire_write(monitor);
+
+  result = sc_storage_get_element_by_addr(addr, &el);
+  if (result != SC_RESULT_OK)
+    goto error;
+
+  if (sc_type_is_not_node_link(el->flags.type))
+  {
+    result = SC_RESULT_ERROR_ELEMENT_IS_NOT_LINK;
+    goto error;
+  }
+
+  // stream is appended by chunks, so big contents aren't read into memory entirely
+  sc_char * chunk = sc_mem_new(sc_char, SC_STORAGE_LINK_CONTENT_CHUNK_SIZE);
+  sc_uint32 appended_bytes = 0;
+  while (appended_bytes < length)
+  {
+    sc_uint32 read_bytes = 0;
+    if (sc_stream_read_data(stream, chunk, SC_STORAGE_LINK_CONTENT_CHUNK_SIZE, &read_bytes) != SC_RESULT_OK
+        || read_bytes == 0)
+    {
+      result = SC_RESULT_ERROR_STREAM_IO;
+      break;
+    }
+
+    if (sc_fs_memory_append_string(SC_ADDR_LOCAL_TO_INT(addr), chunk, read_bytes) != SC_FS_MEMORY_OK)
+    {
+      result = SC_RESULT_ERROR_FILE_MEMORY_IO;
+      break;
+    }
+
+    appended_bytes += read_bytes;
+  }
+  sc_mem_free(chunk);
+
+  // parts appended before an error aren't rolled back, so the changed content is still notified
+  if (appended_bytes == 0 && result != SC_RESULT_OK)
+    goto error;
+
+  sc_event_emit(
+      ctx, addr, sc_event_before_change_link_content_addr, SC_ADDR_EMPTY, 0, SC_ADDR_EMPTY, null_ptr, SC_ADDR_EMPTY);
+
+error:
+  sc_monitor_release_write(monitor);
+  return result;
+}
+
+sc_result sc_storage_open_link_content_stream(sc_memory_context const * ctx, sc_addr addr, sc_stream ** stream)
+{
+  *stream = null_ptr;
+  sc_result result;
+
+  sc_element * el = null_ptr;
+
+  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addr);
+  sc_monitor_acquire_read(monitor);
+
+  result = sc_storage_get_element_by_addr(addr, &el);
+  if (result != SC_RESULT_OK)
+    goto error;
+
+  if (sc_type_is_not_node_link(el->flags.type))
+  {
+    result = SC_RESULT_ERROR_ELEMENT_IS_NOT_LINK;
+    goto error;
+  }
+
+  // only location and size of content are read, content is read by parts from stream by its location
+  sc_uint64 string_location = 0;
+  sc_uint64 string_size = 0;
+  sc_fs_memory_status const fs_memory_status =
+      sc_fs_memory_get_string_location_by_link_hash(SC_ADDR_LOCAL_TO_INT(addr), &string_location, &string_size);
+  if (fs_memory_status != SC_FS_MEMORY_OK && fs_memory_status != SC_FS_MEMORY_NO_STRING)
+  {
+    result = SC_RESULT_ERROR_FILE_MEMORY_IO;
+    goto error;
+  }
+
+  // positions of sc-streams are 32-bit
+  if (string_size > SC_MAXUINT32)
+  {
+    result = SC_RESULT_ERROR_STREAM_IO;
+    goto error;
+  }
+
+  *stream = sc_stream_link_new(SC_ADDR_LOCAL_TO_INT(addr), string_location, string_size);
+
+error:
+  sc_monitor_release_read(monitor);
+  return result;
+}
+
 sc_result sc_storage_find_links_with_content_string(
     sc_memory_context const * ctx,
     sc_stream const * stream,
@@ -1599,6 +1963,20 @@ sc_result sc_storage_get_elements_stat(sc_stat * stat)
   return SC_RESULT_OK;
 }
 
+sc_result sc_storage_get_events_stat(sc_events_stat * stat)
+{
+  sc_mem_set(stat, 0, sizeof(sc_events_stat));
+
+  return sc_event_emission_manager_get_stat(sc_storage_get_event_emission_manager(), stat);
+}
+
+sc_result sc_storage_get_link_contents_cache_stat(sc_link_contents_cache_stat * stat)
+{
+  sc_mem_set(stat, 0, sizeof(sc_link_contents_cache_stat));
+
+  return sc_fs_memory_get_link_contents_cache_stat(stat) == SC_FS_MEMORY_OK ? SC_RESULT_OK : SC_RESULT_ERROR;
+}
+
 sc_result sc_storage_save(sc_memory_context const * ctx)
 {
   return sc_fs_memory_save(storage) == SC_FS_MEMORY_OK ? SC_RESULT_OK : SC_RESULT_ERROR;
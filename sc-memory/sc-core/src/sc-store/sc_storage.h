@@ -259,6 +259,57 @@ sc_addr sc_storage_arc_new_ext(
     sc_addr end_addr,
     sc_result * result);
 
+/*!
+ * @brief Generates sc-nodes and sc-links of the specified types in one batch.
+ *
+ * All sc-elements are allocated at once, so sc-elements of one batch are taken from the same segment of sc-memory
+ * under one lock while it has free sc-elements.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param types Types of new sc-nodes and sc-links.
+ * @param count Count of new sc-elements.
+ * @param addrs Array of size `count` to store sc-addrs of created sc-elements.
+ *
+ * @return Returns SC_RESULT_OK if all sc-elements were created, otherwise no sc-elements are created and `addrs` are
+ * empty.
+ *
+ * Possible values for the result:
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_ELEMENT_IS_NOT_NODE Some specified sc-type is not valid for a sc-node or a sc-link.
+ * @retval SC_RESULT_ERROR_FULL_MEMORY Unable to allocate memory for new sc-elements.
+ */
+sc_result sc_storage_nodes_new(sc_memory_context const * ctx, sc_type const * types, sc_uint32 count, sc_addr * addrs);
+
+/*!
+ * @brief Generates sc-connectors of the specified types in one batch.
+ *
+ * All sc-connectors are allocated at once and then connected with their begin and end sc-elements in order of arrays.
+ * Begin and end sc-elements of sc-connectors must exist before batch.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param types Types of new sc-connectors.
+ * @param beg_addrs sc-addrs of begin sc-elements of new sc-connectors.
+ * @param end_addrs sc-addrs of end sc-elements of new sc-connectors.
+ * @param count Count of new sc-connectors.
+ * @param addrs Array of size `count` to store sc-addrs of created sc-connectors.
+ *
+ * @return Returns SC_RESULT_OK if all sc-connectors were created. Otherwise, sc-connectors before the failed one stay
+ * created and sc-addrs of the failed and next sc-connectors are empty.
+ *
+ * Possible values for the result:
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_ELEMENT_IS_NOT_CONNECTOR Some specified type is not a valid sc-connector type.
+ * @retval SC_RESULT_ERROR_ADDR_IS_NOT_VALID Some begin or end sc-addr is not valid.
+ * @retval SC_RESULT_ERROR_FULL_MEMORY Unable to allocate memory for new sc-connectors.
+ */
+sc_result sc_storage_arcs_new(
+    sc_memory_context const * ctx,
+    sc_type const * types,
+    sc_addr const * beg_addrs,
+    sc_addr const * end_addrs,
+    sc_uint32 count,
+    sc_addr * addrs);
+
 /*!
  * @brief Retrieves the count of output connectors for the specified sc-element.
  *
@@ -504,6 +555,40 @@ sc_result sc_storage_set_link_content(
     sc_stream const * stream,
     sc_bool is_searchable_string);
 
+/*!
+ * @brief Sets the contents of the specified sc-links at once.
+ *
+ * This function sets the content of every sc-link with the specified sc-addr using the data from the stream with
+ * the same index. Contents are divided into terms in parallel and appended to indexes of file memory in one pass, so
+ * it is faster than setting of contents one by one when many sc-links are loaded. Contents aren't set if any of
+ * specified sc-addrs isn't sc-link.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param addrs The sc-addrs of the sc-links for which to set the contents.
+ * @param streams The streams containing the content data to be associated with the sc-links.
+ * @param count A count of sc-addrs and streams.
+ * @param is_searchable_string A boolean indicating whether the contents should be treated
+ *                             as searchable strings.
+ *
+ * @return Returns the result of the operation. If successful, the function returns
+ *         SC_RESULT_OK. If an error occurs, the function returns an error code.
+ *
+ * @note This function is thread-safe.
+ *
+ * Possible values for the result:
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_ADDR_IS_NOT_VALID One of the specified sc-addrs is not valid.
+ * @retval SC_RESULT_ERROR_ELEMENT_IS_NOT_LINK One of the specified sc-addrs does not represent a valid sc-link.
+ * @retval SC_RESULT_ERROR_STREAM_IO Error occurred while processing the streams.
+ * @retval SC_RESULT_ERROR_FILE_MEMORY_IO Error occurred during file/memory operations.
+ */
+sc_result sc_storage_set_links_contents(
+    sc_memory_context const * ctx,
+    sc_addr const * addrs,
+    sc_stream const * const * streams,
+    sc_uint32 count,
+    sc_bool is_searchable_string);
+
 /*!
  * @brief Retrieves the content of the specified sc-link as a stream.
  *
@@ -533,6 +618,58 @@ sc_result sc_storage_set_link_content(
  */
 sc_result sc_storage_get_link_content(sc_memory_context const * ctx, sc_addr addr, sc_stream ** stream);
 
+/*!
+ * @brief Appends the content of the specified stream to the end of content of the specified sc-link.
+ *
+ * This function appends the stream to the sc-link content by parts, so previous content isn't rewritten and
+ * big streams aren't read into memory entirely. Small texts with appended parts are indexed again, other contents with
+ * appended parts are stored out of indexes of file memory, so sc-links with them can't be found by their contents.
+ * Parts appended before an error aren't rolled back, and the sc-event of changing content is emitted for them.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param addr The sc-addr of the sc-link to which to append the content.
+ * @param stream The stream containing the content data to be appended to the sc-link content.
+ *
+ * @return Returns the result of the operation. If successful, the function returns
+ *         SC_RESULT_OK. If an error occurs, the function returns an error code.
+ *
+ * @note The caller is responsible for handling any errors indicated by the result value.
+ * @note This function is thread-safe.
+ *
+ * Possible values for the result:
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_ADDR_IS_NOT_VALID The specified sc-addr is not valid.
+ * @retval SC_RESULT_ERROR_ELEMENT_IS_NOT_LINK The specified sc-addr does not represent a valid sc-link.
+ * @retval SC_RESULT_ERROR_STREAM_IO Error occurred while processing the stream.
+ * @retval SC_RESULT_ERROR_FILE_MEMORY_IO Error occurred during file/memory operations.
+ */
+sc_result sc_storage_append_link_content(sc_memory_context const * ctx, sc_addr addr, sc_stream const * stream);
+
+/*!
+ * @brief Opens a stream that reads the content of the specified sc-link by parts.
+ *
+ * Unlike sc_storage_get_link_content, this function doesn't read the sc-link content into memory. The content is
+ * read from file memory by parts on reading from the stream, so big contents can be read by chunks.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param addr The sc-addr of the sc-link for which to open the content stream.
+ * @param stream Pointer to a variable that will store the opened stream.
+ *
+ * @return Returns the result of the operation. If successful, the function returns
+ *         SC_RESULT_OK, and the stream value is set accordingly. If an error occurs,
+ *         the function returns an error code, and the stream value is not valid.
+ *
+ * @note The stream must be freed with sc_stream_free. The sc-link content mustn't be changed while the stream is read.
+ *
+ * Possible values for the result:
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_ADDR_IS_NOT_VALID The specified sc-addr is not valid.
+ * @retval SC_RESULT_ERROR_ELEMENT_IS_NOT_LINK The specified sc-addr does not represent a valid sc-link.
+ * @retval SC_RESULT_ERROR_STREAM_IO The sc-link content is too big for sc-stream.
+ * @retval SC_RESULT_ERROR_FILE_MEMORY_IO Error occurred during file/memory operations.
+ */
+sc_result sc_storage_open_link_content_stream(sc_memory_context const * ctx, sc_addr addr, sc_stream ** stream);
+
 /*!
  * @brief Finds sc-links with content matching the specified string.
  *
@@ -631,6 +768,26 @@ sc_result sc_storage_find_links_contents_by_content_substring(
  */
 sc_result sc_storage_get_elements_stat(sc_stat * stat);
 
+/*!
+ * @brief Retrieves gauges of the queue of sc-events waiting for processing.
+ *
+ * @param stat Pointer to the `sc_events_stat` structure where the statistics will be stored.
+ *
+ * @return Returns SC_RESULT_OK if successful, SC_RESULT_ERROR_INVALID_STATE if sc-storage is not initialized.
+ * @note This function is thread-safe.
+ */
+sc_result sc_storage_get_events_stat(sc_events_stat * stat);
+
+/*!
+ * @brief Retrieves counters of the cache of sc-link contents read from file memory.
+ *
+ * @param stat Pointer to the `sc_link_contents_cache_stat` structure where the statistics will be stored.
+ *
+ * @return Returns SC_RESULT_OK if successful, SC_RESULT_ERROR if file memory is not initialized.
+ * @note This function is thread-safe.
+ */
+sc_result sc_storage_get_link_contents_cache_stat(sc_link_contents_cache_stat * stat);
+
 /*!
  * @brief Saves the current state of the sc-storage to persistent storage.
  *
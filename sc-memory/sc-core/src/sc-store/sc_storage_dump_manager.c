@@ -82,6 +82,42 @@ void _sc_storage_dump_statistics_timer()
       statistics.connector_count,
       (sc_float)statistics.connector_count / (sc_float)allElements * 100);
   sc_message("Total: %" PRIu64, allElements);
+
+  sc_events_stat events_statistics;
+  if (sc_storage_get_events_stat(&events_statistics) == SC_RESULT_OK)
+  {
+    sc_message(
+        "Events: %" PRIu64 " (high priority queued: %" PRIu64 ", normal priority queued: %" PRIu64 ")",
+        events_statistics.events_count,
+        events_statistics.high_priority_queued_events_count,
+        events_statistics.normal_priority_queued_events_count);
+    sc_message("Max reached events: %" PRIu64, events_statistics.max_reached_events_count);
+    sc_message(
+        "Overflowed events: %" PRIu64 " (above limit now: %" PRIu64 ")",
+        events_statistics.overflowed_events_count,
+        events_statistics.overshoot_events_count);
+    sc_message("Backing off events emitters: %" PRIu64, events_statistics.backing_off_emitters_count);
+    sc_message("Coalesced events: %" PRIu64, events_statistics.coalesced_events_count);
+    sc_message(
+        "Events pool hits: %" PRIu64 ", misses: %" PRIu64,
+        events_statistics.events_pool_hits_count,
+        events_statistics.events_pool_misses_count);
+  }
+
+  sc_link_contents_cache_stat link_contents_cache_statistics;
+  if (sc_storage_get_link_contents_cache_stat(&link_contents_cache_statistics) == SC_RESULT_OK)
+  {
+    sc_message(
+        "Link contents cache hits: %" PRIu64 ", misses: %" PRIu64 ", evictions: %" PRIu64,
+        link_contents_cache_statistics.hits_count,
+        link_contents_cache_statistics.misses_count,
+        link_contents_cache_statistics.evictions_count);
+    sc_message(
+        "Link contents cache: %" PRIu64 " contents, %" PRIu64 "/%" PRIu64 " bytes",
+        link_contents_cache_statistics.contents_count,
+        link_contents_cache_statistics.size,
+        link_contents_cache_statistics.max_size);
+  }
 }
 
 void sc_storage_dump_manager_initialize(sc_storage_dump_manager ** manager, sc_memory_params const * params)
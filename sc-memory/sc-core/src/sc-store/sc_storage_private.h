@@ -39,6 +39,12 @@ sc_event_subscription_manager * sc_storage_get_event_subscription_manager();
 
 sc_element * sc_storage_allocate_new_element(sc_memory_context const * ctx, sc_addr * addr);
 
+/*!
+ * @brief Allocates several sc-elements at once: sc-elements are taken from the same segment under one lock while it has
+ * free sc-elements. If sc-memory is full, then no sc-elements are allocated.
+ */
+sc_result sc_storage_allocate_new_elements(sc_uint32 count, sc_addr * addrs, sc_element ** elements);
+
 sc_result sc_storage_get_element_by_addr(sc_addr addr, sc_element ** el);
 
 sc_result sc_storage_free_element(sc_addr addr);
@@ -0,0 +1,129 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_stream_link.h"
+
+#include "sc-core/sc-base/sc_allocator.h"
+
+#include "sc-store/sc-base/sc_assert_utils.h"
+
+#include "sc-fs-memory/sc_fs_memory.h"
+
+#include "sc_stream_private.h"
+
+struct _sc_link_content
+{
+  sc_addr_hash link_hash;     // hash of sc-link with content
+  sc_uint64 string_location;  // location of content in file memory when stream is opened
+  sc_uint32 size;             // size of content when stream is opened
+  sc_uint32 pos;              // current position
+};
+
+typedef struct _sc_link_content sc_link_content;
+
+sc_result sc_stream_link_read(sc_stream const * stream, sc_char * data, sc_uint32 length, sc_uint32 * bytes_read)
+{
+  sc_assert(stream != null_ptr);
+  sc_link_content * content = (sc_link_content *)stream->handler;
+
+  *bytes_read = 0;
+  if (length > (content->size - content->pos))
+    length = content->size - content->pos;
+
+  if (length == 0)
+    return SC_RESULT_OK;
+
+  // content can't end before its size, so stream isn't read infinitely until its end
+  sc_uint64 read_bytes = 0;
+  if (sc_fs_memory_read_string_by_location(
+          content->link_hash, content->string_location, content->pos, data, length, &read_bytes)
+          != SC_FS_MEMORY_OK
+      || read_bytes == 0)
+    return SC_RESULT_ERROR_FILE_MEMORY_IO;
+
+  *bytes_read = read_bytes;
+  content->pos += *bytes_read;
+
+  return SC_RESULT_OK;
+}
+
+sc_result sc_stream_link_seek(sc_stream const * stream, sc_stream_seek_origin origin, sc_uint32 offset)
+{
+  sc_assert(stream != null_ptr);
+  sc_link_content * content = (sc_link_content *)stream->handler;
+
+  switch (origin)
+  {
+  case SC_STREAM_SEEK_END:
+    if (offset > content->size)
+      return SC_RESULT_ERROR_INVALID_PARAMS;
+    content->pos = content->size - offset;
+    break;
+
+  case SC_STREAM_SEEK_CUR:
+    if (offset > (content->size - content->pos))
+      return SC_RESULT_ERROR_INVALID_PARAMS;
+    content->pos += offset;
+    break;
+
+  case SC_STREAM_SEEK_SET:
+    if (offset > content->size)
+      return SC_RESULT_ERROR_INVALID_PARAMS;
+    content->pos = offset;
+    break;
+  };
+
+  return SC_RESULT_OK;
+}
+
+sc_result sc_stream_link_tell(sc_stream const * stream, sc_uint32 * position)
+{
+  sc_assert(stream != null_ptr);
+  sc_link_content * content = (sc_link_content *)stream->handler;
+
+  *position = content->pos;
+
+  return SC_RESULT_OK;
+}
+
+sc_result sc_stream_link_free_handler(sc_stream const * stream)
+{
+  sc_assert(stream != null_ptr);
+  sc_mem_free(stream->handler);
+
+  return SC_RESULT_OK;
+}
+
+sc_bool sc_stream_link_eof(sc_stream const * stream)
+{
+  sc_assert(stream != null_ptr);
+  sc_link_content * content = (sc_link_content *)stream->handler;
+
+  return content->pos == content->size;
+}
+
+sc_stream * sc_stream_link_new(sc_addr_hash link_hash, sc_uint64 string_location, sc_uint32 size)
+{
+  sc_link_content * content = sc_mem_new(sc_link_content, 1);
+  content->link_hash = link_hash;
+  content->string_location = string_location;
+  content->size = size;
+  content->pos = 0;
+
+  sc_stream * stream = sc_mem_new(sc_stream, 1);
+
+  stream->flags = SC_STREAM_FLAG_READ | SC_STREAM_FLAG_SEEK | SC_STREAM_FLAG_TELL;
+  stream->handler = content;
+
+  stream->eof_func = &sc_stream_link_eof;
+  stream->free_func = &sc_stream_link_free_handler;
+  stream->read_func = &sc_stream_link_read;
+  stream->seek_func = &sc_stream_link_seek;
+  stream->tell_func = &sc_stream_link_tell;
+  stream->write_func = null_ptr;  // doesn't support writing
+
+  return stream;
+}
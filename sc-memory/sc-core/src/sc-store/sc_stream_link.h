@@ -0,0 +1,23 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_stream_link_h_
+#define _sc_stream_link_h_
+
+#include "sc-core/sc_stream.h"
+
+/*! Creates sc-link content data stream. Content is read from file memory by parts on reading from stream, so it
+ * isn't read into memory entirely.
+ * @param link_hash A sc-link hash
+ * @param string_location A location of sc-link content in file memory when stream is opened
+ * @param size A size of sc-link content when stream is opened, stream can't be read after it
+ * @remarks The returned stream pointer should be freed with sc_stream_free function, when done using it. Changes of
+ * sc-link content while stream is read aren't supported.
+ * @return Returns stream pointer.
+ */
+sc_stream * sc_stream_link_new(sc_addr_hash link_hash, sc_uint64 string_location, sc_uint32 size);
+
+#endif
@@ -303,6 +303,18 @@ sc_addr sc_memory_node_new_ext(sc_memory_context const * ctx, sc_type type, sc_r
   return sc_storage_node_new_ext(ctx, type, result);
 }
 
+sc_result sc_memory_nodes_new(sc_memory_context const * ctx, sc_type const * types, sc_uint32 count, sc_addr * addrs)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+  {
+    for (sc_uint32 i = 0; i < count; ++i)
+      addrs[i] = SC_ADDR_EMPTY;
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+  }
+
+  return sc_storage_nodes_new(ctx, types, count, addrs);
+}
+
 sc_addr sc_memory_link_new(sc_memory_context const * ctx)
 {
   return sc_memory_link_new2(ctx, sc_type_const_node_link);
@@ -331,14 +343,8 @@ sc_addr sc_memory_arc_new(sc_memory_context const * ctx, sc_type type, sc_addr b
   return sc_memory_arc_new_ext(ctx, type, beg, end, &result);
 }
 
-sc_addr sc_memory_arc_new_ext(sc_memory_context const * ctx, sc_type type, sc_addr beg, sc_addr end, sc_result * result)
+sc_result _sc_memory_check_arc_new_permissions(sc_memory_context const * ctx, sc_type type, sc_addr beg, sc_addr end)
 {
-  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
-  {
-    *result = SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
-    return SC_ADDR_EMPTY;
-  }
-
   if (_sc_memory_context_check_if_has_permitted_structure(
           memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_WRITE, beg)
           == SC_FALSE
@@ -347,30 +353,60 @@ sc_addr sc_memory_arc_new_ext(sc_memory_context const * ctx, sc_type type, sc_ad
     if (_sc_memory_context_check_local_and_global_permissions(
             memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_WRITE, beg)
         == SC_FALSE)
-    {
-      *result = SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS;
-      return SC_ADDR_EMPTY;
-    }
+      return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS;
     if (_sc_memory_context_check_local_and_global_permissions(
             memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_WRITE, end)
         == SC_FALSE)
-    {
-      *result = SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS;
-      return SC_ADDR_EMPTY;
-    }
+      return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS;
   }
 
   if (_sc_memory_context_check_global_permissions_to_write_permissions(
           memory->context_manager, ctx, beg, type, SC_CONTEXT_PERMISSIONS_TO_WRITE_PERMISSIONS)
       == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_PERMISSIONS_TO_WRITE_PERMISSIONS;
+
+  return SC_RESULT_OK;
+}
+
+sc_addr sc_memory_arc_new_ext(sc_memory_context const * ctx, sc_type type, sc_addr beg, sc_addr end, sc_result * result)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
   {
-    *result = SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_PERMISSIONS_TO_WRITE_PERMISSIONS;
+    *result = SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
     return SC_ADDR_EMPTY;
   }
 
+  *result = _sc_memory_check_arc_new_permissions(ctx, type, beg, end);
+  if (*result != SC_RESULT_OK)
+    return SC_ADDR_EMPTY;
+
   return sc_storage_arc_new_ext(ctx, type, beg, end, result);
 }
 
+sc_result sc_memory_arcs_new(
+    sc_memory_context const * ctx,
+    sc_type const * types,
+    sc_addr const * beg_addrs,
+    sc_addr const * end_addrs,
+    sc_uint32 count,
+    sc_addr * addrs)
+{
+  for (sc_uint32 i = 0; i < count; ++i)
+    addrs[i] = SC_ADDR_EMPTY;
+
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    sc_result const result = _sc_memory_check_arc_new_permissions(ctx, types[i], beg_addrs[i], end_addrs[i]);
+    if (result != SC_RESULT_OK)
+      return result;
+  }
+
+  return sc_storage_arcs_new(ctx, types, beg_addrs, end_addrs, count, addrs);
+}
+
 sc_result sc_memory_get_element_type(sc_memory_context const * ctx, sc_addr addr, sc_type * result)
 {
   if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
@@ -498,6 +534,32 @@ sc_result sc_memory_set_link_content_ext(
   return sc_storage_set_link_content(ctx, addr, stream, is_searchable_string);
 }
 
+sc_result sc_memory_set_links_contents_ext(
+    sc_memory_context const * ctx,
+    sc_addr const * addrs,
+    sc_stream const * const * streams,
+    sc_uint32 count,
+    sc_bool is_searchable_string)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    if (_sc_memory_context_check_local_and_global_permissions(
+            memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_ERASE, addrs[i])
+        == SC_FALSE)
+      return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_ERASE_PERMISSIONS;
+
+    if (_sc_memory_context_check_local_and_global_permissions(
+            memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_WRITE, addrs[i])
+        == SC_FALSE)
+      return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS;
+  }
+
+  return sc_storage_set_links_contents(ctx, addrs, streams, count, is_searchable_string);
+}
+
 sc_result sc_memory_get_link_content(sc_memory_context const * ctx, sc_addr addr, sc_stream ** stream)
 {
   if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
@@ -511,6 +573,32 @@ sc_result sc_memory_get_link_content(sc_memory_context const * ctx, sc_addr addr
   return sc_storage_get_link_content(ctx, addr, stream);
 }
 
+sc_result sc_memory_append_link_content(sc_memory_context const * ctx, sc_addr addr, sc_stream const * stream)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  if (_sc_memory_context_check_local_and_global_permissions(
+          memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_WRITE, addr)
+      == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS;
+
+  return sc_storage_append_link_content(ctx, addr, stream);
+}
+
+sc_result sc_memory_open_link_content_stream(sc_memory_context const * ctx, sc_addr addr, sc_stream ** stream)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  if (_sc_memory_context_check_local_and_global_permissions(
+          memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ, addr)
+      == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS;
+
+  return sc_storage_open_link_content_stream(ctx, addr, stream);
+}
+
 void _push_link_hash(void * data, sc_addr const link_addr)
 {
   sc_list_push_back((sc_list *)data, (sc_addr_hash_to_sc_pointer)SC_ADDR_LOCAL_TO_INT(link_addr));
@@ -636,6 +724,30 @@ sc_result sc_memory_stat(sc_memory_context const * ctx, sc_stat * statistics)
   return sc_storage_get_elements_stat(statistics);
 }
 
+sc_result sc_memory_events_stat(sc_memory_context const * ctx, sc_events_stat * statistics)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  if (_sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ)
+      == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS;
+
+  return sc_storage_get_events_stat(statistics);
+}
+
+sc_result sc_memory_link_contents_cache_stat(sc_memory_context const * ctx, sc_link_contents_cache_stat * statistics)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  if (_sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ)
+      == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS;
+
+  return sc_storage_get_link_contents_cache_stat(statistics);
+}
+
 sc_result sc_memory_save(sc_memory_context const * ctx)
 {
   if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
@@ -245,8 +245,9 @@ void _sc_memory_context_pend_event(
   params->connector_type = connector_type;
   params->other_addr = other_addr;
 
+  // pending events are prepended to list, because appending to list is linear, and they are reversed before emitting
   sc_monitor_acquire_write((sc_monitor *)&ctx->monitor);
-  ((sc_memory_context *)ctx)->pend_events = sc_hash_table_list_append(ctx->pend_events, params);
+  ((sc_memory_context *)ctx)->pend_events = sc_hash_table_list_prepend(ctx->pend_events, params);
   sc_monitor_release_write((sc_monitor *)&ctx->monitor);
 }
 
@@ -255,7 +256,8 @@ void _sc_memory_context_emit_events(sc_memory_context const * ctx)
   GSList * item = null_ptr;
   sc_event_emit_params * event_params = null_ptr;
 
-  // Emit all saved events
+  // Emit all saved events in order of their pending
+  ((sc_memory_context *)ctx)->pend_events = sc_hash_table_list_reverse(ctx->pend_events);
   while (ctx->pend_events)
   {
     item = ctx->pend_events;
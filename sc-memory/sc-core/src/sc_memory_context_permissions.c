@@ -228,6 +228,47 @@ sc_addr _sc_memory_context_manager_generate_guest_user(sc_memory_context_manager
   return guest_user_addr;
 }
 
+/*! Handles deletion of an sc-event subscription of the sc-memory context manager, when the subscription is destroyed
+ * or its sc-element is erased, so that the sc-memory context manager doesn't reference it anymore.
+ */
+sc_result _sc_memory_context_manager_on_delete_user_event_subscription(sc_event_subscription const * event)
+{
+  sc_memory_context_manager * manager = event->data;
+
+  sc_event_subscription ** subscriptions[] = {
+      &manager->on_new_identified_user_subscription,
+      &manager->on_authentication_request_user_subscription,
+      &manager->on_remove_authenticated_user_subscription,
+      &manager->on_new_user_action_class,
+      &manager->on_new_users_set_action_class,
+      &manager->on_remove_user_action_class,
+      &manager->on_remove_users_set_action_class,
+      &manager->on_new_user_action_class_within_sc_structure,
+      &manager->on_new_users_set_action_class_within_sc_structure,
+      &manager->on_remove_user_action_class_within_sc_structure,
+      &manager->on_remove_users_set_action_class_within_sc_structure,
+  };
+  for (sc_uint32 i = 0; i < sizeof(subscriptions) / sizeof(subscriptions[0]); ++i)
+  {
+    if (*subscriptions[i] == event)
+      *subscriptions[i] = null_ptr;
+  }
+
+  sc_pointer const users_set_key = GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(event->subscription_addr));
+
+  sc_monitor_acquire_write(&manager->on_new_users_in_sets_events_monitor);
+  if (sc_hash_table_get(manager->on_new_users_in_sets_events, users_set_key) == event)
+    sc_hash_table_steal(manager->on_new_users_in_sets_events, users_set_key);
+  sc_monitor_release_write(&manager->on_new_users_in_sets_events_monitor);
+
+  sc_monitor_acquire_write(&manager->on_remove_users_from_sets_events_monitor);
+  if (sc_hash_table_get(manager->on_remove_users_from_sets_events, users_set_key) == event)
+    sc_hash_table_steal(manager->on_remove_users_from_sets_events, users_set_key);
+  sc_monitor_release_write(&manager->on_remove_users_from_sets_events_monitor);
+
+  return SC_RESULT_OK;
+}
+
 sc_result _sc_memory_context_manager_on_identified_user(
     sc_event_subscription const * event,
     sc_addr initiator_addr,
@@ -509,14 +550,14 @@ void _sc_memory_context_manager_handle_users_set_action_class(
       sc_hash_table_get(manager->on_new_users_in_sets_events, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(users_set_addr)));
   if (event == null_ptr)
   {
-    event = sc_event_subscription_with_user_new(
+    event = _sc_event_subscription_system_with_user_new(
         s_memory_default_ctx,
         users_set_addr,
         sc_event_after_generate_outgoing_arc_addr,
         sc_type_membership_arc,
         manager,
         _sc_memory_context_manager_on_new_user_in_users_set,
-        null_ptr);
+        _sc_memory_context_manager_on_delete_user_event_subscription);
     sc_hash_table_insert(
         manager->on_new_users_in_sets_events, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(users_set_addr)), event);
   }
@@ -527,14 +568,14 @@ void _sc_memory_context_manager_handle_users_set_action_class(
       manager->on_remove_users_from_sets_events, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(users_set_addr)));
   if (event == null_ptr)
   {
-    event = sc_event_subscription_with_user_new(
+    event = _sc_event_subscription_system_with_user_new(
         s_memory_default_ctx,
         users_set_addr,
         sc_event_before_erase_outgoing_arc_addr,
         sc_type_membership_arc,
         manager,
         _sc_memory_context_manager_on_remove_user_from_users_set,
-        null_ptr);
+        _sc_memory_context_manager_on_delete_user_event_subscription);
     sc_hash_table_insert(
         manager->on_remove_users_from_sets_events, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(users_set_addr)), event);
   }
@@ -1089,7 +1130,7 @@ void _sc_memory_context_handle_all_user_permissions(sc_memory_context_manager *
 }
 
 #define sc_context_manager_register_user_event(...) \
-  manager->user_mode ? sc_event_subscription_with_user_new(__VA_ARGS__) : null_ptr
+  manager->user_mode ? _sc_event_subscription_system_with_user_new(__VA_ARGS__) : null_ptr
 
 #define sc_context_manager_unregister_user_event(...) sc_event_subscription_destroy(__VA_ARGS__)
 
@@ -1109,7 +1150,7 @@ void _sc_memory_context_manager_register_user_events(sc_memory_context_manager *
       sc_type_membership_arc,
       manager,
       _sc_memory_context_manager_on_identified_user,
-      null_ptr);
+      _sc_memory_context_manager_on_delete_user_event_subscription);
 
   manager->concept_authentication_request_user_addr = concept_authentication_request_user_addr;
   _sc_context_set_permissions_for_element(
@@ -1126,7 +1167,7 @@ void _sc_memory_context_manager_register_user_events(sc_memory_context_manager *
       sc_type_membership_arc,
       manager,
       _sc_memory_context_manager_on_authentication_request_user,
-      null_ptr);
+      _sc_memory_context_manager_on_delete_user_event_subscription);
   manager->on_remove_authenticated_user_subscription = sc_context_manager_register_user_event(
       s_memory_default_ctx,
       manager->concept_authenticated_user_addr,
@@ -1134,7 +1175,7 @@ void _sc_memory_context_manager_register_user_events(sc_memory_context_manager *
       sc_type_membership_arc,
       manager,
       _sc_memory_context_manager_on_unauthentication_request_user,
-      null_ptr);
+      _sc_memory_context_manager_on_delete_user_event_subscription);
 
   manager->nrel_user_action_class_addr = nrel_user_action_class_addr;
   _sc_context_set_permissions_for_element(
@@ -1162,7 +1203,7 @@ void _sc_memory_context_manager_register_user_events(sc_memory_context_manager *
       sc_type_membership_arc,
       manager,
       _sc_memory_context_manager_on_new_user_action_class,
-      null_ptr);
+      _sc_memory_context_manager_on_delete_user_event_subscription);
 
   manager->on_new_users_set_action_class = sc_context_manager_register_user_event(
       s_memory_default_ctx,
@@ -1171,7 +1212,7 @@ void _sc_memory_context_manager_register_user_events(sc_memory_context_manager *
       sc_type_membership_arc,
       manager,
       _sc_memory_context_manager_on_new_users_set_action_class,
-      null_ptr);
+      _sc_memory_context_manager_on_delete_user_event_subscription);
 
   manager->on_remove_user_action_class = sc_context_manager_register_user_event(
       s_memory_default_ctx,
@@ -1180,7 +1221,7 @@ void _sc_memory_context_manager_register_user_events(sc_memory_context_manager *
       sc_type_membership_arc,
       manager,
       _sc_memory_context_manager_on_remove_user_action_class,
-      null_ptr);
+      _sc_memory_context_manager_on_delete_user_event_subscription);
 
   manager->on_remove_users_set_action_class = sc_context_manager_register_user_event(
       s_memory_default_ctx,
@@ -1189,7 +1230,7 @@ void _sc_memory_context_manager_register_user_events(sc_memory_context_manager *
       sc_type_membership_arc,
       manager,
       _sc_memory_context_manager_on_remove_users_set_action_class,
-      null_ptr);
+      _sc_memory_context_manager_on_delete_user_event_subscription);
 
   manager->nrel_user_action_class_within_sc_structure_addr = nrel_user_action_class_within_sc_structure_addr;
   _sc_context_set_permissions_for_element(
@@ -1206,7 +1247,7 @@ void _sc_memory_context_manager_register_user_events(sc_memory_context_manager *
       sc_type_membership_arc,
       manager,
       _sc_memory_context_manager_on_new_user_action_class_within_structure,
-      null_ptr);
+      _sc_memory_context_manager_on_delete_user_event_subscription);
 
   manager->on_new_users_set_action_class_within_sc_structure = sc_context_manager_register_user_event(
       s_memory_default_ctx,
@@ -1215,7 +1256,7 @@ void _sc_memory_context_manager_register_user_events(sc_memory_context_manager *
       sc_type_membership_arc,
       manager,
       _sc_memory_context_manager_on_new_users_set_action_class_within_structure,
-      null_ptr);
+      _sc_memory_context_manager_on_delete_user_event_subscription);
 
   manager->on_remove_user_action_class_within_sc_structure = sc_context_manager_register_user_event(
       s_memory_default_ctx,
@@ -1224,7 +1265,7 @@ void _sc_memory_context_manager_register_user_events(sc_memory_context_manager *
       sc_type_membership_arc,
       manager,
       _sc_memory_context_manager_on_remove_user_action_class_within_structure,
-      null_ptr);
+      _sc_memory_context_manager_on_delete_user_event_subscription);
 
   manager->on_remove_users_set_action_class_within_sc_structure = sc_context_manager_register_user_event(
       s_memory_default_ctx,
@@ -1233,7 +1274,35 @@ void _sc_memory_context_manager_register_user_events(sc_memory_context_manager *
       sc_type_membership_arc,
       manager,
       _sc_memory_context_manager_on_remove_users_set_action_class_within_structure,
-      null_ptr);
+      _sc_memory_context_manager_on_delete_user_event_subscription);
+}
+
+/*! Destroys all sc-event subscriptions of the sc-memory context manager stored in a table by users sets. Each
+ * subscription is removed from the table by its delete callback.
+ */
+void _sc_memory_context_manager_unregister_users_sets_events(sc_hash_table * events_table, sc_monitor * monitor)
+{
+  while (SC_TRUE)
+  {
+    sc_pointer users_set_key = null_ptr;
+    sc_pointer event = null_ptr;
+
+    sc_monitor_acquire_read(monitor);
+    sc_hash_table_iterator iterator;
+    sc_hash_table_iterator_init(&iterator, events_table);
+    sc_bool const is_found = sc_hash_table_iterator_next(&iterator, &users_set_key, &event);
+    sc_monitor_release_read(monitor);
+
+    if (is_found == SC_FALSE)
+      break;
+
+    if (sc_event_subscription_destroy(event) != SC_RESULT_OK)
+    {
+      sc_monitor_acquire_write(monitor);
+      sc_hash_table_steal(events_table, users_set_key);
+      sc_monitor_release_write(monitor);
+    }
+  }
 }
 
 void _sc_memory_context_manager_unregister_user_events(sc_memory_context_manager * manager)
@@ -1252,6 +1321,11 @@ void _sc_memory_context_manager_unregister_user_events(sc_memory_context_manager
   sc_context_manager_unregister_user_event(manager->on_new_users_set_action_class_within_sc_structure);
   sc_context_manager_unregister_user_event(manager->on_remove_user_action_class_within_sc_structure);
   sc_context_manager_unregister_user_event(manager->on_remove_users_set_action_class_within_sc_structure);
+
+  _sc_memory_context_manager_unregister_users_sets_events(
+      manager->on_new_users_in_sets_events, &manager->on_new_users_in_sets_events_monitor);
+  _sc_memory_context_manager_unregister_users_sets_events(
+      manager->on_remove_users_from_sets_events, &manager->on_remove_users_from_sets_events_monitor);
 }
 
 // If the system is not in user mode, grant permissions
@@ -21,6 +21,8 @@ void sc_memory_params_clear(sc_memory_params * params)
   params->max_loaded_segments = DEFAULT_MAX_LOADED_SEGMENTS;
   params->limit_max_threads_by_max_physical_cores = DEFAULT_LIMIT_MAX_THREADS_BY_MAX_PHYSICAL_CORES;
   params->max_events_and_agents_threads = DEFAULT_MAX_EVENTS_AND_AGENTS_THREADS;
+  params->max_events_queue_size = DEFAULT_MAX_EVENTS_QUEUE_SIZE;
+  params->events_queue_overflow_policy = DEFAULT_EVENTS_QUEUE_OVERFLOW_POLICY;
 
   params->dump_memory = SC_TRUE;
   params->dump_memory_period = DEFAULT_DUMP_MEMORY_PERIOD;  // seconds
@@ -40,4 +42,5 @@ void sc_memory_params_clear(sc_memory_params * params)
   params->max_searchable_string_size = DEFAULT_MAX_SEARCHABLE_STRING_SIZE;
   params->term_separators = DEFAULT_TERM_SEPARATORS;
   params->search_by_substring = DEFAULT_SEARCH_BY_SUBSTRING;
+  params->max_link_contents_cache_size = DEFAULT_MAX_LINK_CONTENTS_CACHE_SIZE;
 }
@@ -101,3 +101,57 @@ TEST_F(ScMemoryTest, sc_event_subscription_invalid)
       sc_event_subscription_with_user_new(context, SC_ADDR_EMPTY, subscription_addr, 0, nullptr, nullptr, nullptr),
       nullptr);
 }
+
+TEST_F(ScMemoryTest, sc_memory_nodes_new)
+{
+  sc_memory_context * context = **m_ctx;
+  sc_type const types[] = {sc_type_const_node, sc_type_const_node_link, sc_type_node | sc_type_var};
+  sc_addr addrs[3];
+  EXPECT_EQ(sc_memory_nodes_new(context, types, 3, addrs), SC_RESULT_OK);
+
+  for (sc_uint32 i = 0; i < 3; ++i)
+  {
+    EXPECT_TRUE(sc_memory_is_element(context, addrs[i]));
+    sc_type type;
+    EXPECT_EQ(sc_memory_get_element_type(context, addrs[i], &type), SC_RESULT_OK);
+    EXPECT_EQ(type, sc_type_node | types[i]);
+  }
+  EXPECT_FALSE(SC_ADDR_IS_EQUAL(addrs[0], addrs[1]));
+  EXPECT_FALSE(SC_ADDR_IS_EQUAL(addrs[1], addrs[2]));
+
+  // addrs are left from the previous call, all of them must be cleared
+  sc_type const invalid_types[] = {sc_type_const_node, sc_type_const_perm_pos_arc, sc_type_const_node_link};
+  EXPECT_EQ(sc_memory_nodes_new(context, invalid_types, 3, addrs), SC_RESULT_ERROR_ELEMENT_IS_NOT_NODE);
+  for (sc_uint32 i = 0; i < 3; ++i)
+    EXPECT_TRUE(SC_ADDR_IS_EMPTY(addrs[i]));
+}
+
+TEST_F(ScMemoryTest, sc_memory_arcs_new)
+{
+  sc_memory_context * context = **m_ctx;
+  sc_addr const source_addr = sc_memory_node_new(context, sc_type_const_node);
+  sc_addr const target_addr = sc_memory_node_new(context, sc_type_const_node);
+
+  sc_type const types[] = {sc_type_const_perm_pos_arc, sc_type_const_common_edge};
+  sc_addr const beg_addrs[] = {source_addr, target_addr};
+  sc_addr const end_addrs[] = {target_addr, source_addr};
+  sc_addr addrs[2];
+  EXPECT_EQ(sc_memory_arcs_new(context, types, beg_addrs, end_addrs, 2, addrs), SC_RESULT_OK);
+
+  for (sc_uint32 i = 0; i < 2; ++i)
+  {
+    sc_addr found_beg_addr, found_end_addr;
+    EXPECT_EQ(sc_memory_get_arc_info(context, addrs[i], &found_beg_addr, &found_end_addr), SC_RESULT_OK);
+    EXPECT_TRUE(SC_ADDR_IS_EQUAL(found_beg_addr, beg_addrs[i]));
+    EXPECT_TRUE(SC_ADDR_IS_EQUAL(found_end_addr, end_addrs[i]));
+  }
+  sc_result result;
+  EXPECT_EQ(sc_memory_get_element_outgoing_arcs_count(context, source_addr, &result), 2u);
+  EXPECT_EQ(sc_memory_get_element_incoming_arcs_count(context, target_addr, &result), 2u);
+
+  sc_addr const invalid_end_addrs[] = {target_addr, SC_ADDR_EMPTY};
+  EXPECT_EQ(
+      sc_memory_arcs_new(context, types, beg_addrs, invalid_end_addrs, 2, addrs), SC_RESULT_ERROR_ADDR_IS_NOT_VALID);
+  EXPECT_TRUE(SC_ADDR_IS_EMPTY(addrs[0]));
+  EXPECT_EQ(sc_memory_get_element_outgoing_arcs_count(context, source_addr, &result), 2u);
+}
@@ -229,3 +229,35 @@ TEST(ScDictionaryTest, sc_dictionary_append_get_by_key_prefix)
 
   EXPECT_TRUE(_test_sc_uchar_dictionary_destroy(dictionary));
 }
+
+TEST(ScDictionaryTest, sc_dictionary_append_get_by_keys_with_all_chars)
+{
+  sc_dictionary * dictionary;
+  EXPECT_TRUE(_test_sc_uchar_dictionary_initialize(&dictionary));
+
+  // nodes with many children grow through all kinds of nodes
+  sc_uint64 const memory_size = sc_dictionary_get_memory_size(dictionary);
+  for (sc_uint32 ch = 1; ch <= 255; ++ch)
+  {
+    sc_char string[] = {'s', (sc_char)ch, 'x', '\0'};
+    sc_dictionary_append(dictionary, string, 3, (sc_addr_hash_to_sc_pointer)ch);
+    sc_dictionary_append(dictionary, string + 1, 2, (sc_addr_hash_to_sc_pointer)(ch + 1000));
+  }
+  EXPECT_GT(sc_dictionary_get_memory_size(dictionary), memory_size);
+
+  for (sc_uint32 ch = 1; ch <= 255; ++ch)
+  {
+    sc_char string[] = {'s', (sc_char)ch, 'x', '\0'};
+    EXPECT_EQ((sc_pointer_to_sc_addr_hash)sc_dictionary_get_by_key(dictionary, string, 3), ch);
+    EXPECT_EQ((sc_pointer_to_sc_addr_hash)sc_dictionary_get_by_key(dictionary, string + 1, 2), ch + 1000);
+  }
+
+  sc_list * hashes;
+  sc_list_init(&hashes);
+  sc_char search_string[] = "s";
+  sc_dictionary_get_by_key_prefix(dictionary, search_string, 1, _test_visit_nodes_by_key_prefix, (void **)&hashes);
+  EXPECT_EQ(hashes->size, 255u + 1u);
+  sc_list_destroy(hashes);
+
+  EXPECT_TRUE(_test_sc_uchar_dictionary_destroy(dictionary));
+}
@@ -0,0 +1,77 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <sc-memory/test/sc_test.hpp>
+
+extern "C"
+{
+#include <sc-store/sc-container/sc_hash_map.h>
+}
+
+sc_bool _test_sc_hash_map_sum_values(sc_uint64 key, void * value, void ** arguments)
+{
+  EXPECT_EQ(key + 1, (sc_uint64)value);
+  *(sc_uint64 *)arguments += (sc_uint64)value;
+  return SC_TRUE;
+}
+
+TEST(ScHashMapTest, sc_hash_map_insert_get_remove)
+{
+  sc_hash_map * map;
+  EXPECT_TRUE(sc_hash_map_initialize(&map, 0));
+
+  sc_uint64 const count = 10000;
+  // keys differ by high bits as segments of sc-addr hashes
+  for (sc_uint64 i = 0; i < count; ++i)
+    EXPECT_EQ(sc_hash_map_insert(map, i << 16, (void *)((i << 16) + 1)), nullptr);
+  EXPECT_EQ(map->size, count);
+
+  for (sc_uint64 i = 0; i < count; ++i)
+    EXPECT_EQ(sc_hash_map_get(map, i << 16), (void *)((i << 16) + 1));
+  EXPECT_EQ(sc_hash_map_get(map, 1), nullptr);
+
+  EXPECT_EQ(sc_hash_map_insert(map, 0, (void *)2), (void *)1);
+  EXPECT_EQ(sc_hash_map_insert(map, 0, (void *)1), (void *)2);
+  EXPECT_EQ(map->size, count);
+
+  for (sc_uint64 i = 0; i < count; i += 2)
+    EXPECT_EQ(sc_hash_map_remove(map, i << 16), (void *)((i << 16) + 1));
+  EXPECT_EQ(sc_hash_map_remove(map, 0), nullptr);
+  EXPECT_EQ(map->size, count / 2);
+
+  for (sc_uint64 i = 0; i < count; ++i)
+    EXPECT_EQ(sc_hash_map_get(map, i << 16), i % 2 == 0 ? nullptr : (void *)((i << 16) + 1));
+
+  sc_uint64 sum = 0;
+  EXPECT_TRUE(sc_hash_map_visit(map, _test_sc_hash_map_sum_values, (void **)&sum));
+  sc_uint64 expected_sum = 0;
+  for (sc_uint64 i = 1; i < count; i += 2)
+    expected_sum += (i << 16) + 1;
+  EXPECT_EQ(sum, expected_sum);
+
+  EXPECT_TRUE(sc_hash_map_destroy(map, nullptr));
+  EXPECT_FALSE(sc_hash_map_destroy(nullptr, nullptr));
+}
+
+TEST(ScHashMapTest, sc_hash_map_reserve)
+{
+  sc_hash_map * map;
+  EXPECT_TRUE(sc_hash_map_initialize(&map, 0));
+  sc_uint64 const memory_size = sc_hash_map_get_memory_size(map);
+
+  sc_hash_map_reserve(map, 1000);
+  EXPECT_GT(sc_hash_map_get_memory_size(map), memory_size);
+
+  sc_uint64 const reserved_memory_size = sc_hash_map_get_memory_size(map);
+  for (sc_uint64 i = 1; i <= 1000; ++i)
+    sc_hash_map_insert(map, i, (void *)i);
+  EXPECT_EQ(sc_hash_map_get_memory_size(map), reserved_memory_size);
+
+  for (sc_uint64 i = 1; i <= 1000; ++i)
+    EXPECT_EQ(sc_hash_map_get(map, i), (void *)i);
+
+  EXPECT_TRUE(sc_hash_map_destroy(map, nullptr));
+}
@@ -6,6 +6,13 @@
 
 #include "sc_dictionary_fs_memory_test.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <map>
+#include <thread>
+#include <vector>
+
 extern "C"
 {
 #include <sc-core/sc-base/sc_allocator.h>
@@ -16,6 +23,10 @@ extern "C"
 #include <sc-store/sc-fs-memory/sc_dictionary_fs_memory_private.h>
 #include <sc-store/sc-fs-memory/sc_file_system.h>
 #include <sc-store/sc-fs-memory/sc_io.h>
+#include <sc-store/sc-fs-memory/sc_link_contents_cache.h>
+#include <sc-store/sc-fs-memory/sc_ngrams_index.h>
+#include <sc-store/sc-fs-memory/sc_strings_blocks.h>
+#include <sc-store/sc-fs-memory/sc_terms_index.h>
 #include <sc-store/sc-container/sc_pair.h>
 #include <sc-store/sc-container/sc_struct_node.h>
 }
@@ -175,8 +186,13 @@ TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_string_by_link_hash
 
 TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_string_by_link_hash_invalid_data)
 {
+  // strings are changed out of fs-memory, so they must be read from file instead of cache
+  sc_memory_params * params = _sc_dictionary_fs_memory_get_default_params(SC_DICTIONARY_FS_MEMORY_PATH, SC_FALSE);
+  params->max_link_contents_cache_size = 0;
+
   sc_dictionary_fs_memory * memory;
-  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize_ext(&memory, params), SC_FS_MEMORY_OK);
+  sc_mem_free(params);
 
   sc_char string1[] = TEXT_EXAMPLE_1;
   sc_addr_hash hash1 = 112;
@@ -381,6 +397,100 @@ TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_string_by_link_hash
   EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
 }
 
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_string_by_link_hash_load_deprecated_dictionary)
+{
+  std::string const linkHashesPath = std::string(SC_DICTIONARY_FS_MEMORY_PATH) + "/link_hashes_string_offsets.scdb";
+  std::string const stringOffsetsPath = std::string(SC_DICTIONARY_FS_MEMORY_PATH) + "/string_offsets_link_hashes.scdb";
+
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+
+  // link hashes differ only by segments
+  sc_char string1[] = TEXT_EXAMPLE_1;
+  sc_addr_hash hash1 = (1 << 16) | 5;
+  sc_addr_hash hash2 = (2 << 16) | 5;
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, hash1, string1, sc_str_len(string1)), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, hash2, string1, sc_str_len(string1)), SC_FS_MEMORY_OK);
+
+  sc_char string2[] = TEXT_EXAMPLE_2;
+  sc_addr_hash hash3 = (3 << 16) | 5;
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, hash3, string2, sc_str_len(string2)), SC_FS_MEMORY_OK);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  // rewrite saved links in format of deprecated dictionary with link hashes grouped by string offsets
+  std::map<sc_uint64, std::vector<sc_addr_hash>> stringOffsetsLinkHashes;
+  {
+    std::ifstream stream(linkHashesPath, std::ios::binary);
+    sc_uint64 linksCount = 0;
+    stream.read((sc_char *)&linksCount, sizeof(linksCount));
+    EXPECT_EQ(linksCount, 3u);
+    for (sc_uint64 i = 0; i < linksCount; ++i)
+    {
+      sc_addr_hash linkHash;
+      sc_uint64 stringOffset;
+      stream.read((sc_char *)&linkHash, sizeof(linkHash));
+      stream.read((sc_char *)&stringOffset, sizeof(stringOffset));
+      stringOffsetsLinkHashes[stringOffset].push_back(linkHash);
+    }
+    EXPECT_EQ(stringOffsetsLinkHashes.size(), 2u);
+  }
+  std::filesystem::remove(linkHashesPath);
+  {
+    std::ofstream stream(stringOffsetsPath, std::ios::binary);
+    for (auto const & [stringOffset, linkHashes] : stringOffsetsLinkHashes)
+    {
+      sc_uint64 const linkHashesCount = linkHashes.size();
+      stream.write((sc_char const *)&stringOffset, sizeof(stringOffset));
+      stream.write((sc_char const *)&linkHashesCount, sizeof(linkHashesCount));
+      stream.write((sc_char const *)linkHashes.data(), sizeof(sc_addr_hash) * linkHashesCount);
+    }
+  }
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+
+  {
+    sc_char * found_string;
+    sc_uint64 size;
+    EXPECT_EQ(sc_dictionary_fs_memory_get_string_by_link_hash(memory, hash1, &found_string, &size), SC_FS_MEMORY_OK);
+    EXPECT_TRUE(sc_str_cmp(found_string, string1));
+    sc_mem_free(found_string);
+
+    EXPECT_EQ(sc_dictionary_fs_memory_get_string_by_link_hash(memory, hash2, &found_string, &size), SC_FS_MEMORY_OK);
+    EXPECT_TRUE(sc_str_cmp(found_string, string1));
+    sc_mem_free(found_string);
+
+    EXPECT_EQ(sc_dictionary_fs_memory_get_string_by_link_hash(memory, hash3, &found_string, &size), SC_FS_MEMORY_OK);
+    EXPECT_TRUE(sc_str_cmp(found_string, string2));
+    sc_mem_free(found_string);
+  }
+
+  EXPECT_EQ(sc_dictionary_fs_memory_unlink_string(memory, hash1), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  EXPECT_TRUE(std::filesystem::exists(linkHashesPath));
+  EXPECT_FALSE(std::filesystem::exists(stringOffsetsPath));
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+
+  {
+    sc_char * found_string;
+    sc_uint64 size;
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_get_string_by_link_hash(memory, hash1, &found_string, &size), SC_FS_MEMORY_NO_STRING);
+
+    EXPECT_EQ(sc_dictionary_fs_memory_get_string_by_link_hash(memory, hash2, &found_string, &size), SC_FS_MEMORY_OK);
+    EXPECT_TRUE(sc_str_cmp(found_string, string1));
+    sc_mem_free(found_string);
+  }
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
 TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_string_by_link_hash_reset_save_load_empty)
 {
   sc_dictionary_fs_memory * memory;
@@ -987,6 +1097,184 @@ TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_link_hashes_by_subs
   EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
 }
 
+std::vector<sc_addr_hash> _test_get_link_hashes_by_substring(
+    sc_dictionary_fs_memory * memory,
+    sc_char const * substring)
+{
+  sc_list * found_link_hashes;
+  sc_list_init(&found_link_hashes);
+
+  sc_link_handler link_handler;
+  link_handler.check_link_callback = nullptr;
+  link_handler.check_link_callback_data = nullptr;
+  link_handler.request_link_callback = nullptr;
+  link_handler.request_link_callback_data = nullptr;
+  link_handler.push_link_callback = _test_push_link_hash;
+  link_handler.push_link_callback_data = found_link_hashes;
+  link_handler.push_link_content_callback = nullptr;
+  link_handler.push_link_content_callback_data = nullptr;
+
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_get_link_hashes_by_substring(memory, substring, sc_str_len(substring), &link_handler),
+      SC_FS_MEMORY_OK);
+
+  std::vector<sc_addr_hash> link_hashes;
+  sc_iterator * it = sc_list_iterator(found_link_hashes);
+  while (sc_iterator_next(it))
+    link_hashes.push_back((sc_pointer_to_sc_addr_hash)sc_iterator_get(it));
+  sc_iterator_destroy(it);
+  sc_list_destroy(found_link_hashes);
+
+  return link_hashes;
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_link_hashes_by_substring_inside_terms)
+{
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+
+  sc_addr_hash const hash1 = 112;
+  sc_addr_hash const hash2 = 518;
+  sc_addr_hash const hash3 = 1024;
+  {
+    sc_char string1[] = TEXT_EXAMPLE_1;
+    EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, hash1, string1, sc_str_len(string1)), SC_FS_MEMORY_OK);
+
+    sc_char string2[] = TEXT_EXAMPLE_2;
+    EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, hash2, string2, sc_str_len(string2)), SC_FS_MEMORY_OK);
+
+    sc_char string3[] = TEXT_ABOUT_CAT_EXAMPLE_2;
+    EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, hash3, string3, sc_str_len(string3)), SC_FS_MEMORY_OK);
+
+    EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "irst str"), std::vector<sc_addr_hash>({hash1}));
+    EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "econd"), std::vector<sc_addr_hash>({hash2}));
+    EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "tring"), std::vector<sc_addr_hash>({hash1, hash2}));
+    EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "ittens fr"), std::vector<sc_addr_hash>({hash3}));
+    EXPECT_TRUE(_test_get_link_hashes_by_substring(memory, "first string!").empty());
+    EXPECT_TRUE(_test_get_link_hashes_by_substring(memory, "strings").empty());
+
+    EXPECT_EQ(sc_dictionary_fs_memory_unlink_string(memory, hash2), SC_FS_MEMORY_OK);
+    EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "tring"), std::vector<sc_addr_hash>({hash1}));
+  }
+
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "irst str"), std::vector<sc_addr_hash>({hash1}));
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "ittens fr"), std::vector<sc_addr_hash>({hash3}));
+  EXPECT_TRUE(_test_get_link_hashes_by_substring(memory, "econd").empty());
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  // index is built by terms of strings if there is no its file
+  std::string const ngramsPath = std::string(SC_DICTIONARY_FS_MEMORY_PATH) + "/ngrams_string_offsets.scdb";
+  EXPECT_TRUE(sc_fs_is_file(ngramsPath.c_str()));
+  EXPECT_TRUE(sc_fs_remove_file(ngramsPath.c_str()));
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "irst str"), std::vector<sc_addr_hash>({hash1}));
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "ittens fr"), std::vector<sc_addr_hash>({hash3}));
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_ngrams_index_get_string_offsets)
+{
+  sc_ngrams_index * index;
+  EXPECT_TRUE(sc_ngrams_index_initialize(&index));
+
+  sc_char const string1[] = "abcdef";
+  sc_char const string2[] = "xabcx";
+  sc_char const string3[] = "bcdxyz";
+  // strings with big offsets are appended before strings with small offsets
+  sc_ngrams_index_append(index, string1, sc_str_len(string1), 1000);
+  sc_ngrams_index_append(index, string2, sc_str_len(string2), 300000);
+  sc_ngrams_index_append(index, string3, sc_str_len(string3), 7);
+  sc_ngrams_index_append(index, string1, sc_str_len(string1), 1000);
+
+  sc_uint64 * string_offsets;
+  sc_uint64 string_offsets_count;
+  EXPECT_TRUE(sc_ngrams_index_get_string_offsets(index, "abc", 3, &string_offsets, &string_offsets_count));
+  EXPECT_EQ(string_offsets_count, 2u);
+  EXPECT_EQ(string_offsets[0], 1000u);
+  EXPECT_EQ(string_offsets[1], 300000u);
+  sc_mem_free(string_offsets);
+
+  EXPECT_TRUE(sc_ngrams_index_get_string_offsets(index, "bcd", 3, &string_offsets, &string_offsets_count));
+  EXPECT_EQ(string_offsets_count, 2u);
+  EXPECT_EQ(string_offsets[0], 7u);
+  EXPECT_EQ(string_offsets[1], 1000u);
+  sc_mem_free(string_offsets);
+
+  EXPECT_TRUE(sc_ngrams_index_get_string_offsets(index, "abcd", 4, &string_offsets, &string_offsets_count));
+  EXPECT_EQ(string_offsets_count, 1u);
+  EXPECT_EQ(string_offsets[0], 1000u);
+  sc_mem_free(string_offsets);
+
+  EXPECT_TRUE(sc_ngrams_index_get_string_offsets(index, "zzz", 3, &string_offsets, &string_offsets_count));
+  EXPECT_EQ(string_offsets_count, 0u);
+  sc_mem_free(string_offsets);
+
+  EXPECT_FALSE(sc_ngrams_index_get_string_offsets(index, "ab", 2, &string_offsets, &string_offsets_count));
+
+  EXPECT_TRUE(sc_ngrams_index_destroy(index));
+  EXPECT_FALSE(sc_ngrams_index_destroy(nullptr));
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_ngrams_index_get_string_offsets_appended_not_in_order)
+{
+  sc_ngrams_index * index;
+  EXPECT_TRUE(sc_ngrams_index_initialize(&index));
+
+  sc_uint64 const strings_count = 1000;
+  sc_char const string1[] = "abcdef";
+  sc_char const string2[] = "xabcx";
+  // strings are appended in reverse order of their offsets and each fourth string is appended twice
+  for (sc_uint64 i = strings_count; i > 0; --i)
+  {
+    sc_char const * string = i % 2 == 0 ? string1 : string2;
+    sc_ngrams_index_append(index, string, sc_str_len(string), i * 10);
+    if (i % 4 == 0)
+      sc_ngrams_index_append(index, string, sc_str_len(string), i * 10);
+  }
+
+  auto const checkStringOffsets = [&](sc_ngrams_index const * index)
+  {
+    sc_uint64 * string_offsets;
+    sc_uint64 string_offsets_count;
+    EXPECT_TRUE(sc_ngrams_index_get_string_offsets(index, "abc", 3, &string_offsets, &string_offsets_count));
+    EXPECT_EQ(string_offsets_count, strings_count);
+    for (sc_uint64 i = 0; i < string_offsets_count; ++i)
+      EXPECT_EQ(string_offsets[i], (i + 1) * 10);
+    sc_mem_free(string_offsets);
+
+    EXPECT_TRUE(sc_ngrams_index_get_string_offsets(index, "bcde", 4, &string_offsets, &string_offsets_count));
+    EXPECT_EQ(string_offsets_count, strings_count / 2);
+    for (sc_uint64 i = 0; i < string_offsets_count; ++i)
+      EXPECT_EQ(string_offsets[i], (i + 1) * 20);
+    sc_mem_free(string_offsets);
+  };
+  checkStringOffsets(index);
+
+  std::filesystem::create_directories(SC_DICTIONARY_FS_MEMORY_PATH);
+  sc_char const index_path[] = "fs-memory/ngrams.scdb";
+  sc_io_channel * channel = sc_io_new_write_channel(index_path, nullptr);
+  sc_io_channel_set_encoding(channel, nullptr, nullptr);
+  EXPECT_TRUE(sc_ngrams_index_write(index, channel));
+  sc_io_channel_shutdown(channel, SC_TRUE, nullptr);
+  EXPECT_TRUE(sc_ngrams_index_destroy(index));
+
+  EXPECT_TRUE(sc_ngrams_index_initialize(&index));
+  channel = sc_io_new_read_channel(index_path, nullptr);
+  sc_io_channel_set_encoding(channel, nullptr, nullptr);
+  EXPECT_TRUE(sc_ngrams_index_read(index, channel));
+  sc_io_channel_shutdown(channel, SC_TRUE, nullptr);
+  checkStringOffsets(index);
+
+  EXPECT_TRUE(sc_ngrams_index_destroy(index));
+}
+
 TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_link_hashes_by_substring_when_false_config)
 {
   sc_dictionary_fs_memory * memory;
@@ -1503,6 +1791,7 @@ TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_mutiple_link_strings)
   params.max_strings_channels = DEFAULT_MAX_STRINGS_CHANNELS;
   params.max_strings_channel_size = DEFAULT_MAX_STRINGS_CHANNEL_SIZE;
   params.max_searchable_string_size = DEFAULT_MAX_SEARCHABLE_STRING_SIZE;
+  params.max_link_contents_cache_size = DEFAULT_MAX_LINK_CONTENTS_CACHE_SIZE;
   params.term_separators = DEFAULT_TERM_SEPARATORS;
 
   sc_dictionary_fs_memory * memory;
@@ -1543,6 +1832,7 @@ TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_mutiple_link_strings_wi
   params.max_strings_channels = DEFAULT_MAX_STRINGS_CHANNELS;
   params.max_strings_channel_size = DEFAULT_MAX_STRINGS_CHANNEL_SIZE;
   params.max_searchable_string_size = DEFAULT_MAX_SEARCHABLE_STRING_SIZE;
+  params.max_link_contents_cache_size = DEFAULT_MAX_LINK_CONTENTS_CACHE_SIZE;
   params.term_separators = "";
 
   sc_dictionary_fs_memory * memory;
@@ -1574,3 +1864,839 @@ TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_mutiple_link_strings_wi
 
   EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
 }
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_strings_in_parallel)
+{
+  sc_memory_params params;
+  params.storage = SC_DICTIONARY_FS_MEMORY_PATH;
+  params.clear = SC_TRUE;
+  params.max_strings_channels = DEFAULT_MAX_STRINGS_CHANNELS;
+  params.max_strings_channel_size = 1000;
+  params.max_searchable_string_size = DEFAULT_MAX_SEARCHABLE_STRING_SIZE;
+  params.max_link_contents_cache_size = DEFAULT_MAX_LINK_CONTENTS_CACHE_SIZE;
+  params.term_separators = DEFAULT_TERM_SEPARATORS;
+
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize_ext(&memory, &params), SC_FS_MEMORY_OK);
+
+  {
+    static sc_char const string_template[] = "This is string number %" PRIu64;
+    sc_uint64 const STRING_COUNT = 200;
+    sc_uint64 const THREADS_COUNT = 4;
+
+    for (sc_uint64 hash = 0; hash < STRING_COUNT; ++hash)
+    {
+      sc_char string[50];
+      snprintf(string, 50, string_template, hash);
+      EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, hash, string, sc_str_len(string)), SC_FS_MEMORY_OK);
+    }
+
+    // strings are read by several threads while other strings are written to the same strings channels
+    std::atomic_size_t errors_count = 0;
+    std::vector<std::thread> threads;
+    threads.emplace_back(
+        [&]()
+        {
+          for (sc_uint64 hash = STRING_COUNT; hash < 2 * STRING_COUNT; ++hash)
+          {
+            sc_char string[50];
+            snprintf(string, 50, string_template, hash);
+            if (sc_dictionary_fs_memory_link_string(memory, hash, string, sc_str_len(string)) != SC_FS_MEMORY_OK)
+              ++errors_count;
+          }
+        });
+    for (sc_uint64 i = 0; i < THREADS_COUNT; ++i)
+    {
+      threads.emplace_back(
+          [&]()
+          {
+            for (sc_uint64 hash = 0; hash < STRING_COUNT; ++hash)
+            {
+              sc_char string[50];
+              snprintf(string, 50, string_template, hash);
+
+              sc_char * found_string = nullptr;
+              sc_uint64 size;
+              if (sc_dictionary_fs_memory_get_string_by_link_hash(memory, hash, &found_string, &size)
+                      != SC_FS_MEMORY_OK
+                  || sc_str_cmp(found_string, string) == SC_FALSE)
+                ++errors_count;
+              sc_mem_free(found_string);
+            }
+          });
+    }
+
+    for (auto & thread : threads)
+      thread.join();
+    EXPECT_EQ(errors_count, 0u);
+
+    for (sc_uint64 hash = 0; hash < 2 * STRING_COUNT; ++hash)
+    {
+      sc_char string[50];
+      snprintf(string, 50, string_template, hash);
+
+      sc_char * found_string;
+      sc_uint64 size;
+      EXPECT_EQ(sc_dictionary_fs_memory_get_string_by_link_hash(memory, hash, &found_string, &size), SC_FS_MEMORY_OK);
+      EXPECT_TRUE(sc_str_cmp(found_string, string));
+      sc_mem_free(found_string);
+    }
+  }
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_link_strings_in_parallel)
+{
+  sc_memory_params params;
+  params.storage = SC_DICTIONARY_FS_MEMORY_PATH;
+  params.clear = SC_TRUE;
+  params.max_strings_channels = DEFAULT_MAX_STRINGS_CHANNELS;
+  params.max_strings_channel_size = 1000;
+  params.max_searchable_string_size = DEFAULT_MAX_SEARCHABLE_STRING_SIZE;
+  params.max_link_contents_cache_size = DEFAULT_MAX_LINK_CONTENTS_CACHE_SIZE;
+  params.term_separators = DEFAULT_TERM_SEPARATORS;
+  params.search_by_substring = SC_TRUE;
+
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize_ext(&memory, &params), SC_FS_MEMORY_OK);
+
+  {
+    static sc_char const unique_string_template[] = "This is string number %" PRIu64;
+    static sc_char const common_string_template[] = "This is common string number %" PRIu64;
+    sc_uint64 const STRING_COUNT = 100;
+    sc_uint64 const THREADS_COUNT = 4;
+
+    // each thread links unique strings and strings equal to strings linked by other threads
+    std::atomic_size_t errors_count = 0;
+    std::vector<std::thread> threads;
+    for (sc_uint64 i = 0; i < THREADS_COUNT; ++i)
+    {
+      threads.emplace_back(
+          [&, i]()
+          {
+            for (sc_uint64 j = 0; j < STRING_COUNT; ++j)
+            {
+              sc_char string[50];
+              snprintf(string, 50, unique_string_template, i * STRING_COUNT + j);
+              sc_addr_hash const unique_hash = 1 + 2 * (i * STRING_COUNT + j);
+              if (sc_dictionary_fs_memory_link_string(memory, unique_hash, string, sc_str_len(string))
+                  != SC_FS_MEMORY_OK)
+                ++errors_count;
+
+              snprintf(string, 50, common_string_template, j);
+              if (sc_dictionary_fs_memory_link_string(memory, unique_hash + 1, string, sc_str_len(string))
+                  != SC_FS_MEMORY_OK)
+                ++errors_count;
+            }
+          });
+    }
+
+    for (auto & thread : threads)
+      thread.join();
+    EXPECT_EQ(errors_count, 0u);
+
+    for (sc_uint64 i = 0; i < THREADS_COUNT * STRING_COUNT; ++i)
+    {
+      sc_char string[50];
+      snprintf(string, 50, unique_string_template, i);
+
+      sc_char * found_string;
+      sc_uint64 size;
+      EXPECT_EQ(
+          sc_dictionary_fs_memory_get_string_by_link_hash(memory, 1 + 2 * i, &found_string, &size), SC_FS_MEMORY_OK);
+      EXPECT_TRUE(sc_str_cmp(found_string, string));
+      sc_mem_free(found_string);
+
+      snprintf(string, 50, common_string_template, i % STRING_COUNT);
+      EXPECT_EQ(
+          sc_dictionary_fs_memory_get_string_by_link_hash(memory, 2 + 2 * i, &found_string, &size), SC_FS_MEMORY_OK);
+      EXPECT_TRUE(sc_str_cmp(found_string, string));
+      sc_mem_free(found_string);
+    }
+
+    // equal strings linked in parallel are not duplicated
+    sc_uint64 strings_size = 0;
+    for (sc_uint64 i = 0; i < THREADS_COUNT * STRING_COUNT; ++i)
+    {
+      sc_char string[50];
+      strings_size += sizeof(sc_uint64) + snprintf(string, 50, unique_string_template, i);
+    }
+
+    for (sc_uint64 j = 0; j < STRING_COUNT; ++j)
+    {
+      sc_char string[50];
+      strings_size += sizeof(sc_uint64) + snprintf(string, 50, common_string_template, j);
+    }
+    EXPECT_EQ(memory->last_string_offset, strings_size);
+
+    for (sc_uint64 j = 0; j < STRING_COUNT; ++j)
+    {
+      sc_char string[50];
+      snprintf(string, 50, common_string_template, j);
+
+      sc_list * found_link_hashes;
+      sc_list_init(&found_link_hashes);
+      sc_link_handler link_handler;
+      link_handler.check_link_callback = nullptr;
+      link_handler.check_link_callback_data = nullptr;
+      link_handler.request_link_callback = nullptr;
+      link_handler.request_link_callback_data = nullptr;
+      link_handler.push_link_callback = _test_push_link_hash;
+      link_handler.push_link_callback_data = found_link_hashes;
+      link_handler.push_link_content_callback = nullptr;
+      link_handler.push_link_content_callback_data = nullptr;
+      EXPECT_EQ(
+          sc_dictionary_fs_memory_get_link_hashes_by_string(memory, string, sc_str_len(string), &link_handler),
+          SC_FS_MEMORY_OK);
+      EXPECT_EQ(found_link_hashes->size, THREADS_COUNT);
+      sc_list_destroy(found_link_hashes);
+    }
+  }
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
+std::string _test_get_string_by_link_hash(sc_dictionary_fs_memory * memory, sc_addr_hash link_hash)
+{
+  sc_char * string;
+  sc_uint64 size;
+  if (sc_dictionary_fs_memory_get_string_by_link_hash(memory, link_hash, &string, &size) != SC_FS_MEMORY_OK)
+    return "";
+
+  std::string const result(string, size);
+  sc_mem_free(string);
+  return result;
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_pack_strings_on_load)
+{
+  std::string const blocksPath = std::string(SC_DICTIONARY_FS_MEMORY_PATH) + "/strings_blocks.scdb";
+  std::string const bigString(SC_STRINGS_BLOCK_SIZE * 2, 'a');
+  std::string const string1 = TEXT_EXAMPLE_1;
+  std::string const string2 = TEXT_EXAMPLE_2;
+  std::string const string3 = TEXT_ABOUT_CAT_EXAMPLE_1;
+  std::string const string4 = TEXT_ABOUT_CAT_EXAMPLE_2;
+
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, 1, string1.c_str(), string1.size()), SC_FS_MEMORY_OK);
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, 2, string2.c_str(), string2.size()), SC_FS_MEMORY_OK);
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, 3, string3.c_str(), string3.size()), SC_FS_MEMORY_OK);
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, 4, bigString.c_str(), bigString.size()), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_unlink_string(memory, 2), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  // linked strings are packed into strings blocks and strings channels are removed
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_FALSE(sc_fs_is_file(SC_DICTIONARY_FS_MEMORY_STRINGS_PATH));
+  EXPECT_TRUE(sc_fs_is_file(blocksPath.c_str()));
+  EXPECT_EQ(memory->strings_offset, 3 * sizeof(sc_uint64) + string1.size() + string3.size() + bigString.size());
+  EXPECT_EQ(memory->last_string_offset, memory->strings_offset);
+  EXPECT_EQ(memory->strings_blocks->blocks_count, 2u);
+
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 1), string1);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 2), "");
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 3), string3);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 4), bigString);
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "irst str"), std::vector<sc_addr_hash>({1}));
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "cat breeds"), std::vector<sc_addr_hash>({3}));
+  EXPECT_TRUE(_test_get_link_hashes_by_substring(memory, "econd").empty());
+
+  // equal strings are found in strings blocks
+  sc_uint64 const last_string_offset = memory->last_string_offset;
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, 5, string3.c_str(), string3.size()), SC_FS_MEMORY_OK);
+  EXPECT_EQ(memory->last_string_offset, last_string_offset);
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, 6, string4.c_str(), string4.size()), SC_FS_MEMORY_OK);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 6), string4);
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "cat breeds"), std::vector<sc_addr_hash>({3, 5}));
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  // new strings are appended to strings blocks
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(memory->strings_blocks->blocks_count, 3u);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 4), bigString);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 6), string4);
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "ittens fr"), std::vector<sc_addr_hash>({6}));
+
+  EXPECT_EQ(sc_dictionary_fs_memory_unlink_string(memory, 4), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_unlink_string(memory, 6), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  // strings blocks with many not linked strings are packed again
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(memory->strings_offset, 2 * sizeof(sc_uint64) + string1.size() + string3.size());
+  EXPECT_EQ(memory->strings_blocks->blocks_count, 1u);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 1), string1);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 3), string3);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 5), string3);
+  // link hashes of packed strings are grouped again, so their order isn't kept
+  std::vector<sc_addr_hash> linkHashes = _test_get_link_hashes_by_substring(memory, "cat breeds");
+  std::sort(linkHashes.begin(), linkHashes.end());
+  EXPECT_EQ(linkHashes, std::vector<sc_addr_hash>({3, 5}));
+  EXPECT_TRUE(_test_get_link_hashes_by_substring(memory, "ittens fr").empty());
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  // packed files replace previous files of dictionaries and strings blocks
+  for (auto const & entry : std::filesystem::directory_iterator(SC_DICTIONARY_FS_MEMORY_PATH))
+    EXPECT_NE(entry.path().filename().string().rfind("packed_", 0), 0u) << entry.path();
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(memory->strings_blocks->blocks_count, 1u);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 1), string1);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 5), string3);
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "irst str"), std::vector<sc_addr_hash>({1}));
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_link_equal_not_searchable_strings)
+{
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+
+  std::string const string = TEXT_EXAMPLE_1;
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string_ext(memory, 1, string.c_str(), string.size(), SC_FALSE), SC_FS_MEMORY_OK);
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string_ext(memory, 2, string.c_str(), string.size(), SC_FALSE), SC_FS_MEMORY_OK);
+  EXPECT_EQ(memory->last_string_offset, sizeof(sc_uint64) + string.size());
+
+  // not searchable strings aren't shared with searchable ones
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string_ext(memory, 3, string.c_str(), string.size(), SC_TRUE), SC_FS_MEMORY_OK);
+  EXPECT_EQ(memory->last_string_offset, 2 * (sizeof(sc_uint64) + string.size()));
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "irst str"), std::vector<sc_addr_hash>({3}));
+
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 1), string);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 2), string);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_strings_blocks_append_read)
+{
+  std::filesystem::create_directory(SC_DICTIONARY_FS_MEMORY_PATH);
+  std::string const blocksPath = std::string(SC_DICTIONARY_FS_MEMORY_PATH) + "/strings_blocks.scdb";
+  std::string const indexPath = std::string(SC_DICTIONARY_FS_MEMORY_PATH) + "/strings_blocks_index.scdb";
+
+  std::vector<std::string> strings;
+  for (sc_uint64 i = 0; i < 1000; ++i)
+    strings.push_back("string number " + std::to_string(i) + std::string(i % 7, 'x'));
+  strings.push_back("");
+  strings.push_back(std::string(SC_STRINGS_BLOCK_SIZE + 1, 'y'));
+
+  sc_strings_blocks * blocks;
+  EXPECT_TRUE(sc_strings_blocks_initialize(&blocks, blocksPath.c_str()));
+
+  std::vector<sc_uint64> offsets;
+  for (auto const & string : strings)
+  {
+    sc_uint64 offset;
+    EXPECT_TRUE(sc_strings_blocks_append(blocks, string.c_str(), string.size(), &offset));
+    offsets.push_back(offset);
+  }
+  EXPECT_TRUE(sc_strings_blocks_flush(blocks));
+  EXPECT_GT(blocks->blocks_count, 1u);
+
+  sc_io_channel * channel = sc_io_new_write_channel(indexPath.c_str(), nullptr);
+  sc_io_channel_set_encoding(channel, nullptr, nullptr);
+  EXPECT_TRUE(sc_strings_blocks_write_index(blocks, channel));
+  sc_io_channel_shutdown(channel, SC_TRUE, nullptr);
+  sc_uint64 const blocks_count = blocks->blocks_count;
+  EXPECT_TRUE(sc_strings_blocks_destroy(blocks));
+
+  EXPECT_TRUE(sc_strings_blocks_initialize(&blocks, blocksPath.c_str()));
+  channel = sc_io_new_read_channel(indexPath.c_str(), nullptr);
+  sc_io_channel_set_encoding(channel, nullptr, nullptr);
+  EXPECT_TRUE(sc_strings_blocks_read_index(blocks, channel));
+  sc_io_channel_shutdown(channel, SC_TRUE, nullptr);
+  EXPECT_EQ(blocks->blocks_count, blocks_count);
+
+  for (sc_uint64 i = 0; i < strings.size(); ++i)
+  {
+    sc_char * string;
+    sc_uint64 size;
+    EXPECT_TRUE(sc_strings_blocks_read(blocks, offsets[i], &string, &size));
+    EXPECT_EQ(std::string(string, size), strings[i]);
+    sc_mem_free(string);
+  }
+
+  sc_char * string;
+  sc_uint64 size;
+  EXPECT_FALSE(sc_strings_blocks_read(blocks, blocks->strings_size, &string, &size));
+  EXPECT_EQ(string, nullptr);
+
+  EXPECT_TRUE(sc_strings_blocks_destroy(blocks));
+  EXPECT_FALSE(sc_strings_blocks_destroy(nullptr));
+}
+
+std::string _test_read_string_by_link_hash(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash link_hash,
+    sc_uint64 offset,
+    sc_uint64 size)
+{
+  std::string part(size, '\0');
+  sc_uint64 read_bytes;
+  if (sc_dictionary_fs_memory_read_string_by_link_hash(memory, link_hash, offset, part.data(), size, &read_bytes)
+      != SC_FS_MEMORY_OK)
+    return "";
+
+  part.resize(read_bytes);
+  return part;
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_append_read_string_parts)
+{
+  std::string const blobPath = std::string(SC_DICTIONARY_FS_MEMORY_PATH) + "/blobs/1.scdb";
+  std::string const string = TEXT_EXAMPLE_1;
+  std::string const binaryPart("\0binary\0part\0", 13);
+  std::string const bigPart(SC_STRINGS_BLOCK_SIZE * 3, 'b');
+
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+
+  sc_uint64 size;
+  EXPECT_EQ(sc_dictionary_fs_memory_get_string_size_by_link_hash(memory, 1, &size), SC_FS_MEMORY_NO_STRING);
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, 1, string.c_str(), string.size()), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_get_string_size_by_link_hash(memory, 1, &size), SC_FS_MEMORY_OK);
+  EXPECT_EQ(size, string.size());
+  EXPECT_EQ(_test_read_string_by_link_hash(memory, 1, 6, 6), string.substr(6, 6));
+  EXPECT_EQ(_test_read_string_by_link_hash(memory, 1, string.size() - 3, 10), string.substr(string.size() - 3));
+  EXPECT_EQ(_test_read_string_by_link_hash(memory, 1, string.size(), 10), "");
+
+  // linked string is moved to blob on the first appending and isn't found by content anymore
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_append_string(memory, 1, binaryPart.c_str(), binaryPart.size()), SC_FS_MEMORY_OK);
+  EXPECT_TRUE(sc_fs_is_file(blobPath.c_str()));
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_append_string(memory, 1, bigPart.c_str(), bigPart.size()), SC_FS_MEMORY_OK);
+  std::string const content = string + binaryPart + bigPart;
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 1), content);
+  EXPECT_EQ(sc_dictionary_fs_memory_get_string_size_by_link_hash(memory, 1, &size), SC_FS_MEMORY_OK);
+  EXPECT_EQ(size, content.size());
+  EXPECT_EQ(_test_read_string_by_link_hash(memory, 1, string.size(), binaryPart.size()), binaryPart);
+  EXPECT_EQ(_test_read_string_by_link_hash(memory, 1, content.size() - 5, 100), std::string(5, 'b'));
+  EXPECT_TRUE(_test_get_link_hashes_by_substring(memory, "irst str").empty());
+
+  // content of link without string is appended to empty blob
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_append_string(memory, 2, binaryPart.c_str(), binaryPart.size()), SC_FS_MEMORY_OK);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 2), binaryPart);
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  // blobs are kept after load, strings in strings blocks are read by parts
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 1), content);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 2), binaryPart);
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, 3, bigPart.c_str(), bigPart.size()), SC_FS_MEMORY_OK);
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, 4, string.c_str(), string.size()), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(memory->last_string_offset, memory->strings_offset);
+  EXPECT_EQ(_test_read_string_by_link_hash(memory, 3, SC_STRINGS_BLOCK_SIZE, 4), "bbbb");
+  EXPECT_EQ(_test_read_string_by_link_hash(memory, 4, 6, 6), string.substr(6, 6));
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_append_string(memory, 4, binaryPart.c_str(), binaryPart.size()), SC_FS_MEMORY_OK);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 4), string + binaryPart);
+
+  // new string replaces blob
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, 1, string.c_str(), string.size()), SC_FS_MEMORY_OK);
+  EXPECT_FALSE(sc_fs_is_file(blobPath.c_str()));
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 1), string);
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "irst str"), std::vector<sc_addr_hash>({1}));
+
+  EXPECT_EQ(sc_dictionary_fs_memory_unlink_string(memory, 2), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_get_string_size_by_link_hash(memory, 2, &size), SC_FS_MEMORY_NO_STRING);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 2), "");
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_append_string(nullptr, 1, "", 0), SC_FS_MEMORY_NO);
+  EXPECT_EQ(sc_dictionary_fs_memory_get_string_size_by_link_hash(nullptr, 1, &size), SC_FS_MEMORY_NO);
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_append_text_strings)
+{
+  std::string const blobPath = std::string(SC_DICTIONARY_FS_MEMORY_PATH) + "/blobs/1.scdb";
+  std::string const string = TEXT_EXAMPLE_1;
+  std::string const textPart = " with appended part";
+  std::string const binaryPart("\0binary\0part\0", 13);
+
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+
+  // small texts with appended parts stay strings and are found by their new contents
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, 1, string.c_str(), string.size()), SC_FS_MEMORY_OK);
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_append_string(memory, 1, textPart.c_str(), textPart.size()), SC_FS_MEMORY_OK);
+  EXPECT_FALSE(sc_fs_is_file(blobPath.c_str()));
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 1), string + textPart);
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "string with app"), std::vector<sc_addr_hash>({1}));
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "irst str"), std::vector<sc_addr_hash>({1}));
+
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_append_string(memory, 2, textPart.c_str(), textPart.size()), SC_FS_MEMORY_OK);
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "appended part"), std::vector<sc_addr_hash>({1, 2}));
+
+  // binary parts move contents to blobs
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_append_string(memory, 1, binaryPart.c_str(), binaryPart.size()), SC_FS_MEMORY_OK);
+  EXPECT_TRUE(sc_fs_is_file(blobPath.c_str()));
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 1), string + textPart + binaryPart);
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "string with app"), std::vector<sc_addr_hash>());
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_append_string(memory, 1, textPart.c_str(), textPart.size()), SC_FS_MEMORY_OK);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 1), string + textPart + binaryPart + textPart);
+
+  // texts bigger than max searchable string size move contents to blobs
+  std::string const bigPart(memory->max_searchable_string_size, 't');
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_append_string(memory, 2, bigPart.c_str(), bigPart.size()), SC_FS_MEMORY_OK);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 2), textPart + bigPart);
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "appended part"), std::vector<sc_addr_hash>());
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_strings_blocks_read_parts)
+{
+  std::filesystem::create_directory(SC_DICTIONARY_FS_MEMORY_PATH);
+  std::string const blocksPath = std::string(SC_DICTIONARY_FS_MEMORY_PATH) + "/strings_blocks.scdb";
+  std::string const smallString = "small string";
+  std::string bigString;
+  for (sc_uint64 i = 0; bigString.size() <= SC_STRINGS_BLOCK_SIZE; ++i)
+    bigString += std::to_string(i);
+
+  sc_strings_blocks * blocks;
+  EXPECT_TRUE(sc_strings_blocks_initialize(&blocks, blocksPath.c_str()));
+  sc_uint64 smallOffset, bigOffset;
+  EXPECT_TRUE(sc_strings_blocks_append(blocks, smallString.c_str(), smallString.size(), &smallOffset));
+  EXPECT_TRUE(sc_strings_blocks_append(blocks, bigString.c_str(), bigString.size(), &bigOffset));
+  EXPECT_TRUE(sc_strings_blocks_flush(blocks));
+
+  // strings bigger than block aren't compressed to read their parts without other parts
+  sc_strings_block const * block = sc_strings_blocks_get_block(blocks, bigOffset);
+  EXPECT_EQ(block->codec, SC_STRINGS_BLOCK_CODEC_NONE);
+
+  sc_char part[16];
+  sc_uint64 readBytes, size;
+  EXPECT_TRUE(sc_strings_blocks_read_part(blocks, smallOffset, 6, part, sizeof(part), &readBytes, &size));
+  EXPECT_EQ(size, smallString.size());
+  EXPECT_EQ(std::string(part, readBytes), "string");
+  EXPECT_TRUE(sc_strings_blocks_read_part(blocks, bigOffset, 1000, part, sizeof(part), &readBytes, &size));
+  EXPECT_EQ(size, bigString.size());
+  EXPECT_EQ(std::string(part, readBytes), bigString.substr(1000, sizeof(part)));
+  EXPECT_TRUE(sc_strings_blocks_read_part(blocks, bigOffset, size, part, sizeof(part), &readBytes, &size));
+  EXPECT_EQ(readBytes, 0u);
+  EXPECT_FALSE(sc_strings_blocks_read_part(blocks, blocks->strings_size, 0, part, sizeof(part), &readBytes, &size));
+
+  EXPECT_TRUE(sc_strings_blocks_destroy(blocks));
+}
+
+sc_bool _test_push_term(
+    sc_char const * term,
+    sc_uint32 term_size,
+    sc_uint64 const * string_offsets,
+    sc_uint64 string_offsets_count,
+    void ** arguments)
+{
+  auto * terms = (std::map<std::string, std::vector<sc_uint64>> *)arguments[0];
+  (*terms)[std::string(term, term_size)] =
+      std::vector<sc_uint64>(string_offsets, string_offsets + string_offsets_count);
+  return SC_TRUE;
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_terms_index_write_open_find)
+{
+  std::filesystem::create_directory(SC_DICTIONARY_FS_MEMORY_PATH);
+  std::string const indexPath = std::string(SC_DICTIONARY_FS_MEMORY_PATH) + "/terms_index.scdb";
+  std::map<std::string, std::vector<sc_uint64>> const terms = {
+      {"cat", {1, 5}}, {"catalog", {2}}, {"cats", {3, 4, 7}}, {"dog", {6}}};
+
+  sc_terms_index_writer * writer;
+  EXPECT_TRUE(sc_terms_index_writer_initialize(&writer, indexPath.c_str()));
+  for (auto const & [term, stringOffsets] : terms)
+    EXPECT_TRUE(sc_terms_index_writer_append(
+        writer, term.c_str(), term.size(), stringOffsets.data(), stringOffsets.size()));
+  EXPECT_TRUE(sc_terms_index_writer_destroy(writer, 8, SC_TRUE));
+
+  sc_terms_index * index;
+  EXPECT_TRUE(sc_terms_index_initialize(&index));
+  EXPECT_TRUE(sc_terms_index_open(index, indexPath.c_str()));
+  EXPECT_EQ(index->terms_count, terms.size());
+  EXPECT_EQ(index->last_string_offset, 8u);
+
+  // string offsets are read from mapped file without copying
+  sc_uint64 const * stringOffsets;
+  sc_uint64 stringOffsetsCount;
+  EXPECT_TRUE(sc_terms_index_get_string_offsets(index, "cats", 4, &stringOffsets, &stringOffsetsCount));
+  EXPECT_EQ(std::vector<sc_uint64>(stringOffsets, stringOffsets + stringOffsetsCount), terms.at("cats"));
+  EXPECT_GE((sc_char const *)stringOffsets, index->data);
+  EXPECT_LT((sc_char const *)stringOffsets, index->data + index->size);
+  EXPECT_FALSE(sc_terms_index_get_string_offsets(index, "ca", 2, &stringOffsets, &stringOffsetsCount));
+  EXPECT_FALSE(sc_terms_index_get_string_offsets(index, "zebra", 5, &stringOffsets, &stringOffsetsCount));
+  EXPECT_EQ(stringOffsetsCount, 0u);
+
+  std::map<std::string, std::vector<sc_uint64>> foundTerms;
+  void * arguments[1];
+  arguments[0] = &foundTerms;
+  EXPECT_TRUE(sc_terms_index_visit_by_prefix(index, "cat", 3, _test_push_term, arguments));
+  EXPECT_EQ(foundTerms.size(), 3u);
+  EXPECT_EQ(foundTerms.count("dog"), 0u);
+
+  foundTerms.clear();
+  EXPECT_TRUE(sc_terms_index_visit_by_prefix(index, "", 0, _test_push_term, arguments));
+  EXPECT_EQ(foundTerms, terms);
+  EXPECT_TRUE(sc_terms_index_destroy(index));
+
+  // broken files aren't mapped
+  std::filesystem::resize_file(indexPath, std::filesystem::file_size(indexPath) - 1);
+  EXPECT_TRUE(sc_terms_index_initialize(&index));
+  EXPECT_FALSE(sc_terms_index_open(index, indexPath.c_str()));
+  EXPECT_FALSE(sc_terms_index_get_string_offsets(index, "cat", 3, &stringOffsets, &stringOffsetsCount));
+  EXPECT_TRUE(sc_terms_index_destroy(index));
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_find_strings_by_terms_index_and_added_terms)
+{
+  std::string const indexPath = std::string(SC_DICTIONARY_FS_MEMORY_PATH) + "/terms_index.scdb";
+  std::string const string1 = TEXT_EXAMPLE_1;
+  std::string const string2 = TEXT_EXAMPLE_2;
+  std::string const string3 = "the third string";
+
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, 1, string1.c_str(), string1.size()), SC_FS_MEMORY_OK);
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, 2, string2.c_str(), string2.size()), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+  EXPECT_TRUE(sc_fs_is_file(indexPath.c_str()));
+
+  // terms are found in mapped index, new terms are added to dictionary
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_NE(memory->terms_index->file, nullptr);
+  EXPECT_EQ(memory->terms_index->terms_count, 6u);
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, 3, string3.c_str(), string3.size()), SC_FS_MEMORY_OK);
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "it"), std::vector<sc_addr_hash>({1, 2}));
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "st"), std::vector<sc_addr_hash>({1, 2, 3}));
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "third"), std::vector<sc_addr_hash>({3}));
+
+  sc_list * terms;
+  sc_list_init(&terms);
+  sc_list_push_back(terms, (void *)"the");
+  sc_list_push_back(terms, (void *)"string");
+  sc_list * linkHashes;
+  sc_dictionary_fs_memory_intersect_link_hashes_by_terms(memory, terms, &linkHashes);
+  EXPECT_EQ(linkHashes->size, 3u);
+  sc_list_destroy(linkHashes);
+  sc_list_destroy(terms);
+
+  // added terms are merged into index on save
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(memory->terms_index->terms_count, 7u);
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "st"), std::vector<sc_addr_hash>({1, 2, 3}));
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(memory->terms_index->terms_count, 7u);
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "third"), std::vector<sc_addr_hash>({3}));
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 3), string3);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_link_strings_at_once)
+{
+  sc_memory_params params;
+  params.storage = SC_DICTIONARY_FS_MEMORY_PATH;
+  params.clear = SC_TRUE;
+  params.max_strings_channels = DEFAULT_MAX_STRINGS_CHANNELS;
+  params.max_strings_channel_size = 1000;
+  params.max_searchable_string_size = DEFAULT_MAX_SEARCHABLE_STRING_SIZE;
+  params.max_link_contents_cache_size = DEFAULT_MAX_LINK_CONTENTS_CACHE_SIZE;
+  params.term_separators = DEFAULT_TERM_SEPARATORS;
+  params.search_by_substring = SC_TRUE;
+
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize_ext(&memory, &params), SC_FS_MEMORY_OK);
+
+  std::string const existing_string = "bulk string 0";
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, 1, existing_string.c_str(), existing_string.size()),
+      SC_FS_MEMORY_OK);
+  sc_uint64 const existing_strings_size = memory->last_string_offset;
+
+  // strings are divided into terms by several workers and written into several strings channels
+  sc_uint64 const STRING_COUNT = 2000;
+  std::vector<std::string> strings;
+  std::vector<sc_addr_hash> link_hashes;
+  for (sc_uint64 i = 0; i < STRING_COUNT; ++i)
+  {
+    strings.push_back("bulk string " + std::to_string(i % (STRING_COUNT / 2)));
+    link_hashes.push_back(i + 2);
+  }
+  strings.push_back(std::string(2000, 'b'));
+  link_hashes.push_back(STRING_COUNT + 2);
+
+  std::vector<sc_char const *> strings_chars;
+  std::vector<sc_uint64> strings_sizes;
+  for (std::string const & string : strings)
+  {
+    strings_chars.push_back(string.c_str());
+    strings_sizes.push_back(string.size());
+  }
+
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_strings(
+          memory, link_hashes.data(), strings_chars.data(), strings_sizes.data(), strings.size(), SC_TRUE),
+      SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_link_strings(memory, nullptr, nullptr, nullptr, 0, SC_TRUE), SC_FS_MEMORY_OK);
+
+  // equal strings are written once
+  sc_uint64 strings_size = existing_strings_size;
+  for (sc_uint64 i = 1; i < STRING_COUNT / 2; ++i)
+    strings_size += sizeof(sc_uint64) + strings[i].size();
+  strings_size += sizeof(sc_uint64) + strings.back().size();
+  EXPECT_EQ(memory->last_string_offset, strings_size);
+
+  for (sc_uint64 i = 0; i < strings.size(); ++i)
+    EXPECT_EQ(_test_get_string_by_link_hash(memory, link_hashes[i]), strings[i]);
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "999"), std::vector<sc_addr_hash>({1001, 2001}));
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "bbbb"), std::vector<sc_addr_hash>({STRING_COUNT + 2}));
+  EXPECT_EQ(_test_get_link_hashes_by_substring(memory, "bulk").size(), STRING_COUNT + 1);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
+std::string _test_get_cached_link_content(sc_link_contents_cache * cache, sc_addr_hash link_hash, sc_uint64 * version)
+{
+  sc_char * string;
+  sc_uint64 size;
+  if (!sc_link_contents_cache_get(cache, link_hash, &string, &size, version))
+    return "";
+
+  std::string const result(string, size);
+  sc_mem_free(string);
+  return result;
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_link_contents_cache_get_put_evict)
+{
+  std::string const string = "content 00";
+  sc_uint64 const entry_size = sizeof(sc_link_contents_cache_entry) + string.size() + 1;
+
+  // each shard fits two contents, links 0, 16, 32 and 48 are in the same shard
+  sc_link_contents_cache * cache;
+  EXPECT_TRUE(sc_link_contents_cache_initialize(&cache, SC_LINK_CONTENTS_CACHE_SHARDS_COUNT * entry_size * 2));
+
+  sc_uint64 version;
+  EXPECT_EQ(_test_get_cached_link_content(cache, 0, &version), "");
+  sc_link_contents_cache_put(cache, 0, "content 00", string.size(), version);
+  EXPECT_EQ(_test_get_cached_link_content(cache, 16, &version), "");
+  sc_link_contents_cache_put(cache, 16, "content 16", string.size(), version);
+
+  // the least recently used content is evicted
+  EXPECT_EQ(_test_get_cached_link_content(cache, 0, &version), "content 00");
+  EXPECT_EQ(_test_get_cached_link_content(cache, 32, &version), "");
+  sc_link_contents_cache_put(cache, 32, "content 32", string.size(), version);
+  EXPECT_EQ(_test_get_cached_link_content(cache, 16, &version), "");
+  EXPECT_EQ(_test_get_cached_link_content(cache, 32, &version), "content 32");
+  EXPECT_EQ(_test_get_cached_link_content(cache, 0, &version), "content 00");
+
+  // content read before removal of other content of shard isn't cached
+  EXPECT_EQ(_test_get_cached_link_content(cache, 48, &version), "");
+  sc_link_contents_cache_remove(cache, 0);
+  sc_link_contents_cache_put(cache, 48, "content 48", string.size(), version);
+  EXPECT_EQ(_test_get_cached_link_content(cache, 48, &version), "");
+  EXPECT_EQ(_test_get_cached_link_content(cache, 0, &version), "");
+
+  // contents bigger than shard aren't cached
+  std::string const big_string(entry_size * 2, 'a');
+  EXPECT_EQ(_test_get_cached_link_content(cache, 1, &version), "");
+  sc_link_contents_cache_put(cache, 1, big_string.c_str(), big_string.size(), version);
+  EXPECT_EQ(_test_get_cached_link_content(cache, 1, &version), "");
+
+  sc_link_contents_cache_stat stat;
+  sc_link_contents_cache_get_stat(cache, &stat);
+  EXPECT_EQ(stat.hits_count, 3u);
+  EXPECT_EQ(stat.misses_count, 9u);
+  EXPECT_EQ(stat.evictions_count, 1u);
+  EXPECT_EQ(stat.contents_count, 1u);
+  EXPECT_EQ(stat.size, entry_size);
+  EXPECT_EQ(stat.max_size, SC_LINK_CONTENTS_CACHE_SHARDS_COUNT * entry_size * 2);
+
+  EXPECT_TRUE(sc_link_contents_cache_destroy(cache));
+  EXPECT_FALSE(sc_link_contents_cache_destroy(nullptr));
+}
+
+TEST_F(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_invalidate_cached_link_contents)
+{
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+
+  std::string const string = "cached content";
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 1, string.c_str(), string.size()), SC_FS_MEMORY_OK);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 1), string);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 1), string);
+
+  sc_link_contents_cache_stat stat;
+  EXPECT_EQ(sc_dictionary_fs_memory_get_link_contents_cache_stat(memory, &stat), SC_FS_MEMORY_OK);
+  EXPECT_EQ(stat.hits_count, 1u);
+  EXPECT_EQ(stat.misses_count, 1u);
+  EXPECT_EQ(stat.contents_count, 1u);
+  EXPECT_EQ(stat.max_size, DEFAULT_MAX_LINK_CONTENTS_CACHE_SIZE);
+
+  std::string const other_string = "other cached content";
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, 1, other_string.c_str(), other_string.size()), SC_FS_MEMORY_OK);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 1), other_string);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 1), other_string);
+
+  std::string const appended_string = " with appended part";
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_append_string(memory, 1, appended_string.c_str(), appended_string.size()),
+      SC_FS_MEMORY_OK);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 1), other_string + appended_string);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 1, string.c_str(), string.size()), SC_FS_MEMORY_OK);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 1), string);
+  EXPECT_EQ(sc_dictionary_fs_memory_unlink_string(memory, 1), SC_FS_MEMORY_OK);
+  EXPECT_EQ(_test_get_string_by_link_hash(memory, 1), "");
+
+  EXPECT_EQ(sc_dictionary_fs_memory_get_link_contents_cache_stat(memory, &stat), SC_FS_MEMORY_OK);
+  EXPECT_EQ(stat.hits_count, 2u);
+  EXPECT_EQ(stat.contents_count, 0u);
+  EXPECT_EQ(stat.size, 0u);
+  EXPECT_EQ(sc_dictionary_fs_memory_get_link_contents_cache_stat(nullptr, &stat), SC_FS_MEMORY_NO);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
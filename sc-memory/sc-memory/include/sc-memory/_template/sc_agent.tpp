@@ -28,6 +28,9 @@ ScAgent<TScEvent, TScContext>::~ScAgent() noexcept
 template <class TScEvent, class TScContext>
 ScAddr ScAgent<TScEvent, TScContext>::GetAbstractAgent() const noexcept(false)
 {
+  if (m_specification != nullptr && m_specification->abstractAgentAddr.IsValid())
+    return m_specification->abstractAgentAddr;
+
   ScIterator5Ptr const it5 = m_context.CreateIterator5(
       ScType::ConstNode,
       ScType::ConstCommonArc,
@@ -90,6 +93,9 @@ ScAddr ScAgent<TScEvent, TScContext>::GetEventSubscriptionElement() const noexce
 template <class TScEvent, class TScContext>
 ScAddr ScAgent<TScEvent, TScContext>::GetActionClass() const noexcept(false)
 {
+  if (m_specification != nullptr && m_specification->actionClassAddr.IsValid())
+    return m_specification->actionClassAddr;
+
   ScIterator5Ptr const it5 = m_context.CreateIterator5(
       GetAbstractAgent(),
       ScType::ConstCommonArc,
@@ -115,6 +121,9 @@ bool ScAgent<TScEvent, TScContext>::CheckInitiationCondition(TScEvent const & ev
 template <class TScEvent, class TScContext>
 ScAddr ScAgent<TScEvent, TScContext>::GetInitiationCondition() const noexcept(false)
 {
+  if (m_specification != nullptr && m_specification->initiationConditionAddr.IsValid())
+    return m_specification->initiationConditionAddr;
+
   ScIterator5Ptr const it5 = m_context.CreateIterator5(
       GetAbstractAgent(),
       ScType::ConstCommonArc,
@@ -159,6 +168,9 @@ bool ScAgent<TScEvent, TScContext>::CheckResultCondition(TScEvent const &, ScAct
 template <class TScEvent, class TScContext>
 ScAddr ScAgent<TScEvent, TScContext>::GetResultCondition() const noexcept(false)
 {
+  if (m_specification != nullptr && m_specification->resultConditionAddr.IsValid())
+    return m_specification->resultConditionAddr;
+
   ScIterator5Ptr const it5 = m_context.CreateIterator5(
       GetAbstractAgent(),
       ScType::ConstCommonArc,
@@ -194,6 +206,13 @@ void ScAgent<TScEvent, TScContext>::SetImplementation(ScAddr const & agentImplem
   m_agentImplementationAddr = agentImplementationAddr;
 }
 
+template <class TScEvent, class TScContext>
+void ScAgent<TScEvent, TScContext>::SetSpecification(
+    std::shared_ptr<ScAgentSpecification const> const & specification) noexcept
+{
+  m_specification = specification;
+}
+
 template <class TScEvent, class TScContext>
 bool ScAgent<TScEvent, TScContext>::IsActionClassDeactivated() noexcept
 {
@@ -204,6 +223,9 @@ bool ScAgent<TScEvent, TScContext>::IsActionClassDeactivated() noexcept
 template <class TScEvent, class TScContext>
 bool ScAgent<TScEvent, TScContext>::MayBeSpecified() const noexcept
 {
+  if (m_specification != nullptr)
+    return true;
+
   return m_context.IsElement(m_agentImplementationAddr);
 }
 
@@ -242,10 +264,9 @@ bool ScAgent<TScEvent, TScContext>::ValidateInitiationCondition(TScEvent const &
     return false;
 
   bool isFound = false;
-  ScTemplateSearchResult searchResult;
   try
   {
-    isFound = this->m_context.SearchByTemplate(initiationConditionTemplate, searchResult);
+    isFound = this->m_context.CreateTemplateSearchCursor(initiationConditionTemplate, 1).Next();
   }
   catch (utils::ScException const & exception)
   {
@@ -389,7 +410,7 @@ ScTemplate ScAgent<TScEvent, TScContext>::BuildInitiationConditionTemplate(
   }
 
   ScTemplate initiationConditionTemplate;
-  this->m_context.BuildTemplate(initiationConditionTemplate, initiationConditionTemplateAddr, templateParams);
+  this->m_context.BuildCachedTemplate(initiationConditionTemplate, initiationConditionTemplateAddr, templateParams);
   return initiationConditionTemplate;
 }
 
@@ -399,7 +420,7 @@ ScTemplate ScAgent<TScEvent, TScContext>::BuildResultConditionTemplate(
     ScAddr const & resultConditionTemplateAddr) noexcept
 {
   ScTemplate resultConditionTemplate;
-  this->m_context.BuildTemplate(resultConditionTemplate, resultConditionTemplateAddr);
+  this->m_context.BuildCachedTemplate(resultConditionTemplate, resultConditionTemplateAddr);
   return resultConditionTemplate;
 }
 
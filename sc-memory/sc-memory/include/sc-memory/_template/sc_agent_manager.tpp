@@ -76,6 +76,10 @@ void ScAgentManager<TScAgent>::Subscribe(
         "Subscribe " << agentImplementationInfo << " to event `" << eventClassName << "` with subscription sc-element `"
                      << subscriptionElementName << "`.");
 
+    std::shared_ptr<ScAgentSpecificationCache> specificationCache;
+    if (context->IsElement(agentImplementationAddr))
+      specificationCache = GenerateSpecificationCache(context, agentImplementationAddr);
+
     std::function<void(void)> postEraseEventCallback;
     if constexpr (std::is_same<ScElementaryEvent, TScEvent>::value)
     {
@@ -90,8 +94,9 @@ void ScAgentManager<TScAgent>::Subscribe(
                *context,
                eventClassAddr,
                subscriptionElementAddr,
-               ScAgentManager<TScAgent>::GetCallback(agentImplementationAddr, postEraseEventCallback))});
-      ScAgentManager<TScAgent>::m_agentEventClasses.insert({agentClassName, {eventClassAddr, subscriptionElementAddr}});
+               ScAgentManager<TScAgent>::GetCallback(
+                   agentImplementationAddr, postEraseEventCallback, context->GetUser(), specificationCache))});
+      ScAgentManager<TScAgent>::m_agentEventClasses[agentClassName] = {eventClassAddr, subscriptionElementAddr};
     }
     else
     {
@@ -104,9 +109,10 @@ void ScAgentManager<TScAgent>::Subscribe(
            new ScElementaryEventSubscription<TScEvent>(
                *context,
                subscriptionElementAddr,
-               ScAgentManager<TScAgent>::GetCallback(agentImplementationAddr, postEraseEventCallback))});
-      ScAgentManager<TScAgent>::m_agentEventClasses.insert(
-          {agentClassName, {TScEvent::eventClassAddr, subscriptionElementAddr}});
+               ScAgentManager<TScAgent>::GetCallback(
+                   agentImplementationAddr, postEraseEventCallback, context->GetUser(), specificationCache))});
+      ScAgentManager<TScAgent>::m_agentEventClasses[agentClassName] = {
+          TScEvent::eventClassAddr, subscriptionElementAddr};
     }
   }
 }
@@ -387,13 +393,94 @@ std::function<void(void)> ScAgentManager<TScAgent>::GetPostEraseEventCallback(
     EraseSubscription(subscriptionElementAddr, *subscriptions);
     ClearEmptyAgentImplementationSubscriptions(
         agentClassName, agentImplementationAddr, agentImplementationsToSubscriptions, subscriptions);
+
+    // Subscription sc-element is erased only after this callback, but agent must not be unsubscribed again until then.
+    auto const eventClassIt = ScAgentManager<TScAgent>::m_agentEventClasses.find(agentClassName);
+    if (eventClassIt != ScAgentManager<TScAgent>::m_agentEventClasses.cend())
+      eventClassIt->second.second = ScAddr::Empty;
+  };
+}
+
+template <class TScAgent>
+std::shared_ptr<ScAgentSpecification const> ScAgentManager<TScAgent>::ResolveSpecification(
+    ScAddr const & userAddr,
+    ScAddr const & agentImplementationAddr) noexcept
+{
+  using TScBaseAgent = ScAgent<TScEvent, TScContext>;
+
+  TScAgent agent;
+  agent.SetInitiator(userAddr);
+  agent.SetImplementation(agentImplementationAddr);
+
+  auto specification = std::make_shared<ScAgentSpecification>();
+  specification->agentClassName = GetAgentClassName(&agent.m_context, agent);
+
+  auto const & Resolve = [](std::function<ScAddr()> const & getElement) -> ScAddr
+  {
+    try
+    {
+      return getElement();
+    }
+    catch (utils::ScException const &)
+    {
+      return ScAddr::Empty;
+    }
+  };
+
+  auto const & ResolveAbstractAgent = [&]() -> ScAddr
+  {
+    return Resolve(
+        [&]()
+        {
+          return agent.TScBaseAgent::GetAbstractAgent();
+        });
   };
+
+  // Sc-connectors are collected before sc-elements are resolved through them, so agent specification changed while it
+  // is resolved is outdated on the next call.
+  specification->abstractAgentAddr = ResolveAbstractAgent();
+  specification->connectorsAddrs = ScAgentSpecificationCache::CollectConnectors(
+      agent.m_context, agentImplementationAddr, specification->abstractAgentAddr);
+  if (ResolveAbstractAgent() != specification->abstractAgentAddr)
+    specification->connectorsAddrs.clear();
+  if (!specification->abstractAgentAddr.IsValid())
+    return specification;
+
+  specification->actionClassAddr = Resolve(
+      [&]()
+      {
+        return agent.TScBaseAgent::GetActionClass();
+      });
+  specification->initiationConditionAddr = Resolve(
+      [&]()
+      {
+        return agent.TScBaseAgent::GetInitiationCondition();
+      });
+  specification->resultConditionAddr = Resolve(
+      [&]()
+      {
+        return agent.TScBaseAgent::GetResultCondition();
+      });
+
+  return specification;
+}
+
+template <class TScAgent>
+std::shared_ptr<ScAgentSpecificationCache> ScAgentManager<TScAgent>::GenerateSpecificationCache(
+    ScMemoryContext * context,
+    ScAddr const & agentImplementationAddr) noexcept
+{
+  auto specificationCache = std::make_shared<ScAgentSpecificationCache>();
+  specificationCache->Set(ResolveSpecification(context->GetUser(), agentImplementationAddr));
+  return specificationCache;
 }
 
 template <class TScAgent>
 std::function<void(typename TScAgent::TEventType const &)> ScAgentManager<TScAgent>::GetCallback(
     ScAddr const & agentImplementationAddr,
-    std::function<void(void)> const & postEraseEventCallback) noexcept
+    std::function<void(void)> const & postEraseEventCallback,
+    ScAddr const & userAddr,
+    std::shared_ptr<ScAgentSpecificationCache> const & specificationCache) noexcept
 {
   static_assert(
       std::is_base_of<ScAgent<TScEvent, TScContext>, TScAgent>::value,
@@ -414,7 +501,8 @@ std::function<void(typename TScAgent::TEventType const &)> ScAgentManager<TScAge
   static_assert(
       HasOneOverride<TScAgent>::DoProgramMethod::value, "TScAgent must have one override `DoProgram` method.");
 
-  return [agentImplementationAddr, postEraseEventCallback](TScEvent const & event) -> void
+  return [agentImplementationAddr, postEraseEventCallback, userAddr, specificationCache](
+             TScEvent const & event) -> void
   {
     auto const & ResolveAction = [](TScEvent const & event, ScAgent<TScEvent, TScContext> & agent) -> ScAction
     {
@@ -439,7 +527,24 @@ std::function<void(typename TScAgent::TEventType const &)> ScAgentManager<TScAge
     agent.SetInitiator(event.GetUser());
     agent.SetImplementation(agentImplementationAddr);
 
-    std::string const & agentName = GetAgentClassName(&agent.m_context, agent);
+    // Agent specification is resolved in knowledge base only after its changes, otherwise the cached one is used.
+    std::string agentName;
+    if (specificationCache != nullptr)
+    {
+      std::shared_ptr<ScAgentSpecification const> specification =
+          specificationCache->Get(agent.m_context, agentImplementationAddr);
+      if (specification == nullptr)
+      {
+        specification = ResolveSpecification(userAddr, agentImplementationAddr);
+        specificationCache->Set(specification);
+      }
+
+      agent.SetSpecification(specification);
+      agentName = specification->agentClassName;
+    }
+    else
+      agentName = GetAgentClassName(&agent.m_context, agent);
+
     agent.m_logger.Info("Agent `", agentName, "` reacted to primary initiation condition.");
 
     if (agent.IsActionClassDeactivated())
@@ -453,7 +558,7 @@ std::function<void(typename TScAgent::TEventType const &)> ScAgentManager<TScAge
       return PostCallback();
     }
 
-    agent.m_logger.Info("Agent `", agentName, "` started checking initiation condition.");
+    agent.m_logger.Debug("Agent `", agentName, "` started checking initiation condition.");
     bool isInitiationConditionCheckedSuccessfully = false;
     try
     {
@@ -472,14 +577,14 @@ std::function<void(typename TScAgent::TEventType const &)> ScAgentManager<TScAge
           "Agent `", agentName, "` was finished because its initiation condition was checked unsuccessfully.");
       return PostCallback();
     }
-    agent.m_logger.Info("Agent `", agentName, "` finished checking initiation condition.");
+    agent.m_logger.Debug("Agent `", agentName, "` finished checking initiation condition.");
 
     ScAction action = ResolveAction(event, agent);
     ScResult result;
 
     try
     {
-      agent.m_logger.Info("Agent `", agentName, "` started performing action.");
+      agent.m_logger.Debug("Agent `", agentName, "` started performing action.");
       if constexpr (HasOverride<TScAgent>::DoProgramWithEventArgument::value)
         result = agent.DoProgram(event, action);
       else
@@ -513,7 +618,7 @@ std::function<void(typename TScAgent::TEventType const &)> ScAgentManager<TScAge
     else
       agent.m_logger.Info("Agent `", agentName, "` finished performing action with error.");
 
-    agent.m_logger.Info("Agent `", agentName, "` started checking result condition.");
+    agent.m_logger.Debug("Agent `", agentName, "` started checking result condition.");
     bool isResultConditionCheckedSuccessfully = false;
     try
     {
@@ -531,7 +636,7 @@ std::function<void(typename TScAgent::TEventType const &)> ScAgentManager<TScAge
       agent.m_logger.Warning("Result condition of agent `", agentName, "` checked unsuccessfully.");
       return PostCallback();
     }
-    agent.m_logger.Info("Agent `", agentName, "` finished checking result condition.");
+    agent.m_logger.Debug("Agent `", agentName, "` finished checking result condition.");
 
     return PostCallback();
   };
@@ -9,6 +9,7 @@
 #include "sc_object.hpp"
 
 #include "sc_agent_context.hpp"
+#include "sc_agent_specification.hpp"
 
 #include "utils/sc_logger.hpp"
 
@@ -240,6 +241,7 @@ protected:
   mutable TScContext m_context;
   mutable utils::ScLogger m_logger;
   ScAddr m_agentImplementationAddr;
+  std::shared_ptr<ScAgentSpecification const> m_specification;
 
   _SC_EXTERN ScAgent() noexcept;
 
@@ -255,6 +257,12 @@ protected:
    */
   _SC_EXTERN void SetImplementation(ScAddr const & agentImplementationAddr) noexcept;
 
+  /*!
+   * @brief Sets agent specification resolved in knowledge base, it is used instead of searching it.
+   * @param specification A pointer to agent specification of the agent implementation.
+   */
+  _SC_EXTERN void SetSpecification(std::shared_ptr<ScAgentSpecification const> const & specification) noexcept;
+
   //! Checks that agent action class belongs to `action_deactivated`.
   _SC_EXTERN bool IsActionClassDeactivated() noexcept;
 
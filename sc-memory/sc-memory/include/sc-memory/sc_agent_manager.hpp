@@ -9,6 +9,7 @@
 #include <optional>
 
 #include "sc_object.hpp"
+#include "sc_agent_specification.hpp"
 
 #include "utils/sc_logger.hpp"
 
@@ -523,18 +524,52 @@ protected:
       ScAddr const & agentImplementationAddr,
       ScAddr const & subscriptionElementAddr);
 
+  /*!
+   * @brief Resolves specification of agent implementation in knowledge base.
+   *
+   * Sc-elements of agent specification are searched by methods of class `ScAgent`, not by their overrides, so
+   * they can be used instead of searching them in these methods.
+   *
+   * @param userAddr A sc-address of user which sc-memory context is used to search agent specification.
+   * @param agentImplementationAddr A sc-address of agent implementation specified in knowledge base for this agent.
+   * @return A pointer to agent specification.
+   */
+  static _SC_EXTERN std::shared_ptr<ScAgentSpecification const> ResolveSpecification(
+      ScAddr const & userAddr,
+      ScAddr const & agentImplementationAddr) noexcept;
+
+  /*!
+   * @brief Generates cache of agent specification for an agent subscription.
+   *
+   * Cached agent specification is checked by sc-connectors incoming to agent implementation and outgoing from
+   * abstract sc-agent each time it is got.
+   *
+   * @param context A sc-memory context which user resolves agent specification.
+   * @param agentImplementationAddr A sc-address of agent implementation specified in knowledge base for this agent.
+   * @return A pointer to cache of agent specification.
+   */
+  static _SC_EXTERN std::shared_ptr<ScAgentSpecificationCache> GenerateSpecificationCache(
+      ScMemoryContext * context,
+      ScAddr const & agentImplementationAddr) noexcept;
+
   /*!
    * @brief Gets the callback function for agent class.
    * @tparam TScAgent An agent class to be subscribed to the event.
    * @param agentImplementationAddr A sc-address of agent implementation specified in knowledge base for this agent.
    * @param postEraseEventCallback A callback function that remove subscription of agent to sc-event of erasing
    * sc-element from common map after agent flow of performing action. class.
+   * @param userAddr A sc-address of user that subscribed agent, it is used to resolve changed agent
+   * specification.
+   * @param specificationCache A pointer to cache of agent specification, or nullptr if agent isn't specified in
+   * knowledge base.
    * @return A function that takes an sc-event and returns an sc-result.
    * @warning Specified agent class must be derived from class `ScAgent`.
    */
   static _SC_EXTERN std::function<void(TScEvent const &)> GetCallback(
       ScAddr const & agentImplementationAddr,
-      std::function<void(void)> const & postEraseEventCallback) noexcept;
+      std::function<void(void)> const & postEraseEventCallback,
+      ScAddr const & userAddr = ScAddr::Empty,
+      std::shared_ptr<ScAgentSpecificationCache> const & specificationCache = nullptr) noexcept;
 };
 
 #include "_template/sc_agent_manager.tpp"
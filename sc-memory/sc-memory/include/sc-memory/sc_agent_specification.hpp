@@ -0,0 +1,85 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "sc_addr.hpp"
+
+class ScMemoryContext;
+
+/*!
+ * @struct ScAgentSpecification
+ * @brief Sc-elements of agent specification resolved in knowledge base for an agent implementation.
+ *
+ * Not found sc-elements are left invalid, agents search them in knowledge base on each call.
+ */
+struct _SC_EXTERN ScAgentSpecification
+{
+  //! Name of agent class used in logs.
+  std::string agentClassName;
+  //! Abstract sc-agent that includes agent implementation.
+  ScAddr abstractAgentAddr;
+  //! Class of actions performed by agent.
+  ScAddr actionClassAddr;
+  //! Initiation condition of abstract sc-agent.
+  ScAddr initiationConditionAddr;
+  //! Result condition of abstract sc-agent.
+  ScAddr resultConditionAddr;
+  //! Sc-connectors through which agent specification was resolved, they are compared with actual ones on each call.
+  std::vector<ScAddr> connectorsAddrs;
+};
+
+/*!
+ * @class ScAgentSpecificationCache
+ * @brief Keeps agent specification resolved once per agent subscription.
+ *
+ * Each time agent specification is got from the cache, sc-connectors incoming to agent implementation and outgoing
+ * from abstract sc-agent, and sc-connectors incoming to them, are collected again and compared with the ones through
+ * which agent specification was resolved. If some of them are generated or erased, the cached agent specification
+ * isn't returned, so changes of agent specification take effect for the next initiated agent without waiting for
+ * sc-events.
+ */
+class _SC_EXTERN ScAgentSpecificationCache
+{
+public:
+  /*!
+   * @brief Gets cached agent specification if it is still actual.
+   * @param context A sc-memory context used to check agent specification.
+   * @param agentImplementationAddr A sc-address of agent implementation.
+   * @return A pointer to agent specification, or nullptr if nothing is cached or agent specification is changed.
+   */
+  _SC_EXTERN std::shared_ptr<ScAgentSpecification const> Get(
+      ScMemoryContext & context,
+      ScAddr const & agentImplementationAddr) const noexcept;
+
+  /*!
+   * @brief Sets agent specification.
+   * @param specification A pointer to agent specification to be cached. Its sc-connectors must be collected by
+   * `CollectConnectors` before agent specification is resolved.
+   */
+  _SC_EXTERN void Set(std::shared_ptr<ScAgentSpecification const> const & specification) noexcept;
+
+  /*!
+   * @brief Collects sc-connectors through which agent specification is resolved.
+   * @param context A sc-memory context used to collect sc-connectors.
+   * @param agentImplementationAddr A sc-address of agent implementation.
+   * @param abstractAgentAddr A sc-address of abstract sc-agent, it may be invalid.
+   * @return Sc-addresses of sc-connectors in order of iteration.
+   */
+  static _SC_EXTERN std::vector<ScAddr> CollectConnectors(
+      ScMemoryContext & context,
+      ScAddr const & agentImplementationAddr,
+      ScAddr const & abstractAgentAddr) noexcept;
+
+protected:
+  mutable std::mutex m_mutex;
+  std::shared_ptr<ScAgentSpecification const> m_specification;
+};
@@ -23,6 +23,8 @@
 
 class ScMemoryContext;
 class ScTemplate;
+class ScPreparedTemplate;
+class ScTemplateCache;
 class ScStream;
 using ScStreamPtr = std::shared_ptr<ScStream>;
 
@@ -80,6 +82,9 @@ public:
   _SC_EXTERN static void LogUnmute();
 
   static ScMemoryContext * ms_globalContext;
+
+protected:
+  static ScTemplateCache * ms_templateCache;
 };
 
 //! Class used to work with memory. It provides functions to create/retrieve/erase sc-elements.
@@ -88,6 +93,7 @@ class ScMemoryContext
   friend class ScMemory;
   friend class ScAction;
   friend class ScTemplateKeynode;
+  friend class ScTemplateGenerator;
 
 public:
   struct ScMemoryStatistics
@@ -764,6 +770,38 @@ public:
       TContentType const & linkContent,
       bool isSearchableLinkContent = true) noexcept(false);
 
+  /*!
+   * @brief Sets specified contents for specified sc-links at once.
+   *
+   * This method sets the content with the same index for every sc-link. Contents are divided into terms in parallel
+   * and appended to indexes of file memory in one pass, so it is intended for loading of many sc-links. Contents
+   * aren't set if any of specified sc-elements isn't sc-link.
+   *
+   * @param linkAddrs Sc-addresses of the sc-links.
+   * @param linkContents The contents of the sc-links.
+   * @param isSearchableString Flag indicating whether the contents are searchable as strings (default is true).
+   *
+   * @return true if the contents were successfully set; otherwise, returns false.
+   *
+   * @throws utils::ExceptionInvalidParams if the specified sc-addresses are invalid or counts of sc-addresses and
+   * contents differ.
+   * @throws utils::ExceptionInvalidState if the file memory state is invalid.
+   * @throws utils::ExceptionInvalidState if the sc-memory context is not authenticated or does not have erase and write
+   * permissions.
+   *
+   * @code
+   * ScMemoryContext context;
+   * ScAddrVector linkAddrs;
+   * for (std::string const & linkContent : linkContents)
+   *   linkAddrs.push_back(context.GenerateLink(ScType::ConstNodeLink));
+   * context.SetLinksContents(linkAddrs, linkContents);
+   * @endcode
+   */
+  _SC_EXTERN bool SetLinksContents(
+      ScAddrVector const & linkAddrs,
+      std::vector<std::string> const & linkContents,
+      bool isSearchableString = true) noexcept(false);
+
   /*!
    * @brief Gets a content of specified sc-link.
    *
@@ -860,6 +898,62 @@ public:
   template <typename TContentType>
   _SC_EXTERN bool GetLinkContent(ScAddr const & linkAddr, TContentType & outLinkContent) noexcept(false);
 
+  /*!
+   * @brief Appends specified content stream to the end of content of specified sc-link.
+   *
+   * This method appends the content stream to an sc-link content by parts without rewriting its previous content. It
+   * is intended for big binary contents, that are written by chunks. Only texts with appended parts smaller than
+   * `max_searchable_string_size` can be found by their contents. Chunks appended before an error aren't rolled back,
+   * so a failed append can be partial.
+   *
+   * @param linkAddr A sc-address of the sc-link.
+   * @param contentStream A stream containing the content to append.
+   *
+   * @return true if the content was successfully appended; otherwise, returns false.
+   *
+   * @throws utils::ExceptionInvalidParams if the specified sc-address or stream is invalid.
+   * @throws utils::ExceptionInvalidState if the file memory state is invalid.
+   * @throws utils::ExceptionInvalidState if the sc-memory context is not authenticated or does not have write
+   * permissions.
+   *
+   * @code
+   * ScMemoryContext context;
+   * ScAddr linkAddr = context.GenerateLink(ScType::ConstNodeLink);
+   * for (std::string const & chunk : chunks)
+   *   context.AppendLinkContent(linkAddr, ScStreamMakeRead(chunk));
+   * @endcode
+   */
+  _SC_EXTERN bool AppendLinkContent(ScAddr const & linkAddr, ScStreamPtr const & contentStream) noexcept(false);
+
+  /*!
+   * @brief Opens a stream that reads the content of specified sc-link by parts.
+   *
+   * Unlike GetLinkContent, this method doesn't read an sc-link content into memory. The content is read from file
+   * memory on reading from the stream, so big contents can be read by chunks and by offsets with `Seek`. The content
+   * of the sc-link mustn't be changed while the stream is read.
+   *
+   * @param linkAddr A sc-address of the sc-link.
+   *
+   * @return A shared pointer to the stream reading the content.
+   *
+   * @throws utils::ExceptionInvalidParams if the specified sc-address is invalid or the content is too big for stream.
+   * @throws utils::ExceptionInvalidState if the file memory state is invalid.
+   * @throws utils::ExceptionInvalidState if the sc-memory context is not authenticated or does not have read
+   * permissions.
+   *
+   * @code
+   * ScMemoryContext context;
+   * ScStreamPtr const & stream = context.OpenLinkContentStream(linkAddr);
+   * sc_char chunk[4096];
+   * size_t readBytes = 0;
+   * while (stream->Read(chunk, sizeof(chunk), readBytes) && readBytes != 0)
+   * {
+   *   // Handle chunk.
+   * }
+   * @endcode
+   */
+  _SC_EXTERN ScStreamPtr OpenLinkContentStream(ScAddr const & linkAddr) noexcept(false);
+
   /*!
    * @brief Searches for sc-links by specified content stream.
    *
@@ -2084,6 +2178,42 @@ public:
       ScTemplateResultItem & result,
       ScTemplateParams const & params = ScTemplateParams::Empty) noexcept(false);
 
+  /*!
+   * @brief Generates sc-constructions by object of `ScTemplate` for each of the given parameters and accumulates
+   * generated sc-constructions into `results`.
+   *
+   * New sc-elements of all sc-constructions are planned before generation: sc-nodes and sc-links are generated by one
+   * batch of sc-memory, and sc-connectors are generated by batches after their source and target sc-elements.
+   * Sc-events of generated sc-elements are emitted after all sc-constructions are generated. If some parameters are
+   * invalid, then no sc-constructions are generated.
+   * @param templateToGenerate An object of `ScTemplate` to generate sc-constructions by it.
+   * @param paramsList A list of maps of specified sc-template sc-variables to user replacements, one for each
+   * sc-construction.
+   * @param results Generated sc-constructions in order of `paramsList`.
+   * @throws utils::ExceptionInvalidParams if the object of `ScTemplate` or some parameters are not valid.
+   *
+   * @code
+   * ...
+   * ScTemplate templateToGenerate;
+   * templateToGenerate.Triple(
+   *  ScType::VarNodeClass >> "_class",
+   *  ScType::VarPermPosArc >> "_arc",
+   *  ScType::VarNode >> "_addr2"
+   * );
+   *
+   * std::vector<ScTemplateParams> paramsList(classesAddrs.size());
+   * for (size_t i = 0; i < classesAddrs.size(); ++i)
+   *   paramsList[i].Add("_class", classesAddrs[i]);
+   *
+   * std::vector<ScTemplateResultItem> results;
+   * m_context->GenerateByTemplate(templateToGenerate, paramsList, results);
+   * @endcode
+   */
+  _SC_EXTERN void GenerateByTemplate(
+      ScTemplate const & templateToGenerate,
+      std::vector<ScTemplateParams> const & paramsList,
+      std::vector<ScTemplateResultItem> & results) noexcept(false);
+
   /*!
    * @brief Generates sc-constructions by object of `ScTemplate` and accumulates generated sc-construction into
    * `result`.
@@ -2528,6 +2658,222 @@ public:
       ScTemplateSearchResultCallbackWithRequest const & callback,
       ScTemplateSearchResultCheckCallback const & checkCallback) noexcept(false);
 
+  /*!
+   * Searches sc-constructions by prepared sc-template with the given values of its parameters and accumulates found
+   * sc-constructions into `result`. Search plan of prepared sc-template is reused, so this method is cheaper than
+   * `SearchByTemplate` with object of `ScTemplate` when the same sc-template is searched many times.
+   * @param templateToFind A prepared sc-template to find sc-constructions by it.
+   * @param params Values of all parameters specified on preparation of sc-template.
+   * @param result A result vector of found sc-constructions.
+   *
+   * @return true if the sc-constructions are found; otherwise, returns false.
+   *
+   * @throws utils::ExceptionInvalidParams if value of some parameter of prepared sc-template is not given or is not
+   * valid, or if some given parameter wasn't specified on preparation of sc-template.
+   *
+   * @code
+   * ...
+   * ScTemplate templateToFind;
+   * templateToFind.Triple(
+   *  ScType::VarNodeClass >> "_class",
+   *  ScType::VarPermPosArc >> "_arc",
+   *  ScType::Unknown >> "_addr2"
+   * );
+   * ScPreparedTemplate const preparedTemplate{
+   *  *m_context, std::move(templateToFind), ScTemplateParams().Add("_class", ScAddr::Empty)};
+   *
+   * for (ScAddr const & classAddr : classesAddrs)
+   * {
+   *   ScTemplateSearchResult result;
+   *   m_context->SearchByTemplate(preparedTemplate, ScTemplateParams().Add("_class", classAddr), result);
+   *   ...
+   * }
+   * @endcode
+   */
+  _SC_EXTERN ScTemplate::Result SearchByTemplate(
+      ScPreparedTemplate const & templateToFind,
+      ScTemplateParams const & params,
+      ScTemplateSearchResult & result) noexcept(false);
+
+  /*!
+   * Searches sc-constructions by prepared sc-template with the given values of its parameters and passes found
+   * sc-constructions to `callback` lambda-function. If `filterCallback` passed, then all found constructions triples
+   * are filtered by `filterCallback` condition.
+   * @param templateToFind A prepared sc-template to find sc-constructions by it.
+   * @param params Values of all parameters specified on preparation of sc-template.
+   * @param callback A lambda-function, callable when all sc-construction triples were found.
+   * @param filterCallback A lambda-function, that filters all found sc-constructions triples.
+   * @param checkCallback A lambda-function, that filters all found elements.
+   *
+   * @throws utils::ExceptionInvalidParams if value of some parameter of prepared sc-template is not given or is not
+   * valid, or if some given parameter wasn't specified on preparation of sc-template.
+   */
+  _SC_EXTERN void SearchByTemplate(
+      ScPreparedTemplate const & templateToFind,
+      ScTemplateParams const & params,
+      ScTemplateSearchResultCallback const & callback,
+      ScTemplateSearchResultFilterCallback const & filterCallback = {},
+      ScTemplateSearchResultCheckCallback const & checkCallback = {}) noexcept(false);
+
+  /*!
+   * Searches constructions by prepared sc-template with the given values of its parameters and pass found
+   * sc-constructions to `callback` lambda-function. Lambda-function `callback` must return a request command value to
+   * manage sc-template search as in `SearchByTemplateInterruptibly` with object of `ScTemplate`.
+   * @param templateToFind A prepared sc-template to find sc-constructions by it.
+   * @param params Values of all parameters specified on preparation of sc-template.
+   * @param callback A lambda-function, callable when all sc-construction triples were found.
+   * @param filterCallback A lambda-function, that filters all found sc-constructions triples.
+   * @param checkCallback A lambda-function, that filters all found elements.
+   *
+   * @throws utils::ExceptionInvalidParams if value of some parameter of prepared sc-template is not given or is not
+   * valid, or if some given parameter wasn't specified on preparation of sc-template.
+   * @throws utils::ExceptionInvalidState if sc-template search stopped by ScTemplateSearchRequest::ERROR.
+   */
+  _SC_EXTERN void SearchByTemplateInterruptibly(
+      ScPreparedTemplate const & templateToFind,
+      ScTemplateParams const & params,
+      ScTemplateSearchResultCallbackWithRequest const & callback,
+      ScTemplateSearchResultFilterCallback const & filterCallback = {},
+      ScTemplateSearchResultCheckCallback const & checkCallback = {}) noexcept(false);
+
+  /*!
+   * Searches sc-constructions by sc-template by several threads and accumulates found sc-constructions into `result`.
+   * Sc-construction triples found by the first triple of search plan of sc-template are split between threads, and
+   * each thread searches sc-constructions that start from its sc-construction triples. Found sc-constructions are
+   * merged in the same order as by `SearchByTemplate`, so result doesn't depend on number of threads and their
+   * scheduling. Use it for sc-templates with many sc-constructions found by their first triples, for other
+   * sc-templates `SearchByTemplate` is cheaper. Calling thread searches by this sc-memory context, other threads
+   * search by their own sc-memory contexts of the same user, so this context isn't shared between threads.
+   * @param templateToFind A sc-template to find sc-constructions by it.
+   * @param result A result vector of found sc-constructions.
+   * @param threadsCount A number of threads used for search including calling thread, 0 means number of hardware
+   * threads.
+   *
+   * @return true if the sc-constructions are found; otherwise, returns false.
+   *
+   * @throws utils::ExceptionInvalidState if sc-template can't be searched.
+   *
+   * @code
+   * ...
+   * ScTemplate templateToFind;
+   * templateToFind.Triple(
+   *  ScType::VarNodeClass >> "_class",
+   *  ScType::VarPermPosArc >> "_arc",
+   *  ScType::VarNode >> "_addr2"
+   * );
+   * templateToFind.Triple(
+   *  "_addr2",
+   *  ScType::VarCommonArc,
+   *  ScType::VarNode >> "_addr3"
+   * );
+   * ScTemplateSearchResult result;
+   * m_context->SearchByTemplateInParallel(templateToFind, result, 8);
+   * ...
+   * @endcode
+   */
+  _SC_EXTERN ScTemplate::Result SearchByTemplateInParallel(
+      ScTemplate const & templateToFind,
+      ScTemplateSearchResult & result,
+      size_t threadsCount = 0) noexcept(false);
+
+  /*!
+   * Searches sc-constructions by prepared sc-template with the given values of its parameters by several threads and
+   * accumulates found sc-constructions into `result` as `SearchByTemplateInParallel` with object of `ScTemplate`.
+   * @param templateToFind A prepared sc-template to find sc-constructions by it.
+   * @param params Values of all parameters specified on preparation of sc-template.
+   * @param result A result vector of found sc-constructions.
+   * @param threadsCount A number of threads used for search including calling thread, 0 means number of hardware
+   * threads.
+   *
+   * @return true if the sc-constructions are found; otherwise, returns false.
+   *
+   * @throws utils::ExceptionInvalidParams if value of some parameter of prepared sc-template is not given or is not
+   * valid, or if some given parameter wasn't specified on preparation of sc-template.
+   * @throws utils::ExceptionInvalidState if sc-template can't be searched.
+   */
+  _SC_EXTERN ScTemplate::Result SearchByTemplateInParallel(
+      ScPreparedTemplate const & templateToFind,
+      ScTemplateParams const & params,
+      ScTemplateSearchResult & result,
+      size_t threadsCount = 0) noexcept(false);
+
+  /*!
+   * Searches sc-constructions by sc-template, all sc-elements of which belong to sc-structure, and accumulates found
+   * sc-constructions into `result`. Sc-elements of sc-structure are collected once on search, so checking that
+   * sc-element belongs to sc-structure doesn't iterate sc-arcs of sc-structure or sc-element.
+   * @param templateToFind A sc-template to find sc-constructions by it.
+   * @param structureAddr A sc-address of sc-structure that should contain all sc-elements of found sc-constructions.
+   * @param result A result vector of found sc-constructions.
+   *
+   * @return true if the sc-constructions are found; otherwise, returns false.
+   *
+   * @throws utils::ExceptionInvalidParams if `structureAddr` is not valid.
+   * @throws utils::ExceptionInvalidState if the object of `ScTemplate` is not valid.
+   *
+   * @code
+   * ...
+   * ScAddr const & structureAddr = context.SearchElementBySystemIdentifier("my_structure");
+   * ScAddr const & classAddr = context.SearchElementBySystemIdentifier("my_class");
+   * ScTemplate templateToFind;
+   * templateToFind.Triple(
+   *  classAddr,
+   *  ScType::VarPermPosArc,
+   *  ScType::VarNode >> "_element"
+   * );
+   * ScTemplateSearchResult result;
+   * m_context->SearchByTemplateInStructure(templateToFind, structureAddr, result);
+   * ...
+   * @endcode
+   */
+  _SC_EXTERN ScTemplate::Result SearchByTemplateInStructure(
+      ScTemplate const & templateToFind,
+      ScAddr const & structureAddr,
+      ScTemplateSearchResult & result) noexcept(false);
+
+  /*!
+   * Creates cursor that searches sc-constructions by sc-template one by one on demand. Each call of `Next` of cursor
+   * finds only one next sc-construction, so search can be stopped after any found sc-construction without searching
+   * the rest of them, and found sc-constructions aren't accumulated in memory.
+   * @param templateToFind A sc-template to find sc-constructions by it. It must outlive the cursor.
+   * @param limit Maximum number of sc-constructions found by cursor, 0 means no limit.
+   * @return A cursor of search by sc-template.
+   *
+   * @code
+   * ...
+   * ScTemplate templateToFind;
+   * templateToFind.Triple(
+   *  classAddr,
+   *  ScType::VarPermPosArc >> "_arc",
+   *  ScType::Unknown >> "_addr2"
+   * );
+   * ScTemplateSearchCursor cursor = m_context->CreateTemplateSearchCursor(templateToFind, 1);
+   * if (cursor.Next())
+   * {
+   *   ScAddr const foundAddr = cursor.Get()["_addr2"];
+   *   ...
+   * }
+   * @endcode
+   */
+  _SC_EXTERN ScTemplateSearchCursor CreateTemplateSearchCursor(
+      ScTemplate const & templateToFind,
+      size_t limit = 0) noexcept(false);
+
+  /*!
+   * Creates cursor that searches sc-constructions by prepared sc-template with the given values of its parameters one
+   * by one on demand.
+   * @param templateToFind A prepared sc-template to find sc-constructions by it. It must outlive the cursor.
+   * @param params Values of all parameters specified on preparation of sc-template.
+   * @param limit Maximum number of sc-constructions found by cursor, 0 means no limit.
+   * @return A cursor of search by prepared sc-template.
+   *
+   * @throws utils::ExceptionInvalidParams if value of some parameter of prepared sc-template is not given or is not
+   * valid, or if some given parameter wasn't specified on preparation of sc-template.
+   */
+  _SC_EXTERN ScTemplateSearchCursor CreateTemplateSearchCursor(
+      ScPreparedTemplate const & templateToFind,
+      ScTemplateParams const & params,
+      size_t limit = 0) noexcept(false);
+
   /*!
    * Translates a sc-template represented in sc-memory (sc-structure) into object of `ScTemplate`. After
    * sc-template translation you can use object of `ScTemplate` to search or generate sc-constructions: in
@@ -2637,6 +2983,51 @@ public:
       ScTemplate & resultTemplate,
       std::string const & translatableSCsTemplate) noexcept(false);
 
+  /*!
+   * Translates a sc-template represented in sc-memory (sc-structure) into object of `ScTemplate` once and caches it.
+   * Next calls for the same sc-structure return the same object of `ScTemplate` until sc-structure is changed: arcs
+   * outgoing from sc-structure and sc-types of its sc-elements are compared with the cached ones on each call.
+   * @param translatableTemplateAddr A sc-address of sc-template structure to be translated.
+   * @return A shared immutable object of `ScTemplate`.
+   * @throws utils::ExceptionInvalidState if sc-template represented in sc-memory is not valid.
+   *
+   * @code
+   * ...
+   * ScAddr const & translatableTemplAddr = m_context->SearchElementBySystemIdentifier("my_template");
+   * std::shared_ptr<ScTemplate const> const & resultTemplate = m_context->BuildCachedTemplate(translatableTemplAddr);
+   * m_context->SearchByTemplate(*resultTemplate, ...);
+   * ...
+   * @endcode
+   */
+  _SC_EXTERN std::shared_ptr<ScTemplate const> BuildCachedTemplate(ScAddr const & translatableTemplateAddr) noexcept(
+      false);
+
+  /*!
+   * Translates a sc-template represented in sc-memory (sc-structure) into object of `ScTemplate` using cached
+   * sc-elements of sc-structure. If parameters are specified, they are applied to cached sc-elements of sc-structure
+   * without reading it from sc-memory again.
+   * @param resultTemplate An object of `ScTemplate` to be gotten.
+   * @param translatableTemplateAddr A sc-address of sc-template structure to be translated.
+   * @param params A map of specified sc-template sc-variables to their replacements.
+   * @throws utils::ExceptionInvalidState if sc-template represented in sc-memory is not valid.
+   */
+  _SC_EXTERN void BuildCachedTemplate(
+      ScTemplate & resultTemplate,
+      ScAddr const & translatableTemplateAddr,
+      ScTemplateParams const & params = ScTemplateParams()) noexcept(false);
+
+  /*!
+   * Translates a sc-template represented in SCs-code into object of `ScTemplate` once and caches it. Next calls for
+   * the same SCs-code don't parse it again and return the same object of `ScTemplate` until some of sc-elements found
+   * by system identifiers in it are changed.
+   * @param translatableSCsTemplate A sc.s-representation of sc-template to be translated.
+   * @return A shared immutable object of `ScTemplate`.
+   * @throws utils::ExceptionParseError if SCs-code is not valid.
+   * @throws utils::ExceptionInvalidState if sc-template represented in SCs-code is not valid.
+   */
+  _SC_EXTERN std::shared_ptr<ScTemplate const> BuildCachedTemplate(
+      std::string const & translatableSCsTemplate) noexcept(false);
+
 protected:
   /*!
    * Translates an object of `ScTemplate` to sc-template in sc-memory (sc-structure).
@@ -2705,6 +3096,31 @@ public:
 protected:
   _SC_EXTERN explicit ScMemoryContext(ScAddr const & userAddr) noexcept;
 
+  /*!
+   * Generates sc-nodes and sc-links of the given types by one batch of sc-memory.
+   * @param types Types of generated sc-nodes and sc-links.
+   * @param elementsAddrs Sc-addresses of generated sc-elements in order of their types.
+   * @throws utils::ExceptionInvalidParams if some type is not sc-node or sc-link type, then no sc-elements are
+   * generated.
+   */
+  _SC_EXTERN void GenerateNodesAndLinks(std::vector<ScType> const & types, ScAddrVector & elementsAddrs);
+
+  /*!
+   * Generates sc-connectors of the given types by one batch of sc-memory.
+   * @param types Types of generated sc-connectors.
+   * @param sourceElementsAddrs Sc-addresses of source sc-elements of generated sc-connectors.
+   * @param targetElementsAddrs Sc-addresses of target sc-elements of generated sc-connectors.
+   * @param connectorsAddrs Sc-addresses of generated sc-connectors in order of their types. If generation fails, then
+   * sc-addresses of not generated sc-connectors are empty.
+   * @throws utils::ExceptionInvalidParams if some type is not sc-connector type or some source or target is invalid.
+   * @throws utils::ExceptionInvalidState if the context hasn't permissions to generate some sc-connector.
+   */
+  _SC_EXTERN void GenerateConnectors(
+      std::vector<ScType> const & types,
+      ScAddrVector const & sourceElementsAddrs,
+      ScAddrVector const & targetElementsAddrs,
+      ScAddrVector & connectorsAddrs);
+
   _SC_EXTERN ScAddrSet SearchLinksByContentSubstring(
       ScStreamPtr const & linkContentSubstringStream,
       size_t maxLengthToSearchAsPrefix,
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 
 #include "sc_addr.hpp"
 #include "sc_type.hpp"
@@ -181,6 +182,7 @@ _SC_EXTERN ScTemplateItem operator>>(ScType const & value, std::string const & r
 
 class ScTemplateResultItem;
 class ScTemplateSearchResult;
+class ScTemplateSearchCursor;
 
 enum class _SC_EXTERN ScTemplateResultCode : uint8_t
 {
@@ -290,10 +292,13 @@ class _SC_EXTERN ScTemplate
 {
   friend class ScMemoryContext;
   friend class ScTemplateSearch;
+  friend struct ScTemplateSearchPlan;
+  friend class ScPreparedTemplate;
   friend class ScTemplateGenerator;
   friend class ScTemplateBuilder;
   friend class ScTemplateBuilderFromScs;
   friend class ScTemplateLoader;
+  friend class ScTemplateCache;
 
 public:
   /*!
@@ -408,6 +413,26 @@ public:
    */
   _SC_EXTERN bool HasReplacement(ScAddr const & replAddr) const;
 
+  /*!
+   * @brief Builds search plan of object of `ScTemplate` and returns its text representation.
+   *
+   * Each line of the plan describes one step of search: triple index, whether the triple is iterated or only checked
+   * (its source and target are found by previous steps), fixed (F) and searchable (A) items of the triple at this
+   * step and estimated count of sc-constructions found by the triple. Estimations are based on counts of sc-arcs of
+   * fixed sc-elements and sc-types of triple items.
+   *
+   * @code
+   * ScTemplate templ;
+   * templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_element");
+   * std::cout << templ.Explain(context);
+   * // 1. iterate triple 0 (#123, _, `_element`) as F_A_A, estimated count: 3
+   * @endcode
+   *
+   * @param context A sc-memory context used to get counts of sc-arcs of fixed sc-elements.
+   * @return A text representation of search plan.
+   */
+  _SC_EXTERN std::string Explain(ScMemoryContext & context) const noexcept(false);
+
   /*!
    * @brief Adds a triple to object of `ScTemplate`.
    *
@@ -474,6 +499,20 @@ protected:
       ScTemplateParams const & params,
       ScTemplateResultCode * errorCode = nullptr) const noexcept(false);
 
+  /*!
+   * @brief Generates sc-constructions by object of `ScTemplate` for each of the given parameters.
+   *
+   * @param context A sc-memory context.
+   * @param paramsList Template parameters of each generated sc-construction.
+   * @param results Result items to store generated sc-constructions in order of parameters.
+   * @return A result of the generation.
+   * @throws utils::ExceptionInvalidParams if the parameters are invalid.
+   */
+  Result Generate(
+      ScMemoryContext & context,
+      std::vector<ScTemplateParams> const & paramsList,
+      std::vector<ScTemplateResultItem> & results) const noexcept(false);
+
   /*!
    * @brief Searches for sc-elements by object of `ScTemplate`.
    *
@@ -514,6 +553,38 @@ protected:
       ScTemplateSearchResultFilterCallback const & filterCallback = {},
       ScTemplateSearchResultCheckCallback const & checkCallback = {}) const noexcept(false);
 
+  /*!
+   * @brief Searches for sc-elements by object of `ScTemplate` by several threads.
+   *
+   * @param context A sc-memory context.
+   * @param result A result item to store the found elements.
+   * @param threadsCount A number of threads used for search, 0 means number of hardware threads.
+   * @return A result of the search.
+   * @throws utils::ExceptionInvalidState if sc-template can't be searched.
+   */
+  Result SearchInParallel(ScMemoryContext & context, ScTemplateSearchResult & result, size_t threadsCount) const
+      noexcept(false);
+
+  /*!
+   * @brief Searches for sc-elements by object of `ScTemplate` that belong to sc-structure.
+   *
+   * @param context A sc-memory context.
+   * @param structureAddr A sc-address of sc-structure that should contain all sc-elements of found sc-constructions.
+   * @param result A result item to store the found elements.
+   * @return A result of the search.
+   */
+  Result SearchInStructure(ScMemoryContext & context, ScAddr const & structureAddr, ScTemplateSearchResult & result)
+      const noexcept(false);
+
+  /*!
+   * @brief Creates cursor that searches sc-constructions by object of `ScTemplate` one by one.
+   *
+   * @param context A sc-memory context.
+   * @param limit Maximum number of sc-constructions found by cursor, 0 means no limit.
+   * @return A cursor of search by object of `ScTemplate`.
+   */
+  ScTemplateSearchCursor CreateSearchCursor(ScMemoryContext & context, size_t limit) const noexcept(false);
+
   /*!
    * @brief Translates a sc-template in sc-memory (sc-structure) into object of `ScTemplate`.
    *
@@ -584,6 +655,102 @@ protected:
   ScTemplateTripleType GetPriority(ScTemplateTriple * triple);
 };
 
+struct ScTemplateSearchPlan;
+
+/*!
+ * @brief Represents an object of `ScTemplate` prepared for repeated searches.
+ *
+ * ScPreparedTemplate analyses sc-template and builds its search plan once. Searches by it don't repeat this work, so
+ * they are cheaper than searches by object of `ScTemplate` when the same sc-template is searched many times. Values of
+ * sc-template parameters are given on each search, so one prepared sc-template can be used to search sc-constructions
+ * for different sc-elements.
+ *
+ * @code
+ * ScTemplate templ;
+ * templ.Triple(ScType::VarNode >> "_class", ScType::VarPermPosArc, ScType::VarNode >> "_element");
+ *
+ * ScPreparedTemplate preparedTemplate{context, std::move(templ), ScTemplateParams().Add("_class", classAddr)};
+ * for (ScAddr const & otherClassAddr : classesAddrs)
+ * {
+ *   ScTemplateSearchResult result;
+ *   context.SearchByTemplate(preparedTemplate, ScTemplateParams().Add("_class", otherClassAddr), result);
+ * }
+ * @endcode
+ *
+ * @note Object of `ScPreparedTemplate` isn't changed by searches, so it can be used by several threads concurrently.
+ */
+class _SC_EXTERN ScPreparedTemplate
+{
+  friend class ScMemoryContext;
+
+public:
+  /*!
+   * @brief Prepares object of `ScTemplate` for searches by it.
+   *
+   * @param context A sc-memory context used to estimate counts of sc-constructions found by sc-template triples.
+   * @param templ An object of `ScTemplate` to prepare.
+   * @param params Parameters of sc-template. Their names are names of sc-template items or system identifiers of
+   * sc-variables of sc-template built from sc-memory. Their values are used to estimate counts of sc-constructions
+   * only, and can be empty. Values of these parameters must be given on each search by prepared sc-template.
+   * @throws utils::ExceptionInvalidParams if sc-template hasn't item with name of some parameter.
+   */
+  _SC_EXTERN ScPreparedTemplate(
+      ScMemoryContext & context,
+      ScTemplate && templ,
+      ScTemplateParams const & params = ScTemplateParams::Empty) noexcept(false);
+
+  SC_DISALLOW_COPY(ScPreparedTemplate);
+  _SC_EXTERN ScPreparedTemplate(ScPreparedTemplate && other) noexcept;
+
+  _SC_EXTERN ~ScPreparedTemplate() noexcept;
+
+  /*!
+   * @brief Returns text representation of search plan of prepared sc-template.
+   *
+   * @see ScTemplate::Explain
+   */
+  _SC_EXTERN std::string Explain(ScMemoryContext & context) const noexcept(false);
+
+protected:
+  ScTemplate m_template;  ///< Prepared object of `ScTemplate`.
+  std::map<std::string, std::string>
+      m_paramsNamesToTemplateItemsNames;         ///< Map of parameters names to names of sc-template items.
+  std::shared_ptr<ScTemplateSearchPlan> m_plan;  ///< Search plan of sc-template shared by searches.
+
+  ScTemplateParams::ScTemplateItemsToParams GetTemplateItemsToParams(ScTemplateParams const & params) const
+      noexcept(false);
+
+  ScTemplate::Result Search(
+      ScMemoryContext & context,
+      ScTemplateParams const & params,
+      ScTemplateSearchResult & result) const noexcept(false);
+
+  void Search(
+      ScMemoryContext & context,
+      ScTemplateParams const & params,
+      ScTemplateSearchResultCallback const & callback,
+      ScTemplateSearchResultFilterCallback const & filterCallback,
+      ScTemplateSearchResultCheckCallback const & checkCallback) const noexcept(false);
+
+  void Search(
+      ScMemoryContext & context,
+      ScTemplateParams const & params,
+      ScTemplateSearchResultCallbackWithRequest const & callback,
+      ScTemplateSearchResultFilterCallback const & filterCallback,
+      ScTemplateSearchResultCheckCallback const & checkCallback) const noexcept(false);
+
+  ScTemplate::Result SearchInParallel(
+      ScMemoryContext & context,
+      ScTemplateParams const & params,
+      ScTemplateSearchResult & result,
+      size_t threadsCount) const noexcept(false);
+
+  ScTemplateSearchCursor CreateSearchCursor(
+      ScMemoryContext & context,
+      ScTemplateParams const & params,
+      size_t limit) const noexcept(false);
+};
+
 /*!
  * @brief Represents an item in the result of a sc-template operation.
  *
@@ -596,6 +763,7 @@ class _SC_EXTERN ScTemplateResultItem
   friend class ScSet;
   friend class ScTemplateSearch;
   friend class ScTemplateSearchResult;
+  friend class ScTemplateSearchCursor;
 
 public:
   _SC_EXTERN ScTemplateResultItem();
@@ -792,3 +960,84 @@ protected:
   ScTemplate::ScTemplateItemsToReplacementsItemsPositions
       m_templateItemsNamesToReplacementItemsPositions;  ///< A map of template items to replacement item positions.
 };
+
+class ScTemplateSearch;
+
+/*!
+ * @brief Represents a search by sc-template that finds sc-constructions one by one on demand.
+ *
+ * ScTemplateSearchCursor doesn't accumulate found sc-constructions: each call of `Next` resumes search from the state
+ * where the previous sc-construction was found, so the first sc-construction is found without searching the rest of
+ * them, and memory used by cursor doesn't depend on number of found sc-constructions. Cursor is created by
+ * `ScMemoryContext::CreateTemplateSearchCursor`.
+ *
+ * @code
+ * ...
+ * ScTemplateSearchCursor cursor = m_context->CreateTemplateSearchCursor(templ, 10);
+ * while (cursor.Next())
+ * {
+ *   ScTemplateSearchResultItem const & item = cursor.Get();
+ *   ...
+ * }
+ * @endcode
+ *
+ * @warning Sc-template (or prepared sc-template) and sc-memory context used to create cursor must outlive it.
+ */
+class _SC_EXTERN ScTemplateSearchCursor
+{
+  friend class ScTemplate;
+  friend class ScPreparedTemplate;
+
+public:
+  SC_DISALLOW_COPY(ScTemplateSearchCursor);
+
+  _SC_EXTERN ScTemplateSearchCursor(ScTemplateSearchCursor && other) noexcept;
+
+  _SC_EXTERN ScTemplateSearchCursor & operator=(ScTemplateSearchCursor && other) noexcept;
+
+  _SC_EXTERN ~ScTemplateSearchCursor() noexcept;
+
+  /*!
+   * @brief Finds next sc-construction by sc-template.
+   *
+   * @return true if next sc-construction is found, false if there are no more sc-constructions or limit of cursor is
+   * reached.
+   * @throws utils::ExceptionInvalidState if sc-template can't be searched.
+   */
+  _SC_EXTERN bool Next() noexcept(false);
+
+  /*!
+   * @brief Gets the last sc-construction found by `Next`.
+   *
+   * @return A result item of the last found sc-construction.
+   * @throws utils::ExceptionInvalidState if `Next` wasn't called or returned false.
+   */
+  _SC_EXTERN ScTemplateSearchResultItem const & Get() const noexcept(false);
+
+  /*!
+   * @brief Gets the number of sc-constructions found by cursor so far.
+   *
+   * @return The number of found sc-constructions.
+   */
+  [[nodiscard]] _SC_EXTERN size_t Size() const noexcept;
+
+  /*!
+   * @brief Gets the map of template items to replacement item positions.
+   *
+   * @return The map of template items to replacement item positions.
+   */
+  _SC_EXTERN ScTemplate::ScTemplateItemsToReplacementsItemsPositions const & GetReplacements() const noexcept;
+
+protected:
+  std::unique_ptr<ScTemplateSearch> m_search;  ///< Search state, it is released when search is finished.
+  size_t m_limit;                              ///< Maximum number of found sc-constructions, 0 means no limit.
+  size_t m_size;                               ///< Number of found sc-constructions.
+  bool m_hasItem;                              ///< Whether `m_item` keeps the last found sc-construction.
+  ScTemplateSearchResultItem m_item;           ///< The last found sc-construction.
+
+  ScTemplateSearchCursor(
+      ScMemoryContext & context,
+      std::unique_ptr<ScTemplateSearch> search,
+      ScTemplate::ScTemplateItemsToReplacementsItemsPositions const & replacements,
+      size_t limit) noexcept;
+};
@@ -0,0 +1,70 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc-memory/sc_agent_specification.hpp"
+
+#include "sc-memory/sc_memory.hpp"
+
+std::shared_ptr<ScAgentSpecification const> ScAgentSpecificationCache::Get(
+    ScMemoryContext & context,
+    ScAddr const & agentImplementationAddr) const noexcept
+{
+  std::shared_ptr<ScAgentSpecification const> specification;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    specification = m_specification;
+  }
+
+  if (specification == nullptr
+      || CollectConnectors(context, agentImplementationAddr, specification->abstractAgentAddr)
+             != specification->connectorsAddrs)
+    return nullptr;
+
+  return specification;
+}
+
+void ScAgentSpecificationCache::Set(std::shared_ptr<ScAgentSpecification const> const & specification) noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_specification = specification;
+}
+
+std::vector<ScAddr> ScAgentSpecificationCache::CollectConnectors(
+    ScMemoryContext & context,
+    ScAddr const & agentImplementationAddr,
+    ScAddr const & abstractAgentAddr) noexcept
+{
+  std::vector<ScAddr> connectorsAddrs;
+
+  // sc-elements of agent specification are targets of common arcs with relation memberships incoming to these arcs
+  auto const & CollectConnectorsWithIncomingArcs = [&context, &connectorsAddrs](ScIterator3Ptr const & it3)
+  {
+    while (it3->Next())
+    {
+      ScAddr const & connectorAddr = it3->Get(1);
+      connectorsAddrs.push_back(connectorAddr);
+
+      ScIterator3Ptr const relationIt3 = context.CreateIterator3(ScType::Unknown, ScType::Unknown, connectorAddr);
+      while (relationIt3->Next())
+        connectorsAddrs.push_back(relationIt3->Get(1));
+    }
+  };
+
+  try
+  {
+    CollectConnectorsWithIncomingArcs(
+        context.CreateIterator3(ScType::Unknown, ScType::Unknown, agentImplementationAddr));
+    if (abstractAgentAddr.IsValid())
+      CollectConnectorsWithIncomingArcs(context.CreateIterator3(abstractAgentAddr, ScType::Unknown, ScType::Unknown));
+  }
+  catch (utils::ScException const &)
+  {
+    // erased agent implementation or abstract sc-agent is checked by empty list of sc-connectors
+    connectorsAddrs.clear();
+  }
+
+  return connectorsAddrs;
+}
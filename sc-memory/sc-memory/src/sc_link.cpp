@@ -119,11 +119,11 @@ bool ScLink::DetermineTypeArcImpl(ScAddr & outArcAddr, ScAddr & outTypeAddr) con
 
   templ.Triple("_type", ScType::VarTempPosArc >> "_arc", *this);
 
-  ScTemplateSearchResult res;
-  if (m_context->SearchByTemplate(templ, res))
+  ScTemplateSearchCursor cursor = m_context->CreateTemplateSearchCursor(templ, 1);
+  if (cursor.Next())
   {
-    outTypeAddr = res[0]["_type"];
-    outArcAddr = res[0]["_arc"];
+    outTypeAddr = cursor.Get()["_type"];
+    outArcAddr = cursor.Get()["_arc"];
     return true;
   }
 
@@ -12,6 +12,8 @@
 
 #include "sc-memory/utils/sc_logger.hpp"
 
+#include "sc_template_cache.hpp"
+
 extern "C"
 {
 #include <glib.h>
@@ -60,6 +62,7 @@ void _logPrintHandler(sc_char const *, GLogLevelFlags log_level, sc_char const *
 // ------------------
 
 ScMemoryContext * ScMemory::ms_globalContext = nullptr;
+ScTemplateCache * ScMemory::ms_templateCache = nullptr;
 std::string ScMemory::ms_configPath;
 
 bool ScMemory::Initialize(sc_memory_params const & params)
@@ -79,6 +82,8 @@ bool ScMemory::Initialize(sc_memory_params const & params)
 
   ScKeynodes::Initialize(ms_globalContext);
 
+  ms_templateCache = new ScTemplateCache();
+
   ms_globalLogger = utils::ScLogger(
       utils::ScLogger::DefineLogType(params.log_type),
       params.log_file,
@@ -96,6 +101,9 @@ bool ScMemory::Shutdown(bool saveState /* = true */)
 {
   ms_globalLogger = utils::ScLogger();
 
+  delete ms_templateCache;
+  ms_templateCache = nullptr;
+
   ScKeynodes::Shutdown(ms_globalContext);
   bool result = sc_memory_shutdown(saveState);
 
@@ -370,6 +378,40 @@ ScAddr ScMemoryContext::GenerateNode(ScType const & nodeType)
   return nodeAddr;
 }
 
+void ScMemoryContext::GenerateNodesAndLinks(std::vector<ScType> const & types, ScAddrVector & elementsAddrs)
+{
+  CHECK_CONTEXT;
+
+  std::vector<sc_type> elementsTypes;
+  elementsTypes.reserve(types.size());
+  for (ScType const & type : types)
+    elementsTypes.push_back(*type);
+
+  std::vector<sc_addr> addrs(types.size());
+  sc_result const result = sc_memory_nodes_new(m_context, elementsTypes.data(), types.size(), addrs.data());
+
+  elementsAddrs.assign(addrs.cbegin(), addrs.cend());
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_ELEMENT_IS_NOT_NODE:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams,
+        "Specified types must be sc-node or sc-link types. You should provide any of ScType::...Node... value as a "
+        "type.");
+
+  case SC_RESULT_ERROR_FULL_MEMORY:
+    SC_THROW_EXCEPTION(utils::ExceptionCritical, "Not able to create sc-nodes because sc-memory is full.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to create sc-nodes because sc-memory context is not authorized.");
+
+  default:
+    break;
+  }
+}
+
 ScAddr ScMemoryContext::CreateNode(ScType const & nodeType)
 {
   return GenerateNode(nodeType);
@@ -456,6 +498,68 @@ ScAddr ScMemoryContext::GenerateConnector(
   return connectorAddr;
 }
 
+void ScMemoryContext::GenerateConnectors(
+    std::vector<ScType> const & types,
+    ScAddrVector const & sourceElementsAddrs,
+    ScAddrVector const & targetElementsAddrs,
+    ScAddrVector & connectorsAddrs)
+{
+  CHECK_CONTEXT;
+
+  std::vector<sc_type> connectorsTypes;
+  std::vector<sc_addr> sourceAddrs;
+  std::vector<sc_addr> targetAddrs;
+  connectorsTypes.reserve(types.size());
+  sourceAddrs.reserve(types.size());
+  targetAddrs.reserve(types.size());
+  for (size_t i = 0; i < types.size(); ++i)
+  {
+    connectorsTypes.push_back(*types[i]);
+    sourceAddrs.push_back(*sourceElementsAddrs[i]);
+    targetAddrs.push_back(*targetElementsAddrs[i]);
+  }
+
+  std::vector<sc_addr> addrs(types.size());
+  sc_result const result = sc_memory_arcs_new(
+      m_context, connectorsTypes.data(), sourceAddrs.data(), targetAddrs.data(), types.size(), addrs.data());
+
+  connectorsAddrs.assign(addrs.cbegin(), addrs.cend());
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_ADDR_IS_NOT_VALID:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams,
+        "Specified source or target sc-element sc-address is invalid to create sc-connectors.");
+
+  case SC_RESULT_ERROR_ELEMENT_IS_NOT_CONNECTOR:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams,
+        "Specified types must be sc-connector types. You should provide any of ScType::...Arc... or "
+        "ScType::...Edge... value as a type.");
+
+  case SC_RESULT_ERROR_FULL_MEMORY:
+    SC_THROW_EXCEPTION(utils::ExceptionCritical, "Not able to create sc-connectors because sc-memory is full.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to create sc-connectors because sc-memory context is not authorized.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to create sc-connectors because sc-memory context hasn't write permissions.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_PERMISSIONS_TO_WRITE_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to create sc-connectors because sc-memory context hasn't permissions to write permissions.");
+
+  default:
+    break;
+  }
+}
+
 ScAddr ScMemoryContext::CreateEdge(
     ScType const & connectorType,
     ScAddr const & sourceElementAddr,
@@ -730,6 +834,143 @@ bool ScMemoryContext::GetLinkContent(ScAddr const & linkAddr, std::string & outL
          && ScStreamConverter::StreamToString(linkContentStream, outLinkContent);
 }
 
+bool ScMemoryContext::SetLinksContents(
+    ScAddrVector const & linkAddrs,
+    std::vector<std::string> const & linkContents,
+    bool isSearchableString)
+{
+  CHECK_CONTEXT;
+
+  if (linkAddrs.size() != linkContents.size())
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams, "Counts of specified sc-links and contents differ to set contents.");
+
+  std::vector<sc_addr> addrs;
+  std::vector<ScStreamPtr> linkContentStreams;
+  std::vector<sc_stream const *> streams;
+  addrs.reserve(linkAddrs.size());
+  linkContentStreams.reserve(linkContents.size());
+  streams.reserve(linkContents.size());
+  for (size_t i = 0; i < linkAddrs.size(); ++i)
+  {
+    addrs.push_back(*linkAddrs[i]);
+    linkContentStreams.push_back(ScStreamMakeRead(linkContents[i]));
+    streams.push_back(linkContentStreams.back()->m_stream);
+  }
+
+  sc_result const result =
+      sc_memory_set_links_contents_ext(m_context, addrs.data(), streams.data(), addrs.size(), isSearchableString);
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_ADDR_IS_NOT_VALID:
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified sc-link sc-address is invalid to set contents.");
+
+  case SC_RESULT_ERROR_ELEMENT_IS_NOT_LINK:
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified sc-element is not sc-link to set contents.");
+
+  case SC_RESULT_ERROR_STREAM_IO:
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified sc-stream data is invalid to set contents.");
+
+  case SC_RESULT_ERROR_FILE_MEMORY_IO:
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "File memory state is invalid to set contents.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to set contents because sc-memory context is not authorized.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_ERASE_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to set contents because sc-memory context hasn't erase permissions.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to set contents because sc-memory context hasn't write permissions.");
+
+  default:
+    break;
+  }
+
+  return result == SC_RESULT_OK;
+}
+
+bool ScMemoryContext::AppendLinkContent(ScAddr const & linkAddr, ScStreamPtr const & linkContentStream)
+{
+  CHECK_CONTEXT;
+
+  if (!linkContentStream || !linkContentStream->IsValid())
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified stream is invalid to append content.");
+
+  sc_result const result = sc_memory_append_link_content(m_context, *linkAddr, linkContentStream->m_stream);
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_ADDR_IS_NOT_VALID:
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified sc-link sc-address is invalid to append content.");
+
+  case SC_RESULT_ERROR_ELEMENT_IS_NOT_LINK:
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified sc-element is not sc-link to append content.");
+
+  case SC_RESULT_ERROR_STREAM_IO:
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified sc-stream data is invalid to append content.");
+
+  case SC_RESULT_ERROR_FILE_MEMORY_IO:
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "File memory state is invalid to append content.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to append content because sc-memory context is not authorized.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to append content because sc-memory context hasn't write permissions.");
+
+  default:
+    break;
+  }
+
+  return result == SC_RESULT_OK;
+}
+
+ScStreamPtr ScMemoryContext::OpenLinkContentStream(ScAddr const & linkAddr)
+{
+  CHECK_CONTEXT;
+
+  sc_stream * linkContentStream = nullptr;
+  sc_result const result = sc_memory_open_link_content_stream(m_context, *linkAddr, &linkContentStream);
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_ADDR_IS_NOT_VALID:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams, "Specified sc-link sc-address is invalid to open content stream.");
+
+  case SC_RESULT_ERROR_ELEMENT_IS_NOT_LINK:
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified sc-element is not sc-link to open content stream.");
+
+  case SC_RESULT_ERROR_STREAM_IO:
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified sc-link content is too big to open content stream.");
+
+  case SC_RESULT_ERROR_FILE_MEMORY_IO:
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "File memory state is invalid to open content stream.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to open content stream because sc-memory context is not authorized.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to open content stream because sc-memory context hasn't read permissions.");
+
+  default:
+    break;
+  }
+
+  return std::make_shared<ScStream>(linkContentStream);
+}
+
 void _PushLinkAddr(void * _data, sc_addr const link_addr)
 {
   void ** data = ((void **)_data);
@@ -1228,6 +1469,15 @@ void ScMemoryContext::GenerateByTemplate(
   templateToGenerate.Generate(*this, result, params, nullptr);
 }
 
+void ScMemoryContext::GenerateByTemplate(
+    ScTemplate const & templateToGenerate,
+    std::vector<ScTemplateParams> const & paramsList,
+    std::vector<ScTemplateResultItem> & results)
+{
+  CHECK_CONTEXT;
+  templateToGenerate.Generate(*this, paramsList, results);
+}
+
 ScTemplate::Result ScMemoryContext::HelperGenTemplate(
     ScTemplate const & templateToGenerate,
     ScTemplateResultItem & result,
@@ -1321,6 +1571,84 @@ void ScMemoryContext::HelperSmartSearchTemplate(
   SearchByTemplateInterruptibly(templateToFind, callback, checkCallback);
 }
 
+ScTemplate::Result ScMemoryContext::SearchByTemplate(
+    ScPreparedTemplate const & templateToFind,
+    ScTemplateParams const & params,
+    ScTemplateSearchResult & result)
+{
+  CHECK_CONTEXT;
+  return templateToFind.Search(*this, params, result);
+}
+
+void ScMemoryContext::SearchByTemplate(
+    ScPreparedTemplate const & templateToFind,
+    ScTemplateParams const & params,
+    ScTemplateSearchResultCallback const & callback,
+    ScTemplateSearchResultFilterCallback const & filterCallback,
+    ScTemplateSearchResultCheckCallback const & checkCallback)
+{
+  CHECK_CONTEXT;
+  templateToFind.Search(*this, params, callback, filterCallback, checkCallback);
+}
+
+void ScMemoryContext::SearchByTemplateInterruptibly(
+    ScPreparedTemplate const & templateToFind,
+    ScTemplateParams const & params,
+    ScTemplateSearchResultCallbackWithRequest const & callback,
+    ScTemplateSearchResultFilterCallback const & filterCallback,
+    ScTemplateSearchResultCheckCallback const & checkCallback)
+{
+  CHECK_CONTEXT;
+  templateToFind.Search(*this, params, callback, filterCallback, checkCallback);
+}
+
+ScTemplate::Result ScMemoryContext::SearchByTemplateInParallel(
+    ScTemplate const & templateToFind,
+    ScTemplateSearchResult & result,
+    size_t threadsCount)
+{
+  CHECK_CONTEXT;
+  return templateToFind.SearchInParallel(*this, result, threadsCount);
+}
+
+ScTemplate::Result ScMemoryContext::SearchByTemplateInParallel(
+    ScPreparedTemplate const & templateToFind,
+    ScTemplateParams const & params,
+    ScTemplateSearchResult & result,
+    size_t threadsCount)
+{
+  CHECK_CONTEXT;
+  return templateToFind.SearchInParallel(*this, params, result, threadsCount);
+}
+
+ScTemplate::Result ScMemoryContext::SearchByTemplateInStructure(
+    ScTemplate const & templateToFind,
+    ScAddr const & structureAddr,
+    ScTemplateSearchResult & result)
+{
+  CHECK_CONTEXT;
+  if (!IsElement(structureAddr))
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams, "Specified sc-structure sc-address is invalid to search by sc-template in it.");
+
+  return templateToFind.SearchInStructure(*this, structureAddr, result);
+}
+
+ScTemplateSearchCursor ScMemoryContext::CreateTemplateSearchCursor(ScTemplate const & templateToFind, size_t limit)
+{
+  CHECK_CONTEXT;
+  return templateToFind.CreateSearchCursor(*this, limit);
+}
+
+ScTemplateSearchCursor ScMemoryContext::CreateTemplateSearchCursor(
+    ScPreparedTemplate const & templateToFind,
+    ScTemplateParams const & params,
+    size_t limit)
+{
+  CHECK_CONTEXT;
+  return templateToFind.CreateSearchCursor(*this, params, limit);
+}
+
 void ScMemoryContext::BuildTemplate(
     ScTemplate & resultTemplate,
     ScAddr const & translatableTemplateAddr,
@@ -1353,6 +1681,47 @@ ScTemplate::Result ScMemoryContext::HelperBuildTemplate(
   return ScTemplate::Result(true);
 }
 
+std::shared_ptr<ScTemplate const> ScMemoryContext::BuildCachedTemplate(ScAddr const & translatableTemplateAddr)
+{
+  CHECK_CONTEXT;
+  if (ScMemory::ms_templateCache == nullptr)
+  {
+    auto resultTemplate = std::make_shared<ScTemplate>();
+    resultTemplate->TranslateFrom(*this, translatableTemplateAddr);
+    return resultTemplate;
+  }
+
+  return ScMemory::ms_templateCache->GetTemplate(*this, translatableTemplateAddr);
+}
+
+void ScMemoryContext::BuildCachedTemplate(
+    ScTemplate & resultTemplate,
+    ScAddr const & translatableTemplateAddr,
+    ScTemplateParams const & params)
+{
+  CHECK_CONTEXT;
+  if (ScMemory::ms_templateCache == nullptr)
+  {
+    resultTemplate.TranslateFrom(*this, translatableTemplateAddr, params);
+    return;
+  }
+
+  ScMemory::ms_templateCache->BuildTemplate(*this, resultTemplate, translatableTemplateAddr, params);
+}
+
+std::shared_ptr<ScTemplate const> ScMemoryContext::BuildCachedTemplate(std::string const & translatableSCsTemplate)
+{
+  CHECK_CONTEXT;
+  if (ScMemory::ms_templateCache == nullptr)
+  {
+    auto resultTemplate = std::make_shared<ScTemplate>();
+    resultTemplate->TranslateFrom(*this, translatableSCsTemplate);
+    return resultTemplate;
+  }
+
+  return ScMemory::ms_templateCache->GetTemplate(*this, translatableSCsTemplate);
+}
+
 void ScMemoryContext::LoadTemplate(
     ScTemplate & translatableTemplate,
     ScAddr & resultTemplateAddr,
@@ -120,14 +120,16 @@ private:
           ScType::VarPermPosArc,
           ScKeynodes::nrel_scs_global_idtf);
 
-      ScTemplateSearchResult searchResult;
-      if (m_ctx.SearchByTemplate(templ, searchResult))
+      // it is enough to find two sc-elements to check that global identifier is not unique
+      ScTemplateSearchCursor cursor = m_ctx.CreateTemplateSearchCursor(templ, 2);
+      if (cursor.Next())
       {
-        if (result.IsValid() || searchResult.Size() > 1)
+        ScAddr const elementAddr = cursor.Get()["_el"];
+        if (result.IsValid() || cursor.Next())
           SC_THROW_EXCEPTION(
               utils::ExceptionInvalidState, "There are more then 1 element with global identifier: " << idtf);
 
-        result = searchResult[0]["_el"];
+        result = elementAddr;
       }
     }
 
@@ -12,6 +12,8 @@
 
 #include "sc-memory/sc_memory.hpp"
 
+#include "sc_template_cache.hpp"
+
 namespace
 {
 class ObjectInfo
@@ -85,14 +87,14 @@ private:
 class ScTemplateBuilder
 {
   friend class ScTemplate;
+  friend class ScTemplateCache;
   using ConnectorDependenceMap = std::unordered_multimap<ScAddr::HashType, ScAddr::HashType>;
   using ObjectToIdtfMap = std::unordered_map<ScAddr::HashType, ObjectInfo>;
   using ScAddrHashSet = std::set<ScAddr::HashType>;
 
 protected:
-  ScTemplateBuilder(ScAddr const & translatableTemplateAddr, ScMemoryContext & ctx, ScTemplateParams const & params)
-    : m_templateAddr(translatableTemplateAddr)
-    , m_context(ctx)
+  ScTemplateBuilder(ScMemoryContext & ctx, ScTemplateParams const & params)
+    : m_context(ctx)
   {
     auto const & replacements = params.GetAll();
     for (auto const & item : replacements)
@@ -115,34 +117,58 @@ protected:
     }
   }
 
-  void operator()(ScTemplate * inTemplate)
+  static ScTemplateStructureElements CollectStructureElements(
+      ScMemoryContext & ctx,
+      ScAddr const & translatableTemplateAddr)
   {
     // TODO: Add blocking sc-structure
+    ScTemplateStructureElements elements;
+
+    ScIterator3Ptr iter = ctx.CreateIterator3(translatableTemplateAddr, ScType::ConstPermPosArc, ScType::Unknown);
+    while (iter->Next())
+    {
+      ScTemplateStructureElement element;
+      element.m_arcAddr = iter->Get(1);
+      element.m_addr = iter->Get(2);
+      element.m_type = ctx.GetElementType(element.m_addr);
+      if (element.m_type.IsConnector())
+        CollectConnectorIncidentElements(ctx, element);
+
+      elements.push_back(element);
+    }
+
+    return elements;
+  }
+
+  void operator()(ScTemplate * inTemplate, ScTemplateStructureElements const & elements)
+  {
     ScAddrHashSet independentConnectors;
 
     // define connectors set and independent connectors set
-    ScIterator3Ptr iter = m_context.CreateIterator3(m_templateAddr, ScType::ConstPermPosArc, ScType::Unknown);
-    while (iter->Next())
+    for (ScTemplateStructureElement const & element : elements)
     {
-      ScAddr const & objAddr = iter->Get(2);
+      ScAddr const & objAddr = element.m_addr;
 
       auto const & it = m_elements.find(objAddr.Hash());
-      ObjectInfo obj = it == m_elements.cend() ? CollectObjectInfo(objAddr) : it->second;
+      ObjectInfo obj = it == m_elements.cend() ? ObjectInfo(objAddr, element.m_type, std::to_string(objAddr.Hash()))
+                                               : it->second;
 
       if (obj.IsConnector())
       {
-        auto [objSrcAddr, objTrgAddr] = m_context.GetConnectorIncidentElements(objAddr);
-        obj.SetSourceHash(objSrcAddr.Hash());
-        obj.SetTargetHash(objTrgAddr.Hash());
+        // parameter value may be sc-connector while sc-template element is not
+        ScTemplateStructureElement connector = element;
+        if (!connector.m_type.IsConnector())
+          CollectConnectorIncidentElements(m_context, connector);
+
+        obj.SetSourceHash(connector.m_sourceAddr.Hash());
+        obj.SetTargetHash(connector.m_targetAddr.Hash());
 
-        ScType const srcType = m_context.GetElementType(objSrcAddr);
-        ScType const trgType = m_context.GetElementType(objTrgAddr);
-        if (!srcType.IsConnector() && !trgType.IsConnector())
+        if (!connector.m_isSourceConnector && !connector.m_isTargetConnector)
           independentConnectors.insert(obj.GetHash());
-        if (srcType.IsConnector())
-          m_connectorDependenceMap.insert({obj.GetHash(), objSrcAddr.Hash()});
-        if (trgType.IsConnector())
-          m_connectorDependenceMap.insert({obj.GetHash(), objTrgAddr.Hash()});
+        if (connector.m_isSourceConnector)
+          m_connectorDependenceMap.insert({obj.GetHash(), connector.m_sourceAddr.Hash()});
+        if (connector.m_isTargetConnector)
+          m_connectorDependenceMap.insert({obj.GetHash(), connector.m_targetAddr.Hash()});
       }
 
       m_elements.insert({obj.GetHash(), obj});
@@ -174,15 +200,20 @@ protected:
   }
 
 protected:
-  ScAddr m_templateAddr;
   ScMemoryContext & m_context;
-  ScTemplateParams m_params;
 
   // all objects in template
   ObjectToIdtfMap m_elements;
   ConnectorDependenceMap m_connectorDependenceMap;
 
 private:
+  static void CollectConnectorIncidentElements(ScMemoryContext & ctx, ScTemplateStructureElement & connector)
+  {
+    std::tie(connector.m_sourceAddr, connector.m_targetAddr) = ctx.GetConnectorIncidentElements(connector.m_addr);
+    connector.m_isSourceConnector = ctx.GetElementType(connector.m_sourceAddr).IsConnector();
+    connector.m_isTargetConnector = ctx.GetElementType(connector.m_targetAddr).IsConnector();
+  }
+
   ObjectInfo CollectObjectInfo(ScAddr const & objAddr, std::string objIdtf = "") const
   {
     ScType const objType = m_context.GetElementType(objAddr);
@@ -246,6 +277,24 @@ void ScTemplate::TranslateFrom(
     ScAddr const & translatableTemplateAddr,
     ScTemplateParams const & params)
 {
-  ScTemplateBuilder builder(translatableTemplateAddr, ctx, params);
-  builder(this);
+  ScTemplateBuilder builder(ctx, params);
+  builder(this, ScTemplateBuilder::CollectStructureElements(ctx, translatableTemplateAddr));
+}
+
+std::shared_ptr<ScTemplateStructureElements const> ScTemplateCache::CollectStructureElements(
+    ScMemoryContext & ctx,
+    ScAddr const & translatableTemplateAddr)
+{
+  return std::make_shared<ScTemplateStructureElements const>(
+      ScTemplateBuilder::CollectStructureElements(ctx, translatableTemplateAddr));
+}
+
+void ScTemplateCache::TranslateStructureElements(
+    ScMemoryContext & ctx,
+    ScTemplateStructureElements const & elements,
+    ScTemplateParams const & params,
+    ScTemplate & resultTemplate)
+{
+  ScTemplateBuilder builder(ctx, params);
+  builder(&resultTemplate, elements);
 }
@@ -0,0 +1,179 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_template_cache.hpp"
+
+#include "sc-memory/sc_memory.hpp"
+
+#include "sc_template_private.hpp"
+
+ScTemplateCache::ScTemplateCache(uint32_t logCacheSize)
+  : m_structureEntries(logCacheSize)
+  , m_scsEntries(logCacheSize)
+{
+}
+
+std::shared_ptr<ScTemplate const> ScTemplateCache::GetTemplate(
+    ScMemoryContext & context,
+    ScAddr const & translatableTemplateAddr)
+{
+  if (!context.IsElement(translatableTemplateAddr))
+  {
+    auto resultTemplate = std::make_shared<ScTemplate>();
+    resultTemplate->TranslateFrom(context, translatableTemplateAddr);
+    return resultTemplate;
+  }
+
+  return GetStructureEntry(context, translatableTemplateAddr)->m_template;
+}
+
+void ScTemplateCache::BuildTemplate(
+    ScMemoryContext & context,
+    ScTemplate & resultTemplate,
+    ScAddr const & translatableTemplateAddr,
+    ScTemplateParams const & params)
+{
+  if (!resultTemplate.IsEmpty() || !context.IsElement(translatableTemplateAddr))
+  {
+    resultTemplate.TranslateFrom(context, translatableTemplateAddr, params);
+    return;
+  }
+
+  auto const & entry = GetStructureEntry(context, translatableTemplateAddr);
+  if (params.IsEmpty())
+    CopyTemplate(*entry->m_template, resultTemplate);
+  else
+    TranslateStructureElements(context, *entry->m_elements, params, resultTemplate);
+}
+
+std::shared_ptr<ScTemplate const> ScTemplateCache::GetTemplate(
+    ScMemoryContext & context,
+    std::string const & translatableSCsTemplate)
+{
+  std::shared_ptr<SCsEntry const> entry;
+  std::shared_ptr<SCsEntry const> evictedEntry;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    bool found = false;
+    auto & cachedEntry = m_scsEntries.Find(translatableSCsTemplate, found);
+    if (found)
+      entry = cachedEntry;
+    else
+      evictedEntry = std::move(cachedEntry);
+  }
+
+  if (entry != nullptr && IsValid(context, *entry))
+    return entry->m_template;
+
+  auto newEntry = std::make_shared<SCsEntry>();
+  // sc-elements found by system identifiers may change, but the parsed SCs-code is reused
+  newEntry->m_triples = entry != nullptr ? entry->m_triples : ParseSCsTemplate(translatableSCsTemplate);
+  auto resultTemplate = std::make_shared<ScTemplate>();
+  TranslateSCsTriples(context, *newEntry->m_triples, *resultTemplate, newEntry->m_resolvedIdentifiers);
+  newEntry->m_template = resultTemplate;
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    bool found = false;
+    auto & cachedEntry = m_scsEntries.Find(translatableSCsTemplate, found);
+    entry = std::move(cachedEntry);
+    cachedEntry = std::move(newEntry);
+  }
+
+  return resultTemplate;
+}
+
+std::shared_ptr<ScTemplateCache::StructureEntry const> ScTemplateCache::GetStructureEntry(
+    ScMemoryContext & context,
+    ScAddr const & translatableTemplateAddr)
+{
+  std::shared_ptr<StructureEntry const> entry;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    bool found = false;
+    auto & cachedEntry = m_structureEntries.Find(translatableTemplateAddr.Hash(), found);
+    if (found)
+      entry = cachedEntry;
+  }
+
+  if (entry != nullptr && IsValid(context, *entry, translatableTemplateAddr))
+    return entry;
+
+  auto newEntry = GenerateStructureEntry(context, translatableTemplateAddr);
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    bool found = false;
+    m_structureEntries.Find(translatableTemplateAddr.Hash(), found) = newEntry;
+  }
+
+  return newEntry;
+}
+
+std::shared_ptr<ScTemplateCache::StructureEntry const> ScTemplateCache::GenerateStructureEntry(
+    ScMemoryContext & context,
+    ScAddr const & translatableTemplateAddr)
+{
+  auto entry = std::make_shared<StructureEntry>();
+  entry->m_elements = CollectStructureElements(context, translatableTemplateAddr);
+
+  auto resultTemplate = std::make_shared<ScTemplate>();
+  TranslateStructureElements(context, *entry->m_elements, ScTemplateParams(), *resultTemplate);
+  entry->m_template = resultTemplate;
+
+  return entry;
+}
+
+bool ScTemplateCache::IsValid(
+    ScMemoryContext & context,
+    StructureEntry const & entry,
+    ScAddr const & translatableTemplateAddr)
+{
+  // arcs are compared in order of iteration, so the same sc-structure iterated in other order is translated again
+  ScTemplateStructureElements const & elements = *entry.m_elements;
+  size_t index = 0;
+  ScIterator3Ptr const iter =
+      context.CreateIterator3(translatableTemplateAddr, ScType::ConstPermPosArc, ScType::Unknown);
+  while (iter->Next())
+  {
+    if (index == elements.size())
+      return false;
+
+    ScTemplateStructureElement const & element = elements[index++];
+    if (iter->Get(1) != element.m_arcAddr || iter->Get(2) != element.m_addr
+        || context.GetElementType(element.m_addr) != element.m_type)
+      return false;
+  }
+
+  return index == elements.size();
+}
+
+bool ScTemplateCache::IsValid(ScMemoryContext & context, SCsEntry const & entry)
+{
+  for (auto const & [idtf, addr] : entry.m_resolvedIdentifiers)
+  {
+    if (context.SearchElementBySystemIdentifier(idtf) != addr)
+      return false;
+  }
+
+  return true;
+}
+
+void ScTemplateCache::CopyTemplate(ScTemplate const & sourceTemplate, ScTemplate & resultTemplate)
+{
+  resultTemplate.m_templateItemsNamesToReplacementItemsPositions =
+      sourceTemplate.m_templateItemsNamesToReplacementItemsPositions;
+  resultTemplate.m_priorityOrderedTemplateTriples = sourceTemplate.m_priorityOrderedTemplateTriples;
+  resultTemplate.m_templateItemsNamesToReplacementItemsAddrs =
+      sourceTemplate.m_templateItemsNamesToReplacementItemsAddrs;
+  resultTemplate.m_templateItemsNamesToTypes = sourceTemplate.m_templateItemsNamesToTypes;
+
+  resultTemplate.m_templateTriples.reserve(sourceTemplate.m_templateTriples.size());
+  for (ScTemplateTriple const * triple : sourceTemplate.m_templateTriples)
+  {
+    auto const & values = triple->GetValues();
+    resultTemplate.m_templateTriples.push_back(new ScTemplateTriple(values[0], values[1], values[2], triple->m_index));
+  }
+}
@@ -0,0 +1,141 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "sc-memory/sc_template.hpp"
+
+#include "sc-memory/utils/sc_cache.hpp"
+
+class ScMemoryContext;
+
+/*!
+ * @brief Represents an element of sc-structure of sc-template as it was collected from sc-memory.
+ *
+ * Source and target of sc-connector are collected only if the element is sc-connector.
+ */
+struct ScTemplateStructureElement
+{
+  ScAddr m_arcAddr;
+  ScAddr m_addr;
+  ScType m_type;
+  ScAddr m_sourceAddr;
+  ScAddr m_targetAddr;
+  bool m_isSourceConnector = false;
+  bool m_isTargetConnector = false;
+};
+
+using ScTemplateStructureElements = std::vector<ScTemplateStructureElement>;
+
+/*!
+ * @brief Represents an element of parsed SCs-template: its system identifier and sc-type.
+ */
+struct ScTemplateSCsElement
+{
+  std::string m_idtf;
+  ScType m_type;
+};
+
+using ScTemplateSCsTriple = std::array<ScTemplateSCsElement, 3>;
+using ScTemplateSCsTriples = std::vector<ScTemplateSCsTriple>;
+
+//! Map of system identifiers resolved on sc-template translation to sc-addresses found by them.
+using ScTemplateSystemIdentifiers = std::unordered_map<std::string, ScAddr>;
+
+/*!
+ * @brief Memory-wide cache of sc-templates translated from sc-structures and SCs-code.
+ *
+ * sc-templates translated from sc-structures are keyed by sc-address of sc-structure. Each time an entry is requested,
+ * arcs outgoing from sc-structure are iterated again and compared with the cached ones together with sc-types of
+ * sc-elements they are incoming to. If some arc is generated or erased, or some sc-type is changed, sc-template is
+ * translated again. So the entry is never stale, but it saves only translation of sc-structure, not reading it.
+ *
+ * sc-templates translated from SCs-code are keyed by SCs-code. The parsed SCs-code is never invalidated, but
+ * sc-elements found by system identifiers in it are searched again each time an entry is requested. If some of them
+ * has changed, sc-template is translated again from the parsed SCs-code.
+ *
+ * Cached sc-templates are immutable and shared between all callers.
+ */
+class ScTemplateCache
+{
+public:
+  explicit ScTemplateCache(uint32_t logCacheSize = 10);
+
+  std::shared_ptr<ScTemplate const> GetTemplate(ScMemoryContext & context, ScAddr const & translatableTemplateAddr);
+
+  void BuildTemplate(
+      ScMemoryContext & context,
+      ScTemplate & resultTemplate,
+      ScAddr const & translatableTemplateAddr,
+      ScTemplateParams const & params);
+
+  std::shared_ptr<ScTemplate const> GetTemplate(ScMemoryContext & context, std::string const & translatableSCsTemplate);
+
+  //! Collects elements of sc-structure of sc-template. Defined in sc_template_build.cpp.
+  static std::shared_ptr<ScTemplateStructureElements const> CollectStructureElements(
+      ScMemoryContext & context,
+      ScAddr const & translatableTemplateAddr);
+
+  //! Translates collected elements of sc-structure into sc-template. Defined in sc_template_build.cpp.
+  static void TranslateStructureElements(
+      ScMemoryContext & context,
+      ScTemplateStructureElements const & elements,
+      ScTemplateParams const & params,
+      ScTemplate & resultTemplate);
+
+  //! Parses SCs-template into triples. Defined in sc_template_scs.cpp.
+  static std::shared_ptr<ScTemplateSCsTriples const> ParseSCsTemplate(std::string const & translatableSCsTemplate);
+
+  //! Translates parsed triples of SCs-template into sc-template. Defined in sc_template_scs.cpp.
+  static void TranslateSCsTriples(
+      ScMemoryContext & context,
+      ScTemplateSCsTriples const & triples,
+      ScTemplate & resultTemplate,
+      ScTemplateSystemIdentifiers & resolvedIdentifiers);
+
+  //! Copies triples of one sc-template to other empty sc-template.
+  static void CopyTemplate(ScTemplate const & sourceTemplate, ScTemplate & resultTemplate);
+
+private:
+  struct StructureEntry
+  {
+    std::shared_ptr<ScTemplateStructureElements const> m_elements;
+    std::shared_ptr<ScTemplate const> m_template;
+  };
+
+  struct SCsEntry
+  {
+    std::shared_ptr<ScTemplateSCsTriples const> m_triples;
+    ScTemplateSystemIdentifiers m_resolvedIdentifiers;
+    std::shared_ptr<ScTemplate const> m_template;
+  };
+
+  std::mutex m_mutex;
+  utils::Cache<uint64_t, std::shared_ptr<StructureEntry const>> m_structureEntries;
+  utils::Cache<std::string, std::shared_ptr<SCsEntry const>> m_scsEntries;
+
+  std::shared_ptr<StructureEntry const> GetStructureEntry(
+      ScMemoryContext & context,
+      ScAddr const & translatableTemplateAddr);
+
+  static std::shared_ptr<StructureEntry const> GenerateStructureEntry(
+      ScMemoryContext & context,
+      ScAddr const & translatableTemplateAddr);
+
+  static bool IsValid(
+      ScMemoryContext & context,
+      StructureEntry const & entry,
+      ScAddr const & translatableTemplateAddr);
+
+  static bool IsValid(ScMemoryContext & context, SCsEntry const & entry);
+};
@@ -6,6 +6,9 @@
 
 #include "sc-memory/sc_template.hpp"
 
+#include <limits>
+#include <unordered_map>
+
 #include "sc_template_private.hpp"
 #include "sc-memory/sc_memory.hpp"
 
@@ -21,7 +24,7 @@ public:
       ScMemoryContext & context)
     : m_replacements(replacements)
     , m_triples(triples)
-    , m_params(params)
+    , m_params(&params)
     , m_context(context)
   {
   }
@@ -33,12 +36,103 @@ public:
 
     PreCheckTemplateAndParams();
 
-    result = ScTemplateResultItem{&m_context, m_replacements};
-    result.m_replacementConstruction.resize(m_triples.size() * 3);
+    std::vector<ScTemplateGenItemValue> values;
+    if (!PlanConstruction(values))
+      return GenerateSequentially(result);
 
-    ScAddrVector generatedElements;
-    size_t resultIdx = 0;
+    GeneratePlannedElements();
+    FillConstruction(values, result);
+
+    return ScTemplateResultCode::Success;
+  }
+
+  /*!
+   * Generates sc-constructions by sc-template for each of the given parameters. New sc-elements of all
+   * sc-constructions are planned before generation, so they are generated by batches of sc-memory.
+   */
+  ScTemplateResultCode operator()(
+      std::vector<ScTemplateParams> const & paramsList,
+      std::vector<ScTemplateGenResult> & results)
+  {
+    ScMemoryContextEventsPendingGuard guard(m_context);
+
+    std::vector<std::vector<ScTemplateGenItemValue>> constructionsValues(paramsList.size());
+    bool isPlanned = true;
+    for (size_t i = 0; i < paramsList.size() && isPlanned; ++i)
+    {
+      m_params = &paramsList[i];
+      PreCheckTemplateAndParams();
+      isPlanned = PlanConstruction(constructionsValues[i]);
+    }
+
+    results.resize(paramsList.size());
+    if (!isPlanned)
+    {
+      m_plannedElements.clear();
+      for (size_t i = 0; i < paramsList.size(); ++i)
+      {
+        m_params = &paramsList[i];
+        PreCheckTemplateAndParams();
+        GenerateSequentially(results[i]);
+      }
+      return ScTemplateResultCode::Success;
+    }
+
+    GeneratePlannedElements();
+    for (size_t i = 0; i < paramsList.size(); ++i)
+      FillConstruction(constructionsValues[i], results[i]);
+
+    return ScTemplateResultCode::Success;
+  }
+
+  void CleanupCreatedElements()
+  {
+    for (auto & m_generatedElement : m_generatedElements)
+      m_context.EraseElement(m_generatedElement);
+    m_generatedElements.clear();
+  }
+
+private:
+  static constexpr size_t NO_PLANNED_ELEMENT = std::numeric_limits<size_t>::max();
+
+  //! Value of item of sc-construction: sc-address of existing sc-element or index of planned sc-element
+  struct ScTemplateGenItemValue
+  {
+    ScAddr m_addr;
+    size_t m_plannedElementIdx = NO_PLANNED_ELEMENT;
+
+    bool IsValid() const
+    {
+      return m_addr.IsValid() || IsPlanned();
+    }
+
+    bool IsPlanned() const
+    {
+      return m_plannedElementIdx != NO_PLANNED_ELEMENT;
+    }
+  };
+
+  //! Sc-element that will be generated, sc-connectors have values of their source and target
+  struct ScTemplatePlannedElement
+  {
+    ScType m_type;
+    bool m_isConnector;
+    ScTemplateGenItemValue m_sourceValue;
+    ScTemplateGenItemValue m_targetValue;
+    ScAddr m_addr;
+  };
+
+  /*!
+   * Resolves items of sc-construction triple by triple as `GenerateSequentially` does, but instead of generating new
+   * sc-elements it plans them. Checks of sc-template are the same, so if some check fails, then nothing is generated.
+   * @returns false if some sc-connector item is specified by sc-connector planned in the same sc-construction, such
+   * sc-constructions are generated sequentially.
+   */
+  bool PlanConstruction(std::vector<ScTemplateGenItemValue> & values)
+  {
+    values.assign(m_triples.size() * 3, ScTemplateGenItemValue{});
 
+    size_t valueIdx = 0;
     for (auto const & triple : m_triples)
     {
       auto const & items = triple->GetValues();
@@ -46,43 +140,238 @@ public:
       ScTemplateItem const & connectorItem = items[1];
       ScTemplateItem const & targetItem = items[2];
 
-      if (sourceItem.IsType() && sourceItem.m_typeValue.IsUnknown())
-        SC_THROW_EXCEPTION(
-            utils::ExceptionInvalidParams,
-            "You can't generate sc-element with unknown sc-type as the first item of triple "
-                << sourceItem.GetPrettyName() << ".");
+      ScTemplateGenItemValue sourceValue, connectorValue, targetValue;
+      ResolveTripleValues(
+          *triple,
+          [this, &values](ScTemplateItem const & item)
+          {
+            return TryFindElementValue(item, values);
+          },
+          sourceValue,
+          connectorValue,
+          targetValue);
+
+      if (connectorValue.IsPlanned())
+        return false;
+
+      if (connectorValue.IsValid())
+      {
+        CheckIncidenceBetweenConnectorAndIncidentElements(
+            connectorItem, connectorValue.m_addr, sourceItem, targetItem);
 
-      ScAddr sourceAddr = TryFindElementReplacement(sourceItem, result.m_replacementConstruction);
-      if (sourceItem.IsType() && sourceItem.m_typeValue.IsConnector() && !sourceAddr.IsValid())
-        SC_THROW_EXCEPTION(
-            utils::ExceptionInvalidParams,
-            "You can't generate sc-connector as the first item of triple "
-                << (sourceItem.HasName() ? sourceItem.GetPrettyName() + " " : "")
-                << "without specifying source and target "
-                   "sc-elements of this sc-connector.");
+        auto [firstIncidentElementAddr, secondIncidentElementAddr] =
+            m_context.GetConnectorIncidentElements(connectorValue.m_addr);
+        sourceValue = {firstIncidentElementAddr};
+        targetValue = {secondIncidentElementAddr};
+      }
 
-      if (targetItem.IsType() && targetItem.m_typeValue.IsUnknown())
-        SC_THROW_EXCEPTION(
-            utils::ExceptionInvalidParams,
-            "You can't generate sc-element with unknown sc-type as the third item of triple "
-                << targetItem.GetPrettyName() << ".");
+      if (!sourceValue.IsValid())
+        sourceValue = PlanElement({sourceItem.m_typeValue.UpConstType(), false});
+      if (!targetValue.IsValid())
+        targetValue = PlanElement({targetItem.m_typeValue.UpConstType(), false});
 
-      ScAddr targetAddr = TryFindElementReplacement(targetItem, result.m_replacementConstruction);
-      if (targetItem.IsType() && targetItem.m_typeValue.IsConnector() && !targetAddr.IsValid())
-        SC_THROW_EXCEPTION(
-            utils::ExceptionInvalidParams,
-            "You can't generate sc-connector as the third item of triple "
-                << (targetItem.HasName() ? targetItem.GetPrettyName() + " " : "")
-                << "without specifying source and target "
-                   "sc-elements of this sc-connector.");
+      if (!connectorValue.IsValid())
+        connectorValue = PlanElement({connectorItem.m_typeValue.UpConstType(), true, sourceValue, targetValue});
 
-      if (connectorItem.IsType() && connectorItem.m_typeValue.IsUnknown())
-        SC_THROW_EXCEPTION(
-            utils::ExceptionInvalidParams,
-            "You can't generate sc-element with unknown sc-type as the second item of triple "
-                << connectorItem.GetPrettyName() << ".");
+      values[valueIdx++] = sourceValue;
+      values[valueIdx++] = connectorValue;
+      values[valueIdx++] = targetValue;
+    }
+
+    return true;
+  }
+
+  /*!
+   * Finds values of items of sc-template triple and checks that items without values can be generated. It is shared
+   * by planning and sequential generation of sc-constructions, so both of them check sc-template the same way.
+   * @param triple A sc-template triple to resolve items of.
+   * @param FindValue A function that finds value of sc-template item or returns invalid value.
+   * @throws utils::ExceptionInvalidParams if some item without value has unknown sc-type or is sc-connector specified
+   * as source or target of triple.
+   */
+  template <typename TValue, typename TFindValue>
+  static void ResolveTripleValues(
+      ScTemplateTriple const & triple,
+      TFindValue const & FindValue,
+      TValue & sourceValue,
+      TValue & connectorValue,
+      TValue & targetValue)
+  {
+    auto const & items = triple.GetValues();
+    ScTemplateItem const & sourceItem = items[0];
+    ScTemplateItem const & connectorItem = items[1];
+    ScTemplateItem const & targetItem = items[2];
+
+    if (sourceItem.IsType() && sourceItem.m_typeValue.IsUnknown())
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidParams,
+          "You can't generate sc-element with unknown sc-type as the first item of triple "
+              << sourceItem.GetPrettyName() << ".");
+
+    sourceValue = FindValue(sourceItem);
+    if (sourceItem.IsType() && sourceItem.m_typeValue.IsConnector() && !sourceValue.IsValid())
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidParams,
+          "You can't generate sc-connector as the first item of triple "
+              << (sourceItem.HasName() ? sourceItem.GetPrettyName() + " " : "")
+              << "without specifying source and target "
+                 "sc-elements of this sc-connector.");
+
+    if (targetItem.IsType() && targetItem.m_typeValue.IsUnknown())
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidParams,
+          "You can't generate sc-element with unknown sc-type as the third item of triple "
+              << targetItem.GetPrettyName() << ".");
+
+    targetValue = FindValue(targetItem);
+    if (targetItem.IsType() && targetItem.m_typeValue.IsConnector() && !targetValue.IsValid())
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidParams,
+          "You can't generate sc-connector as the third item of triple "
+              << (targetItem.HasName() ? targetItem.GetPrettyName() + " " : "")
+              << "without specifying source and target "
+                 "sc-elements of this sc-connector.");
+
+    if (connectorItem.IsType() && connectorItem.m_typeValue.IsUnknown())
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidParams,
+          "You can't generate sc-element with unknown sc-type as the second item of triple "
+              << connectorItem.GetPrettyName() << ".");
+
+    connectorValue = FindValue(connectorItem);
+  }
+
+  ScTemplateGenItemValue PlanElement(ScTemplatePlannedElement const & element)
+  {
+    m_plannedElements.push_back(element);
+    return {ScAddr::Empty, m_plannedElements.size() - 1};
+  }
+
+  ScAddr const & ResolveValue(ScTemplateGenItemValue const & value) const
+  {
+    return value.IsPlanned() ? m_plannedElements[value.m_plannedElementIdx].m_addr : value.m_addr;
+  }
+
+  /*!
+   * Generates all planned sc-nodes and sc-links by one batch, then generates planned sc-connectors by batches: each
+   * batch contains all sc-connectors, which source and target are generated before it. Usually there is one batch of
+   * sc-connectors and one more batch for each level of sc-connectors incident to generated sc-connectors.
+   */
+  void GeneratePlannedElements()
+  {
+    std::vector<ScType> types;
+    std::vector<size_t> plannedElementsIndices;
+    for (size_t i = 0; i < m_plannedElements.size(); ++i)
+    {
+      if (m_plannedElements[i].m_isConnector)
+        continue;
+
+      types.push_back(m_plannedElements[i].m_type);
+      plannedElementsIndices.push_back(i);
+    }
+
+    ScAddrVector addrs;
+    if (!types.empty())
+    {
+      m_context.GenerateNodesAndLinks(types, addrs);
+      for (size_t i = 0; i < addrs.size(); ++i)
+      {
+        m_plannedElements[plannedElementsIndices[i]].m_addr = addrs[i];
+        m_generatedElements.push_back(addrs[i]);
+      }
+    }
+
+    std::vector<size_t> connectorsIndices;
+    for (size_t i = 0; i < m_plannedElements.size(); ++i)
+    {
+      if (m_plannedElements[i].m_isConnector)
+        connectorsIndices.push_back(i);
+    }
+
+    ScAddrVector sourcesAddrs;
+    ScAddrVector targetsAddrs;
+    while (!connectorsIndices.empty())
+    {
+      types.clear();
+      sourcesAddrs.clear();
+      targetsAddrs.clear();
+      plannedElementsIndices.clear();
+
+      std::vector<size_t> nextConnectorsIndices;
+      for (size_t const idx : connectorsIndices)
+      {
+        ScTemplatePlannedElement const & connector = m_plannedElements[idx];
+        ScAddr const & sourceAddr = ResolveValue(connector.m_sourceValue);
+        ScAddr const & targetAddr = ResolveValue(connector.m_targetValue);
+        if (!sourceAddr.IsValid() || !targetAddr.IsValid())
+        {
+          nextConnectorsIndices.push_back(idx);
+          continue;
+        }
+
+        types.push_back(connector.m_type);
+        sourcesAddrs.push_back(sourceAddr);
+        targetsAddrs.push_back(targetAddr);
+        plannedElementsIndices.push_back(idx);
+      }
+
+      try
+      {
+        m_context.GenerateConnectors(types, sourcesAddrs, targetsAddrs, addrs);
+      }
+      catch (utils::ScException const &)
+      {
+        for (ScAddr const & addr : addrs)
+        {
+          if (addr.IsValid())
+            m_generatedElements.push_back(addr);
+        }
+        throw;
+      }
+
+      for (size_t i = 0; i < addrs.size(); ++i)
+      {
+        m_plannedElements[plannedElementsIndices[i]].m_addr = addrs[i];
+        m_generatedElements.push_back(addrs[i]);
+      }
+      connectorsIndices = std::move(nextConnectorsIndices);
+    }
+  }
+
+  void FillConstruction(std::vector<ScTemplateGenItemValue> const & values, ScTemplateGenResult & result) const
+  {
+    result = ScTemplateResultItem{&m_context, m_replacements};
+    result.m_replacementConstruction.resize(values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+      result.m_replacementConstruction[i] = ResolveValue(values[i]);
+  }
+
+  //! Generates sc-construction triple by triple, it is used if sc-construction can't be planned before generation
+  ScTemplateResultCode GenerateSequentially(ScTemplateGenResult & result)
+  {
+    result = ScTemplateResultItem{&m_context, m_replacements};
+    result.m_replacementConstruction.resize(m_triples.size() * 3);
+
+    size_t resultIdx = 0;
+
+    for (auto const & triple : m_triples)
+    {
+      auto const & items = triple->GetValues();
+      ScTemplateItem const & sourceItem = items[0];
+      ScTemplateItem const & connectorItem = items[1];
+      ScTemplateItem const & targetItem = items[2];
+
+      ScAddr sourceAddr, connectorAddr, targetAddr;
+      ResolveTripleValues(
+          *triple,
+          [this, &result](ScTemplateItem const & item)
+          {
+            return TryFindElementReplacement(item, result.m_replacementConstruction);
+          },
+          sourceAddr,
+          connectorAddr,
+          targetAddr);
 
-      ScAddr connectorAddr = TryFindElementReplacement(connectorItem, result.m_replacementConstruction);
       if (connectorAddr.IsValid())
         CheckIncidenceBetweenConnectorAndIncidentElements(connectorItem, connectorAddr, sourceItem, targetItem);
 
@@ -110,14 +399,6 @@ public:
     return ScTemplateResultCode::Success;
   }
 
-  void CleanupCreatedElements()
-  {
-    for (auto & m_generatedElement : m_generatedElements)
-      m_context.EraseElement(m_generatedElement);
-    m_generatedElements.clear();
-  }
-
-private:
   ScAddr GenerateNodeOrLink(ScType const & type)
   {
     ScAddr addr;
@@ -142,7 +423,7 @@ private:
   [[nodiscard]] ScAddr GetAddrFromParams(ScTemplateItem const & itemValue) const
   {
     ScAddr result;
-    if (m_params.Get(itemValue.m_name, result))
+    if (m_params->Get(itemValue.m_name, result))
       return result;
 
     std::stringstream stream(itemValue.m_name);
@@ -151,12 +432,20 @@ private:
     if (stream.fail() || !stream.eof())
       return ScAddr::Empty;
 
-    ScAddr const & varAddr = ScAddr(hash);
-    if (!varAddr.IsValid() || !m_context.IsElement(varAddr))
-      return ScAddr::Empty;
+    // system identifiers of sc-elements are the same for all parameters of generated sc-constructions, so they are
+    // found once, searching system identifier of sc-element with many outgoing sc-arcs is not cheap
+    auto it = m_itemsSystemIdentifiers.find(itemValue.m_name);
+    if (it == m_itemsSystemIdentifiers.cend())
+    {
+      ScAddr const & varAddr = ScAddr(hash);
+      std::string name;
+      if (varAddr.IsValid() && m_context.IsElement(varAddr))
+        name = m_context.GetElementSystemIdentifier(varAddr);
+      it = m_itemsSystemIdentifiers.emplace(itemValue.m_name, name).first;
+    }
 
-    std::string const & name = m_context.GetElementSystemIdentifier(varAddr);
-    m_params.Get(name, result);
+    if (!it->second.empty())
+      m_params->Get(it->second, result);
 
     return result;
   }
@@ -164,7 +453,7 @@ private:
   [[nodiscard]] ScAddr TryFindElementReplacement(ScTemplateItem const & item, ScAddrVector const & resultAddrs) const
   {
     // replace by value from params
-    if (!m_params.IsEmpty() && item.HasName())
+    if (!m_params->IsEmpty() && item.HasName())
     {
       ScAddr const & addr = GetAddrFromParams(item);
       if (addr.IsValid())
@@ -184,6 +473,32 @@ private:
     return ScAddr::Empty;
   }
 
+  //! Finds value of item as `TryFindElementReplacement` does, but item can be replaced by planned sc-element
+  [[nodiscard]] ScTemplateGenItemValue TryFindElementValue(
+      ScTemplateItem const & item,
+      std::vector<ScTemplateGenItemValue> const & values) const
+  {
+    // replace by value from params
+    if (!m_params->IsEmpty() && item.HasName())
+    {
+      ScAddr const & addr = GetAddrFromParams(item);
+      if (addr.IsValid())
+        return {addr};
+    }
+
+    if (item.IsAddr())
+      return {item.m_addrValue};
+
+    if (item.IsReplacement())
+    {
+      auto it = m_replacements.find(item.m_name);
+      if (it != m_replacements.cend())
+        return values[it->second];
+    }
+
+    return {};
+  }
+
   void CheckIncidenceBetweenConnectorAndIncidentElements(
       ScTemplateItem const & connectorItem,
       ScAddr const & connectorAddr,
@@ -206,8 +521,8 @@ private:
 
     if (sourceItem.HasName())
     {
-      auto const & itemIt = m_params.m_templateItemsToParams.find(sourceItem.m_name);
-      if (itemIt != m_params.m_templateItemsToParams.cend() && itemIt->second != foundSourceAddr)
+      auto const & itemIt = m_params->m_templateItemsToParams.find(sourceItem.m_name);
+      if (itemIt != m_params->m_templateItemsToParams.cend() && itemIt->second != foundSourceAddr)
         SC_THROW_EXCEPTION(
             utils::ExceptionInvalidParams,
             "Specified sc-connector `"
@@ -232,8 +547,8 @@ private:
 
     if (targetItem.HasName())
     {
-      auto const & itemIt = m_params.m_templateItemsToParams.find(targetItem.m_name);
-      if (itemIt != m_params.m_templateItemsToParams.cend() && itemIt->second != foundTargetAddr)
+      auto const & itemIt = m_params->m_templateItemsToParams.find(targetItem.m_name);
+      if (itemIt != m_params->m_templateItemsToParams.cend() && itemIt->second != foundTargetAddr)
         SC_THROW_EXCEPTION(
             utils::ExceptionInvalidParams,
             "Specified sc-connector `" << std::to_string(connectorAddr.Hash())
@@ -299,7 +614,7 @@ private:
                              << "` and up-constant template item type can't be extended to template parameter type.");
     };
 
-    for (auto const & item : m_params.m_templateItemsToParams)
+    for (auto const & item : m_params->m_templateItemsToParams)
     {
       std::string const & templateParamReplacementName = item.first;
 
@@ -330,9 +645,11 @@ private:
 
   ScTemplate::ScTemplateItemsToReplacementsItemsPositions const & m_replacements;
   ScTemplate::ScTemplateTriplesVector const & m_triples;
-  ScTemplateParams const & m_params;
+  ScTemplateParams const * m_params;
   ScMemoryContext & m_context;
   ScAddrList m_generatedElements;
+  std::vector<ScTemplatePlannedElement> m_plannedElements;
+  mutable std::unordered_map<std::string, std::string> m_itemsSystemIdentifiers;
 };
 
 ScTemplate::Result ScTemplate::Generate(
@@ -359,3 +676,24 @@ ScTemplate::Result ScTemplate::Generate(
 
   return ScTemplate::Result(true);
 }
+
+ScTemplate::Result ScTemplate::Generate(
+    ScMemoryContext & ctx,
+    std::vector<ScTemplateParams> const & paramsList,
+    std::vector<ScTemplateGenResult> & results) const
+{
+  ScTemplateGenerator gen(
+      m_templateItemsNamesToReplacementItemsPositions, m_templateTriples, ScTemplateParams::Empty, ctx);
+
+  try
+  {
+    gen(paramsList, results);
+  }
+  catch (utils::ExceptionInvalidParams const & exception)
+  {
+    gen.CleanupCreatedElements();
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, exception.Message());
+  }
+
+  return ScTemplate::Result(true);
+}
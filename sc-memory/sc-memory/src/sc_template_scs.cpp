@@ -10,35 +10,71 @@
 
 #include "sc-memory/scs/scs_parser.hpp"
 
-#include "sc-memory/utils/sc_keynode_cache.hpp"
+#include "sc_template_cache.hpp"
 
 class ScTemplateBuilderFromScs
 {
+  friend class ScTemplateCache;
+
 public:
   ScTemplateBuilderFromScs(std::string const & translatableSCsTemplate, ScMemoryContext & ctx)
     : m_translatableSCsTemplate(translatableSCsTemplate)
     , m_ctx(ctx)
-    , m_parser()
   {
   }
 
   void operator()(ScTemplate * templ)
   {
-    if (!m_parser.Parse(m_translatableSCsTemplate))
-      SC_THROW_EXCEPTION(utils::ExceptionParseError, m_parser.GetParseError());
-
-    BuildImpl(templ);
+    ScTemplateSystemIdentifiers resolvedIdentifiers;
+    BuildImpl(m_ctx, Parse(m_translatableSCsTemplate), templ, resolvedIdentifiers);
   }
 
 protected:
-  void BuildImpl(ScTemplate * templ) const
+  static ScTemplateSCsTriples Parse(std::string const & translatableSCsTemplate)
+  {
+    scs::Parser parser;
+    if (!parser.Parse(translatableSCsTemplate))
+      SC_THROW_EXCEPTION(utils::ExceptionParseError, parser.GetParseError());
+
+    ScTemplateSCsTriples triples;
+    parser.ForEachTripleForGeneration(
+        [&triples](
+            scs::ParsedElement const & source,
+            scs::ParsedElement const & connector,
+            scs::ParsedElement const & target) -> void
+        {
+          triples.push_back(
+              {ScTemplateSCsElement{source.GetIdtf(), source.GetType()},
+               ScTemplateSCsElement{connector.GetIdtf(), connector.GetType()},
+               ScTemplateSCsElement{target.GetIdtf(), target.GetType()}});
+        });
+
+    return triples;
+  }
+
+  static void BuildImpl(
+      ScMemoryContext & ctx,
+      ScTemplateSCsTriples const & triples,
+      ScTemplate * templ,
+      ScTemplateSystemIdentifiers & resolvedIdentifiers)
   {
-    utils::ScKeynodeCache keynodes(m_ctx);
     std::unordered_set<std::string> passed;
 
-    auto const MakeTemplItem = [&passed, &keynodes](scs::ParsedElement const & el, ScTemplateItem & outValue) -> void
+    // all found and not found sc-elements are remembered to check cached sc-template by them
+    auto const ResolveKeynode = [&ctx, &resolvedIdentifiers](std::string const & idtf) -> ScAddr
+    {
+      auto const it = resolvedIdentifiers.find(idtf);
+      if (it != resolvedIdentifiers.cend())
+        return it->second;
+
+      ScAddr const addr = ctx.ResolveElementSystemIdentifier(idtf);
+      resolvedIdentifiers.insert({idtf, addr});
+      return addr;
+    };
+
+    auto const MakeTemplItem = [&passed, &ResolveKeynode](ScTemplateSCsElement const & el, ScTemplateItem & outValue)
     {
-      std::string const & idtf = el.GetIdtf();
+      std::string const & idtf = el.m_idtf;
       bool const isUnnamed = scs::TypeResolver::IsUnnamed(idtf);
       bool const isPassed = passed.find(idtf) != passed.cend();
 
@@ -47,11 +83,11 @@ protected:
       else
       {
         sc_char const * alias = isUnnamed ? nullptr : idtf.c_str();
-        ScAddr const addr = keynodes.GetKeynode(idtf);
+        ScAddr const addr = ResolveKeynode(idtf);
         if (addr.IsValid())
           outValue.SetAddr(addr, alias);
-        else if (el.GetType().IsVar())
-          outValue.SetType(el.GetType(), alias);
+        else if (el.m_type.IsVar())
+          outValue.SetType(el.m_type, alias);
         else
           SC_THROW_EXCEPTION(
               utils::ExceptionInvalidState,
@@ -61,26 +97,21 @@ protected:
       passed.insert(idtf);
     };
 
-    m_parser.ForEachTripleForGeneration(
-        [&](scs::ParsedElement const & source,
-            scs::ParsedElement const & connector,
-            scs::ParsedElement const & target) -> void
-        {
-          ScTemplateItem sourceItem, connectorItem, targetItem;
+    for (auto const & [source, connector, target] : triples)
+    {
+      ScTemplateItem sourceItem, connectorItem, targetItem;
 
-          MakeTemplItem(source, sourceItem);
-          MakeTemplItem(connector, connectorItem);
-          MakeTemplItem(target, targetItem);
+      MakeTemplItem(source, sourceItem);
+      MakeTemplItem(connector, connectorItem);
+      MakeTemplItem(target, targetItem);
 
-          templ->Triple(sourceItem, connectorItem, targetItem);
-        });
+      templ->Triple(sourceItem, connectorItem, targetItem);
+    }
   }
 
 private:
   std::string const & m_translatableSCsTemplate;
   ScMemoryContext & m_ctx;
-
-  scs::Parser m_parser;
 };
 
 void ScTemplate::TranslateFrom(ScMemoryContext & ctx, std::string const & translatableSCsTemplate)
@@ -88,3 +119,18 @@ void ScTemplate::TranslateFrom(ScMemoryContext & ctx, std::string const & transl
   ScTemplateBuilderFromScs builder(translatableSCsTemplate, ctx);
   builder(this);
 }
+
+std::shared_ptr<ScTemplateSCsTriples const> ScTemplateCache::ParseSCsTemplate(
+    std::string const & translatableSCsTemplate)
+{
+  return std::make_shared<ScTemplateSCsTriples const>(ScTemplateBuilderFromScs::Parse(translatableSCsTemplate));
+}
+
+void ScTemplateCache::TranslateSCsTriples(
+    ScMemoryContext & ctx,
+    ScTemplateSCsTriples const & triples,
+    ScTemplate & resultTemplate,
+    ScTemplateSystemIdentifiers & resolvedIdentifiers)
+{
+  ScTemplateBuilderFromScs::BuildImpl(ctx, triples, &resultTemplate, resolvedIdentifiers);
+}
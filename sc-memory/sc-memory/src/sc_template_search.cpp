@@ -7,23 +7,375 @@
 #include "sc-memory/sc_template.hpp"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <exception>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <tuple>
 
 #include "sc_template_private.hpp"
 #include "sc-memory/sc_memory.hpp"
 
+/*!
+ * Set of indices of sc-template triples stored as bitset. Sets of indices less than 128 are stored inline, so copying
+ * them doesn't allocate memory.
+ */
+class ScTemplateTriplesBitset
+{
+public:
+  static constexpr size_t NOT_FOUND = std::numeric_limits<size_t>::max();
+
+  class Iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = size_t const *;
+    using reference = size_t;
+
+    Iterator() = default;
+
+    Iterator(ScTemplateTriplesBitset const * bitset, size_t const idx)
+      : m_bitset(bitset)
+      , m_idx(idx)
+    {
+    }
+
+    size_t operator*() const
+    {
+      return m_idx;
+    }
+
+    Iterator & operator++()
+    {
+      m_idx = m_bitset->FindNext(m_idx + 1);
+      return *this;
+    }
+
+    Iterator operator++(int)
+    {
+      Iterator it = *this;
+      ++*this;
+      return it;
+    }
+
+    bool operator==(Iterator const & other) const
+    {
+      return m_idx == other.m_idx;
+    }
+
+    bool operator!=(Iterator const & other) const
+    {
+      return m_idx != other.m_idx;
+    }
+
+  private:
+    ScTemplateTriplesBitset const * m_bitset = nullptr;
+    size_t m_idx = NOT_FOUND;
+  };
+
+  using const_iterator = Iterator;
+
+  ScTemplateTriplesBitset() = default;
+
+  ScTemplateTriplesBitset(std::initializer_list<size_t> const & indices)
+  {
+    for (size_t const idx : indices)
+      Insert(idx);
+  }
+
+  bool Has(size_t const idx) const
+  {
+    size_t const wordIdx = idx / WORD_BITS;
+    return wordIdx < GetWordsCount() && (GetWord(wordIdx) & GetMask(idx)) != 0;
+  }
+
+  void Insert(size_t const idx)
+  {
+    size_t const wordIdx = idx / WORD_BITS;
+    if (wordIdx >= GetWordsCount())
+      m_extraWords.resize(wordIdx + 1 - INLINE_WORDS_COUNT, 0);
+
+    uint64_t & word = GetWord(wordIdx);
+    if ((word & GetMask(idx)) == 0)
+    {
+      word |= GetMask(idx);
+      ++m_size;
+    }
+  }
+
+  void Erase(size_t const idx)
+  {
+    if (!Has(idx))
+      return;
+
+    GetWord(idx / WORD_BITS) &= ~GetMask(idx);
+    --m_size;
+  }
+
+  void Clear()
+  {
+    m_inlineWords.fill(0);
+    std::fill(m_extraWords.begin(), m_extraWords.end(), 0);
+    m_size = 0;
+  }
+
+  size_t Size() const
+  {
+    return m_size;
+  }
+
+  bool IsEmpty() const
+  {
+    return m_size == 0;
+  }
+
+  //! Returns the least index in set that is not less than `idx`, or NOT_FOUND
+  size_t FindNext(size_t const idx) const
+  {
+    for (size_t wordIdx = idx / WORD_BITS; wordIdx < GetWordsCount(); ++wordIdx)
+    {
+      uint64_t word = GetWord(wordIdx);
+      if (wordIdx == idx / WORD_BITS)
+        word &= ~(uint64_t)0 << (idx % WORD_BITS);
+
+      if (word != 0)
+        return wordIdx * WORD_BITS + __builtin_ctzll(word);
+    }
+
+    return NOT_FOUND;
+  }
+
+  Iterator begin() const
+  {
+    return {this, FindNext(0)};
+  }
+
+  Iterator end() const
+  {
+    return {this, NOT_FOUND};
+  }
+
+  Iterator cbegin() const
+  {
+    return begin();
+  }
+
+  Iterator cend() const
+  {
+    return end();
+  }
+
+private:
+  static constexpr size_t WORD_BITS = 64;
+  static constexpr size_t INLINE_WORDS_COUNT = 2;
+
+  std::array<uint64_t, INLINE_WORDS_COUNT> m_inlineWords{};
+  std::vector<uint64_t> m_extraWords;
+  size_t m_size = 0;
+
+  static uint64_t GetMask(size_t const idx)
+  {
+    return (uint64_t)1 << (idx % WORD_BITS);
+  }
+
+  size_t GetWordsCount() const
+  {
+    return INLINE_WORDS_COUNT + m_extraWords.size();
+  }
+
+  uint64_t GetWord(size_t const wordIdx) const
+  {
+    return wordIdx < INLINE_WORDS_COUNT ? m_inlineWords[wordIdx] : m_extraWords[wordIdx - INLINE_WORDS_COUNT];
+  }
+
+  uint64_t & GetWord(size_t const wordIdx)
+  {
+    return wordIdx < INLINE_WORDS_COUNT ? m_inlineWords[wordIdx] : m_extraWords[wordIdx - INLINE_WORDS_COUNT];
+  }
+};
+
+/*!
+ * Set of sc-addresses stored as bitset keyed by `SC_ADDR_LOCAL_TO_INT`. Bits of sc-addresses of each segment are
+ * allocated on insertion of the first sc-address of this segment, so checking sc-address in set is a bit probe.
+ */
+class ScAddrsBitset
+{
+public:
+  bool Has(ScAddr const & addr) const
+  {
+    ScAddr::HashType const hash = ScAddrHashFunc()(addr);
+    size_t const segmentIdx = hash >> SEGMENT_BITS;
+    if (segmentIdx >= m_segmentsWords.size() || !m_segmentsWords[segmentIdx])
+      return false;
+
+    size_t const offset = hash & SEGMENT_MASK;
+    return (m_segmentsWords[segmentIdx][offset / WORD_BITS] & GetMask(offset)) != 0;
+  }
+
+  void Insert(ScAddr const & addr)
+  {
+    ScAddr::HashType const hash = ScAddrHashFunc()(addr);
+    size_t const segmentIdx = hash >> SEGMENT_BITS;
+    if (segmentIdx >= m_segmentsWords.size())
+      m_segmentsWords.resize(segmentIdx + 1);
+
+    std::unique_ptr<uint64_t[]> & words = m_segmentsWords[segmentIdx];
+    if (!words)
+      words = std::make_unique<uint64_t[]>(SEGMENT_WORDS_COUNT);
+
+    size_t const offset = hash & SEGMENT_MASK;
+    words[offset / WORD_BITS] |= GetMask(offset);
+  }
+
+private:
+  static constexpr size_t WORD_BITS = 64;
+  static constexpr size_t SEGMENT_BITS = 16;
+  static constexpr size_t SEGMENT_MASK = (1u << SEGMENT_BITS) - 1;
+  static constexpr size_t SEGMENT_WORDS_COUNT = (SEGMENT_MASK + 1) / WORD_BITS;
+
+  std::vector<std::unique_ptr<uint64_t[]>> m_segmentsWords;
+
+  static uint64_t GetMask(size_t const offset)
+  {
+    return (uint64_t)1 << (offset % WORD_BITS);
+  }
+};
+
+//! Step of sc-template search plan
+struct ScTemplateSearchPlanStep
+{
+  size_t m_tripleIdx;       ///< Index of triple in sc-template.
+  bool m_isCheck;           ///< True, if source and target of triple are found before this step.
+  size_t m_estimatedCount;  ///< Estimated count of sc-constructions found by triple at this step.
+  std::string m_pattern;    ///< Fixed (F) and searchable (A) items of triple at this step.
+  size_t m_symmetricGroupFirstStep = 0;  ///< First step of consecutive steps with symmetric triples.
+  size_t m_symmetricGroupLastStep = 0;   ///< Last step of consecutive steps with symmetric triples.
+  size_t m_intersectionGroupFirstStep = 0;  ///< First step of consecutive steps with triples finding the same item.
+  size_t m_intersectionGroupLastStep = 0;   ///< Last step of consecutive steps with triples finding the same item.
+  size_t m_intersectedItemIdx = 0;          ///< Index in triple of item found by steps of intersection group.
+};
+
+/*!
+ * Prepared data of sc-template used by searches by it. It isn't changed by searches.
+ *
+ * Items of sc-template are addressed by their positions: position of item is `3 * triple index + item index in
+ * triple`. Named items are compiled to slots: items with the same name have the same slot, so searches compare and
+ * resolve items by integers instead of their names.
+ */
+struct ScTemplateSearchPlan
+{
+  using ScTemplateTriples = ScTemplateTriplesBitset;
+
+  static constexpr size_t NO_SLOT = std::numeric_limits<size_t>::max();
+
+  // sc-template items that are specified by parameters on each search and their values used for estimations
+  ScTemplateParams::ScTemplateItemsToParams m_paramsAddrs;
+
+  std::unordered_map<std::string, size_t> m_itemsNamesToSlots;
+  std::vector<ScAddr> m_slotsAddrs;
+  ScTemplate::ScTemplateItemsToReplacementsItemsPositions m_itemsNamesToReplacementItemsPositions;
+  std::vector<size_t> m_itemsSlots;
+  std::vector<ScAddr> m_itemsAddrs;
+  std::vector<ScType> m_itemsTypes;
+  std::vector<ScTemplateTriples> m_itemsDependedTemplateTriples;
+  std::vector<ScTemplateTriples> m_equalTemplateTriples;
+  std::vector<size_t> m_symmetricTemplateTriplesGroups;
+
+  std::vector<ScTemplate::ScTemplateTripleType> m_templateTriplesPriorities;
+  ScTemplateTriples m_cycledTemplateTriples;
+  std::vector<ScTemplateTriples> m_connectivityComponentsTemplateTriples;
+
+  std::vector<ScTemplateSearchPlanStep> m_steps;
+  std::vector<size_t> m_templateTriplesPlanPositions;
+  bool m_hasNotSearchableConnectivityComponent = false;
+};
+
+//! Level of search stack: iterator of sc-construction triples for triple of search plan step and undo log of its slots
+struct ScTemplateSearchLevel
+{
+  ScIterator3Ptr m_iterator;
+  std::array<size_t, 3> m_boundSlots;
+  size_t m_boundSlotsCount = 0;
+  // sorted sc-construction triples for steps of symmetric triples and index of the next one for this level
+  std::vector<ScAddrTriple> m_candidates;
+  size_t m_nextCandidateIdx = 0;
+  // sc-construction triples for triple of this level grouped by item found by intersection group, they are collected
+  // on opening of the first level of group, and ones of them with the item found at the first level
+  ScAddrToValueUnorderedMap<std::vector<ScAddrTriple>> m_intersectedTriples;
+  bool m_hasIntersectedTriples = false;
+  std::vector<ScAddrTriple> const * m_intersectedCandidates = nullptr;
+};
+
+enum class ScTemplateSearchIterationsState : uint8_t
+{
+  NotStarted,
+  Started,
+  Finished
+};
+
+//! Sc-memory context of a thread of search in parallel, it has the same user as sc-memory context of search.
+class ScTemplateSearchThreadContext : public ScMemoryContext
+{
+public:
+  explicit ScTemplateSearchThreadContext(ScAddr const & userAddr)
+    : ScMemoryContext(userAddr)
+  {
+  }
+};
+
 class ScTemplateSearch
 {
 public:
-  ScTemplateSearch(ScTemplate & templ, ScMemoryContext & context, ScAddr const & structure)
+  ScTemplateSearch(
+      ScTemplate & templ,
+      ScMemoryContext & context,
+      ScAddr const & structure,
+      ScTemplateParams::ScTemplateItemsToParams const & paramsAddrs = {})
     : m_template(templ)
     , m_context(context)
+    , m_plan(std::make_shared<ScTemplateSearchPlan>())
     , m_structure(structure)
   {
+    m_plan->m_paramsAddrs = paramsAddrs;
     PrepareSearch();
   }
 
-  using ScTemplateTriples = ScTemplate::ScTemplateGroupedTriples;
-  using ScReplacementTriple = ScAddrTriple;
+  ScTemplateSearch(
+      ScTemplate & templ,
+      ScMemoryContext & context,
+      ScAddr const & structure,
+      std::shared_ptr<ScTemplateSearchPlan> const & plan)
+    : m_template(templ)
+    , m_context(context)
+    , m_plan(plan)
+    , m_structure(structure)
+  {
+  }
+
+  using ScTemplateTriples = ScTemplateTriplesBitset;
+
+  std::shared_ptr<ScTemplateSearchPlan> const & GetPlan() const
+  {
+    return m_plan;
+  }
+
+  //! Sets values of sc-template parameters specified on preparation of search plan
+  void SetParams(ScTemplateParams::ScTemplateItemsToParams const & paramsAddrs)
+  {
+    m_slotsParamsAddrs.assign(m_plan->m_itemsNamesToSlots.size(), ScAddr::Empty);
+    for (auto const & [name, addr] : paramsAddrs)
+    {
+      auto const & it = m_plan->m_itemsNamesToSlots.find(name);
+      if (it != m_plan->m_itemsNamesToSlots.cend())
+        m_slotsParamsAddrs[it->second] = addr;
+    }
+  }
 
   void SetCallbackWithRequest(ScTemplateSearchResultCallbackWithRequest const & callback)
   {
@@ -46,81 +398,210 @@ public:
   }
 
 private:
+  static constexpr size_t NO_SLOT = ScTemplateSearchPlan::NO_SLOT;
+  static constexpr size_t NO_INTERSECTED_ITEM = std::numeric_limits<size_t>::max();
+
   /*!
    * Prepares input sc-template to minimize search
    */
   void PrepareSearch()
   {
-    if (m_template.Size() == 1)
-      return;
+    CompileItems();
+
+    m_plan->m_templateTriplesPriorities.reserve(m_template.Size());
+    for (ScTemplateTriple const * triple : m_template.m_templateTriples)
+      m_plan->m_templateTriplesPriorities.push_back(GetTriplePriority(triple));
 
-    SetUpDependenciesBetweenTriples();
-    RemoveCycledDependenciesBetweenTriples();
-    FindConnectivityComponents();
-    FindTriplesWithMostMinimalArcsForFirstItem();
+    if (m_template.Size() > 1)
+    {
+      SetUpDependenciesBetweenTriples();
+      RemoveCycledDependenciesBetweenTriples();
+      FindConnectivityComponents();
+    }
+    BuildSearchPlan();
+  }
+
+  ScTemplateItem const & GetItem(size_t const itemPosition) const
+  {
+    return (*m_template.m_templateTriples[itemPosition / 3])[itemPosition % 3];
   }
 
   /*!
-   * Find all dependencies between triples. Compares replacement name of each item of the triple
-   * with replacement name of each item of the other triple, and if they are equal, then adds
-   * dependencies between them.
-   * @note All triple items that have valid address must have replacement names to set up dependencies with them.
+   * Compiles items of sc-template: assigns slots to named items, resolves sc-addresses and sc-types of items and finds
+   * triples with equal items.
    */
-  void SetUpDependenciesBetweenTriples()
+  void CompileItems()
   {
-    auto const & AddDependenceFromTripleItemToOtherTriple =
-        [this](ScTemplateTriple const * triple, ScTemplateItem const & tripleItem, ScTemplateTriple const * otherTriple)
+    size_t const itemsCount = m_template.Size() * 3;
+    m_plan->m_itemsSlots.assign(itemsCount, NO_SLOT);
+    m_plan->m_itemsAddrs.assign(itemsCount, ScAddr::Empty);
+    m_plan->m_itemsTypes.assign(itemsCount, ScType::Unknown);
+    m_plan->m_itemsDependedTemplateTriples.assign(itemsCount, {});
+    m_plan->m_itemsNamesToReplacementItemsPositions = m_template.m_templateItemsNamesToReplacementItemsPositions;
+
+    for (size_t itemPosition = 0; itemPosition < itemsCount; ++itemPosition)
+    {
+      ScTemplateItem const & item = GetItem(itemPosition);
+
+      ScType type = item.m_typeValue;
+      if (item.HasName())
+      {
+        auto const & slotIt = m_plan->m_itemsNamesToSlots.emplace(item.m_name, m_plan->m_itemsNamesToSlots.size());
+        m_plan->m_itemsSlots[itemPosition] = slotIt.first->second;
+        m_plan->m_itemsNamesToReplacementItemsPositions.emplace(item.m_name, itemPosition);
+
+        auto const & typeIt = m_template.m_templateItemsNamesToTypes.find(item.m_name);
+        if (typeIt != m_template.m_templateItemsNamesToTypes.cend())
+          type = typeIt->second;
+      }
+      m_plan->m_itemsTypes[itemPosition] = type.HasConstancyFlag() ? type.UpConstType() : type;
+
+      if (item.IsAddr())
+        m_plan->m_itemsAddrs[itemPosition] = item.m_addrValue;
+      else if (item.IsReplacement())
+      {
+        auto const & addrIt = m_template.m_templateItemsNamesToReplacementItemsAddrs.find(item.m_name);
+        if (addrIt != m_template.m_templateItemsNamesToReplacementItemsAddrs.cend())
+          m_plan->m_itemsAddrs[itemPosition] = addrIt->second;
+      }
+    }
+
+    // named items with fixed sc-addresses are found before search
+    m_plan->m_slotsAddrs.assign(m_plan->m_itemsNamesToSlots.size(), ScAddr::Empty);
+    for (size_t itemPosition = 0; itemPosition < itemsCount; ++itemPosition)
     {
-      std::string const & key = GetKey(triple, tripleItem);
+      size_t const itemSlot = m_plan->m_itemsSlots[itemPosition];
+      if (itemSlot == NO_SLOT)
+        continue;
 
-      auto const & found = m_templateItemsNamesToDependedTemplateTriples.find(key);
-      if (found == m_templateItemsNamesToDependedTemplateTriples.cend())
-        m_templateItemsNamesToDependedTemplateTriples.insert({key, {otherTriple->m_index}});
+      ScTemplateItem const & item = GetItem(itemPosition);
+      if (item.IsAddr())
+        m_plan->m_slotsAddrs[itemSlot] = item.m_addrValue;
       else
-        found->second.insert(otherTriple->m_index);
-    };
+      {
+        auto const & addrIt = m_template.m_templateItemsNamesToReplacementItemsAddrs.find(item.m_name);
+        if (addrIt != m_template.m_templateItemsNamesToReplacementItemsAddrs.cend())
+          m_plan->m_slotsAddrs[itemSlot] = addrIt->second;
+      }
+    }
+
+    FindSymmetricTriples();
 
-    auto const & TryAddDependenceBetweenTriples = [&AddDependenceFromTripleItemToOtherTriple](
-                                                      ScTemplateTriple const * triple,
-                                                      ScTemplateItem const & tripleItem,
-                                                      ScTemplateTriple const * otherTriple,
-                                                      ScTemplateItem const & otherTripleItem1,
-                                                      ScTemplateItem const & otherTripleItem2,
-                                                      ScTemplateItem const & otherTripleItem3)
+    m_plan->m_equalTemplateTriples.assign(m_template.Size(), {});
+    for (ScTemplateTriple const * triple : m_template.m_templateTriples)
     {
-      // don't set up dependency with self
-      if (triple->m_index == otherTriple->m_index)
-        return;
+      for (ScTemplateTriple const * otherTriple : m_template.m_templateTriples)
+      {
+        if (triple->m_index == otherTriple->m_index || IsTriplesItemsEqual(triple, otherTriple))
+          m_plan->m_equalTemplateTriples[triple->m_index].Insert(otherTriple->m_index);
+      }
+    }
+  }
 
-      // don't set up dependency if item of triple has empty replacement name
-      if (tripleItem.m_name.empty())
-        return;
+  /*!
+   * Finds groups of symmetric triples. Triples are symmetric if they have the same source and target items and their
+   * sc-connectors items have the same sc-type and are not used in other triples. Exchanging sc-connectors of symmetric
+   * triples gives the same sc-construction, so search finds sc-connectors of them in ascending order only.
+   */
+  void FindSymmetricTriples()
+  {
+    std::vector<size_t> slotsOccurrencesCounts(m_plan->m_itemsNamesToSlots.size(), 0);
+    for (size_t const itemSlot : m_plan->m_itemsSlots)
+    {
+      if (itemSlot != NO_SLOT)
+        ++slotsOccurrencesCounts[itemSlot];
+    }
+
+    auto const & IsItemsSame = [this](size_t const itemPosition, size_t const otherItemPosition) -> bool
+    {
+      size_t const itemSlot = m_plan->m_itemsSlots[itemPosition];
+      if (itemSlot != NO_SLOT)
+        return itemSlot == m_plan->m_itemsSlots[otherItemPosition];
 
-      // check triple item name with other triple items names and dependencies
-      tripleItem.m_name == otherTripleItem1.m_name
-          ? AddDependenceFromTripleItemToOtherTriple(triple, tripleItem, otherTriple)
-          : (tripleItem.m_name == otherTripleItem2.m_name
-                 ? AddDependenceFromTripleItemToOtherTriple(triple, tripleItem, otherTriple)
-                 : (tripleItem.m_name == otherTripleItem3.m_name
-                        ? AddDependenceFromTripleItemToOtherTriple(triple, tripleItem, otherTriple)
-                        : (void)(null_ptr)));
+      return GetItem(itemPosition).IsAddr() && GetItem(otherItemPosition).IsAddr()
+             && m_plan->m_itemsAddrs[itemPosition] == m_plan->m_itemsAddrs[otherItemPosition];
     };
 
-    for (ScTemplateTriple const * triple : m_template.m_templateTriples)
+    auto const & IsConnectorItemPrivate = [this, &slotsOccurrencesCounts](size_t const itemPosition) -> bool
     {
-      ScTemplateItem const & item1 = (*triple)[0];
-      ScTemplateItem const & item2 = (*triple)[1];
-      ScTemplateItem const & item3 = (*triple)[2];
+      ScTemplateItem const & item = GetItem(itemPosition);
+      if (item.IsAddr() || IsItemParam(item) || m_plan->m_itemsAddrs[itemPosition].IsValid())
+        return false;
 
-      for (ScTemplateTriple const * otherTriple : m_template.m_templateTriples)
+      size_t const itemSlot = m_plan->m_itemsSlots[itemPosition];
+      return itemSlot == NO_SLOT
+             || (slotsOccurrencesCounts[itemSlot] == 1 && !m_plan->m_slotsAddrs[itemSlot].IsValid());
+    };
+
+    m_plan->m_symmetricTemplateTriplesGroups.resize(m_template.Size());
+    for (size_t tripleIdx = 0; tripleIdx < m_template.Size(); ++tripleIdx)
+    {
+      m_plan->m_symmetricTemplateTriplesGroups[tripleIdx] = tripleIdx;
+      if (!IsConnectorItemPrivate(tripleIdx * 3 + 1))
+        continue;
+
+      for (size_t otherTripleIdx = 0; otherTripleIdx < tripleIdx; ++otherTripleIdx)
+      {
+        if (m_plan->m_symmetricTemplateTriplesGroups[otherTripleIdx] == otherTripleIdx
+            && IsConnectorItemPrivate(otherTripleIdx * 3 + 1) && IsItemsSame(tripleIdx * 3, otherTripleIdx * 3)
+            && IsItemsSame(tripleIdx * 3 + 2, otherTripleIdx * 3 + 2)
+            && m_plan->m_itemsTypes[tripleIdx * 3 + 1] == m_plan->m_itemsTypes[otherTripleIdx * 3 + 1])
+        {
+          m_plan->m_symmetricTemplateTriplesGroups[tripleIdx] = otherTripleIdx;
+          break;
+        }
+      }
+    }
+  }
+
+  /*!
+   * Returns position of the first item of triple that has the same slot as item with specified position. Depended
+   * triples of items with the same name in one triple are stored by this position.
+   */
+  size_t GetDependenceItemPosition(size_t const itemPosition) const
+  {
+    size_t const firstItemPosition = itemPosition / 3 * 3;
+    for (size_t position = firstItemPosition; position < itemPosition; ++position)
+    {
+      if (m_plan->m_itemsSlots[position] == m_plan->m_itemsSlots[itemPosition])
+        return position;
+    }
+    return itemPosition;
+  }
+
+  ScTemplateTriples const & GetDependedTriples(size_t const itemPosition) const
+  {
+    static ScTemplateTriples const emptyTriples;
+    if (m_plan->m_itemsSlots[itemPosition] == NO_SLOT)
+      return emptyTriples;
+
+    return m_plan->m_itemsDependedTemplateTriples[GetDependenceItemPosition(itemPosition)];
+  }
+
+  /*!
+   * Find all dependencies between triples. Compares slot of each item of the triple with slot of each item of the
+   * other triple, and if they are equal, then adds dependencies between them.
+   * @note All triple items that have valid address must have replacement names to set up dependencies with them.
+   */
+  void SetUpDependenciesBetweenTriples()
+  {
+    for (size_t itemPosition = 0; itemPosition < m_plan->m_itemsSlots.size(); ++itemPosition)
+    {
+      size_t const slot = m_plan->m_itemsSlots[itemPosition];
+      // don't set up dependency if item of triple has empty replacement name
+      if (slot == NO_SLOT)
+        continue;
+
+      size_t const tripleIdx = itemPosition / 3;
+      for (size_t otherItemPosition = 0; otherItemPosition < m_plan->m_itemsSlots.size(); ++otherItemPosition)
       {
-        ScTemplateItem const & otherItem1 = (*otherTriple)[0];
-        ScTemplateItem const & otherItem2 = (*otherTriple)[1];
-        ScTemplateItem const & otherItem3 = (*otherTriple)[2];
+        // don't set up dependency with self
+        size_t const otherTripleIdx = otherItemPosition / 3;
+        if (tripleIdx == otherTripleIdx)
+          continue;
 
-        TryAddDependenceBetweenTriples(triple, item1, otherTriple, otherItem1, otherItem2, otherItem3);
-        TryAddDependenceBetweenTriples(triple, item2, otherTriple, otherItem1, otherItem2, otherItem3);
-        TryAddDependenceBetweenTriples(triple, item3, otherTriple, otherItem1, otherItem2, otherItem3);
+        if (m_plan->m_itemsSlots[otherItemPosition] == slot)
+          m_plan->m_itemsDependedTemplateTriples[GetDependenceItemPosition(itemPosition)].Insert(otherTripleIdx);
       }
     }
   };
@@ -136,29 +617,22 @@ private:
       return found != m_template.m_templateItemsNamesToTypes.cend() && found->second == ScType::VarNodeStructure;
     };
 
-    auto const & faeTriples =
-        m_template.m_priorityOrderedTemplateTriples[(size_t)ScTemplate::ScTemplateTripleType::FAE];
     auto const & CheckIfItemIsFixedAndOtherConnectorItemIsConnector =
-        [&faeTriples](size_t const tripleIdx, ScTemplateItem const & item) -> bool
+        [this](size_t const tripleIdx, ScTemplateItem const & item) -> bool
     {
-      return item.IsAddr() && faeTriples.find(tripleIdx) != faeTriples.cend();
+      return (item.IsAddr() || IsItemParam(item))
+             && m_plan->m_templateTriplesPriorities[tripleIdx] == ScTemplate::ScTemplateTripleType::FAE;
     };
 
-    auto const & UpdateCycledTriples = [this](ScTemplateTriple const * triple, ScTemplateItem const & item)
+    auto const & UpdateCycledTriples = [this](size_t const tripleIdx)
     {
-      std::string const & key = GetKey(triple, item);
-
-      auto const & dependedTriples = m_templateItemsNamesToDependedTemplateTriples.find(key);
-      if (dependedTriples != m_templateItemsNamesToDependedTemplateTriples.cend())
+      for (size_t const dependedTripleIdx : GetDependedTriples(tripleIdx * 3))
       {
-        for (size_t const dependedTripleIdx : dependedTriples->second)
-        {
-          if (IsTriplesEqual(triple, m_template.m_templateTriples[dependedTripleIdx]))
-            m_cycledTemplateTriples.insert(dependedTripleIdx);
-        }
+        if (IsTriplesEqual(tripleIdx, dependedTripleIdx))
+          m_plan->m_cycledTemplateTriples.Insert(dependedTripleIdx);
       }
 
-      m_cycledTemplateTriples.insert(triple->m_index);
+      m_plan->m_cycledTemplateTriples.Insert(tripleIdx);
     };
 
     // save all triples that form cycles
@@ -167,41 +641,35 @@ private:
       ScTemplateItem const & item1 = (*triple)[0];
 
       bool isFound = false;
-      if (m_cycledTemplateTriples.find(triple->m_index) == m_cycledTemplateTriples.cend()
+      if (!m_plan->m_cycledTemplateTriples.Has(triple->m_index)
           && (CheckIfItemIsNodeVarStruct(item1)
               || CheckIfItemIsFixedAndOtherConnectorItemIsConnector(triple->m_index, item1)))
       {
         ScTemplateTriples checkedTriples;
-        FindCycleWithFAATriple(item1, triple, triple, checkedTriples, isFound);
+        FindCycleWithFAATriple(triple->m_index * 3, triple->m_index, checkedTriples, isFound);
       }
 
       if (isFound)
       {
-        UpdateCycledTriples(triple, item1);
+        UpdateCycledTriples(triple->m_index);
       }
     }
 
     // remove dependencies with all triples that form cycles
-    for (size_t const idx : m_cycledTemplateTriples)
+    for (size_t const idx : m_plan->m_cycledTemplateTriples)
     {
-      ScTemplateTriple * triple = m_template.m_templateTriples[idx];
-      std::string const & key = GetKey(triple, (*triple)[0]);
+      if (m_plan->m_itemsSlots[idx * 3] == NO_SLOT)
+        continue;
 
-      auto const & found = m_templateItemsNamesToDependedTemplateTriples.find(key);
-      if (found != m_templateItemsNamesToDependedTemplateTriples.cend())
-      {
-        for (size_t const otherIdx : m_cycledTemplateTriples)
-        {
-          found->second.erase(otherIdx);
-        }
-      }
+      ScTemplateTriples & dependedTriples = m_plan->m_itemsDependedTemplateTriples[idx * 3];
+      for (size_t const otherIdx : m_plan->m_cycledTemplateTriples)
+        dependedTriples.Erase(otherIdx);
     }
   };
 
   void FindCycleWithFAATriple(
-      ScTemplateItem const & templateItem,
-      ScTemplateTriple const * templateTriple,
-      ScTemplateTriple const * templateTripleToFind,
+      size_t const itemPosition,
+      size_t const tripleToFindIdx,
       ScTemplateTriples checkedTemplateTriples,
       bool & isFound)
   {
@@ -209,32 +677,29 @@ private:
     if (isFound)
       return;
 
-    auto const & FindCycleWithFAATripleByTripleItem = [this, &templateTripleToFind, &checkedTemplateTriples](
-                                                          ScTemplateItem const & item,
-                                                          ScTemplateTriple const * triple,
-                                                          ScTemplateItem const & previousItem,
-                                                          bool & isFound)
+    auto const & FindCycleWithFAATripleByTripleItem =
+        [this, &tripleToFindIdx, &checkedTemplateTriples](
+            size_t const otherItemPosition, size_t const previousItemPosition, bool & isFound)
     {
+      ScTemplateItem const & item = GetItem(otherItemPosition);
+      ScTemplateItem const & previousItem = GetItem(previousItemPosition);
+
       // no iterate back by the same item name
-      if (!item.m_name.empty() && item.m_name == previousItem.m_name)
+      if (m_plan->m_itemsSlots[otherItemPosition] != NO_SLOT
+          && m_plan->m_itemsSlots[otherItemPosition] == m_plan->m_itemsSlots[previousItemPosition])
         return;
 
       // no iterate back by the same item address
       if (item.m_addrValue.IsValid() && item.m_addrValue == previousItem.m_addrValue)
         return;
 
-      FindCycleWithFAATriple(item, triple, templateTripleToFind, checkedTemplateTriples, isFound);
+      FindCycleWithFAATriple(otherItemPosition, tripleToFindIdx, checkedTemplateTriples, isFound);
     };
 
-    ScTemplateTriples nextTemplateTriples;
-    FindDependedTriple(templateItem, templateTriple, nextTemplateTriples);
-
-    for (size_t const otherTemplateTripleIdx : nextTemplateTriples)
+    for (size_t const otherTemplateTripleIdx : GetDependedTriples(itemPosition))
     {
-      ScTemplateTriple const * otherTriple = m_template.m_templateTriples[otherTemplateTripleIdx];
-
-      if ((otherTemplateTripleIdx == templateTripleToFind->m_index
-           && templateItem.m_name != (*templateTripleToFind)[0].m_name)
+      if ((otherTemplateTripleIdx == tripleToFindIdx
+           && m_plan->m_itemsSlots[itemPosition] != m_plan->m_itemsSlots[tripleToFindIdx * 3])
           || isFound)
       {
         isFound = true;
@@ -242,16 +707,16 @@ private:
       }
 
       // check if triple was passed in branch of sc-template
-      if (checkedTemplateTriples.find(otherTemplateTripleIdx) != checkedTemplateTriples.cend())
+      if (checkedTemplateTriples.Has(otherTemplateTripleIdx))
         continue;
 
       // iterate by all triple items
       {
-        checkedTemplateTriples.insert(otherTemplateTripleIdx);
+        checkedTemplateTriples.Insert(otherTemplateTripleIdx);
 
-        FindCycleWithFAATripleByTripleItem((*otherTriple)[0], otherTriple, templateItem, isFound);
-        FindCycleWithFAATripleByTripleItem((*otherTriple)[1], otherTriple, templateItem, isFound);
-        FindCycleWithFAATripleByTripleItem((*otherTriple)[2], otherTriple, templateItem, isFound);
+        FindCycleWithFAATripleByTripleItem(otherTemplateTripleIdx * 3, itemPosition, isFound);
+        FindCycleWithFAATripleByTripleItem(otherTemplateTripleIdx * 3 + 1, itemPosition, isFound);
+        FindCycleWithFAATripleByTripleItem(otherTemplateTripleIdx * 3 + 2, itemPosition, isFound);
       }
     }
   }
@@ -263,227 +728,508 @@ private:
     for (ScTemplateTriple const * triple : m_template.m_templateTriples)
     {
       ScTemplateTriples connectivityComponentTriples;
-      FindConnectivityComponent(triple, checkedTriples, connectivityComponentTriples);
+      FindConnectivityComponent(triple->m_index, checkedTriples, connectivityComponentTriples);
 
-      m_connectivityComponentsTemplateTriples.push_back(connectivityComponentTriples);
+      m_plan->m_connectivityComponentsTemplateTriples.push_back(connectivityComponentTriples);
     }
   }
 
   void FindConnectivityComponent(
-      ScTemplateTriple const * templateTriple,
+      size_t const tripleIdx,
       ScTemplateTriples & checkedTemplateTriples,
       ScTemplateTriples & connectivityComponentTemplateTriples)
   {
     // check if triple was passed in branch of sc-template
-    if (checkedTemplateTriples.find(templateTriple->m_index) != checkedTemplateTriples.cend())
+    if (checkedTemplateTriples.Has(tripleIdx))
       return;
 
-    connectivityComponentTemplateTriples.insert(templateTriple->m_index);
+    connectivityComponentTemplateTriples.Insert(tripleIdx);
 
-    FindConnectivityComponentByItem(
-        (*templateTriple)[0], templateTriple, checkedTemplateTriples, connectivityComponentTemplateTriples);
-    FindConnectivityComponentByItem(
-        (*templateTriple)[1], templateTriple, checkedTemplateTriples, connectivityComponentTemplateTriples);
-    FindConnectivityComponentByItem(
-        (*templateTriple)[2], templateTriple, checkedTemplateTriples, connectivityComponentTemplateTriples);
+    FindConnectivityComponentByItem(tripleIdx * 3, checkedTemplateTriples, connectivityComponentTemplateTriples);
+    FindConnectivityComponentByItem(tripleIdx * 3 + 1, checkedTemplateTriples, connectivityComponentTemplateTriples);
+    FindConnectivityComponentByItem(tripleIdx * 3 + 2, checkedTemplateTriples, connectivityComponentTemplateTriples);
   }
 
   void FindConnectivityComponentByItem(
-      ScTemplateItem const & templateItem,
-      ScTemplateTriple const * templateTriple,
+      size_t const itemPosition,
       ScTemplateTriples & checkedTemplateTriples,
       ScTemplateTriples & connectivityComponentTemplateTriples)
   {
-    ScTemplateTriples nextTriples;
-    FindDependedTriple(templateItem, templateTriple, nextTriples);
-
-    for (size_t const otherTripleIdx : nextTriples)
+    for (size_t const otherTripleIdx : GetDependedTriples(itemPosition))
     {
       // check if triple was passed in branch of sc-template
-      if (checkedTemplateTriples.find(otherTripleIdx) != checkedTemplateTriples.cend())
+      if (checkedTemplateTriples.Has(otherTripleIdx))
         continue;
 
       // iterate by all triple items
       {
-        checkedTemplateTriples.insert(otherTripleIdx);
-        connectivityComponentTemplateTriples.insert(otherTripleIdx);
-
-        ScTemplateTriple const * otherTriple = m_template.m_templateTriples[otherTripleIdx];
+        checkedTemplateTriples.Insert(otherTripleIdx);
+        connectivityComponentTemplateTriples.Insert(otherTripleIdx);
 
         FindConnectivityComponentByItem(
-            (*otherTriple)[0], otherTriple, checkedTemplateTriples, connectivityComponentTemplateTriples);
+            otherTripleIdx * 3, checkedTemplateTriples, connectivityComponentTemplateTriples);
         FindConnectivityComponentByItem(
-            (*otherTriple)[1], otherTriple, checkedTemplateTriples, connectivityComponentTemplateTriples);
+            otherTripleIdx * 3 + 1, checkedTemplateTriples, connectivityComponentTemplateTriples);
         FindConnectivityComponentByItem(
-            (*otherTriple)[2], otherTriple, checkedTemplateTriples, connectivityComponentTemplateTriples);
+            otherTripleIdx * 3 + 2, checkedTemplateTriples, connectivityComponentTemplateTriples);
       }
     }
   }
 
   /*!
-   * Finds all connectivity component triples among all triples that have the fixed first item, but not fixed
-   * other items, for which the minimum number of arcs goes/incomes out of the first item compared to the other triples.
+   * Builds search plan for sc-template. For each connectivity component chooses the cheapest start triple, then orders
+   * other triples of the component greedily by estimated count of sc-constructions they produce, when items of previous
+   * triples are already found. Triples which source and target items are found at their step are checked, not iterated.
    */
-  void FindTriplesWithMostMinimalArcsForFirstItem()
+  void BuildSearchPlan()
   {
-    for (ScTemplateTriples const & connectivityComponentsTriples : m_connectivityComponentsTemplateTriples)
+    if (m_template.IsEmpty())
+      return;
+
+    std::vector<ScTemplateTriples> connectivityComponentsTriples = m_plan->m_connectivityComponentsTemplateTriples;
+    if (m_template.Size() == 1)
+      connectivityComponentsTriples = {{m_template.m_templateTriples[0]->m_index}};
+
+    m_plan->m_templateTriplesPlanPositions.assign(m_template.Size(), m_template.Size());
+
+    std::vector<bool> foundItemsSlots(m_plan->m_itemsNamesToSlots.size(), false);
+
+    // start triples of connectivity components: estimated count, triple index, component index
+    std::vector<std::tuple<size_t, size_t, size_t>> componentsStartTriples;
+    for (size_t i = 0; i < connectivityComponentsTriples.size(); ++i)
     {
-      sc_int32 priorityTripleIdx = -1;
-      auto & afaTriples = m_template.m_priorityOrderedTemplateTriples[(size_t)ScTemplate::ScTemplateTripleType::AFA];
-      if (!afaTriples.empty())
-        priorityTripleIdx = (sc_int32)*afaTriples.cbegin();
+      if (connectivityComponentsTriples[i].IsEmpty())
+        continue;
 
-      if (priorityTripleIdx == -1)
+      sc_int32 const startTripleIdx = FindStartTriple(connectivityComponentsTriples[i], foundItemsSlots);
+      if (startTripleIdx == -1)
       {
-        priorityTripleIdx = FindTripleWithMostMinimalInputArcsForThirdItem(connectivityComponentsTriples);
-        if (priorityTripleIdx == -1)
-          priorityTripleIdx = FindTripleWithMostMinimalOutputArcsForFirstItem(connectivityComponentsTriples);
+        m_plan->m_hasNotSearchableConnectivityComponent = true;
+        continue;
       }
 
-      // save triple in which the first item address has the most minimal count of incoming/outgoing sc-arcs in vector
-      // with more priority
-      if (priorityTripleIdx != -1)
-      {
-        m_connectivityComponentPriorityTemplateTriples.insert(priorityTripleIdx);
-      }
+      ScTemplateSearchPlanStep const & step = EstimateTriple(startTripleIdx, foundItemsSlots);
+      componentsStartTriples.emplace_back(step.m_estimatedCount, startTripleIdx, i);
     }
-  }
+    std::sort(componentsStartTriples.begin(), componentsStartTriples.end());
 
-  sc_int32 FindTripleWithMostMinimalInputArcsForThirdItem(ScTemplateTriples const & connectivityComponentsTriples)
+    for (auto const & [_, startTripleIdx, componentIdx] : componentsStartTriples)
+    {
+      if (m_plan->m_templateTriplesPlanPositions[startTripleIdx] == m_template.Size())
+        AddSearchPlanStep(startTripleIdx, foundItemsSlots);
+
+      ScTemplateTriples const & componentTriples = connectivityComponentsTriples[componentIdx];
+      for (size_t plannedCount = 1; plannedCount < componentTriples.Size(); ++plannedCount)
+      {
+        sc_int32 nextTripleIdx = -1;
+        bool isNextTripleConnected = false;
+        size_t minEstimatedCount = 0;
+        for (size_t const tripleIdx : componentTriples)
+        {
+          if (m_plan->m_templateTriplesPlanPositions[tripleIdx] != m_template.Size())
+            continue;
+
+          bool const isConnected = IsTripleConnected(tripleIdx, foundItemsSlots);
+          size_t const estimatedCount = EstimateTriple(tripleIdx, foundItemsSlots).m_estimatedCount;
+
+          // prefer triples connected with found items, then triples with less estimated count
+          if (nextTripleIdx == -1 || (isConnected && !isNextTripleConnected)
+              || (isConnected == isNextTripleConnected
+                  && (estimatedCount < minEstimatedCount
+                      || (estimatedCount == minEstimatedCount && tripleIdx < (size_t)nextTripleIdx))))
+          {
+            nextTripleIdx = (sc_int32)tripleIdx;
+            isNextTripleConnected = isConnected;
+            minEstimatedCount = estimatedCount;
+          }
+        }
+
+        if (nextTripleIdx == -1)
+          break;
+
+        AddSearchPlanStep(nextTripleIdx, foundItemsSlots);
+      }
+    }
+  }
+
+  /*!
+   * Finds triple of connectivity component with the least estimated count of sc-constructions among triples that
+   * can start search. Triples with fixed first item and connector third item are considered only if there are no
+   * other such triples.
+   */
+  sc_int32 FindStartTriple(
+      ScTemplateTriples const & connectivityComponentTriples,
+      std::vector<bool> const & foundItemsSlots)
+  {
+    if (m_template.Size() == 1)
+      return (sc_int32)*connectivityComponentTriples.cbegin();
+
+    auto const & FindCheapestTriple = [&](std::initializer_list<ScTemplate::ScTemplateTripleType> const & types)
+    {
+      sc_int32 priorityTripleIdx = -1;
+      size_t minEstimatedCount = 0;
+      for (size_t const tripleIdx : connectivityComponentTriples)
+      {
+        if (std::find(types.begin(), types.end(), m_plan->m_templateTriplesPriorities[tripleIdx]) == types.end())
+          continue;
+
+        size_t const estimatedCount = EstimateTriple(tripleIdx, foundItemsSlots).m_estimatedCount;
+        if (priorityTripleIdx == -1 || estimatedCount < minEstimatedCount
+            || (estimatedCount == minEstimatedCount && tripleIdx < (size_t)priorityTripleIdx))
+        {
+          priorityTripleIdx = (sc_int32)tripleIdx;
+          minEstimatedCount = estimatedCount;
+        }
+      }
+      return priorityTripleIdx;
+    };
+
+    sc_int32 const priorityTripleIdx = FindCheapestTriple(
+        {ScTemplate::ScTemplateTripleType::AFA,
+         ScTemplate::ScTemplateTripleType::FAF,
+         ScTemplate::ScTemplateTripleType::AAF,
+         ScTemplate::ScTemplateTripleType::FAN});
+    if (priorityTripleIdx != -1)
+      return priorityTripleIdx;
+
+    return FindCheapestTriple({ScTemplate::ScTemplateTripleType::FAE});
+  }
+
+  /*!
+   * Adds step for triple and steps for all not planned triples symmetric to it right after it. If triple has no
+   * symmetric triples, then adds steps for not planned triples that find the same item from items found before it.
+   */
+  void AddSearchPlanStep(size_t const tripleIdx, std::vector<bool> & foundItemsSlots)
   {
-    auto triplesWithConstEndElement =
-        m_template.m_priorityOrderedTemplateTriples[(size_t)ScTemplate::ScTemplateTripleType::FAF];
-    if (triplesWithConstEndElement.empty())
+    size_t const firstStep = m_plan->m_steps.size();
+    std::vector<bool> const previousFoundItemsSlots = foundItemsSlots;
+    AddTripleSearchPlanStep(tripleIdx, foundItemsSlots);
+
+    size_t const symmetricGroup = m_plan->m_symmetricTemplateTriplesGroups[tripleIdx];
+    for (size_t otherTripleIdx = 0; otherTripleIdx < m_template.Size(); ++otherTripleIdx)
+    {
+      if (m_plan->m_symmetricTemplateTriplesGroups[otherTripleIdx] == symmetricGroup
+          && m_plan->m_templateTriplesPlanPositions[otherTripleIdx] == m_template.Size())
+        AddTripleSearchPlanStep(otherTripleIdx, foundItemsSlots);
+    }
+
+    for (size_t step = firstStep; step < m_plan->m_steps.size(); ++step)
     {
-      triplesWithConstEndElement =
-          m_template.m_priorityOrderedTemplateTriples[(size_t)ScTemplate::ScTemplateTripleType::AAF];
+      m_plan->m_steps[step].m_symmetricGroupFirstStep = firstStep;
+      m_plan->m_steps[step].m_symmetricGroupLastStep = m_plan->m_steps.size() - 1;
+      m_plan->m_steps[step].m_intersectionGroupFirstStep = step;
+      m_plan->m_steps[step].m_intersectionGroupLastStep = step;
     }
 
-    // find triple in which the third item address has the most minimal count of incoming sc-arcs
-    sc_int32 priorityTripleIdx = -1;
-    sc_int32 minInputArcsCount = -1;
-    for (size_t const tripleIdx : triplesWithConstEndElement)
+    if (m_plan->m_steps.size() == firstStep + 1)
+      AddIntersectedSearchPlanSteps(firstStep, previousFoundItemsSlots, foundItemsSlots);
+  }
+
+  /*!
+   * Adds steps for all not planned triples that find the same item as triple of specified step from items found before
+   * this step. These steps form intersection group: search iterates triple of group with the least count of
+   * sc-connectors of its found item and intersects found items with sc-construction triples of other triples of group,
+   * instead of iterating sc-construction triples of one triple and checking other triples for each of them.
+   */
+  void AddIntersectedSearchPlanSteps(
+      size_t const firstStep,
+      std::vector<bool> const & previousFoundItemsSlots,
+      std::vector<bool> & foundItemsSlots)
+  {
+    size_t const tripleIdx = m_plan->m_steps[firstStep].m_tripleIdx;
+    size_t const itemIdx = GetIntersectedItemIdx(tripleIdx, previousFoundItemsSlots);
+    if (itemIdx == NO_INTERSECTED_ITEM)
+      return;
+
+    size_t const itemSlot = m_plan->m_itemsSlots[tripleIdx * 3 + itemIdx];
+    for (size_t otherTripleIdx = 0; otherTripleIdx < m_template.Size(); ++otherTripleIdx)
     {
-      // check if triple in connectivity component
-      if (connectivityComponentsTriples.find(tripleIdx) == connectivityComponentsTriples.cend())
+      if (m_plan->m_templateTriplesPlanPositions[otherTripleIdx] != m_template.Size()
+          || HasSymmetricTriples(otherTripleIdx))
         continue;
 
-      ScTemplateTriple const * triple = m_template.m_templateTriples[tripleIdx];
-      auto const count = (sc_int32)m_context.GetElementEdgesAndIncomingArcsCount(triple->GetValues()[2].m_addrValue);
+      size_t const otherItemIdx = GetIntersectedItemIdx(otherTripleIdx, previousFoundItemsSlots);
+      if (otherItemIdx == NO_INTERSECTED_ITEM || m_plan->m_itemsSlots[otherTripleIdx * 3 + otherItemIdx] != itemSlot)
+        continue;
 
-      if (minInputArcsCount == -1 || count < minInputArcsCount)
-      {
-        priorityTripleIdx = (sc_int32)tripleIdx;
-        minInputArcsCount = (sc_int32)count;
-      }
+      AddTripleSearchPlanStep(otherTripleIdx, foundItemsSlots);
+      ScTemplateSearchPlanStep & step = m_plan->m_steps.back();
+      step.m_symmetricGroupFirstStep = m_plan->m_steps.size() - 1;
+      step.m_symmetricGroupLastStep = m_plan->m_steps.size() - 1;
+      step.m_intersectedItemIdx = otherItemIdx;
     }
 
-    return priorityTripleIdx;
+    m_plan->m_steps[firstStep].m_intersectedItemIdx = itemIdx;
+    for (size_t step = firstStep; step < m_plan->m_steps.size(); ++step)
+    {
+      m_plan->m_steps[step].m_intersectionGroupFirstStep = firstStep;
+      m_plan->m_steps[step].m_intersectionGroupLastStep = m_plan->m_steps.size() - 1;
+    }
   }
 
-  sc_int32 FindTripleWithMostMinimalOutputArcsForFirstItem(ScTemplateTriples const & connectivityComponentsTriples)
+  /*!
+   * Returns index in triple of its source or target item that is found by triple from its other item found before:
+   * one of source and target of triple is found, other one is named and not found, and sc-connector of triple is not
+   * found. Otherwise, returns NO_INTERSECTED_ITEM.
+   */
+  size_t GetIntersectedItemIdx(size_t const tripleIdx, std::vector<bool> const & foundItemsSlots) const
   {
-    auto triplesWithConstBeginElement =
-        m_template.m_priorityOrderedTemplateTriples[(size_t)ScTemplate::ScTemplateTripleType::FAN];
-    // if there are no triples with the no connector third item than sort triples with the connector third item
-    if (triplesWithConstBeginElement.empty())
-      triplesWithConstBeginElement =
-          m_template.m_priorityOrderedTemplateTriples[(size_t)ScTemplate::ScTemplateTripleType::FAE];
+    size_t const itemPosition = tripleIdx * 3;
+    if (IsItemFound(itemPosition + 1, foundItemsSlots))
+      return NO_INTERSECTED_ITEM;
+
+    bool const isSourceFound = IsItemFound(itemPosition, foundItemsSlots);
+    if (isSourceFound == IsItemFound(itemPosition + 2, foundItemsSlots))
+      return NO_INTERSECTED_ITEM;
 
-    // find triple in which the first item address has the most minimal count of outgoing sc-arcs
-    sc_int32 priorityTripleIdx = -1;
-    sc_int32 minOutputArcsCount = -1;
-    for (size_t const tripleIdx : triplesWithConstBeginElement)
+    size_t const itemIdx = isSourceFound ? 2 : 0;
+    if (m_plan->m_itemsSlots[itemPosition + itemIdx] == NO_SLOT)
+      return NO_INTERSECTED_ITEM;
+
+    return itemIdx;
+  }
+
+  bool HasSymmetricTriples(size_t const tripleIdx) const
+  {
+    size_t const symmetricGroup = m_plan->m_symmetricTemplateTriplesGroups[tripleIdx];
+    for (size_t otherTripleIdx = 0; otherTripleIdx < m_template.Size(); ++otherTripleIdx)
     {
-      // check if triple in connectivity component
-      if (connectivityComponentsTriples.find(tripleIdx) == connectivityComponentsTriples.cend())
-        continue;
+      if (otherTripleIdx != tripleIdx && m_plan->m_symmetricTemplateTriplesGroups[otherTripleIdx] == symmetricGroup)
+        return true;
+    }
+    return false;
+  }
 
-      ScTemplateTriple const * triple = m_template.m_templateTriples[tripleIdx];
-      auto const count = (sc_int32)m_context.GetElementEdgesAndOutgoingArcsCount(triple->GetValues()[0].m_addrValue);
+  void AddTripleSearchPlanStep(size_t const tripleIdx, std::vector<bool> & foundItemsSlots)
+  {
+    m_plan->m_templateTriplesPlanPositions[tripleIdx] = m_plan->m_steps.size();
+    m_plan->m_steps.push_back(EstimateTriple(tripleIdx, foundItemsSlots));
 
-      if (minOutputArcsCount == -1 || count < minOutputArcsCount)
-      {
-        priorityTripleIdx = (sc_int32)tripleIdx;
-        minOutputArcsCount = (sc_int32)count;
-      }
+    for (size_t itemPosition = tripleIdx * 3; itemPosition < tripleIdx * 3 + 3; ++itemPosition)
+    {
+      if (m_plan->m_itemsSlots[itemPosition] != NO_SLOT)
+        foundItemsSlots[m_plan->m_itemsSlots[itemPosition]] = true;
     }
+  }
 
-    return priorityTripleIdx;
+  bool IsItemFoundBySlot(size_t const itemPosition, std::vector<bool> const & foundItemsSlots) const
+  {
+    size_t const slot = m_plan->m_itemsSlots[itemPosition];
+    return slot != NO_SLOT && foundItemsSlots[slot];
   }
 
-  //! Returns key - "${item replacement name}${triple index}"
-  static std::string GetKey(ScTemplateTriple const * triple, ScTemplateItem const & item)
+  bool IsTripleConnected(size_t const tripleIdx, std::vector<bool> const & foundItemsSlots) const
   {
-    std::ostringstream stream;
-    stream << item.m_name << "_" << triple->m_index;
-    return stream.str();
+    return IsItemFoundBySlot(tripleIdx * 3, foundItemsSlots) || IsItemFoundBySlot(tripleIdx * 3 + 1, foundItemsSlots)
+           || IsItemFoundBySlot(tripleIdx * 3 + 2, foundItemsSlots);
   }
 
-  void FindDependedTriple(ScTemplateItem const & item, ScTemplateTriple const * triple, ScTemplateTriples & nextTriples)
+  bool IsItemParam(ScTemplateItem const & item) const
   {
-    if (item.m_name.empty())
-      return;
+    return item.HasName() && m_plan->m_paramsAddrs.find(item.m_name) != m_plan->m_paramsAddrs.cend();
+  }
 
-    std::string const & key = GetKey(triple, item);
-    auto const & found = m_templateItemsNamesToDependedTemplateTriples.find(key);
-    if (found != m_templateItemsNamesToDependedTemplateTriples.cend())
-      nextTriples = found->second;
+  bool IsItemFixed(ScTemplateItem const & item) const
+  {
+    return item.IsFixed() || IsItemParam(item);
   }
 
-  bool IsTriplesEqual(
-      ScTemplateTriple const * templateTriple,
-      ScTemplateTriple const * otherTemplateTriple,
-      std::string const & itemName = "")
+  bool IsItemFound(size_t const itemPosition, std::vector<bool> const & foundItemsSlots) const
   {
-    if (templateTriple->m_index == otherTemplateTriple->m_index)
-      return true;
+    ScTemplateItem const & item = GetItem(itemPosition);
+    return IsItemFixed(item) || GetItemFixedAddr(item).IsValid() || IsItemFoundBySlot(itemPosition, foundItemsSlots);
+  }
+
+  ScAddr GetItemFixedAddr(ScTemplateItem const & item) const
+  {
+    if (item.IsFixed())
+      return item.m_addrValue;
+
+    if (item.HasName())
+    {
+      auto const & found = m_template.m_templateItemsNamesToReplacementItemsAddrs.find(item.m_name);
+      if (found != m_template.m_templateItemsNamesToReplacementItemsAddrs.cend())
+        return found->second;
 
-    auto const & tripleValues = templateTriple->GetValues();
-    auto const & otherTripleValues = otherTemplateTriple->GetValues();
+      auto const & foundParam = m_plan->m_paramsAddrs.find(item.m_name);
+      if (foundParam != m_plan->m_paramsAddrs.cend())
+        return foundParam->second;
+    }
+
+    return ScAddr::Empty;
+  }
+
+  //! Returns priority of triple as `ScTemplate::GetPriority`, but considers sc-template parameters as fixed items
+  ScTemplate::ScTemplateTripleType GetTriplePriority(ScTemplateTriple const * triple) const
+  {
+    ScTemplateItem const & item1 = (*triple)[0];
+    ScTemplateItem const & item2 = (*triple)[1];
+    ScTemplateItem const & item3 = (*triple)[2];
+
+    if (IsItemFixed(item2))
+      return ScTemplate::ScTemplateTripleType::AFA;
+
+    if (IsItemFixed(item1) && IsItemFixed(item3))
+      return ScTemplate::ScTemplateTripleType::FAF;
+
+    if (IsItemFixed(item3))
+      return ScTemplate::ScTemplateTripleType::AAF;
 
-    auto const & IsTriplesItemsEqual = [this](ScTemplateItem const & item, ScTemplateItem const & otherItem) -> bool
+    if (IsItemFixed(item1) && (!item3.m_typeValue.IsConnector() || item3.m_typeValue.IsUnknown()))
     {
-      bool isEqual = item.m_typeValue == otherItem.m_typeValue;
-      if (!isEqual)
+      auto const & it = m_template.m_templateItemsNamesToTypes.find(item3.m_name);
+      if (it != m_template.m_templateItemsNamesToTypes.cend() && !it->second.IsConnector() && !it->second.IsUnknown())
+        return ScTemplate::ScTemplateTripleType::FAN;
+    }
+
+    if (IsItemFixed(item1))
+      return ScTemplate::ScTemplateTripleType::FAE;
+
+    return ScTemplate::ScTemplateTripleType::AAA;
+  }
+
+  ScType GetItemType(ScTemplateItem const & item) const
+  {
+    if (item.HasName())
+    {
+      auto const & found = m_template.m_templateItemsNamesToTypes.find(item.m_name);
+      if (found != m_template.m_templateItemsNamesToTypes.cend())
+        return found->second;
+    }
+
+    return item.m_typeValue;
+  }
+
+  /*!
+   * Returns count of sc-arcs of fixed item. If item will be found during search only, then returns default estimation.
+   */
+  size_t EstimateItemArcsCount(ScTemplateItem const & item, bool const isOutgoing) const
+  {
+    ScAddr const & addr = GetItemFixedAddr(item);
+    if (!addr.IsValid())
+      return DEFAULT_ESTIMATED_ARCS_COUNT;
+
+    try
+    {
+      return isOutgoing ? m_context.GetElementEdgesAndOutgoingArcsCount(addr)
+                        : m_context.GetElementEdgesAndIncomingArcsCount(addr);
+    }
+    catch (utils::ScException const &)
+    {
+      // sc-element can be not accessible for context, search will not find anything by it
+      return DEFAULT_ESTIMATED_ARCS_COUNT;
+    }
+  }
+
+  /*!
+   * Returns selectivity of sc-type as power of two: each specified subtype of sc-element halves count of sc-elements
+   * of this sc-type. Constancy and kind of sc-element (node or connector) are not considered, because variable sc-types
+   * are matched with constant sc-elements and kind of sc-element is defined by its position in triple.
+   */
+  static size_t GetTypeSelectivityShift(ScType const & type)
+  {
+    size_t shift = 0;
+    for (sc_type bits = *type & ~(sc_type_constancy_mask | sc_type_element_mask); bits != 0; bits &= bits - 1)
+      ++shift;
+
+    return std::min(shift, MAX_TYPE_SELECTIVITY_SHIFT);
+  }
+
+  /*!
+   * Estimates count of sc-constructions found by triple when items with specified slots are already found.
+   */
+  ScTemplateSearchPlanStep EstimateTriple(size_t const tripleIdx, std::vector<bool> const & foundItemsSlots) const
+  {
+    ScTemplateTriple const * triple = m_template.m_templateTriples[tripleIdx];
+    ScTemplateItem const & item1 = (*triple)[0];
+    ScTemplateItem const & item2 = (*triple)[1];
+    ScTemplateItem const & item3 = (*triple)[2];
+
+    bool const isItem1Found = IsItemFound(tripleIdx * 3, foundItemsSlots);
+    bool const isItem2Found = IsItemFound(tripleIdx * 3 + 1, foundItemsSlots);
+    bool const isItem3Found = IsItemFound(tripleIdx * 3 + 2, foundItemsSlots);
+
+    auto const & ApplySelectivity = [](size_t const count, size_t const shift) -> size_t
+    {
+      return (count + ((size_t)1 << shift) - 1) >> shift;
+    };
+
+    size_t estimatedCount = UNKNOWN_ESTIMATED_COUNT;
+    if (isItem2Found)
+      estimatedCount = 1;
+    else if (isItem1Found && isItem3Found)
+      estimatedCount = ApplySelectivity(
+          std::min(EstimateItemArcsCount(item1, true), EstimateItemArcsCount(item3, false)),
+          GetTypeSelectivityShift(GetItemType(item2)));
+    else if (isItem1Found)
+      estimatedCount = ApplySelectivity(
+          EstimateItemArcsCount(item1, true),
+          GetTypeSelectivityShift(GetItemType(item2)) + GetTypeSelectivityShift(GetItemType(item3)));
+    else if (isItem3Found)
+      estimatedCount = ApplySelectivity(
+          EstimateItemArcsCount(item3, false),
+          GetTypeSelectivityShift(GetItemType(item1)) + GetTypeSelectivityShift(GetItemType(item2)));
+
+    std::string pattern;
+    pattern += isItem1Found ? "F" : "A";
+    pattern += isItem2Found ? "_F" : "_A";
+    pattern += isItem3Found ? "_F" : "_A";
+
+    return {tripleIdx, isItem1Found && isItem3Found, estimatedCount, pattern};
+  }
+
+  bool IsTriplesItemsEqual(ScTemplateItem const & item, ScTemplateItem const & otherItem) const
+  {
+    bool isEqual = item.m_typeValue == otherItem.m_typeValue;
+    if (!isEqual)
+    {
+      auto found = m_template.m_templateItemsNamesToTypes.find(item.m_name);
+      if (found == m_template.m_templateItemsNamesToTypes.cend())
       {
-        auto found = m_template.m_templateItemsNamesToTypes.find(item.m_name);
-        if (found == m_template.m_templateItemsNamesToTypes.cend())
-        {
-          found = m_template.m_templateItemsNamesToTypes.find(otherItem.m_name);
-          if (found != m_template.m_templateItemsNamesToTypes.cend())
-            isEqual = item.m_typeValue == found->second;
-        }
-        else
-          isEqual = found->second == otherItem.m_typeValue;
+        found = m_template.m_templateItemsNamesToTypes.find(otherItem.m_name);
+        if (found != m_template.m_templateItemsNamesToTypes.cend())
+          isEqual = item.m_typeValue == found->second;
       }
+      else
+        isEqual = found->second == otherItem.m_typeValue;
+    }
 
-      if (isEqual)
-        isEqual = item.m_addrValue == otherItem.m_addrValue;
+    if (isEqual)
+      isEqual = item.m_addrValue == otherItem.m_addrValue;
 
-      if (!isEqual)
+    if (!isEqual)
+    {
+      auto found = m_template.m_templateItemsNamesToReplacementItemsAddrs.find(item.m_name);
+      if (found == m_template.m_templateItemsNamesToReplacementItemsAddrs.cend())
       {
-        auto found = m_template.m_templateItemsNamesToReplacementItemsAddrs.find(item.m_name);
-        if (found == m_template.m_templateItemsNamesToReplacementItemsAddrs.cend())
-        {
-          found = m_template.m_templateItemsNamesToReplacementItemsAddrs.find(otherItem.m_name);
-          if (found != m_template.m_templateItemsNamesToReplacementItemsAddrs.cend())
-            isEqual = item.m_addrValue == found->second;
-        }
-        else
-          isEqual = found->second == otherItem.m_addrValue;
+        found = m_template.m_templateItemsNamesToReplacementItemsAddrs.find(otherItem.m_name);
+        if (found != m_template.m_templateItemsNamesToReplacementItemsAddrs.cend())
+          isEqual = item.m_addrValue == found->second;
       }
+      else
+        isEqual = found->second == otherItem.m_addrValue;
+    }
 
-      return isEqual;
-    };
+    return isEqual;
+  }
+
+  bool IsTriplesItemsEqual(ScTemplateTriple const * triple, ScTemplateTriple const * otherTriple) const
+  {
+    return IsTriplesItemsEqual((*triple)[0], (*otherTriple)[0]) && IsTriplesItemsEqual((*triple)[1], (*otherTriple)[1])
+           && IsTriplesItemsEqual((*triple)[2], (*otherTriple)[2]);
+  }
 
-    return IsTriplesItemsEqual(tripleValues[0], otherTripleValues[0])
-           && IsTriplesItemsEqual(tripleValues[1], otherTripleValues[1])
-           && IsTriplesItemsEqual(tripleValues[2], otherTripleValues[2])
-           && ((tripleValues[0].m_name == otherTripleValues[0].m_name
-                && (itemName.empty() || otherTripleValues[0].m_name == itemName))
-               || (tripleValues[2].m_name == otherTripleValues[2].m_name
-                   && (itemName.empty() || otherTripleValues[0].m_name == itemName)));
+  bool IsTriplesEqual(size_t const tripleIdx, size_t const otherTripleIdx) const
+  {
+    if (tripleIdx == otherTripleIdx)
+      return true;
+
+    if (!m_plan->m_equalTemplateTriples[tripleIdx].Has(otherTripleIdx))
+      return false;
+
+    std::vector<size_t> const & slots = m_plan->m_itemsSlots;
+    return slots[tripleIdx * 3] == slots[otherTripleIdx * 3]
+           || slots[tripleIdx * 3 + 2] == slots[otherTripleIdx * 3 + 2];
   };
 
   inline bool IsStructureValid()
@@ -491,513 +1237,408 @@ private:
     return m_structure.IsValid();
   }
 
+  /*!
+   * Checks that sc-element belongs to sc-structure of search. Sc-elements of sc-structure are collected into bitset on
+   * the first check, so each check is a bit probe instead of iteration of sc-arcs.
+   */
   inline bool IsInStructure(ScAddr const & addr)
   {
-    return m_context.CheckConnector(m_structure, addr, ScType::ConstPermPosArc);
+    if (!m_structureElements)
+      m_structureElements = CollectStructureElements();
+
+    return m_structureElements->Has(addr);
   }
 
-  ScAddr const & ResolveAddr(
-      ScTemplateItem const & templateItem,
-      ScAddrVector const & replacementConstruction,
-      ScTemplateSearchResult & result) const
+  std::shared_ptr<ScAddrsBitset const> CollectStructureElements()
   {
-    auto const & GetItemAddrInReplacements = [&replacementConstruction,
-                                              &result](ScTemplateItem const & item) -> ScAddr const &
-    {
-      auto const & it = result.m_templateItemsNamesToReplacementItemsPositions.find(item.m_name);
-      if (it != result.m_templateItemsNamesToReplacementItemsPositions.cend())
-      {
-        ScAddr const & addr = replacementConstruction[it->second];
-        if (addr.IsValid())
-          return addr;
-      }
+    auto elements = std::make_shared<ScAddrsBitset>();
+    ScIterator3Ptr const & it = m_context.CreateIterator3(m_structure, ScType::ConstPermPosArc, ScType::Unknown);
+    while (it->Next())
+      elements->Insert(it->Get(2));
+    return elements;
+  }
 
-      return ScAddr::Empty;
-    };
+  //! Calls check callback once for each sc-element and remembers its result
+  bool IsElementChecked(ScAddr const & addr)
+  {
+    if (m_checkedElements.Has(addr))
+      return m_acceptedElements.Has(addr);
+
+    bool const isAccepted = m_checkCallback(addr);
+    m_checkedElements.Insert(addr);
+    if (isAccepted)
+      m_acceptedElements.Insert(addr);
+    return isAccepted;
+  }
 
-    switch (templateItem.m_itemType)
-    {
-    case ScTemplateItem::Type::Addr:
+  //! Returns sc-address of item if it is fixed or its slot is bound, otherwise returns empty sc-address
+  ScAddr const & ResolveAddr(size_t const itemPosition) const
+  {
+    if (GetItem(itemPosition).IsAddr())
+      return m_plan->m_itemsAddrs[itemPosition];
+
+    size_t const itemSlot = m_plan->m_itemsSlots[itemPosition];
+    if (itemSlot != NO_SLOT)
+      return m_slotsAddrs[itemSlot];
+
+    return m_plan->m_itemsAddrs[itemPosition];
+  }
+
+  //! Returns index of triple of search plan step at specified level, steps of intersection group can be reordered
+  size_t GetLevelTripleIdx(size_t const level) const
+  {
+    return m_plan->m_steps[m_levelsSteps[level]].m_tripleIdx;
+  }
+
+  //! Returns index in triple of item found by intersection group of triple at specified level
+  size_t GetLevelIntersectedItemIdx(size_t const level) const
+  {
+    return m_plan->m_steps[m_levelsSteps[level]].m_intersectedItemIdx;
+  }
+
+  bool IsIntersectionGroupFirstLevel(size_t const level) const
+  {
+    ScTemplateSearchPlanStep const & step = m_plan->m_steps[level];
+    return step.m_intersectionGroupFirstStep == level && step.m_intersectionGroupLastStep > level;
+  }
+
+  //! Returns count of sc-connectors of found item of triple at specified level that are iterated to find its other item
+  size_t GetLevelFoundItemArcsCount(size_t const level) const
+  {
+    size_t const foundItemIdx = 2 - GetLevelIntersectedItemIdx(level);
+    ScAddr const & foundItemAddr = ResolveAddr(GetLevelTripleIdx(level) * 3 + foundItemIdx);
+
+    try
     {
-      return templateItem.m_addrValue;
+      return foundItemIdx == 0 ? m_context.GetElementEdgesAndOutgoingArcsCount(foundItemAddr)
+                               : m_context.GetElementEdgesAndIncomingArcsCount(foundItemAddr);
     }
-
-    case ScTemplateItem::Type::Replace:
+    catch (utils::ScException const &)
     {
-      ScAddr const & replacementAddr = GetItemAddrInReplacements(templateItem);
-      if (replacementAddr.IsValid())
-        return replacementAddr;
+      return std::numeric_limits<size_t>::max();
+    }
+  }
 
-      auto const & addrsIt = m_template.m_templateItemsNamesToReplacementItemsAddrs.find(templateItem.m_name);
-      if (addrsIt != m_template.m_templateItemsNamesToReplacementItemsAddrs.cend())
-        return addrsIt->second;
+  /*!
+   * Chooses triple of intersection group that starts at specified level with the least count of sc-connectors of its
+   * found item to be iterated at this level. For other levels of group collects their sc-construction triples by item
+   * found by group, if it is cheaper than checking triples of these levels for each sc-construction triple of the first
+   * level of group. Collecting is always cheaper for triples which found item is target, because checking iterates
+   * incoming sc-connectors of it.
+   */
+  void OpenIntersectionGroup(size_t const level)
+  {
+    size_t const lastLevel = m_plan->m_steps[level].m_intersectionGroupLastStep;
+    for (size_t groupLevel = level; groupLevel <= lastLevel; ++groupLevel)
+      m_levelsFoundItemsArcsCounts[groupLevel] = GetLevelFoundItemArcsCount(groupLevel);
 
-      return ScAddr::Empty;
+    size_t firstLevel = level;
+    for (size_t groupLevel = level + 1; groupLevel <= lastLevel; ++groupLevel)
+    {
+      if (m_levelsFoundItemsArcsCounts[groupLevel] < m_levelsFoundItemsArcsCounts[firstLevel])
+        firstLevel = groupLevel;
     }
+    std::swap(m_levelsSteps[level], m_levelsSteps[firstLevel]);
+    std::swap(m_levelsFoundItemsArcsCounts[level], m_levelsFoundItemsArcsCounts[firstLevel]);
+
+    CollectIntersectedTriples(level);
+  }
 
-    case ScTemplateItem::Type::Type:
+  void CollectIntersectedTriples(size_t const level)
+  {
+    size_t const lastLevel = m_plan->m_steps[level].m_intersectionGroupLastStep;
+    size_t const firstLevelArcsCount = m_levelsFoundItemsArcsCounts[level];
+    for (size_t groupLevel = level + 1; groupLevel <= lastLevel; ++groupLevel)
     {
-      if (!templateItem.m_name.empty())
+      ScTemplateSearchLevel & searchLevel = m_levels[groupLevel];
+      size_t const itemIdx = GetLevelIntersectedItemIdx(groupLevel);
+
+      searchLevel.m_intersectedTriples.clear();
+      searchLevel.m_hasIntersectedTriples =
+          itemIdx == 0
+          || m_levelsFoundItemsArcsCounts[groupLevel] / DEFAULT_ESTIMATED_ARCS_COUNT <= firstLevelArcsCount;
+      if (!searchLevel.m_hasIntersectedTriples)
+        continue;
+
+      ScIterator3Ptr const iterator = CreateIterator(GetLevelTripleIdx(groupLevel));
+      while (iterator->Next())
       {
-        return GetItemAddrInReplacements(templateItem);
+        ScAddrTriple const & triple = iterator->Get();
+        if (IsTripleAccepted(triple))
+          searchLevel.m_intersectedTriples[triple[itemIdx]].push_back(triple);
       }
-      SC_FALLTHROUGH;
     }
+  }
+
+  //! Checks if item found at the first level of intersection group is found by triples of other levels of group
+  bool IsItemIntersected(size_t const level, ScAddrTriple const & triple) const
+  {
+    if (!IsIntersectionGroupFirstLevel(level))
+      return true;
 
-    default:
+    ScAddr const & itemAddr = triple[GetLevelIntersectedItemIdx(level)];
+    size_t const lastLevel = m_plan->m_steps[level].m_intersectionGroupLastStep;
+    for (size_t groupLevel = level + 1; groupLevel <= lastLevel; ++groupLevel)
     {
-      return ScAddr::Empty;
-    }
+      ScTemplateSearchLevel const & searchLevel = m_levels[groupLevel];
+      if (searchLevel.m_hasIntersectedTriples
+          && searchLevel.m_intersectedTriples.find(itemAddr) == searchLevel.m_intersectedTriples.cend())
+        return false;
     }
+
+    return true;
   }
 
-  ScIterator3Ptr CreateIterator(
-      ScTemplateTriple const * templateTriple,
-      ScAddrVector const & replacementConstruction,
-      ScTemplateSearchResult & result)
+  ScIterator3Ptr CreateIterator(size_t const tripleIdx)
   {
-    ScTemplateItem const & item1 = (*templateTriple)[0];
-    ScTemplateItem const & item2 = (*templateTriple)[1];
-    ScTemplateItem const & item3 = (*templateTriple)[2];
-
-    ScAddr const & addr1 = ResolveAddr(item1, replacementConstruction, result);
-    ScAddr const & addr2 = ResolveAddr(item2, replacementConstruction, result);
-    ScAddr const & addr3 = ResolveAddr(item3, replacementConstruction, result);
-
-    auto const & PrepareType = [this](ScTemplateItem const & item) -> ScType
-    {
-      ScType type = item.m_typeValue;
-      if (!item.m_name.empty())
-      {
-        auto const & found = m_template.m_templateItemsNamesToTypes.find(item.m_name);
-        if (found != m_template.m_templateItemsNamesToTypes.cend())
-          type = found->second;
-      }
+    size_t const itemPosition = tripleIdx * 3;
 
-      if (type.HasConstancyFlag())
-        return type.UpConstType();
+    ScAddr const & addr1 = ResolveAddr(itemPosition);
+    ScAddr const & addr2 = ResolveAddr(itemPosition + 1);
+    ScAddr const & addr3 = ResolveAddr(itemPosition + 2);
 
-      return type;
-    };
+    ScType const & type1 = m_plan->m_itemsTypes[itemPosition];
+    ScType const & type2 = m_plan->m_itemsTypes[itemPosition + 1];
+    ScType const & type3 = m_plan->m_itemsTypes[itemPosition + 2];
 
     if (addr1.IsValid())
     {
       if (!addr2.IsValid())
       {
         if (addr3.IsValid())  // F_A_F
-          return m_context.CreateIterator3(addr1, PrepareType(item2), addr3);
+          return m_context.CreateIterator3(addr1, type2, addr3);
         else  // F_A_A
-          return m_context.CreateIterator3(addr1, PrepareType(item2), PrepareType(item3));
+          return m_context.CreateIterator3(addr1, type2, type3);
       }
       else
       {
         if (addr3.IsValid())  // F_F_F
           return m_context.CreateIterator3(addr1, addr2, addr3);
         else  // F_F_A
-          return m_context.CreateIterator3(addr1, addr2, PrepareType(item3));
+          return m_context.CreateIterator3(addr1, addr2, type3);
       }
     }
     else if (addr3.IsValid())
     {
       if (addr2.IsValid())  // A_F_F
-        return m_context.CreateIterator3(PrepareType(item1), addr2, addr3);
+        return m_context.CreateIterator3(type1, addr2, addr3);
       else  // A_A_F
-        return m_context.CreateIterator3(PrepareType(item1), PrepareType(item2), addr3);
+        return m_context.CreateIterator3(type1, type2, addr3);
     }
     else if (addr2.IsValid() && !addr3.IsValid())  // A_F_A
-      return m_context.CreateIterator3(PrepareType(item1), addr2, PrepareType(item3));
+      return m_context.CreateIterator3(type1, addr2, type3);
 
     return {};
   }
 
-  using UsedConnectors = std::unordered_set<ScAddr, ScAddrHashFunc>;
-
-  void DoIterationOnNextEqualTriples(
-      ScTemplateTriples const & templateTriples,
-      std::string const & templateItemName,
-      size_t const replacementConstructionIdx,
-      ScTemplateTriples const & currentIterableTemplateTriples,
-      ScTemplateTriples & childrenTemplateTriples,
-      ScTemplateSearchResult & result,
-      bool & isFinished,
-      bool & isLast)
+  /*!
+   * Creates iterator for triple of search plan step at specified level of search stack. Level that follows the first
+   * level of symmetric triples collects sc-construction triples for all next symmetric levels, their sc-connectors
+   * must be greater than sc-connector found at the first level.
+   * @throws utils::ExceptionInvalidState if all items of triple are not fixed and not found at previous levels.
+   */
+  void OpenLevel(size_t const level)
   {
-    isLast = true;
-    isFinished = true;
+    ScTemplateSearchPlanStep const & step = m_plan->m_steps[level];
+    ScTemplateSearchLevel & searchLevel = m_levels[level];
+    searchLevel.m_boundSlotsCount = 0;
 
-    std::unordered_set<size_t> iteratedTemplateTriples;
-    for (size_t const idx : templateTriples)
+    if (level > step.m_symmetricGroupFirstStep + 1)
     {
-      ScTemplateTriple * triple = m_template.m_templateTriples[idx];
-      if (iteratedTemplateTriples.find(triple->m_index) != iteratedTemplateTriples.cend())
-        continue;
-
-      ScTemplateTriples equalTemplateTriples;
-      for (ScTemplateTriple * otherTemplateTriple : m_template.m_templateTriples)
-      {
-        // check if iterable triple is equal to current, not checked and not iterable with previous
-        if (m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].find(
-                otherTemplateTriple->m_index)
-                == m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].cend()
-            && currentIterableTemplateTriples.find(idx) == currentIterableTemplateTriples.cend()
-            && IsTriplesEqual(triple, otherTemplateTriple, templateItemName))
-        {
-          equalTemplateTriples.insert(otherTemplateTriple->m_index);
-          iteratedTemplateTriples.insert(otherTemplateTriple->m_index);
-        }
-      }
+      searchLevel.m_nextCandidateIdx = m_levels[level - 1].m_nextCandidateIdx;
+      return;
+    }
 
-      if (!equalTemplateTriples.empty())
-      {
-        isLast = false;
-        DoDependenceIteration(equalTemplateTriples, replacementConstructionIdx, childrenTemplateTriples, result);
-
-        isFinished = std::all_of(
-            equalTemplateTriples.begin(),
-            equalTemplateTriples.end(),
-            [this, replacementConstructionIdx](size_t const idx)
-            {
-              return m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].find(idx)
-                     != m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].cend();
-            });
-
-        if (!isFinished)
-          break;
-      }
+    if (IsIntersectionGroupFirstLevel(level))
+      OpenIntersectionGroup(level);
+    else if (level > step.m_intersectionGroupFirstStep && searchLevel.m_hasIntersectedTriples)
+    {
+      ScAddr const & itemAddr = ResolveAddr(GetLevelTripleIdx(level) * 3 + GetLevelIntersectedItemIdx(level));
+      auto const & it = searchLevel.m_intersectedTriples.find(itemAddr);
+      searchLevel.m_intersectedCandidates = it == searchLevel.m_intersectedTriples.cend() ? nullptr : &it->second;
+      searchLevel.m_nextCandidateIdx = 0;
+      return;
     }
-  }
 
-  bool DoDependenceIterationByItem(
-      ScTemplateTriple const * templateTriple,
-      ScTemplateItem const & item,
-      size_t replacementConstructionIdx,
-      ScTemplateTriples const & templateTriples,
-      ScTemplateTriples & childrenTemplateTriples,
-      ScTemplateSearchResult & result,
-      bool & isForLastTemplateTripleAllChildrenFinished,
-      bool & isLastTemplateTripleHasNoChildren)
-  {
-    bool isChildFinished = false;
-    bool isNoChild = false;
-    ScTemplateTriples nextTemplateTriples;
-    FindDependedTriple(item, templateTriple, nextTemplateTriples);
-
-    DoIterationOnNextEqualTriples(
-        nextTemplateTriples,
-        item.m_name,
-        replacementConstructionIdx,
-        templateTriples,
-        childrenTemplateTriples,
-        result,
-        isChildFinished,
-        isNoChild);
-
-    isForLastTemplateTripleAllChildrenFinished &= isChildFinished;
-    isLastTemplateTripleHasNoChildren &= isNoChild;
-    return !isForLastTemplateTripleAllChildrenFinished && !isLastTemplateTripleHasNoChildren;
-  }
-
-  void DoDependenceIteration(
-      ScTemplateTriples const & templateTriples,
-      size_t replacementConstructionIdx,
-      ScTemplateTriples & childrenTemplateTriples,
-      ScTemplateSearchResult & result)
-  {
-    size_t templateTripleIdx = *templateTriples.begin();
-    ScTemplateTriple * templateTriple = m_template.m_templateTriples[templateTripleIdx];
-
-    bool isForLastTemplateTripleAllChildrenFinished = true;
-    bool isLastTemplateTripleHasNoChildren = false;
-
-    ScIterator3Ptr it =
-        CreateIterator(templateTriple, result.m_replacementConstructions[replacementConstructionIdx], result);
-    if (!it || !it->IsValid())
+    searchLevel.m_iterator = CreateIterator(GetLevelTripleIdx(level));
+    if (!searchLevel.m_iterator || !searchLevel.m_iterator->IsValid())
       SC_THROW_EXCEPTION(
           utils::ExceptionInvalidState,
           "Fully variable triple was selected during searching by specified sc-template. It is possible that you have "
           "incorrect sc-template or you can't find constructions in knowledge base using this sc-template. Check "
           "sc-template.");
 
-    size_t checkedCurrentResultEqualTemplateTriplesCount = 0;
-
-    ScAddrVector nextResultReplacementTriples{result.m_replacementConstructions[replacementConstructionIdx]};
-    ScTemplateTriples nextCheckedTemplateTriples{
-        m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx]};
-    UsedConnectors nextUsedReplacementConnectors{
-        m_usedConnectorsInReplacementConstructions[replacementConstructionIdx]};
+    if (level == step.m_symmetricGroupFirstStep)
+      return;
 
-    bool isTemplateTriplesIteratorNext = false;
-    ScTemplateTriples::const_iterator templateTriplesIterator;
-    do
+    sc_addr_hash const firstConnectorHash = m_construction[GetLevelTripleIdx(level - 1) * 3 + 1].Hash();
+    searchLevel.m_candidates.clear();
+    while (searchLevel.m_iterator->Next())
     {
-      ScReplacementTriple replacementTriple;
-      if (it->Next())
-      {
-        replacementTriple = it->Get();
-        auto copiedTemplateTriplesIterator = templateTriplesIterator;
-        if (copiedTemplateTriplesIterator != templateTriples.cend())
+      ScAddrTriple const & triple = searchLevel.m_iterator->Get();
+      if (triple[1].Hash() > firstConnectorHash && !IsConnectorUsed(level, triple[1]) && IsTripleAccepted(triple))
+        searchLevel.m_candidates.push_back(triple);
+    }
+    searchLevel.m_iterator.reset();
+
+    std::sort(
+        searchLevel.m_candidates.begin(),
+        searchLevel.m_candidates.end(),
+        [](ScAddrTriple const & triple, ScAddrTriple const & otherTriple)
         {
-          ++copiedTemplateTriplesIterator;
-          if (copiedTemplateTriplesIterator == templateTriples.cend())
-            isTemplateTriplesIteratorNext = false;
-        }
-      }
-      else
-      {
-        // it is not universal sc-template search
-        break;
-      }
+          return triple[1].Hash() < otherTriple[1].Hash();
+        });
+    searchLevel.m_nextCandidateIdx = 0;
+  }
 
-      auto & notUsedConnectorsInCurrentTemplateTriple = m_notUsedConnectorsInTemplateTriples[templateTriple->m_index];
-      if (notUsedConnectorsInCurrentTemplateTriple.find(replacementTriple[1])
-          != notUsedConnectorsInCurrentTemplateTriple.cend())
-        continue;
+  //! Unbinds slots of items that were bound by the current sc-construction triple at specified level
+  void UndoLevel(size_t const level)
+  {
+    ScTemplateSearchLevel & searchLevel = m_levels[level];
+    for (size_t i = 0; i < searchLevel.m_boundSlotsCount; ++i)
+      m_slotsAddrs[searchLevel.m_boundSlots[i]] = ScAddr::Empty;
+    searchLevel.m_boundSlotsCount = 0;
+  }
 
-      bool isFoundInOtherTemplateTriples = false;
-      for (size_t const otherTemplateTripleIdx : templateTriples)
-      {
-        if (templateTripleIdx == otherTemplateTripleIdx)
-          continue;
+  //! Checks if sc-connector is already found for triple at one of previous levels
+  bool IsConnectorUsed(size_t const level, ScAddr const & connectorAddr) const
+  {
+    for (size_t previousLevel = 0; previousLevel < level; ++previousLevel)
+    {
+      if (m_construction[GetLevelTripleIdx(previousLevel) * 3 + 1] == connectorAddr)
+        return true;
+    }
+    return false;
+  }
 
-        if (m_usedConnectorsInTemplateTriples[otherTemplateTripleIdx].find(replacementTriple[1])
-            != m_usedConnectorsInTemplateTriples[otherTemplateTripleIdx].cend())
-        {
-          isFoundInOtherTemplateTriples = true;
-          break;
-        }
-      }
-      if (isFoundInOtherTemplateTriples)
-        continue;
+  bool IsTripleAccepted(ScAddrTriple const & triple)
+  {
+    if (IsStructureValid() && (!IsInStructure(triple[0]) || !IsInStructure(triple[1]) || !IsInStructure(triple[2])))
+      return false;
+
+    return !m_checkCallback
+           || (IsElementChecked(triple[0]) && IsElementChecked(triple[1]) && IsElementChecked(triple[2]));
+  }
 
-      // check if connector is used for other equal triple
-      auto & usedConnectorsInCurrentReplacementConstruction =
-          m_usedConnectorsInReplacementConstructions[replacementConstructionIdx];
-      if (usedConnectorsInCurrentReplacementConstruction.find(replacementTriple[1])
-          != usedConnectorsInCurrentReplacementConstruction.cend())
+  /*!
+   * Binds slots of not found named items of triple at specified level to sc-elements of sc-construction triple. If
+   * item is already bound to other sc-element, then unbinds slots bound at this level and returns false.
+   */
+  bool BindTripleItems(size_t const level, size_t const tripleIdx, ScAddrTriple const & triple)
+  {
+    ScTemplateSearchLevel & searchLevel = m_levels[level];
+    for (size_t i = 0; i < 3; ++i)
+    {
+      size_t const itemPosition = tripleIdx * 3 + i;
+      size_t const itemSlot = m_plan->m_itemsSlots[itemPosition];
+      if (itemSlot == NO_SLOT || GetItem(itemPosition).IsAddr())
         continue;
 
-      // check triple elements by structure belonging or predicate callback
-      if ((IsStructureValid()
-           && (!IsInStructure(replacementTriple[0]) || !IsInStructure(replacementTriple[1])
-               || !IsInStructure(replacementTriple[2])))
-          || (m_checkCallback
-              && (!m_checkCallback(replacementTriple[0]) || !m_checkCallback(replacementTriple[1])
-                  || !m_checkCallback(replacementTriple[2]))))
+      ScAddr & slotAddr = m_slotsAddrs[itemSlot];
+      if (!slotAddr.IsValid())
       {
-        m_usedConnectorsInReplacementConstructions[replacementConstructionIdx].insert(replacementTriple[1]);
-        continue;
+        slotAddr = triple[i];
+        searchLevel.m_boundSlots[searchLevel.m_boundSlotsCount++] = itemSlot;
       }
-
-      do
+      else if (slotAddr != triple[i])
       {
-        if (!isTemplateTriplesIteratorNext)
-        {
-          templateTriplesIterator = templateTriples.cbegin();
-          isTemplateTriplesIteratorNext = true;
-        }
-        else if (templateTriplesIterator != templateTriples.cend())
-          ++templateTriplesIterator;
-
-        // check if all equal triples found to make a new search result item
-        if (checkedCurrentResultEqualTemplateTriplesCount == templateTriples.size())
-        {
-          replacementConstructionIdx = ++m_lastReplacementConstructionIdx;
-          checkedCurrentResultEqualTemplateTriplesCount = 0;
-
-          ReserveResult(replacementConstructionIdx, result);
-
-          result.m_replacementConstructions.emplace_back(nextResultReplacementTriples);
-          m_checkedTemplateTriplesInReplacementConstructions.emplace_back(nextCheckedTemplateTriples);
-          m_usedConnectorsInReplacementConstructions.emplace_back(DEFAULT_RESULT_RESERVE_SIZE);
-
-          templateTriplesIterator = templateTriples.cbegin();
-        }
-
-        auto & checkedTemplateTriplesInCurrentReplacementConstruction =
-            m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx];
-        if (!isForLastTemplateTripleAllChildrenFinished)
-        {
-          result.m_replacementConstructions[replacementConstructionIdx].assign(
-              nextResultReplacementTriples.cbegin(), nextResultReplacementTriples.cend());
-          checkedTemplateTriplesInCurrentReplacementConstruction = nextCheckedTemplateTriples;
-          m_usedConnectorsInReplacementConstructions[replacementConstructionIdx] = nextUsedReplacementConnectors;
-        }
-
-        if (templateTriplesIterator == templateTriples.cend())
-        {
-          isTemplateTriplesIteratorNext = false;
-          break;
-        }
+        UndoLevel(level);
+        return false;
+      }
+    }
 
-        templateTripleIdx = *templateTriplesIterator;
+    return true;
+  }
 
-        templateTriple = m_template.m_templateTriples[templateTripleIdx];
+  //! Finds next sc-construction triple for triple at specified level and binds items of triple to its sc-elements
+  bool NextAtLevel(size_t const level)
+  {
+    ScTemplateSearchPlanStep const & step = m_plan->m_steps[level];
+    ScTemplateSearchLevel & searchLevel = m_levels[level];
+    size_t const tripleIdx = GetLevelTripleIdx(level);
 
-        if (checkedTemplateTriplesInCurrentReplacementConstruction.find(templateTripleIdx)
-            != checkedTemplateTriplesInCurrentReplacementConstruction.cend())
+    if (level == 0 && m_hasRootTriples)
+    {
+      // sc-construction triples of the first level are already iterated and accepted
+      while (m_nextRootTripleIt != m_rootTriplesEndIt)
+      {
+        ScAddrTriple const & triple = *m_nextRootTripleIt++;
+        if (!BindTripleItems(level, tripleIdx, triple))
           continue;
 
-        ScAddrVector & replacementConstruction = result.m_replacementConstructions[replacementConstructionIdx];
+        std::copy(triple.cbegin(), triple.cend(), m_construction.begin() + tripleIdx * 3);
+        return true;
+      }
 
-        bool isFinished = true;
-        auto const & items = templateTriple->GetValues();
-        for (size_t i = 0; i < items.size(); ++i)
-        {
-          ScAddr const & resolvedAddr = ResolveAddr(items[i], replacementConstruction, result);
-          if (resolvedAddr.IsValid() && resolvedAddr != replacementTriple[i])
-          {
-            isForLastTemplateTripleAllChildrenFinished = false;
-            isFinished = false;
-            break;
-          }
-        }
+      return false;
+    }
 
-        if (!isFinished)
+    if (level > step.m_symmetricGroupFirstStep)
+    {
+      // leave enough sc-construction triples with greater sc-connectors for next symmetric levels
+      auto const & candidates = m_levels[step.m_symmetricGroupFirstStep + 1].m_candidates;
+      size_t const nextLevelsCount = step.m_symmetricGroupLastStep - level;
+      while (searchLevel.m_nextCandidateIdx + nextLevelsCount < candidates.size())
+      {
+        ScAddrTriple const & triple = candidates[searchLevel.m_nextCandidateIdx++];
+        if (!BindTripleItems(level, tripleIdx, triple))
           continue;
 
-        // update data
-        {
-          UpdateResult(templateTriple, replacementConstructionIdx, replacementTriple, result);
-        }
-
-        // find next depended on triples and analyse result
-        {
-          isForLastTemplateTripleAllChildrenFinished = true;
-          isLastTemplateTripleHasNoChildren = true;
-
-          // first of all check triples by connector, it is more effectively
-          if (DoDependenceIterationByItem(
-                  templateTriple,
-                  items[1],
-                  replacementConstructionIdx,
-                  templateTriples,
-                  childrenTemplateTriples,
-                  result,
-                  isForLastTemplateTripleAllChildrenFinished,
-                  isLastTemplateTripleHasNoChildren)
-              || DoDependenceIterationByItem(
-                  templateTriple,
-                  items[0],
-                  replacementConstructionIdx,
-                  templateTriples,
-                  childrenTemplateTriples,
-                  result,
-                  isForLastTemplateTripleAllChildrenFinished,
-                  isLastTemplateTripleHasNoChildren)
-              || DoDependenceIterationByItem(
-                  templateTriple,
-                  items[2],
-                  replacementConstructionIdx,
-                  templateTriples,
-                  childrenTemplateTriples,
-                  result,
-                  isForLastTemplateTripleAllChildrenFinished,
-                  isLastTemplateTripleHasNoChildren))
-          {
-            for (auto const & otherTemplateTripleIdx : childrenTemplateTriples)
-            {
-              m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].erase(
-                  otherTemplateTripleIdx);
-            }
-            childrenTemplateTriples.clear();
-            ClearResult(templateTripleIdx, replacementConstructionIdx, replacementConstruction);
-            continue;
-          }
-
-          // all connected triples found
-          if (isForLastTemplateTripleAllChildrenFinished)
-          {
-            ++checkedCurrentResultEqualTemplateTriplesCount;
-
-            // current connector is busy for all equal triples
-            childrenTemplateTriples.insert(templateTripleIdx);
-            m_usedConnectorsInTemplateTriples[templateTripleIdx].insert(replacementTriple[1]);
-            m_usedConnectorsInReplacementConstructions[replacementConstructionIdx].insert(replacementTriple[1]);
-
-            break;
-          }
-        }
+        std::copy(triple.cbegin(), triple.cend(), m_construction.begin() + tripleIdx * 3);
+        return true;
       }
-      while (templateTriplesIterator != templateTriples.cend());
 
-      // there are no next triples for current triple, it is last
-      if (isLastTemplateTripleHasNoChildren && isForLastTemplateTripleAllChildrenFinished
-          && m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].size()
-                 == m_template.m_templateTriples.size())
-      {
-        if (!m_filterCallback
-            || m_filterCallback(
-                {&m_context,
-                 result.m_replacementConstructions[replacementConstructionIdx],
-                 result.m_templateItemsNamesToReplacementItemsPositions}))
-          AppendFoundReplacementConstruction(result, replacementConstructionIdx);
-      }
+      return false;
     }
-    while (!isStopped);
-  }
 
-  void UpdateResult(
-      ScTemplateTriple const * templateTriple,
-      size_t const replacementConstructionIdx,
-      ScAddrTriple const & replacementTriple,
-      ScTemplateSearchResult & result)
-  {
-    auto const & UpdateResultByItem =
-        [&result](ScTemplateItem const & item, ScAddr const & addr, size_t const elementNum, ScAddrVector & resultAddrs)
+    if (level > step.m_intersectionGroupFirstStep && searchLevel.m_hasIntersectedTriples)
     {
-      resultAddrs[elementNum] = addr;
+      // sc-construction triples with item found at the first level of intersection group are already accepted
+      if (searchLevel.m_intersectedCandidates == nullptr)
+        return false;
 
-      if (item.m_name.empty())
-        return;
+      auto const & candidates = *searchLevel.m_intersectedCandidates;
+      while (searchLevel.m_nextCandidateIdx < candidates.size())
+      {
+        ScAddrTriple const & triple = candidates[searchLevel.m_nextCandidateIdx++];
+        if (IsConnectorUsed(level, triple[1]) || !BindTripleItems(level, tripleIdx, triple))
+          continue;
 
-      result.m_templateItemsNamesToReplacementItemsPositions[item.m_name] = elementNum;
-    };
+        std::copy(triple.cbegin(), triple.cend(), m_construction.begin() + tripleIdx * 3);
+        return true;
+      }
 
-    m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].insert(templateTriple->m_index);
-    m_usedConnectorsInReplacementConstructions[replacementConstructionIdx].insert(replacementTriple[1]);
+      return false;
+    }
 
-    size_t itemIdx = templateTriple->m_index * 3;
-    for (size_t i = replacementConstructionIdx; i < result.Size(); ++i)
+    while (searchLevel.m_iterator->Next())
     {
-      ScAddrVector & resultAddrs = result.m_replacementConstructions[i];
+      ScAddrTriple const & triple = searchLevel.m_iterator->Get();
+      if (IsConnectorUsed(level, triple[1]) || !IsTripleAccepted(triple) || !IsItemIntersected(level, triple)
+          || !BindTripleItems(level, tripleIdx, triple))
+        continue;
 
-      UpdateResultByItem((*templateTriple)[0], replacementTriple[0], itemIdx, resultAddrs);
-      UpdateResultByItem((*templateTriple)[1], replacementTriple[1], itemIdx + 1, resultAddrs);
-      UpdateResultByItem((*templateTriple)[2], replacementTriple[2], itemIdx + 2, resultAddrs);
+      std::copy(triple.cbegin(), triple.cend(), m_construction.begin() + tripleIdx * 3);
+      return true;
     }
-  };
 
-  void ClearResult(
-      size_t const tripleIdx,
-      size_t const replacementConstructionIdx,
-      ScAddrVector & replacementConstruction)
-  {
-    m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].erase(tripleIdx);
-
-    size_t itemIdx = tripleIdx * 3;
-
-    replacementConstruction[itemIdx] = ScAddr::Empty;
-    m_usedConnectorsInReplacementConstructions[replacementConstructionIdx].erase(replacementConstruction[++itemIdx]);
-    m_notUsedConnectorsInTemplateTriples[tripleIdx].insert(replacementConstruction[itemIdx]);
-    replacementConstruction[itemIdx] = ScAddr::Empty;
-    replacementConstruction[++itemIdx] = ScAddr::Empty;
-  };
+    return false;
+  }
 
-  void AppendFoundReplacementConstruction(ScTemplateSearchResult & result, size_t & resultIdx)
+  void AppendFoundReplacementConstruction(ScTemplateSearchResult & result)
   {
+    if (m_filterCallback
+        && !m_filterCallback({&m_context, m_construction, result.m_templateItemsNamesToReplacementItemsPositions}))
+      return;
+
     if (m_callback)
     {
-      m_callback(
-          {&m_context,
-           result.m_replacementConstructions[resultIdx],
-           result.m_templateItemsNamesToReplacementItemsPositions});
+      m_callback({&m_context, m_construction, result.m_templateItemsNamesToReplacementItemsPositions});
     }
     else if (m_callbackWithRequest)
     {
-      ScTemplateSearchRequest const & request = m_callbackWithRequest(
-          {&m_context,
-           result.m_replacementConstructions[resultIdx],
-           result.m_templateItemsNamesToReplacementItemsPositions});
+      ScTemplateSearchRequest const & request =
+          m_callbackWithRequest({&m_context, m_construction, result.m_templateItemsNamesToReplacementItemsPositions});
       switch (request)
       {
       case ScTemplateSearchRequest::STOP:
@@ -1014,18 +1655,62 @@ private:
       }
     }
     else
-      m_foundReplacementConstructions.insert(resultIdx);
+      result.m_replacementConstructions.emplace_back(m_construction);
   }
 
-  void ReserveResult(size_t const replacementConstructionIdx, ScTemplateSearchResult & result)
+  void ResetIterations()
   {
-    if (replacementConstructionIdx < DEFAULT_RESULT_RESERVE_SIZE * m_resultReserveCount)
-      return;
+    m_construction.assign(CalculateOneResultSize(), ScAddr::Empty);
 
-    ++m_resultReserveCount;
-    result.m_replacementConstructions.reserve(DEFAULT_RESULT_RESERVE_SIZE * m_resultReserveCount);
-    m_checkedTemplateTriplesInReplacementConstructions.reserve(DEFAULT_RESULT_RESERVE_SIZE * m_resultReserveCount);
-    m_usedConnectorsInReplacementConstructions.reserve(DEFAULT_RESULT_RESERVE_SIZE * m_resultReserveCount);
+    m_slotsAddrs = m_plan->m_slotsAddrs;
+    for (size_t slot = 0; slot < m_slotsParamsAddrs.size(); ++slot)
+    {
+      if (m_slotsParamsAddrs[slot].IsValid())
+        m_slotsAddrs[slot] = m_slotsParamsAddrs[slot];
+    }
+
+    m_levels.assign(m_plan->m_steps.size(), {});
+    m_levelsSteps.resize(m_plan->m_steps.size());
+    std::iota(m_levelsSteps.begin(), m_levelsSteps.end(), 0);
+    m_levelsFoundItemsArcsCounts.assign(m_plan->m_steps.size(), 0);
+  }
+
+  //! Checks if search plan contains steps for all triples of sc-template
+  bool IsSearchable() const
+  {
+    // connectivity component without fixed items can't be searched
+    return !m_template.IsEmpty() && !m_plan->m_hasNotSearchableConnectivityComponent
+           && m_plan->m_steps.size() == m_template.Size();
+  }
+
+  /*!
+   * Searches sc-constructions which triples of the first level of search stack are in the given range. Order of steps
+   * at the first level is taken from search that iterated these triples, if it is other search.
+   */
+  void SearchFromRootTriples(
+      std::vector<ScAddrTriple>::const_iterator const & beginIt,
+      std::vector<ScAddrTriple>::const_iterator const & endIt,
+      ScTemplateSearchResult::SearchResults & constructions,
+      ScTemplateSearch const & rootSearch)
+  {
+    if (this != &rootSearch)
+    {
+      ResetIterations();
+      if (IsIntersectionGroupFirstLevel(0))
+      {
+        m_levelsSteps = rootSearch.m_levelsSteps;
+        m_levelsFoundItemsArcsCounts = rootSearch.m_levelsFoundItemsArcsCounts;
+        CollectIntersectedTriples(0);
+      }
+    }
+    m_hasRootTriples = true;
+    m_nextRootTripleIt = beginIt;
+    m_rootTriplesEndIt = endIt;
+    m_level = 0;
+    m_iterationsState = ScTemplateSearchIterationsState::Started;
+
+    while (NextConstruction())
+      constructions.push_back(m_construction);
   }
 
   void DoIterations(ScTemplateSearchResult & result)
@@ -1033,42 +1718,183 @@ private:
     if (m_template.IsEmpty())
       return;
 
-    ScAddrVector newResult;
-    newResult.resize(CalculateOneResultSize());
-    result.m_replacementConstructions.reserve(DEFAULT_RESULT_RESERVE_SIZE);
-    result.m_replacementConstructions.emplace_back(newResult);
+    result.m_templateItemsNamesToReplacementItemsPositions = m_plan->m_itemsNamesToReplacementItemsPositions;
+
+    while (!isStopped && NextConstruction())
+      AppendFoundReplacementConstruction(result);
+  }
+
+public:
+  /*!
+   * Finds next sc-construction by backtracking over steps of search plan. Each level of search stack iterates
+   * sc-construction triples for triple of its step and keeps slots it bound, so returning to the level unbinds only
+   * them. Search stack, found items and current sc-construction are allocated once per search, and search is resumed
+   * from the last level, so sc-constructions can be found one by one.
+   * @returns true if next sc-construction is found, otherwise false.
+   */
+  bool NextConstruction()
+  {
+    if (m_iterationsState == ScTemplateSearchIterationsState::NotStarted)
+    {
+      m_iterationsState = ScTemplateSearchIterationsState::Finished;
+      if (!IsSearchable())
+        return false;
+
+      ResetIterations();
+      m_level = 0;
+      OpenLevel(m_level);
+      m_iterationsState = ScTemplateSearchIterationsState::Started;
+    }
+    else if (m_iterationsState == ScTemplateSearchIterationsState::Finished)
+      return false;
 
-    m_notUsedConnectorsInTemplateTriples.resize(m_template.Size());
-    m_usedConnectorsInTemplateTriples.resize(m_template.Size());
-    m_usedConnectorsInReplacementConstructions.reserve(DEFAULT_RESULT_RESERVE_SIZE);
-    m_usedConnectorsInReplacementConstructions.emplace_back();
-    m_checkedTemplateTriplesInReplacementConstructions.reserve(DEFAULT_RESULT_RESERVE_SIZE);
-    m_checkedTemplateTriplesInReplacementConstructions.emplace_back();
+    size_t const levelsCount = m_levels.size();
+    while (true)
+    {
+      UndoLevel(m_level);
+
+      if (!NextAtLevel(m_level))
+      {
+        m_levels[m_level].m_iterator.reset();
+        if (m_level == 0)
+          break;
 
-    ScTemplateTriples childrenTemplateTriples;
+        --m_level;
+        continue;
+      }
 
-    bool isFinished = false;
-    bool isLast = false;
+      if (m_level + 1 == levelsCount)
+        return true;
+
+      OpenLevel(++m_level);
+    }
 
-    auto const & startTriples = m_template.Size() == 1 ? ScTemplateTriples{m_template.m_templateTriples[0]->m_index}
-                                                       : m_connectivityComponentPriorityTemplateTriples;
-    DoIterationOnNextEqualTriples(startTriples, "", 0, {}, childrenTemplateTriples, result, isFinished, isLast);
+    m_iterationsState = ScTemplateSearchIterationsState::Finished;
+    return false;
   }
 
-public:
-  ScTemplate::Result operator()(ScTemplateSearchResult & result)
+  //! Returns the last sc-construction found by `NextConstruction`
+  ScAddrVector const & GetConstruction() const
+  {
+    return m_construction;
+  }
+
+  /*!
+   * Searches sc-constructions by several threads. Sc-construction triples of the first step of search plan are
+   * iterated by calling thread and split into chunks, then threads take chunks one by one and search sc-constructions
+   * that start from sc-construction triples of their chunks. Sc-constructions found for chunks are appended to `result`
+   * in order of chunks, so they are found in the same order as by search in one thread. Sc-constructions of different
+   * chunks differ in sc-connector of the first step, so they aren't duplicated. Each thread except calling one uses
+   * its own sc-memory context of the same user.
+   * @param result A result of search.
+   * @param threadsCount A number of threads used for search including calling thread, 0 means number of hardware
+   * threads.
+   * @throws utils::ExceptionInvalidParams if callbacks of search are set, they can't be called by several threads.
+   * @throws utils::ExceptionInvalidState if sc-template can't be searched.
+   */
+  ScTemplate::Result SearchInParallel(ScTemplateSearchResult & result, size_t threadsCount)
   {
+    if (m_callback || m_callbackWithRequest || m_filterCallback || m_checkCallback)
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidParams,
+          "Callbacks can't be specified for search by sc-template in parallel, because they would be called by several "
+          "threads.");
+
     result.Clear();
-    DoIterations(result);
+    result.m_context = &m_context;
+    if (m_template.IsEmpty())
+      return ScTemplate::Result(false);
+
+    result.m_templateItemsNamesToReplacementItemsPositions = m_plan->m_itemsNamesToReplacementItemsPositions;
+    if (!IsSearchable())
+      return ScTemplate::Result(false);
+
+    ResetIterations();
+    OpenLevel(0);
+    std::vector<ScAddrTriple> rootTriples;
+    ScIterator3Ptr const & rootIterator = m_levels[0].m_iterator;
+    while (rootIterator->Next())
+    {
+      ScAddrTriple const & triple = rootIterator->Get();
+      if (IsTripleAccepted(triple) && IsItemIntersected(0, triple))
+        rootTriples.push_back(triple);
+    }
+    m_levels[0].m_iterator.reset();
 
-    std::vector<ScAddrVector> checkedResults;
-    checkedResults.reserve(result.Size());
-    for (size_t const foundIdx : m_foundReplacementConstructions)
+    if (threadsCount == 0)
+      threadsCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    threadsCount = std::min(threadsCount, rootTriples.size());
+    if (threadsCount <= 1)
     {
-      checkedResults.emplace_back(result.m_replacementConstructions[foundIdx]);
+      SearchFromRootTriples(rootTriples.cbegin(), rootTriples.cend(), result.m_replacementConstructions, *this);
+      return ScTemplate::Result(result.Size() > 0);
     }
+
+    size_t const chunksCount = std::min(rootTriples.size(), threadsCount * PARALLEL_SEARCH_CHUNKS_PER_THREAD);
+    std::vector<ScTemplateSearchResult::SearchResults> chunksConstructions(chunksCount);
+    std::atomic<size_t> nextChunkIdx{0};
+    std::atomic<bool> isFailed{false};
+    std::exception_ptr exception;
+    std::mutex exceptionMutex;
+
+    auto const & SearchChunks = [&](ScMemoryContext & context)
+    {
+      try
+      {
+        ScTemplateSearch search(m_template, context, m_structure, m_plan);
+        search.m_slotsParamsAddrs = m_slotsParamsAddrs;
+        search.m_structureElements = m_structureElements;
+
+        size_t chunkIdx;
+        while (!isFailed && (chunkIdx = nextChunkIdx++) < chunksCount)
+        {
+          auto const & beginIt = rootTriples.cbegin() + chunkIdx * rootTriples.size() / chunksCount;
+          auto const & endIt = rootTriples.cbegin() + (chunkIdx + 1) * rootTriples.size() / chunksCount;
+          search.SearchFromRootTriples(beginIt, endIt, chunksConstructions[chunkIdx], *this);
+        }
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> lock(exceptionMutex);
+        if (!isFailed.exchange(true))
+          exception = std::current_exception();
+      }
+    };
+
+    ScAddr const & userAddr = m_context.GetUser();
+    auto const & SearchChunksInThread = [&]()
+    {
+      ScTemplateSearchThreadContext context(userAddr);
+      SearchChunks(context);
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadsCount - 1);
+    for (size_t i = 1; i < threadsCount; ++i)
+      threads.emplace_back(SearchChunksInThread);
+    SearchChunks(m_context);
+    for (std::thread & thread : threads)
+      thread.join();
+
+    if (exception)
+      std::rethrow_exception(exception);
+
+    size_t constructionsCount = 0;
+    for (auto const & constructions : chunksConstructions)
+      constructionsCount += constructions.size();
+
+    result.m_replacementConstructions.reserve(constructionsCount);
+    for (auto & constructions : chunksConstructions)
+      std::move(constructions.begin(), constructions.end(), std::back_inserter(result.m_replacementConstructions));
+
+    return ScTemplate::Result(result.Size() > 0);
+  }
+
+  ScTemplate::Result operator()(ScTemplateSearchResult & result)
+  {
+    result.Clear();
+    DoIterations(result);
     result.m_context = &m_context;
-    result.m_replacementConstructions.assign(checkedResults.cbegin(), checkedResults.cend());
 
     return ScTemplate::Result(result.Size() > 0);
   }
@@ -1084,37 +1910,91 @@ public:
     return m_template.Size() * 3;
   }
 
+  std::string Explain() const
+  {
+    auto const & ItemToString = [](ScTemplateItem const & item) -> std::string
+    {
+      if (item.IsAddr())
+        return "#" + std::to_string(item.m_addrValue.Hash());
+
+      if (item.HasName())
+        return item.GetPrettyName();
+
+      return "_";
+    };
+
+    std::ostringstream stream;
+    for (size_t i = 0; i < m_plan->m_steps.size(); ++i)
+    {
+      ScTemplateSearchPlanStep const & step = m_plan->m_steps[i];
+      ScTemplateTriple const * triple = m_template.m_templateTriples[step.m_tripleIdx];
+
+      stream << i + 1 << ". " << (step.m_isCheck ? "check" : "iterate") << " triple " << step.m_tripleIdx << " ("
+             << ItemToString((*triple)[0]) << ", " << ItemToString((*triple)[1]) << ", "
+             << ItemToString((*triple)[2]) << ") as " << step.m_pattern << ", estimated count: ";
+      if (step.m_estimatedCount == UNKNOWN_ESTIMATED_COUNT)
+        stream << "unknown";
+      else
+        stream << step.m_estimatedCount;
+
+      if (step.m_intersectionGroupFirstStep == i && step.m_intersectionGroupLastStep == i + 1)
+        stream << ", intersected with step " << i + 2;
+      else if (step.m_intersectionGroupFirstStep == i && step.m_intersectionGroupLastStep > i)
+        stream << ", intersected with steps " << i + 2 << "-" << step.m_intersectionGroupLastStep + 1;
+      stream << "\n";
+    }
+
+    return stream.str();
+  }
+
 private:
   ScTemplate & m_template;
   ScMemoryContext & m_context;
 
   // fields for template preprocessing
-  std::map<std::string, ScTemplateTriples> m_templateItemsNamesToDependedTemplateTriples;
-  ScTemplateTriples m_cycledTemplateTriples;
-  std::vector<ScTemplateTriples> m_connectivityComponentsTemplateTriples;
-  ScTemplateTriples m_connectivityComponentPriorityTemplateTriples;
+  std::shared_ptr<ScTemplateSearchPlan> m_plan;
 
-  // fields search by template
-  std::vector<UsedConnectors> m_notUsedConnectorsInTemplateTriples;
-  std::vector<UsedConnectors> m_usedConnectorsInTemplateTriples;
-  std::vector<UsedConnectors> m_usedConnectorsInReplacementConstructions;
-  std::vector<ScTemplateTriples> m_checkedTemplateTriplesInReplacementConstructions;
+  static constexpr size_t DEFAULT_ESTIMATED_ARCS_COUNT = 64;
+  static constexpr size_t MAX_TYPE_SELECTIVITY_SHIFT = 2;
+  static constexpr size_t UNKNOWN_ESTIMATED_COUNT = std::numeric_limits<size_t>::max();
+  static constexpr size_t PARALLEL_SEARCH_CHUNKS_PER_THREAD = 8;
 
-  size_t const DEFAULT_RESULT_RESERVE_SIZE = 512;
-  size_t m_resultReserveCount = 1;
-  size_t m_lastReplacementConstructionIdx = 0;
-  std::unordered_set<size_t> m_foundReplacementConstructions;
+  // fields search by template
+  std::vector<ScAddr> m_slotsParamsAddrs;
+  std::vector<ScAddr> m_slotsAddrs;
+  std::vector<ScTemplateSearchLevel> m_levels;
+  std::vector<size_t> m_levelsSteps;
+  std::vector<size_t> m_levelsFoundItemsArcsCounts;
+  size_t m_level = 0;
+  ScTemplateSearchIterationsState m_iterationsState = ScTemplateSearchIterationsState::NotStarted;
+  ScAddrVector m_construction;
+  // sc-construction triples of the first step of search plan given by parallel search
+  bool m_hasRootTriples = false;
+  std::vector<ScAddrTriple>::const_iterator m_nextRootTripleIt;
+  std::vector<ScAddrTriple>::const_iterator m_rootTriplesEndIt;
 
   // fields for append result handling
   bool isStopped = false;
 
   ScAddr const m_structure;
+  // sc-elements of sc-structure collected on the first check, they are shared with searches of parallel search
+  std::shared_ptr<ScAddrsBitset const> m_structureElements;
   ScTemplateSearchResultCallback m_callback;
   ScTemplateSearchResultCallbackWithRequest m_callbackWithRequest;
   ScTemplateSearchResultFilterCallback m_filterCallback;
   ScTemplateSearchResultCheckCallback m_checkCallback;
+  // sc-elements passed to check callback and sc-elements accepted by it
+  ScAddrsBitset m_checkedElements;
+  ScAddrsBitset m_acceptedElements;
 };
 
+
+std::string ScTemplate::Explain(ScMemoryContext & context) const
+{
+  ScTemplateSearch search(const_cast<ScTemplate &>(*this), context, ScAddr::Empty);
+  return search.Explain();
+}
+
 ScTemplate::Result ScTemplate::Search(ScMemoryContext & ctx, ScTemplateSearchResult & result) const
 {
   ScTemplateSearch search(const_cast<ScTemplate &>(*this), ctx, ScAddr::Empty);
@@ -1146,3 +2026,215 @@ void ScTemplate::Search(
   search.SetCheckCallback(checkCallback);
   search();
 }
+
+ScTemplate::Result ScTemplate::SearchInParallel(
+    ScMemoryContext & context,
+    ScTemplateSearchResult & result,
+    size_t threadsCount) const
+{
+  ScTemplateSearch search(const_cast<ScTemplate &>(*this), context, ScAddr::Empty);
+  return search.SearchInParallel(result, threadsCount);
+}
+
+ScTemplate::Result ScTemplate::SearchInStructure(
+    ScMemoryContext & context,
+    ScAddr const & structureAddr,
+    ScTemplateSearchResult & result) const
+{
+  ScTemplateSearch search(const_cast<ScTemplate &>(*this), context, structureAddr);
+  return search(result);
+}
+
+ScTemplateSearchCursor ScTemplate::CreateSearchCursor(ScMemoryContext & context, size_t limit) const
+{
+  auto search = std::make_unique<ScTemplateSearch>(const_cast<ScTemplate &>(*this), context, ScAddr::Empty);
+  auto const & replacements = search->GetPlan()->m_itemsNamesToReplacementItemsPositions;
+  return {context, std::move(search), replacements, limit};
+}
+
+ScPreparedTemplate::ScPreparedTemplate(ScMemoryContext & context, ScTemplate && templ, ScTemplateParams const & params)
+  : m_template(std::move(templ))
+{
+  ScTemplateParams::ScTemplateItemsToParams templateItemsToParams;
+  for (auto const & [paramName, paramAddr] : params.GetAll())
+  {
+    std::string templateItemName = paramName;
+    if (!m_template.HasReplacement(templateItemName))
+    {
+      ScAddr const & varAddr = context.SearchElementBySystemIdentifier(paramName);
+      if (!varAddr.IsValid() || !m_template.HasReplacement(varAddr))
+        SC_THROW_EXCEPTION(
+            utils::ExceptionInvalidParams,
+            "The given sc-template hasn't item with name `" << paramName << "` given in parameters.");
+
+      templateItemName = std::to_string(varAddr.Hash());
+    }
+
+    m_paramsNamesToTemplateItemsNames[paramName] = templateItemName;
+    templateItemsToParams[templateItemName] = paramAddr;
+  }
+
+  ScTemplateSearch search(m_template, context, ScAddr::Empty, templateItemsToParams);
+  m_plan = search.GetPlan();
+}
+
+ScPreparedTemplate::ScPreparedTemplate(ScPreparedTemplate && other) noexcept = default;
+
+ScPreparedTemplate::~ScPreparedTemplate() noexcept = default;
+
+std::string ScPreparedTemplate::Explain(ScMemoryContext & context) const
+{
+  ScTemplateSearch search(const_cast<ScTemplate &>(m_template), context, ScAddr::Empty, m_plan);
+  return search.Explain();
+}
+
+ScTemplateParams::ScTemplateItemsToParams ScPreparedTemplate::GetTemplateItemsToParams(
+    ScTemplateParams const & params) const
+{
+  ScTemplateParams::ScTemplateItemsToParams templateItemsToParams;
+  for (auto const & [paramName, paramAddr] : params.GetAll())
+  {
+    auto const & it = m_paramsNamesToTemplateItemsNames.find(paramName);
+    if (it == m_paramsNamesToTemplateItemsNames.cend())
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidParams,
+          "Parameter `" << paramName << "` wasn't specified on preparation of the given sc-template.");
+
+    if (!paramAddr.IsValid())
+      SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Value of parameter `" << paramName << "` is not valid.");
+
+    templateItemsToParams[it->second] = paramAddr;
+  }
+
+  if (templateItemsToParams.size() != m_paramsNamesToTemplateItemsNames.size())
+  {
+    for (auto const & [paramName, templateItemName] : m_paramsNamesToTemplateItemsNames)
+    {
+      if (templateItemsToParams.find(templateItemName) == templateItemsToParams.cend())
+        SC_THROW_EXCEPTION(
+            utils::ExceptionInvalidParams,
+            "Value of parameter `" << paramName << "` of the given sc-template is not given.");
+    }
+  }
+
+  return templateItemsToParams;
+}
+
+ScTemplate::Result ScPreparedTemplate::Search(
+    ScMemoryContext & context,
+    ScTemplateParams const & params,
+    ScTemplateSearchResult & result) const
+{
+  ScTemplateSearch search(const_cast<ScTemplate &>(m_template), context, ScAddr::Empty, m_plan);
+  search.SetParams(GetTemplateItemsToParams(params));
+  return search(result);
+}
+
+void ScPreparedTemplate::Search(
+    ScMemoryContext & context,
+    ScTemplateParams const & params,
+    ScTemplateSearchResultCallback const & callback,
+    ScTemplateSearchResultFilterCallback const & filterCallback,
+    ScTemplateSearchResultCheckCallback const & checkCallback) const
+{
+  ScTemplateSearch search(const_cast<ScTemplate &>(m_template), context, ScAddr::Empty, m_plan);
+  search.SetParams(GetTemplateItemsToParams(params));
+  search.SetCallback(callback);
+  search.SetFilterCallback(filterCallback);
+  search.SetCheckCallback(checkCallback);
+  search();
+}
+
+void ScPreparedTemplate::Search(
+    ScMemoryContext & context,
+    ScTemplateParams const & params,
+    ScTemplateSearchResultCallbackWithRequest const & callback,
+    ScTemplateSearchResultFilterCallback const & filterCallback,
+    ScTemplateSearchResultCheckCallback const & checkCallback) const
+{
+  ScTemplateSearch search(const_cast<ScTemplate &>(m_template), context, ScAddr::Empty, m_plan);
+  search.SetParams(GetTemplateItemsToParams(params));
+  search.SetCallbackWithRequest(callback);
+  search.SetFilterCallback(filterCallback);
+  search.SetCheckCallback(checkCallback);
+  search();
+}
+
+ScTemplate::Result ScPreparedTemplate::SearchInParallel(
+    ScMemoryContext & context,
+    ScTemplateParams const & params,
+    ScTemplateSearchResult & result,
+    size_t threadsCount) const
+{
+  ScTemplateSearch search(const_cast<ScTemplate &>(m_template), context, ScAddr::Empty, m_plan);
+  search.SetParams(GetTemplateItemsToParams(params));
+  return search.SearchInParallel(result, threadsCount);
+}
+
+ScTemplateSearchCursor ScPreparedTemplate::CreateSearchCursor(
+    ScMemoryContext & context,
+    ScTemplateParams const & params,
+    size_t limit) const
+{
+  auto search =
+      std::make_unique<ScTemplateSearch>(const_cast<ScTemplate &>(m_template), context, ScAddr::Empty, m_plan);
+  search->SetParams(GetTemplateItemsToParams(params));
+  return {context, std::move(search), m_plan->m_itemsNamesToReplacementItemsPositions, limit};
+}
+
+ScTemplateSearchCursor::ScTemplateSearchCursor(
+    ScMemoryContext & context,
+    std::unique_ptr<ScTemplateSearch> search,
+    ScTemplate::ScTemplateItemsToReplacementsItemsPositions const & replacements,
+    size_t limit) noexcept
+  : m_search(std::move(search))
+  , m_limit(limit)
+  , m_size(0)
+  , m_hasItem(false)
+  , m_item(&context, replacements)
+{
+}
+
+ScTemplateSearchCursor::ScTemplateSearchCursor(ScTemplateSearchCursor && other) noexcept = default;
+
+ScTemplateSearchCursor & ScTemplateSearchCursor::operator=(ScTemplateSearchCursor && other) noexcept = default;
+
+ScTemplateSearchCursor::~ScTemplateSearchCursor() noexcept = default;
+
+bool ScTemplateSearchCursor::Next()
+{
+  m_hasItem = false;
+  if (!m_search)
+    return false;
+
+  if ((m_limit != 0 && m_size == m_limit) || !m_search->NextConstruction())
+  {
+    // release iterators and search stack as soon as they are not needed
+    m_search.reset();
+    return false;
+  }
+
+  m_item.m_replacementConstruction = m_search->GetConstruction();
+  ++m_size;
+  m_hasItem = true;
+  return true;
+}
+
+ScTemplateSearchResultItem const & ScTemplateSearchCursor::Get() const
+{
+  if (!m_hasItem)
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Cursor has no found sc-construction, call `Next` and check its result first.");
+
+  return m_item;
+}
+
+size_t ScTemplateSearchCursor::Size() const noexcept
+{
+  return m_size;
+}
+
+ScTemplate::ScTemplateItemsToReplacementsItemsPositions const & ScTemplateSearchCursor::GetReplacements() const noexcept
+{
+  return m_item.GetReplacements();
+}
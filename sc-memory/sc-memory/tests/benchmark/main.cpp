@@ -18,7 +18,10 @@
 
 #include "units/sc_code_base_vs_extend.hpp"
 
+#include "units/template_build.hpp"
+#include "units/template_generate.hpp"
 #include "units/template_search_complex.hpp"
+#include "units/template_search_intersection.hpp"
 #include "units/template_search_smoke.hpp"
 
 #include <atomic>
@@ -532,10 +535,34 @@ BENCHMARK_TEMPLATE(BM_Template, TestTemplateSearchSmoke)
 ->Unit(benchmark::TimeUnit::kMicrosecond)
 ->Arg(5)->Arg(50)->Arg(500);
 
+BENCHMARK_TEMPLATE(BM_Template, TestTemplateSearchSmokePrepared)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(5)->Arg(50)->Arg(500);
+
 BENCHMARK_TEMPLATE(BM_Template, TestTemplateSearchComplex)
 ->Unit(benchmark::TimeUnit::kMicrosecond)
 ->Arg(5)->Arg(50);
 
+BENCHMARK_TEMPLATE(BM_Template, TestTemplateSearchIntersection)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(50)->Arg(500);
+
+BENCHMARK_TEMPLATE(BM_Template, TestTemplateGenerateOneByOne)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(5)->Arg(50);
+
+BENCHMARK_TEMPLATE(BM_Template, TestTemplateGenerateByParamsList)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(5)->Arg(50);
+
+BENCHMARK_TEMPLATE(BM_Template, TestTemplateBuildFromStructure)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(5)->Arg(50);
+
+BENCHMARK_TEMPLATE(BM_Template, TestTemplateBuildCachedFromStructure)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(5)->Arg(50);
+
 // SC-code base vs extended
 BENCHMARK_TEMPLATE(BM_Template, TestScCodeBase)
 ->Unit(benchmark::TimeUnit::kMicrosecond)
@@ -0,0 +1,60 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "template_test.hpp"
+
+class TestTemplateBuild : public TestTemplate
+{
+public:
+  void Setup(size_t constrCount) override
+  {
+    ScAddr const relationAddr = m_ctx->GenerateNode(ScType::ConstNodeNonRole);
+    ScAddr const classAddr = m_ctx->GenerateNode(ScType::VarNodeClass);
+
+    m_structureAddr = m_ctx->GenerateNode(ScType::ConstNodeStructure);
+    AppendToStructure({relationAddr, classAddr});
+
+    for (size_t i = 0; i < constrCount; ++i)
+    {
+      ScAddr const linkAddr = m_ctx->GenerateNode(ScType::VarNodeLink);
+      ScAddr const connectorAddr = m_ctx->GenerateConnector(ScType::VarCommonArc, classAddr, linkAddr);
+      ScAddr const arcAddr = m_ctx->GenerateConnector(ScType::VarPermPosArc, relationAddr, connectorAddr);
+      AppendToStructure({linkAddr, connectorAddr, arcAddr});
+    }
+  }
+
+  void AppendToStructure(std::initializer_list<ScAddr> const & elementAddrs)
+  {
+    for (ScAddr const & elementAddr : elementAddrs)
+      m_ctx->GenerateConnector(ScType::ConstPermPosArc, m_structureAddr, elementAddr);
+  }
+
+protected:
+  ScAddr m_structureAddr;
+};
+
+class TestTemplateBuildFromStructure : public TestTemplateBuild
+{
+public:
+  bool Run()
+  {
+    ScTemplate templ;
+    m_ctx->BuildTemplate(templ, m_structureAddr);
+
+    return !templ.IsEmpty();
+  }
+};
+
+class TestTemplateBuildCachedFromStructure : public TestTemplateBuild
+{
+public:
+  bool Run()
+  {
+    return !m_ctx->BuildCachedTemplate(m_structureAddr)->IsEmpty();
+  }
+};
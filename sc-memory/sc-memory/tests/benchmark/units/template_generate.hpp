@@ -0,0 +1,64 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "template_test.hpp"
+
+#include <vector>
+
+class TestTemplateGenerate : public TestTemplate
+{
+public:
+  void Setup(size_t constrCount) override
+  {
+    ScAddr const relationAddr = m_ctx->GenerateNode(ScType::ConstNodeNonRole);
+    m_paramsList.resize(constrCount);
+    for (ScTemplateParams & params : m_paramsList)
+      params.Add("_class", m_ctx->GenerateNode(ScType::ConstNodeClass));
+
+    m_templ.Quintuple(
+          ScType::VarNodeClass >> "_class",
+          ScType::VarCommonArc,
+          ScType::VarNodeLink,
+          ScType::VarPermPosArc,
+          relationAddr);
+    m_templ.Triple(
+          "_class",
+          ScType::VarPermPosArc,
+          ScType::VarNode);
+  }
+
+protected:
+  std::vector<ScTemplateParams> m_paramsList;
+};
+
+class TestTemplateGenerateOneByOne : public TestTemplateGenerate
+{
+public:
+  bool Run()
+  {
+    for (ScTemplateParams const & params : m_paramsList)
+    {
+      ScTemplateGenResult result;
+      m_ctx->GenerateByTemplate(m_templ, result, params);
+    }
+
+    return true;
+  }
+};
+
+class TestTemplateGenerateByParamsList : public TestTemplateGenerate
+{
+public:
+  bool Run()
+  {
+    std::vector<ScTemplateGenResult> results;
+    m_ctx->GenerateByTemplate(m_templ, m_paramsList, results);
+
+    return results.size() == m_paramsList.size();
+  }
+};
@@ -0,0 +1,39 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "template_test.hpp"
+
+class TestTemplateSearchIntersection : public TestTemplate
+{
+public:
+  void Setup(size_t constrCount) override
+  {
+    ScAddr const classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+    ScAddr const setAddr = m_ctx->GenerateNode(ScType::ConstNode);
+    for (size_t i = 0; i < constrCount; ++i)
+    {
+      ScAddr const elementAddr = m_ctx->GenerateNode(ScType::ConstNode);
+      m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, elementAddr);
+      if (i % 10 == 0)
+        m_ctx->GenerateConnector(ScType::ConstPermPosArc, elementAddr, setAddr);
+    }
+
+    // set has much more incoming sc-arcs than elements of class
+    for (size_t i = 0; i < constrCount * 10; ++i)
+      m_ctx->GenerateConnector(ScType::ConstPermPosArc, m_ctx->GenerateNode(ScType::ConstNode), setAddr);
+
+    m_templ.Triple(
+          classAddr,
+          ScType::VarPermPosArc,
+          ScType::VarNode >> "_element");
+    m_templ.Triple(
+          "_element",
+          ScType::VarPermPosArc,
+          setAddr);
+  }
+};
@@ -26,3 +26,35 @@ public:
           ScType::VarNodeStructure);
   }
 };
+
+class TestTemplateSearchSmokePrepared : public TestTemplateSearchSmoke
+{
+public:
+  void Setup(size_t constrCount) override
+  {
+    ScAddr const node = m_ctx->GenerateNode(ScType::ConstNode);
+    for (uint32_t i = 0; i < constrCount; ++i)
+    {
+      ScAddr const trg = m_ctx->GenerateNode(ScType::ConstNodeStructure);
+      m_ctx->GenerateConnector(ScType::ConstPermPosArc, node, trg);
+    }
+
+    m_params.Add("_node", node);
+
+    m_templ.Triple(
+          ScType::VarNode >> "_node",
+          ScType::VarPermPosArc,
+          ScType::VarNodeStructure);
+    m_preparedTempl = std::make_unique<ScPreparedTemplate>(*m_ctx, std::move(m_templ), m_params);
+  }
+
+  bool Run()
+  {
+    ScTemplateSearchResult result;
+    return m_ctx->SearchByTemplate(*m_preparedTempl, m_params, result);
+  }
+
+protected:
+  ScTemplateParams m_params;
+  std::unique_ptr<ScPreparedTemplate> m_preparedTempl;
+};
@@ -176,6 +176,56 @@ TEST_F(ScAgentBuilderTest, ProgrammlySpecifiedAgentHasFullSpecificationWithTempl
   module.Unregister(&*m_ctx);
 }
 
+TEST_F(ScAgentBuilderTest, ProgrammlySpecifiedAgentUsesChangedSpecification)
+{
+  ATestSpecifiedAgent::msWaiter.Reset();
+
+  ScAddr const & abstractAgentAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, ScKeynodes::abstract_sc_agent, abstractAgentAddr);
+
+  ScAddr const & actionClassAddr =
+      m_ctx->ResolveElementSystemIdentifier("test_specified_agent_action", ScType::ConstNodeClass);
+  ScAddr const & arcAddr =
+      m_ctx->GenerateConnector(ScType::ConstCommonArc, ScKeynodes::information_action, actionClassAddr);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, ScKeynodes::nrel_inclusion, arcAddr);
+
+  TestModule module;
+  module.AgentBuilder<ATestSpecifiedAgent>()
+      ->SetAbstractAgent(abstractAgentAddr)
+      ->SetPrimaryInitiationCondition({ScKeynodes::sc_event_after_generate_outgoing_arc, ScKeynodes::action_initiated})
+      ->SetActionClass(ATestSpecifiedAgent::test_specified_agent_action)
+      ->SetInitiationConditionAndResult(
+          {ATestSpecifiedAgent::test_specified_agent_initiation_condition,
+           ATestSpecifiedAgent::test_specified_agent_result_condition})
+      ->FinishBuild();
+  module.Register(&*m_ctx);
+
+  m_ctx->GenerateAction(ATestSpecifiedAgent::test_specified_agent_action).SetArguments().Initiate();
+  EXPECT_TRUE(ATestSpecifiedAgent::msWaiter.Wait());
+
+  // Specify new action class of the abstract agent and deactivate it, the agent must use this action class.
+  ScIterator5Ptr const it5 = m_ctx->CreateIterator5(
+      abstractAgentAddr,
+      ScType::ConstCommonArc,
+      ScType::ConstNodeClass,
+      ScType::ConstPermPosArc,
+      ScKeynodes::nrel_sc_agent_action_class);
+  EXPECT_TRUE(it5->Next());
+  m_ctx->EraseElement(it5->Get(1));
+
+  ScAddr const & newActionClassAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddr const & newArcAddr = m_ctx->GenerateConnector(ScType::ConstCommonArc, abstractAgentAddr, newActionClassAddr);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, ScKeynodes::nrel_sc_agent_action_class, newArcAddr);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, ScKeynodes::action_deactivated, newActionClassAddr);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+  ATestSpecifiedAgent::msWaiter.Reset();
+  m_ctx->GenerateAction(ATestSpecifiedAgent::test_specified_agent_action).SetArguments().Initiate();
+  EXPECT_FALSE(ATestSpecifiedAgent::msWaiter.Wait(0.2));
+
+  module.Unregister(&*m_ctx);
+}
+
 TEST_F(ScAgentBuilderTest, ProgrammlySpecifiedAgentHasFullSpecificationWithTemplateKeynodesInKB)
 {
   ATestSpecifiedAgent::msWaiter.Reset();
@@ -558,3 +608,35 @@ TEST_F(ScAgentBuilderTest, ProgrammlySpecifiedAgentSetInvalidConditionResult)
   EXPECT_THROW(module.Register(&*m_ctx), utils::ExceptionInvalidParams);
   EXPECT_THROW(module.Unregister(&*m_ctx), utils::ExceptionInvalidState);
 }
+
+TEST_F(ScAgentBuilderTest, AgentSpecificationCacheChecksSpecificationConnectors)
+{
+  ScAddr const & agentImplementationAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const & abstractAgentAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const & arcAddr =
+      m_ctx->GenerateConnector(ScType::ConstCommonArc, abstractAgentAddr, agentImplementationAddr);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, ScKeynodes::nrel_inclusion, arcAddr);
+
+  auto specification = std::make_shared<ScAgentSpecification>();
+  specification->abstractAgentAddr = abstractAgentAddr;
+  specification->connectorsAddrs =
+      ScAgentSpecificationCache::CollectConnectors(*m_ctx, agentImplementationAddr, abstractAgentAddr);
+  EXPECT_EQ(specification->connectorsAddrs.size(), 4u);
+
+  ScAgentSpecificationCache cache;
+  EXPECT_EQ(cache.Get(*m_ctx, agentImplementationAddr), nullptr);
+  cache.Set(specification);
+  EXPECT_EQ(cache.Get(*m_ctx, agentImplementationAddr), specification);
+
+  // changes of agent specification are seen by the next call without waiting for sc-events
+  ScAddr const & actionClassAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddr const & actionClassArcAddr =
+      m_ctx->GenerateConnector(ScType::ConstCommonArc, abstractAgentAddr, actionClassAddr);
+  EXPECT_EQ(cache.Get(*m_ctx, agentImplementationAddr), nullptr);
+
+  m_ctx->EraseElement(actionClassArcAddr);
+  EXPECT_EQ(cache.Get(*m_ctx, agentImplementationAddr), specification);
+
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, ScKeynodes::action_deactivated, arcAddr);
+  EXPECT_EQ(cache.Get(*m_ctx, agentImplementationAddr), nullptr);
+}
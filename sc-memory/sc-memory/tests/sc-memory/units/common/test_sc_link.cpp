@@ -207,6 +207,118 @@ TEST_F(ScLinkTest, content_changed)
   ctx.Destroy();
 }
 
+TEST_F(ScLinkTest, append_content_and_read_by_chunks)
+{
+  ScMemoryContext ctx;
+
+  ScAddr const linkAddr = ctx.GenerateLink();
+  EXPECT_TRUE(ctx.SetLinkContent(linkAddr, "content"));
+  EXPECT_FALSE(ctx.SearchLinksByContent("content").empty());
+
+  // small texts with appended parts are found by their new contents
+  EXPECT_TRUE(ctx.AppendLinkContent(linkAddr, ScStreamMakeRead(std::string(" text"))));
+  EXPECT_EQ(ctx.SearchLinksByContent("content text"), ScAddrSet({linkAddr}));
+  EXPECT_TRUE(ctx.SetLinkContent(linkAddr, "content"));
+
+  std::string const binaryChunk("\0chunk\0", 7);
+  std::string const bigChunk(100000, 'c');
+  EXPECT_TRUE(ctx.AppendLinkContent(linkAddr, ScStreamMakeRead(binaryChunk)));
+  EXPECT_TRUE(ctx.AppendLinkContent(linkAddr, ScStreamMakeRead(bigChunk)));
+  EXPECT_TRUE(ctx.AppendLinkContent(linkAddr, ScStreamMakeRead(std::string())));
+
+  // contents with appended parts aren't found by contents
+  std::string const content = "content" + binaryChunk + bigChunk;
+  std::string linkContent;
+  EXPECT_TRUE(ctx.GetLinkContent(linkAddr, linkContent));
+  EXPECT_EQ(linkContent, content);
+  EXPECT_TRUE(ctx.SearchLinksByContent("content").empty());
+
+  ScStreamPtr const & stream = ctx.OpenLinkContentStream(linkAddr);
+  EXPECT_TRUE(stream->IsValid());
+  EXPECT_EQ(stream->Size(), content.size());
+
+  std::string readContent;
+  sc_char chunk[4096];
+  size_t readBytes = 0;
+  while (stream->Read(chunk, sizeof(chunk), readBytes) && readBytes != 0)
+    readContent.append(chunk, readBytes);
+  EXPECT_TRUE(stream->Eof());
+  EXPECT_EQ(readContent, content);
+
+  EXPECT_TRUE(stream->Seek(SC_STREAM_SEEK_SET, 7));
+  EXPECT_TRUE(stream->Read(chunk, binaryChunk.size(), readBytes));
+  EXPECT_EQ(std::string(chunk, readBytes), binaryChunk);
+
+  // new content replaces appended parts
+  ScStreamPtr const & replacedContentStream = ctx.OpenLinkContentStream(linkAddr);
+  EXPECT_TRUE(ctx.SetLinkContent(linkAddr, "content"));
+  EXPECT_TRUE(ctx.GetLinkContent(linkAddr, linkContent));
+  EXPECT_EQ(linkContent, "content");
+  // removed appended parts aren't read as empty ones before end of stream
+  EXPECT_FALSE(replacedContentStream->Read(chunk, sizeof(chunk), readBytes));
+  EXPECT_FALSE(replacedContentStream->Eof());
+  EXPECT_FALSE(ctx.SearchLinksByContent("content").empty());
+  EXPECT_EQ(ctx.OpenLinkContentStream(linkAddr)->Size(), 7u);
+
+  ScAddr const emptyLinkAddr = ctx.GenerateLink();
+  EXPECT_EQ(ctx.OpenLinkContentStream(emptyLinkAddr)->Size(), 0u);
+  EXPECT_TRUE(ctx.AppendLinkContent(emptyLinkAddr, ScStreamMakeRead(binaryChunk)));
+  EXPECT_TRUE(ctx.GetLinkContent(emptyLinkAddr, linkContent));
+  EXPECT_EQ(linkContent, binaryChunk);
+
+  ScAddr const nodeAddr = ctx.GenerateNode(ScType::ConstNode);
+  EXPECT_THROW(ctx.AppendLinkContent(nodeAddr, ScStreamMakeRead(binaryChunk)), utils::ExceptionInvalidParams);
+  EXPECT_THROW(ctx.AppendLinkContent(linkAddr, ScStreamPtr()), utils::ExceptionInvalidParams);
+  EXPECT_THROW(ctx.OpenLinkContentStream(nodeAddr), utils::ExceptionInvalidParams);
+  EXPECT_THROW(ctx.OpenLinkContentStream(ScAddr::Empty), utils::ExceptionInvalidParams);
+
+  ctx.Destroy();
+}
+
+TEST_F(ScLinkTest, set_links_contents)
+{
+  ScMemoryContext ctx;
+
+  ScAddr const existingLinkAddr = ctx.GenerateLink();
+  EXPECT_TRUE(ctx.SetLinkContent(existingLinkAddr, "bulk content 0"));
+
+  // links are divided into terms by several workers
+  ScAddrVector linkAddrs;
+  std::vector<std::string> linkContents;
+  for (size_t i = 0; i < 2000; ++i)
+  {
+    linkAddrs.push_back(ctx.GenerateLink());
+    linkContents.push_back("bulk content " + std::to_string(i % 1000));
+  }
+  linkAddrs.push_back(ctx.GenerateLink());
+  linkContents.push_back(std::string(2000000, 'b'));
+  linkAddrs.push_back(existingLinkAddr);
+  linkContents.push_back("other bulk content");
+
+  EXPECT_TRUE(ctx.SetLinksContents(linkAddrs, linkContents));
+
+  std::string linkContent;
+  for (size_t i = 0; i < linkAddrs.size(); ++i)
+  {
+    EXPECT_TRUE(ctx.GetLinkContent(linkAddrs[i], linkContent));
+    EXPECT_EQ(linkContent, linkContents[i]);
+  }
+
+  EXPECT_EQ(ctx.SearchLinksByContent("bulk content 0").size(), 2u);
+  EXPECT_EQ(ctx.SearchLinksByContent("bulk content 999").size(), 2u);
+  EXPECT_EQ(ctx.SearchLinksByContent("other bulk content").size(), 1u);
+  EXPECT_EQ(ctx.SearchLinksByContentSubstring("content 99").size(), 22u);
+  EXPECT_TRUE(ctx.SetLinksContents({}, {}));
+
+  ScAddr const nodeAddr = ctx.GenerateNode(ScType::ConstNode);
+  EXPECT_THROW(ctx.SetLinksContents({linkAddrs[0], nodeAddr}, {"first", "second"}), utils::ExceptionInvalidParams);
+  EXPECT_THROW(ctx.SetLinksContents({linkAddrs[0]}, {}), utils::ExceptionInvalidParams);
+  EXPECT_TRUE(ctx.GetLinkContent(linkAddrs[0], linkContent));
+  EXPECT_EQ(linkContent, linkContents[0]);
+
+  ctx.Destroy();
+}
+
 TEST_F(ScLinkTest, set_system_idtf)
 {
   ScMemoryContext ctx;
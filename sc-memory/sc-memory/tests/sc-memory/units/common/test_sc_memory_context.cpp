@@ -2203,3 +2203,73 @@ TEST_F(ScMemoryTestWithUserMode, HandleElementsByAuthenticatedUserWithLocalReadP
   SC_LOCK_WAIT_WHILE_TRUE(!isAuthenticated.load());
   EXPECT_TRUE(isAuthenticated.load());
 }
+
+class ScMemoryTestWithUserModeAndBoundedEventsQueue : public ScMemoryTest
+{
+  virtual void SetUp()
+  {
+    sc_memory_params params;
+    sc_memory_params_clear(&params);
+
+    params.dump_memory = SC_FALSE;
+    params.dump_memory_statistics = SC_FALSE;
+
+    params.clear = SC_TRUE;
+    params.storage = "repo";
+    params.log_level = "Debug";
+
+    params.user_mode = SC_TRUE;
+    params.max_events_queue_size = 1;
+    params.events_queue_overflow_policy = "Coalesce";
+
+    ScMemory::LogMute();
+    ScMemory::Initialize(params);
+    ScMemory::LogUnmute();
+
+    m_ctx = std::make_unique<TestScMemoryContext>(ScKeynodes::myself);
+  }
+};
+
+TEST_F(ScMemoryTestWithUserModeAndBoundedEventsQueue, HandleElementsByUserAuthenticatedWhenEventsQueueIsFull)
+{
+  ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  std::atomic_bool isReleased = false;
+  auto eventSubscription =
+      m_ctx->CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+          nodeAddr,
+          [&isReleased](ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const &)
+          {
+            while (!isReleased)
+              std::this_thread::sleep_for(std::chrono::milliseconds(1));
+          });
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  // Sc-events of sc-memory permissions subscriptions are admitted to the full queue
+  ScAddr const & userAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  TestAddAllPermissionsForUserToInitActions(m_ctx, userAddr);
+  TestAuthenticationRequestUser(m_ctx, userAddr);
+
+  sc_events_stat stat;
+  EXPECT_EQ(sc_memory_events_stat(**m_ctx, &stat), SC_RESULT_OK);
+  EXPECT_EQ(stat.coalesced_events_count, 0u);
+
+  isReleased = true;
+
+  TestScMemoryContext userContext{userAddr};
+  auto const & isUserAuthenticated = [&]()
+  {
+    try
+    {
+      return userContext.IsElement(nodeAddr);
+    }
+    catch (utils::ExceptionInvalidState const &)
+    {
+      return false;
+    }
+  };
+  SC_LOCK_WAIT_WHILE_TRUE(!isUserAuthenticated());
+  EXPECT_TRUE(isUserAuthenticated());
+
+  TestActionsSuccessfully(m_ctx, userContext);
+}
@@ -87,6 +87,341 @@ TEST(ScEventQueueTest, EventsQueueDestroy)
   ScMemory::Shutdown();
 }
 
+TEST(ScEventQueueTest, EventsQueueAdmitsEraseEventsWhenFull)
+{
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+  params.clear = SC_TRUE;
+  params.storage = "repo";
+  params.log_level = "Debug";
+  params.max_events_queue_size = 1;
+  params.events_queue_overflow_policy = "Coalesce";
+
+  ScMemory::Initialize(params);
+
+  ScAgentContext ctx;
+
+  ScAddr const blockingNode = ctx.GenerateNode(ScType::ConstNode);
+  ScAddr const generateNode = ctx.GenerateNode(ScType::ConstNode);
+  ScAddr const eraseNode = ctx.GenerateNode(ScType::ConstNode);
+
+  std::atomic_bool isReleased = false;
+  std::atomic_bool isGenerateEventProcessed = false;
+  std::atomic_bool isEraseEventProcessed = false;
+
+  auto blockingSubscription =
+      ctx.CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+          blockingNode,
+          [&isReleased](ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const &)
+          {
+            while (!isReleased)
+              std::this_thread::sleep_for(std::chrono::milliseconds(1));
+          });
+  auto generateSubscription =
+      ctx.CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+          generateNode,
+          [&isGenerateEventProcessed](ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const &)
+          {
+            isGenerateEventProcessed = true;
+          });
+  auto eraseSubscription = ctx.CreateElementaryEventSubscription<ScEventBeforeEraseElement>(
+      eraseNode,
+      [&isEraseEventProcessed](ScEventBeforeEraseElement const &)
+      {
+        isEraseEventProcessed = true;
+      });
+
+  ctx.GenerateConnector(ScType::ConstPermPosArc, blockingNode, ctx.GenerateNode(ScType::ConstNode));
+  ctx.GenerateConnector(ScType::ConstPermPosArc, generateNode, ctx.GenerateNode(ScType::ConstNode));
+  EXPECT_TRUE(ctx.EraseElement(eraseNode));
+
+  sc_events_stat stat;
+  EXPECT_EQ(sc_memory_events_stat(*ctx, &stat), SC_RESULT_OK);
+  EXPECT_EQ(stat.events_count, 2u);
+  EXPECT_EQ(stat.coalesced_events_count, 1u);
+
+  isReleased = true;
+
+  ScTimer timer(5);
+  while (!isEraseEventProcessed && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  EXPECT_TRUE(isEraseEventProcessed);
+  EXPECT_FALSE(isGenerateEventProcessed);
+
+  ctx.Destroy();
+  ScMemory::Shutdown();
+}
+
+TEST(ScEventQueueTest, EventsQueueCoalescesEventsWhenFull)
+{
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+  params.clear = SC_TRUE;
+  params.storage = "repo";
+  params.log_level = "Debug";
+  params.max_events_queue_size = 1;
+  params.events_queue_overflow_policy = "Coalesce";
+
+  ScMemory::Initialize(params);
+
+  ScAgentContext ctx;
+
+  ScAddr const node = ctx.GenerateNode(ScType::ConstNode);
+
+  size_t const count = 10;
+  std::atomic_bool isReleased = false;
+  std::atomic_size_t processedCount = 0;
+
+  auto eventSubscription =
+      ctx.CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+          node,
+          [&](ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const &)
+          {
+            while (!isReleased)
+              std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            ++processedCount;
+          });
+
+  for (size_t i = 0; i < count; ++i)
+    ctx.GenerateConnector(ScType::ConstPermPosArc, node, ctx.GenerateNode(ScType::ConstNode));
+
+  sc_events_stat stat;
+  EXPECT_EQ(sc_memory_events_stat(*ctx, &stat), SC_RESULT_OK);
+  EXPECT_EQ(stat.events_count, 1u);
+  EXPECT_EQ(stat.max_events_count, 1u);
+  EXPECT_EQ(stat.coalesced_events_count, count - 1);
+
+  isReleased = true;
+
+  ScTimer timer(5);
+  while (processedCount == 0 && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  EXPECT_EQ(processedCount, 1u);
+
+  ctx.Destroy();
+  ScMemory::Shutdown();
+}
+
+TEST(ScEventQueueTest, EventsQueueBacksOffEmittersWhenFull)
+{
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+  params.clear = SC_TRUE;
+  params.storage = "repo";
+  params.log_level = "Debug";
+  params.max_events_queue_size = 1;
+  params.events_queue_overflow_policy = "Backoff";
+
+  ScMemory::Initialize(params);
+
+  ScAgentContext ctx;
+
+  ScAddr const node = ctx.GenerateNode(ScType::ConstNode);
+
+  size_t const count = 5;
+  std::atomic_size_t processedCount = 0;
+
+  auto eventSubscription =
+      ctx.CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+          node,
+          [&](ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const &)
+          {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            ++processedCount;
+          });
+
+  for (size_t i = 0; i < count; ++i)
+    ctx.GenerateConnector(ScType::ConstPermPosArc, node, ctx.GenerateNode(ScType::ConstNode));
+
+  ScTimer timer(5);
+  while (processedCount < count && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  EXPECT_EQ(processedCount, count);
+
+  sc_events_stat stat;
+  EXPECT_EQ(sc_memory_events_stat(*ctx, &stat), SC_RESULT_OK);
+  EXPECT_EQ(stat.max_reached_events_count, 1u);
+  EXPECT_EQ(stat.coalesced_events_count, 0u);
+  EXPECT_EQ(stat.overflowed_events_count, 0u);
+
+  ctx.Destroy();
+  ScMemory::Shutdown();
+}
+
+TEST(ScEventQueueTest, EventsQueueOverflowsAfterBackoff)
+{
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+  params.clear = SC_TRUE;
+  params.storage = "repo";
+  params.log_level = "Debug";
+  params.max_events_queue_size = 1;
+  params.events_queue_overflow_policy = "Backoff";
+
+  ScMemory::Initialize(params);
+
+  ScAgentContext ctx;
+
+  ScAddr const node = ctx.GenerateNode(ScType::ConstNode);
+
+  size_t const count = 3;
+  std::atomic_size_t processedCount = 0;
+
+  auto eventSubscription =
+      ctx.CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+          node,
+          [&](ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const &)
+          {
+            std::this_thread::sleep_for(std::chrono::milliseconds(500));
+            ++processedCount;
+          });
+
+  for (size_t i = 0; i < count; ++i)
+    ctx.GenerateConnector(ScType::ConstPermPosArc, node, ctx.GenerateNode(ScType::ConstNode));
+
+  sc_events_stat stat;
+  EXPECT_EQ(sc_memory_events_stat(*ctx, &stat), SC_RESULT_OK);
+  EXPECT_EQ(stat.overflowed_events_count, count - 1);
+  EXPECT_GT(stat.overshoot_events_count, 0u);
+
+  ScTimer timer(5);
+  while (processedCount < count && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  EXPECT_EQ(processedCount, count);
+
+  EXPECT_EQ(sc_memory_events_stat(*ctx, &stat), SC_RESULT_OK);
+  EXPECT_EQ(stat.max_reached_events_count, count);
+  EXPECT_EQ(stat.overshoot_events_count, 0u);
+  EXPECT_EQ(stat.coalesced_events_count, 0u);
+
+  ctx.Destroy();
+  ScMemory::Shutdown();
+}
+
+TEST(ScEventQueueTest, EventsPoolReusesEventRecords)
+{
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+  params.clear = SC_TRUE;
+  params.storage = "repo";
+  params.log_level = "Debug";
+  params.max_events_and_agents_threads = 1;
+
+  ScMemory::Initialize(params);
+
+  ScAgentContext ctx;
+
+  ScAddr const node = ctx.GenerateNode(ScType::ConstNode);
+
+  size_t const count = 2000;
+  std::atomic_size_t processedCount = 0;
+
+  auto eventSubscription =
+      ctx.CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+          node,
+          [&processedCount](ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const &)
+          {
+            ++processedCount;
+          });
+
+  auto const & GenerateArcs = [&](size_t const arcsCount)
+  {
+    for (size_t i = 0; i < arcsCount; ++i)
+      ctx.GenerateConnector(ScType::ConstPermPosArc, node, ctx.GenerateNode(ScType::ConstNode));
+  };
+
+  auto const & WaitProcessedEvents = [&](size_t const eventsCount)
+  {
+    ScTimer timer(10);
+    while (processedCount < eventsCount && !timer.IsTimeOut())
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    EXPECT_EQ(processedCount, eventsCount);
+  };
+
+  GenerateArcs(count);
+  WaitProcessedEvents(count);
+
+  GenerateArcs(count / 2);
+  WaitProcessedEvents(count + count / 2);
+
+  sc_events_stat stat;
+  EXPECT_EQ(sc_memory_events_stat(*ctx, &stat), SC_RESULT_OK);
+  EXPECT_EQ(stat.events_pool_hits_count + stat.events_pool_misses_count, count + count / 2);
+  EXPECT_GE(stat.events_pool_hits_count, count / 2);
+
+  ctx.Destroy();
+  ScMemory::Shutdown();
+}
+
+TEST(ScEventQueueTest, ElementErasureDoesNotBlockOtherEmitters)
+{
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+  params.clear = SC_TRUE;
+  params.storage = "repo";
+  params.log_level = "Debug";
+
+  ScMemory::Initialize(params);
+
+  ScAgentContext ctx;
+
+  ScAddr const node = ctx.GenerateNode(ScType::ConstNode);
+  ScAddr const otherNode = ctx.GenerateNode(ScType::ConstNode);
+
+  std::atomic_bool isCallbackStarted = false;
+  std::atomic_bool isCallbackReleased = false;
+
+  auto eventSubscription =
+      ctx.CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+          node,
+          [&](ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const &)
+          {
+            isCallbackStarted = true;
+            while (!isCallbackReleased)
+              std::this_thread::sleep_for(std::chrono::milliseconds(1));
+          });
+
+  ctx.GenerateConnector(ScType::ConstPermPosArc, node, ctx.GenerateNode(ScType::ConstNode));
+
+  ScTimer startTimer(5);
+  while (!isCallbackStarted && !startTimer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  EXPECT_TRUE(isCallbackStarted);
+
+  // Erasure of the node waits for the running callback of its sc-event subscription
+  std::thread eraser(
+      [&node]()
+      {
+        ScMemoryContext eraserCtx;
+        eraserCtx.EraseElement(node);
+      });
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  // Emitters of sc-events of other sc-elements aren't blocked by this erasure
+  std::atomic_bool isConnectorGenerated = false;
+  std::thread emitter(
+      [&otherNode, &isConnectorGenerated]()
+      {
+        ScMemoryContext emitterCtx;
+        emitterCtx.GenerateConnector(ScType::ConstPermPosArc, otherNode, emitterCtx.GenerateNode(ScType::ConstNode));
+        isConnectorGenerated = true;
+      });
+
+  ScTimer emitTimer(5);
+  while (!isConnectorGenerated && !emitTimer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  EXPECT_TRUE(isConnectorGenerated);
+
+  isCallbackReleased = true;
+  emitter.join();
+  eraser.join();
+
+  EXPECT_FALSE(ctx.IsElement(node));
+
+  ctx.Destroy();
+  ScMemory::Shutdown();
+}
+
 double const kTestTimeout = 0.1;
 
 template <ScType const & subscriptionConnectorType, ScType const & eventConnectorType>
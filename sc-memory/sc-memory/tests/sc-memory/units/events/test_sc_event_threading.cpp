@@ -104,3 +104,42 @@ TEST_F(ScEventTest, ThreadingSmoke)
 
   eventSubscriptions.clear();
 }
+
+TEST_F(ScEventTest, EventsOfOneSubscriptionAreProcessedInEmissionOrder)
+{
+  size_t const arcsCount = 5000;
+
+  ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const otherNodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  std::vector<ScAddr> emittedArcs(arcsCount);
+  std::vector<ScAddr> processedArcs(arcsCount);
+  std::atomic_size_t processedArcsCount = {0};
+  std::atomic_bool isProcessedConcurrently = {false};
+  std::atomic_bool isProcessing = {false};
+
+  auto eventSubscription =
+      m_ctx->CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+          nodeAddr,
+          [&](ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const & event)
+          {
+            if (isProcessing.exchange(true))
+              isProcessedConcurrently = true;
+
+            processedArcs[processedArcsCount] = event.GetArc();
+            ++processedArcsCount;
+
+            isProcessing = false;
+          });
+
+  for (size_t i = 0; i < arcsCount; ++i)
+    emittedArcs[i] = m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, otherNodeAddr);
+
+  ScTimer timer(10);
+  while (processedArcsCount < arcsCount && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  EXPECT_EQ(processedArcsCount, arcsCount);
+  EXPECT_FALSE(isProcessedConcurrently);
+  EXPECT_EQ(processedArcs, emittedArcs);
+}
@@ -4,6 +4,9 @@
  * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
  */
 
+#include <thread>
+#include <chrono>
+
 #include <sc-memory/sc_memory.hpp>
 #include <sc-memory/sc_structure.hpp>
 
@@ -150,3 +153,178 @@ TEST_F(ScTemplateBuildTest, GenWithParams)
 
   EXPECT_FALSE(searchResult[0].Has(ScAddr::Empty));
 }
+
+TEST_F(ScTemplateBuildTest, BuildCachedTemplateFromStructure)
+{
+  ScAddr const addr1 = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const addr2 = m_ctx->GenerateNode(ScType::VarNode);
+  ScAddr const addr3 = m_ctx->GenerateNode(ScType::VarNode);
+  ScAddr const arc1 = m_ctx->GenerateConnector(ScType::VarPermPosArc, addr1, addr2);
+  ScAddr const arc2 = m_ctx->GenerateConnector(ScType::VarPermPosArc, addr1, addr3);
+
+  ScAddr const structAddr = m_ctx->GenerateNode(ScType::ConstNodeStructure);
+  ScStructure st = m_ctx->ConvertToStructure(structAddr);
+  st << addr1 << addr2 << arc1;
+
+  auto const & templ = m_ctx->BuildCachedTemplate(structAddr);
+  EXPECT_EQ(templ->Size(), 1u);
+  EXPECT_EQ(m_ctx->BuildCachedTemplate(structAddr), templ);
+
+  ScTemplate copiedTempl;
+  m_ctx->BuildCachedTemplate(copiedTempl, structAddr);
+  EXPECT_EQ(copiedTempl.Size(), 1u);
+  EXPECT_TRUE(copiedTempl.HasReplacement(addr2));
+
+  st << addr3 << arc2;
+
+  auto const & changedTempl = m_ctx->BuildCachedTemplate(structAddr);
+  EXPECT_NE(changedTempl, templ);
+  EXPECT_EQ(changedTempl->Size(), 2u);
+  EXPECT_EQ(templ->Size(), 1u);
+
+  ScTemplateSearchResult result;
+  EXPECT_FALSE(m_ctx->SearchByTemplate(*changedTempl, result));
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, addr1, m_ctx->GenerateNode(ScType::ConstNode));
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, addr1, m_ctx->GenerateNode(ScType::ConstNode));
+  EXPECT_TRUE(m_ctx->SearchByTemplate(*changedTempl, result));
+
+  // sc-element is erased after sc-event of its erasure is processed
+  st >> arc2;
+  for (size_t i = 0; i < 50 && st.HasElement(arc2); ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_FALSE(st.HasElement(arc2));
+  EXPECT_EQ(m_ctx->BuildCachedTemplate(structAddr)->Size(), 1u);
+}
+
+TEST_F(ScTemplateBuildTest, BuildCachedTemplateFromStructureWithReplacedArc)
+{
+  ScAddr const addr1 = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const addr2 = m_ctx->GenerateNode(ScType::VarNode);
+  ScAddr const addr3 = m_ctx->GenerateNode(ScType::VarNode);
+  ScAddr const arc1 = m_ctx->GenerateConnector(ScType::VarPermPosArc, addr1, addr2);
+  ScAddr const arc2 = m_ctx->GenerateConnector(ScType::VarPermPosArc, addr1, addr3);
+
+  ScAddr const structAddr = m_ctx->GenerateNode(ScType::ConstNodeStructure);
+  ScStructure st = m_ctx->ConvertToStructure(structAddr);
+  st << addr1 << addr2 << arc1;
+
+  auto const & templ = m_ctx->BuildCachedTemplate(structAddr);
+  EXPECT_TRUE(templ->HasReplacement(addr2));
+
+  // the number of arcs outgoing from sc-structure isn't changed, but sc-template is
+  ScAddr const membershipArcAddr = m_ctx->GenerateConnector(ScType::ConstPermPosArc, structAddr, arc2);
+  ScIterator3Ptr const iter = m_ctx->CreateIterator3(structAddr, ScType::ConstPermPosArc, arc1);
+  EXPECT_TRUE(iter->Next());
+  EXPECT_TRUE(m_ctx->EraseElement(iter->Get(1)));
+  st << addr3;
+
+  auto const & changedTempl = m_ctx->BuildCachedTemplate(structAddr);
+  EXPECT_NE(changedTempl, templ);
+  EXPECT_TRUE(changedTempl->HasReplacement(addr3));
+  EXPECT_FALSE(changedTempl->HasReplacement(addr2));
+  EXPECT_TRUE(m_ctx->IsElement(membershipArcAddr));
+}
+
+TEST_F(ScTemplateBuildTest, BuildCachedTemplateFromStructureWithChangedSubtype)
+{
+  ScAddr const addr1 = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const addr2 = m_ctx->GenerateNode(ScType::VarNode);
+  ScAddr const arc1 = m_ctx->GenerateConnector(ScType::VarPermPosArc, addr1, addr2);
+
+  ScAddr const structAddr = m_ctx->GenerateNode(ScType::ConstNodeStructure);
+  ScStructure st = m_ctx->ConvertToStructure(structAddr);
+  st << addr1 << addr2 << arc1;
+
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, addr1, m_ctx->GenerateNode(ScType::ConstNode));
+
+  auto const & templ = m_ctx->BuildCachedTemplate(structAddr);
+  ScTemplateSearchResult result;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(*templ, result));
+
+  EXPECT_TRUE(m_ctx->SetElementSubtype(addr2, ScType::VarNodeClass));
+
+  auto const & changedTempl = m_ctx->BuildCachedTemplate(structAddr);
+  EXPECT_NE(changedTempl, templ);
+  EXPECT_FALSE(m_ctx->SearchByTemplate(*changedTempl, result));
+}
+
+TEST_F(ScTemplateBuildTest, BuildCachedTemplateFromStructureWithParams)
+{
+  ScAddr const addr1 = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const addr2 = m_ctx->GenerateNode(ScType::VarNode);
+  ScAddr const arc1 = m_ctx->GenerateConnector(ScType::VarPermPosArc, addr1, addr2);
+
+  ScAddr const structAddr = m_ctx->GenerateNode(ScType::ConstNodeStructure);
+  ScStructure st = m_ctx->ConvertToStructure(structAddr);
+  st << addr1 << addr2 << arc1;
+
+  ScAddr const node1 = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const node2 = m_ctx->GenerateNode(ScType::ConstNode);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, addr1, node1);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, addr1, node2);
+
+  for (ScAddr const & node : {node1, node2})
+  {
+    ScTemplateParams params;
+    params.Add(addr2, node);
+
+    ScTemplate templ;
+    m_ctx->BuildCachedTemplate(templ, structAddr, params);
+
+    ScTemplate expectedTempl;
+    m_ctx->BuildTemplate(expectedTempl, structAddr, params);
+
+    ScTemplateSearchResult result;
+    EXPECT_TRUE(m_ctx->SearchByTemplate(templ, result));
+    EXPECT_EQ(result.Size(), 1u);
+    EXPECT_EQ(result[0][2], node);
+
+    ScTemplateSearchResult expectedResult;
+    EXPECT_TRUE(m_ctx->SearchByTemplate(expectedTempl, expectedResult));
+    EXPECT_EQ(expectedResult.Size(), result.Size());
+    EXPECT_EQ(expectedResult[0][2], result[0][2]);
+  }
+}
+
+TEST_F(ScTemplateBuildTest, BuildCachedTemplateFromInvalidStructure)
+{
+  EXPECT_TRUE(m_ctx->BuildCachedTemplate(ScAddr::Empty)->IsEmpty());
+}
+
+TEST_F(ScTemplateBuildTest, BuildCachedTemplateFromSCs)
+{
+  ScAddr const classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  m_ctx->SetElementSystemIdentifier("cached_template_class", classAddr);
+
+  std::string const data = "cached_template_class _-> _element;;";
+  auto const & templ = m_ctx->BuildCachedTemplate(data);
+  EXPECT_EQ(templ->Size(), 1u);
+  EXPECT_EQ(m_ctx->BuildCachedTemplate(data), templ);
+
+  ScTemplate copiedTempl;
+  m_ctx->BuildTemplate(copiedTempl, data);
+  EXPECT_EQ(copiedTempl.Size(), 1u);
+
+  ScAddr const elementAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, elementAddr);
+  ScTemplateSearchResult result;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(*templ, result));
+  EXPECT_EQ(result[0]["_element"], elementAddr);
+  EXPECT_TRUE(m_ctx->SearchByTemplate(copiedTempl, result));
+  EXPECT_EQ(result[0]["_element"], elementAddr);
+
+  // system identifier is moved to other sc-element, so cached sc-template must be translated again
+  ScAddr const otherClassAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  m_ctx->SetElementSystemIdentifier("cached_template_class", otherClassAddr);
+
+  auto const & changedTempl = m_ctx->BuildCachedTemplate(data);
+  EXPECT_NE(changedTempl, templ);
+  EXPECT_FALSE(m_ctx->SearchByTemplate(*changedTempl, result));
+}
+
+TEST_F(ScTemplateBuildTest, BuildCachedTemplateFromInvalidSCs)
+{
+  EXPECT_THROW(m_ctx->BuildCachedTemplate("cached_template_class _-> ;;"), utils::ExceptionParseError);
+  EXPECT_THROW(
+      m_ctx->BuildCachedTemplate("not_existing_cached_template_class _-> _element;;"), utils::ExceptionInvalidState);
+}
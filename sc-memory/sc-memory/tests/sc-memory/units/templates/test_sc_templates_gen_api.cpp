@@ -454,3 +454,82 @@ TEST_F(ScTemplateGenApiTest, GenTemplateWithNodeReplacedByArc)
 
   EXPECT_EQ(result["_addr2"], edgeAddr);
 }
+
+TEST_F(ScTemplateGenApiTest, GenTemplateWithConnectorReplacedByGeneratedConnector)
+{
+  ScTemplate templ;
+  templ.Triple(ScType::VarNode >> "_addr1", ScType::VarCommonArc >> "_arc", ScType::VarNode >> "_addr2");
+  templ.Triple("_addr1", "_arc", "_addr2");
+  templ.Triple(ScType::VarNode >> "_addr3", ScType::VarPermPosArc, "_arc");
+
+  ScTemplateGenResult result;
+  m_ctx->GenerateByTemplate(templ, result);
+  EXPECT_EQ(result.Size(), 9u);
+
+  EXPECT_EQ(result[4], result["_arc"]);
+  EXPECT_TRUE(m_ctx->CheckConnector(result["_addr1"], result["_addr2"], ScType::ConstCommonArc));
+  EXPECT_EQ(m_ctx->GetArcTargetElement(result[7]), result["_arc"]);
+}
+
+TEST_F(ScTemplateGenApiTest, GenTemplateForSeveralParams)
+{
+  ScAddr const & relationAddr = m_ctx->GenerateNode(ScType::ConstNodeNonRole);
+
+  ScTemplate templ;
+  templ.Quintuple(
+      ScType::VarNodeClass >> "_class",
+      ScType::VarCommonArc >> "_arc",
+      ScType::VarNodeLink >> "_link",
+      ScType::VarPermPosArc,
+      relationAddr);
+  templ.Triple("_class", ScType::VarPermPosArc, ScType::VarNode >> "_element");
+
+  std::vector<ScTemplateParams> paramsList(5);
+  ScAddrVector classesAddrs;
+  for (ScTemplateParams & params : paramsList)
+  {
+    classesAddrs.push_back(m_ctx->GenerateNode(ScType::ConstNodeClass));
+    params.Add("_class", classesAddrs.back());
+  }
+
+  std::vector<ScTemplateGenResult> results;
+  m_ctx->GenerateByTemplate(templ, paramsList, results);
+  EXPECT_EQ(results.size(), paramsList.size());
+
+  ScAddrUnorderedSet elementsAddrs;
+  for (size_t i = 0; i < results.size(); ++i)
+  {
+    ScTemplateGenResult const & result = results[i];
+    EXPECT_EQ(result.Size(), 9u);
+    EXPECT_EQ(result["_class"], classesAddrs[i]);
+    EXPECT_EQ(m_ctx->GetElementType(result["_link"]), ScType::ConstNodeLink);
+    EXPECT_EQ(m_ctx->GetElementType(result["_element"]), ScType::ConstNode);
+    EXPECT_TRUE(m_ctx->CheckConnector(result["_class"], result["_link"], ScType::ConstCommonArc));
+    EXPECT_TRUE(m_ctx->CheckConnector(relationAddr, result["_arc"], ScType::ConstPermPosArc));
+    EXPECT_TRUE(m_ctx->CheckConnector(result["_class"], result["_element"], ScType::ConstPermPosArc));
+    EXPECT_TRUE(elementsAddrs.insert(result["_element"]).second);
+  }
+
+  ScTemplateSearchResult searchResult;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, searchResult));
+  EXPECT_EQ(searchResult.Size(), paramsList.size());
+}
+
+TEST_F(ScTemplateGenApiTest, GenTemplateForSeveralParamsWithInvalidParams)
+{
+  ScTemplate templ;
+  templ.Triple(ScType::VarNodeClass >> "_class", ScType::VarPermPosArc, ScType::VarNode >> "_element");
+
+  std::vector<ScTemplateParams> paramsList(3);
+  paramsList[0].Add("_class", m_ctx->GenerateNode(ScType::ConstNodeClass));
+  paramsList[1].Add("_class", m_ctx->GenerateNode(ScType::ConstNodeClass));
+  paramsList[2].Add("_other_class", m_ctx->GenerateNode(ScType::ConstNodeClass));
+
+  ScMemoryContext::ScMemoryStatistics const statisticsBefore = m_ctx->CalculateStatistics();
+
+  std::vector<ScTemplateGenResult> results;
+  EXPECT_THROW(m_ctx->GenerateByTemplate(templ, paramsList, results), utils::ExceptionInvalidParams);
+
+  ScMemoryContext::ScMemoryStatistics const statisticsAfter = m_ctx->CalculateStatistics();
+  EXPECT_EQ(statisticsAfter.GetAllNum(), statisticsBefore.GetAllNum());
+}
@@ -4,6 +4,8 @@
  * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
  */
 
+#include <random>
+
 #include <sc-memory/sc_link.hpp>
 #include <sc-memory/sc_memory.hpp>
 #include <sc-memory/sc_structure.hpp>
@@ -12,6 +14,52 @@
 
 using ScTemplateSearchTest = ScTemplateTest;
 
+using ScAddrHashesVectors = std::vector<std::vector<size_t>>;
+
+//! Generates nodes and sc-arcs between random pairs of them, some sc-arcs are duplicated or are loops.
+static ScAddrVector GenerateRandomGraph(ScMemoryContext & context, size_t nodesCount, size_t arcsCount)
+{
+  std::mt19937 random(42);
+  ScAddrVector nodesAddrs;
+  for (size_t i = 0; i < nodesCount; ++i)
+    nodesAddrs.push_back(context.GenerateNode(ScType::ConstNode));
+
+  for (size_t i = 0; i < arcsCount; ++i)
+  {
+    ScAddr const & sourceAddr = nodesAddrs[random() % nodesCount];
+    ScAddr const & targetAddr = nodesAddrs[random() % nodesCount];
+    ScType const & arcType = random() % 3 == 0 ? ScType::ConstCommonArc : ScType::ConstPermPosArc;
+    context.GenerateConnector(arcType, sourceAddr, targetAddr);
+  }
+
+  return nodesAddrs;
+}
+
+//! Returns sorted hashes of sc-elements of items with specified names of all found sc-constructions.
+static ScAddrHashesVectors GetSortedResultHashes(
+    ScTemplateSearchResult & result,
+    std::vector<std::string> const & itemsNames)
+{
+  ScAddrHashesVectors hashesVectors;
+  result.ForEach(
+      [&](ScTemplateResultItem const & item)
+      {
+        std::vector<size_t> hashes;
+        for (std::string const & name : itemsNames)
+          hashes.push_back(item[name].Hash());
+        hashesVectors.push_back(std::move(hashes));
+      });
+  std::sort(hashesVectors.begin(), hashesVectors.end());
+  return hashesVectors;
+}
+
+//! Checks that sc-connectors of sc-construction are different, sc-template search doesn't use sc-connector twice.
+static bool AreConnectorsDifferent(ScAddrVector const & connectorsAddrs)
+{
+  ScAddrSet const uniqueConnectorsAddrs{connectorsAddrs.cbegin(), connectorsAddrs.cend()};
+  return uniqueConnectorsAddrs.size() == connectorsAddrs.size();
+}
+
 TEST_F(ScTemplateSearchTest, SimpleSearch1)
 {
   /**			_y
@@ -475,3 +523,177 @@ TEST_F(ScTemplateSearchTest, StructureElements)
   EXPECT_EQ(searchResult[0]["_target"], targetAddr);
   EXPECT_EQ(searchResult[0]["_relation"], relationAddr);
 }
+
+TEST_F(ScTemplateSearchTest, IntersectedSearchOfTriangleEqualsIteratorsSearch)
+{
+  ScAddrVector const & nodesAddrs = GenerateRandomGraph(*m_ctx, 12, 70);
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  for (size_t i = 0; i < nodesAddrs.size(); i += 2)
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, nodesAddrs[i]);
+
+  auto const & BuildTemplate = [&]()
+  {
+    ScTemplate templ;
+    templ.Triple(classAddr, ScType::VarPermPosArc >> "_class_arc", ScType::VarNode >> "_a");
+    templ.Triple("_a", ScType::VarPermPosArc >> "_ab", ScType::VarNode >> "_b");
+    templ.Triple("_b", ScType::VarPermPosArc >> "_bc", ScType::VarNode >> "_c");
+    templ.Triple("_c", ScType::VarPermPosArc >> "_ca", "_a");
+    return templ;
+  };
+  EXPECT_NE(
+      ScPreparedTemplate(*m_ctx, BuildTemplate()).Explain(*m_ctx).find("intersected with step"), std::string::npos);
+
+  ScAddrHashesVectors expectedHashesVectors;
+  ScIterator3Ptr const classIt = m_ctx->CreateIterator3(classAddr, ScType::ConstPermPosArc, ScType::ConstNode);
+  while (classIt->Next())
+  {
+    ScAddr const & aAddr = classIt->Get(2);
+    ScIterator3Ptr const abIt = m_ctx->CreateIterator3(aAddr, ScType::ConstPermPosArc, ScType::ConstNode);
+    while (abIt->Next())
+    {
+      ScAddr const & bAddr = abIt->Get(2);
+      ScIterator3Ptr const bcIt = m_ctx->CreateIterator3(bAddr, ScType::ConstPermPosArc, ScType::ConstNode);
+      while (bcIt->Next())
+      {
+        ScAddr const & cAddr = bcIt->Get(2);
+        ScIterator3Ptr const caIt = m_ctx->CreateIterator3(cAddr, ScType::ConstPermPosArc, aAddr);
+        while (caIt->Next())
+        {
+          if (AreConnectorsDifferent({classIt->Get(1), abIt->Get(1), bcIt->Get(1), caIt->Get(1)}))
+            expectedHashesVectors.push_back(
+                {aAddr.Hash(),
+                 bAddr.Hash(),
+                 cAddr.Hash(),
+                 abIt->Get(1).Hash(),
+                 bcIt->Get(1).Hash(),
+                 caIt->Get(1).Hash()});
+        }
+      }
+    }
+  }
+  std::sort(expectedHashesVectors.begin(), expectedHashesVectors.end());
+  EXPECT_FALSE(expectedHashesVectors.empty());
+
+  ScTemplateSearchResult result;
+  m_ctx->SearchByTemplate(BuildTemplate(), result);
+  EXPECT_EQ(GetSortedResultHashes(result, {"_a", "_b", "_c", "_ab", "_bc", "_ca"}), expectedHashesVectors);
+}
+
+TEST_F(ScTemplateSearchTest, IntersectedSearchOfFourCycleEqualsIteratorsSearch)
+{
+  ScAddrVector const & nodesAddrs = GenerateRandomGraph(*m_ctx, 10, 50);
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  for (size_t i = 0; i < nodesAddrs.size(); i += 3)
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, nodesAddrs[i]);
+
+  auto const & BuildTemplate = [&]()
+  {
+    ScTemplate templ;
+    templ.Triple(classAddr, ScType::VarPermPosArc >> "_class_arc", ScType::VarNode >> "_a");
+    templ.Triple("_a", ScType::VarPermPosArc >> "_ab", ScType::VarNode >> "_b");
+    templ.Triple("_b", ScType::VarPermPosArc >> "_bc", ScType::VarNode >> "_c");
+    templ.Triple("_c", ScType::VarPermPosArc >> "_cd", ScType::VarNode >> "_d");
+    templ.Triple("_d", ScType::VarPermPosArc >> "_da", "_a");
+    return templ;
+  };
+  EXPECT_NE(
+      ScPreparedTemplate(*m_ctx, BuildTemplate()).Explain(*m_ctx).find("intersected with step"), std::string::npos);
+
+  ScAddrHashesVectors expectedHashesVectors;
+  ScIterator3Ptr const classIt = m_ctx->CreateIterator3(classAddr, ScType::ConstPermPosArc, ScType::ConstNode);
+  while (classIt->Next())
+  {
+    ScAddr const & aAddr = classIt->Get(2);
+    ScIterator3Ptr const abIt = m_ctx->CreateIterator3(aAddr, ScType::ConstPermPosArc, ScType::ConstNode);
+    while (abIt->Next())
+    {
+      ScAddr const & bAddr = abIt->Get(2);
+      ScIterator3Ptr const bcIt = m_ctx->CreateIterator3(bAddr, ScType::ConstPermPosArc, ScType::ConstNode);
+      while (bcIt->Next())
+      {
+        ScAddr const & cAddr = bcIt->Get(2);
+        ScIterator3Ptr const cdIt = m_ctx->CreateIterator3(cAddr, ScType::ConstPermPosArc, ScType::ConstNode);
+        while (cdIt->Next())
+        {
+          ScAddr const & dAddr = cdIt->Get(2);
+          ScIterator3Ptr const daIt = m_ctx->CreateIterator3(dAddr, ScType::ConstPermPosArc, aAddr);
+          while (daIt->Next())
+          {
+            if (AreConnectorsDifferent(
+                    {classIt->Get(1), abIt->Get(1), bcIt->Get(1), cdIt->Get(1), daIt->Get(1)}))
+              expectedHashesVectors.push_back(
+                  {aAddr.Hash(),
+                   bAddr.Hash(),
+                   cAddr.Hash(),
+                   dAddr.Hash(),
+                   abIt->Get(1).Hash(),
+                   bcIt->Get(1).Hash(),
+                   cdIt->Get(1).Hash(),
+                   daIt->Get(1).Hash()});
+          }
+        }
+      }
+    }
+  }
+  std::sort(expectedHashesVectors.begin(), expectedHashesVectors.end());
+  EXPECT_FALSE(expectedHashesVectors.empty());
+
+  ScTemplateSearchResult result;
+  m_ctx->SearchByTemplate(BuildTemplate(), result);
+  EXPECT_EQ(
+      GetSortedResultHashes(result, {"_a", "_b", "_c", "_d", "_ab", "_bc", "_cd", "_da"}), expectedHashesVectors);
+}
+
+TEST_F(ScTemplateSearchTest, IntersectedSearchWithRepeatedVariablesEqualsIteratorsSearch)
+{
+  ScAddrVector const & nodesAddrs = GenerateRandomGraph(*m_ctx, 10, 80);
+  ScAddr const & hubAddr = nodesAddrs[0];
+
+  // `_y` is found from `_x` by two triples and from hub by the third one
+  auto const & BuildTemplate = [&]()
+  {
+    ScTemplate templ;
+    templ.Triple(hubAddr, ScType::VarPermPosArc >> "_hub_x", ScType::VarNode >> "_x");
+    templ.Triple("_x", ScType::VarPermPosArc >> "_xy", ScType::VarNode >> "_y");
+    templ.Triple("_x", ScType::VarCommonArc >> "_xy_common", "_y");
+    templ.Triple("_y", ScType::VarPermPosArc >> "_y_hub", hubAddr);
+    return templ;
+  };
+  EXPECT_NE(
+      ScPreparedTemplate(*m_ctx, BuildTemplate()).Explain(*m_ctx).find("intersected with steps"), std::string::npos);
+
+  ScAddrHashesVectors expectedHashesVectors;
+  ScIterator3Ptr const hubXIt = m_ctx->CreateIterator3(hubAddr, ScType::ConstPermPosArc, ScType::ConstNode);
+  while (hubXIt->Next())
+  {
+    ScAddr const & xAddr = hubXIt->Get(2);
+    ScIterator3Ptr const xyIt = m_ctx->CreateIterator3(xAddr, ScType::ConstPermPosArc, ScType::ConstNode);
+    while (xyIt->Next())
+    {
+      ScAddr const & yAddr = xyIt->Get(2);
+      ScIterator3Ptr const xyCommonIt = m_ctx->CreateIterator3(xAddr, ScType::ConstCommonArc, yAddr);
+      while (xyCommonIt->Next())
+      {
+        ScIterator3Ptr const yHubIt = m_ctx->CreateIterator3(yAddr, ScType::ConstPermPosArc, hubAddr);
+        while (yHubIt->Next())
+        {
+          if (AreConnectorsDifferent({hubXIt->Get(1), xyIt->Get(1), xyCommonIt->Get(1), yHubIt->Get(1)}))
+            expectedHashesVectors.push_back(
+                {xAddr.Hash(),
+                 yAddr.Hash(),
+                 hubXIt->Get(1).Hash(),
+                 xyIt->Get(1).Hash(),
+                 xyCommonIt->Get(1).Hash(),
+                 yHubIt->Get(1).Hash()});
+        }
+      }
+    }
+  }
+  std::sort(expectedHashesVectors.begin(), expectedHashesVectors.end());
+  EXPECT_FALSE(expectedHashesVectors.empty());
+
+  ScTemplateSearchResult result;
+  m_ctx->SearchByTemplate(BuildTemplate(), result);
+  EXPECT_EQ(
+      GetSortedResultHashes(result, {"_x", "_y", "_hub_x", "_xy", "_xy_common", "_y_hub"}), expectedHashesVectors);
+}
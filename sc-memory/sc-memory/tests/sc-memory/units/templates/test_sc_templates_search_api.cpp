@@ -4,6 +4,8 @@
  * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
  */
 
+#include <set>
+
 #include <sc-memory/sc_memory.hpp>
 #include <sc-memory/sc_structure.hpp>
 
@@ -11,6 +13,21 @@
 
 using ScTemplateSearchApiTest = ScTemplateTest;
 
+/*! Prepares sc-template searching elements of class `_class`, which is given on each search. If relation is valid,
+ * then found elements must have `_value` in this relation.
+ */
+static ScPreparedTemplate PrepareClassElementsTemplate(
+    ScMemoryContext & context,
+    ScAddr const & relationAddr = ScAddr::Empty)
+{
+  ScTemplate templ;
+  templ.Triple(ScType::VarNodeClass >> "_class", ScType::VarPermPosArc, ScType::VarNode >> "_element");
+  if (relationAddr.IsValid())
+    templ.Quintuple(
+        "_element", ScType::VarCommonArc, ScType::VarNode >> "_value", ScType::VarPermPosArc, relationAddr);
+  return ScPreparedTemplate(context, std::move(templ), ScTemplateParams().Add("_class", ScAddr::Empty));
+}
+
 TEST_F(ScTemplateSearchApiTest, SearchWithResultNotSafeGet)
 {
   ScAddr const addr1 = m_ctx->GenerateNode(ScType::ConstNode);
@@ -456,3 +473,379 @@ TEST_F(ScTemplateSearchApiTest, SearchTemplateWithConstantTriple)
   for (ScAddr const & addr : result[0])
     EXPECT_TRUE(m_ctx->IsElement(addr));
 }
+
+TEST_F(ScTemplateSearchApiTest, ExplainStartsFromTripleWithLessArcs)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddr const & subclassAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  for (size_t i = 0; i < 50; ++i)
+  {
+    ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, nodeAddr);
+    if (i % 10 == 0)
+      m_ctx->GenerateConnector(ScType::ConstPermPosArc, subclassAddr, nodeAddr);
+  }
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_node");
+  templ.Triple(subclassAddr, ScType::VarPermPosArc, "_node");
+
+  std::string const & plan = templ.Explain(*m_ctx);
+  EXPECT_EQ(plan.find("1. iterate triple 1 "), 0u) << plan;
+  EXPECT_NE(plan.find("2. check triple 0 "), std::string::npos) << plan;
+  EXPECT_NE(plan.find(", `_node`) as F_A_A"), std::string::npos) << plan;
+  EXPECT_NE(plan.find(", `_node`) as F_A_F"), std::string::npos) << plan;
+  EXPECT_NE(plan.find("intersected with step 2\n"), std::string::npos) << plan;
+
+  ScTemplateSearchResult result;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, result));
+  EXPECT_EQ(result.Size(), 5u);
+}
+
+TEST_F(ScTemplateSearchApiTest, ExplainChecksTripleWithFoundSourceAndTarget)
+{
+  ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const & relationAddr = m_ctx->GenerateNode(ScType::ConstNodeNonRole);
+  ScAddr const & linkAddr = m_ctx->GenerateLink(ScType::ConstNodeLink);
+  ScAddr const & arcAddr = m_ctx->GenerateConnector(ScType::ConstCommonArc, nodeAddr, linkAddr);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, relationAddr, arcAddr);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, linkAddr, nodeAddr);
+
+  ScTemplate templ;
+  templ.Quintuple(
+      nodeAddr,
+      ScType::VarCommonArc >> "_arc",
+      ScType::VarNodeLink >> "_link",
+      ScType::VarPermPosArc,
+      relationAddr);
+  templ.Triple("_link", ScType::VarPermPosArc, nodeAddr);
+
+  std::string const & plan = templ.Explain(*m_ctx);
+  EXPECT_EQ(plan.find("1. iterate triple"), 0u) << plan;
+  EXPECT_NE(plan.find("3. check triple"), std::string::npos) << plan;
+  EXPECT_EQ(std::count(plan.cbegin(), plan.cend(), '\n'), 3) << plan;
+
+  ScTemplateSearchResult result;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, result));
+  EXPECT_EQ(result.Size(), 1u);
+  EXPECT_EQ(result[0]["_link"], linkAddr);
+}
+
+TEST_F(ScTemplateSearchApiTest, SearchTemplateWithSeveralConnectivityComponents)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddr const & otherClassAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  for (size_t i = 0; i < 2; ++i)
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, m_ctx->GenerateNode(ScType::ConstNode));
+  for (size_t i = 0; i < 3; ++i)
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, otherClassAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_element");
+  templ.Triple(otherClassAddr, ScType::VarPermPosArc, ScType::VarNode >> "_other_element");
+
+  ScTemplateSearchResult result;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, result));
+  EXPECT_EQ(result.Size(), 6u);
+
+  std::set<std::pair<sc_addr_hash, sc_addr_hash>> foundPairs;
+  result.ForEach(
+      [&](ScTemplateResultItem const & item)
+      {
+        foundPairs.insert({item["_element"].Hash(), item["_other_element"].Hash()});
+      });
+  EXPECT_EQ(foundPairs.size(), 6u);
+
+  size_t count = 0;
+  m_ctx->SearchByTemplateInterruptibly(
+      templ,
+      [&count](ScTemplateResultItem const &) -> ScTemplateSearchRequest
+      {
+        return ++count == 4 ? ScTemplateSearchRequest::STOP : ScTemplateSearchRequest::CONTINUE;
+      });
+  EXPECT_EQ(count, 4u);
+}
+
+TEST_F(ScTemplateSearchApiTest, SearchByPreparedTemplateWithDifferentParams)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddr const & otherClassAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddr const & relationAddr = m_ctx->GenerateNode(ScType::ConstNodeNonRole);
+  for (size_t i = 0; i < 2; ++i)
+  {
+    ScAddr const & elementAddr = m_ctx->GenerateNode(ScType::ConstNode);
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, elementAddr);
+    ScAddr const & arcAddr = m_ctx->GenerateConnector(
+        ScType::ConstCommonArc, elementAddr, m_ctx->GenerateLink(ScType::ConstNodeLink));
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, relationAddr, arcAddr);
+  }
+  for (size_t i = 0; i < 3; ++i)
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, otherClassAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  ScTemplate templ;
+  templ.Triple(ScType::VarNodeClass >> "_class", ScType::VarPermPosArc, ScType::VarNode >> "_element");
+  templ.Quintuple(
+      "_element", ScType::VarCommonArc, ScType::VarNodeLink >> "_link", ScType::VarPermPosArc, relationAddr);
+
+  ScPreparedTemplate const preparedTemplate{*m_ctx, std::move(templ), ScTemplateParams().Add("_class", classAddr)};
+  EXPECT_EQ(preparedTemplate.Explain(*m_ctx).find("1. iterate triple 0 "), 0u);
+
+  for (size_t i = 0; i < 2; ++i)
+  {
+    ScTemplateSearchResult result;
+    EXPECT_TRUE(m_ctx->SearchByTemplate(preparedTemplate, ScTemplateParams().Add("_class", classAddr), result));
+    EXPECT_EQ(result.Size(), 2u);
+    result.ForEach(
+        [&](ScTemplateResultItem const & item)
+        {
+          EXPECT_EQ(item["_class"], classAddr);
+          EXPECT_TRUE(m_ctx->CheckConnector(classAddr, item["_element"], ScType::ConstPermPosArc));
+        });
+
+    EXPECT_FALSE(m_ctx->SearchByTemplate(preparedTemplate, ScTemplateParams().Add("_class", otherClassAddr), result));
+    EXPECT_TRUE(result.IsEmpty());
+  }
+
+  size_t count = 0;
+  m_ctx->SearchByTemplate(
+      preparedTemplate,
+      ScTemplateParams().Add("_class", classAddr),
+      [&count](ScTemplateResultItem const &)
+      {
+        ++count;
+      });
+  EXPECT_EQ(count, 2u);
+
+  count = 0;
+  m_ctx->SearchByTemplateInterruptibly(
+      preparedTemplate,
+      ScTemplateParams().Add("_class", classAddr),
+      [&count](ScTemplateResultItem const &) -> ScTemplateSearchRequest
+      {
+        ++count;
+        return ScTemplateSearchRequest::STOP;
+      });
+  EXPECT_EQ(count, 1u);
+}
+
+TEST_F(ScTemplateSearchApiTest, SearchByPreparedTemplateWithInvalidParams)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  ScTemplate templ;
+  templ.Triple(ScType::VarNodeClass >> "_class", ScType::VarPermPosArc, ScType::VarNode >> "_element");
+  EXPECT_THROW(
+      ScPreparedTemplate(*m_ctx, std::move(templ), ScTemplateParams().Add("_set", classAddr)),
+      utils::ExceptionInvalidParams);
+
+  ScPreparedTemplate const preparedTemplate = PrepareClassElementsTemplate(*m_ctx);
+
+  ScTemplateSearchResult result;
+  EXPECT_THROW(m_ctx->SearchByTemplate(preparedTemplate, ScTemplateParams(), result), utils::ExceptionInvalidParams);
+  EXPECT_THROW(
+      m_ctx->SearchByTemplate(preparedTemplate, ScTemplateParams().Add("_class", ScAddr::Empty), result),
+      utils::ExceptionInvalidParams);
+  EXPECT_THROW(
+      m_ctx->SearchByTemplate(
+          preparedTemplate, ScTemplateParams().Add("_class", classAddr).Add("_element", classAddr), result),
+      utils::ExceptionInvalidParams);
+
+  EXPECT_TRUE(m_ctx->SearchByTemplate(preparedTemplate, ScTemplateParams().Add("_class", classAddr), result));
+  EXPECT_EQ(result.Size(), 1u);
+}
+
+TEST_F(ScTemplateSearchApiTest, SearchByCursor)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddrSet elementsAddrs;
+  for (size_t i = 0; i < 5; ++i)
+  {
+    ScAddr const & elementAddr = m_ctx->GenerateNode(ScType::ConstNode);
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, elementAddr);
+    elementsAddrs.insert(elementAddr);
+  }
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::VarPermPosArc >> "_arc", ScType::VarNode >> "_element");
+
+  ScTemplateSearchCursor cursor = m_ctx->CreateTemplateSearchCursor(templ);
+  EXPECT_THROW(cursor.Get(), utils::ExceptionInvalidState);
+
+  ScAddrSet foundAddrs;
+  while (cursor.Next())
+  {
+    ScTemplateSearchResultItem const & item = cursor.Get();
+    EXPECT_TRUE(m_ctx->CheckConnector(classAddr, item["_element"], ScType::ConstPermPosArc));
+    EXPECT_EQ(item[0], classAddr);
+    foundAddrs.insert(item["_element"]);
+  }
+  EXPECT_EQ(cursor.Size(), elementsAddrs.size());
+  EXPECT_FALSE(cursor.Next());
+  EXPECT_THROW(cursor.Get(), utils::ExceptionInvalidState);
+  EXPECT_NE(cursor.GetReplacements().find("_element"), cursor.GetReplacements().cend());
+  EXPECT_EQ(foundAddrs, elementsAddrs);
+
+  ScTemplateSearchCursor limitedCursor = m_ctx->CreateTemplateSearchCursor(templ, 2);
+  EXPECT_TRUE(limitedCursor.Next());
+  ScTemplateSearchCursor movedCursor = std::move(limitedCursor);
+  EXPECT_EQ(movedCursor.Size(), 1u);
+  EXPECT_TRUE(movedCursor.Next());
+  EXPECT_FALSE(movedCursor.Next());
+  EXPECT_EQ(movedCursor.Size(), 2u);
+
+  ScPreparedTemplate const preparedTemplate = PrepareClassElementsTemplate(*m_ctx);
+  EXPECT_THROW(
+      m_ctx->CreateTemplateSearchCursor(preparedTemplate, ScTemplateParams()), utils::ExceptionInvalidParams);
+
+  ScTemplateSearchCursor preparedCursor =
+      m_ctx->CreateTemplateSearchCursor(preparedTemplate, ScTemplateParams().Add("_class", classAddr), 3);
+  while (preparedCursor.Next())
+    EXPECT_EQ(preparedCursor.Get()["_class"], classAddr);
+  EXPECT_EQ(preparedCursor.Size(), 3u);
+}
+
+TEST_F(ScTemplateSearchApiTest, SearchByCursorEmptyTemplate)
+{
+  ScTemplate templ;
+  ScTemplateSearchCursor cursor = m_ctx->CreateTemplateSearchCursor(templ);
+  EXPECT_FALSE(cursor.Next());
+  EXPECT_EQ(cursor.Size(), 0u);
+}
+
+TEST_F(ScTemplateSearchApiTest, SearchInParallel)
+{
+  ScAddr const & relationAddr = m_ctx->GenerateNode(ScType::ConstNodeNonRole);
+  ScAddrVector classesAddrs;
+  for (size_t i = 0; i < 10; ++i)
+  {
+    ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+    for (size_t j = 0; j < 20; ++j)
+    {
+      ScAddr const & elementAddr = m_ctx->GenerateNode(ScType::ConstNode);
+      m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, elementAddr);
+      if (j % 2 == 0)
+      {
+        ScAddr const & arcAddr = m_ctx->GenerateConnector(
+            ScType::ConstCommonArc, elementAddr, m_ctx->GenerateNode(ScType::ConstNode));
+        m_ctx->GenerateConnector(ScType::ConstPermPosArc, relationAddr, arcAddr);
+      }
+    }
+    classesAddrs.push_back(classAddr);
+  }
+
+  ScTemplate templ;
+  templ.Triple(ScType::VarNodeClass >> "_class", ScType::VarPermPosArc, ScType::VarNode >> "_element");
+  templ.Quintuple("_element", ScType::VarCommonArc, ScType::VarNode >> "_value", ScType::VarPermPosArc, relationAddr);
+
+  ScTemplateSearchResult expectedResult;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, expectedResult));
+  EXPECT_EQ(expectedResult.Size(), 100u);
+
+  for (size_t const threadsCount : {0, 1, 3, 16})
+  {
+    ScTemplateSearchResult result;
+    EXPECT_TRUE(m_ctx->SearchByTemplateInParallel(templ, result, threadsCount));
+    EXPECT_EQ(result.Size(), expectedResult.Size());
+    for (size_t i = 0; i < result.Size(); ++i)
+    {
+      ScTemplateResultItem const & item = result[i];
+      ScTemplateResultItem const & expectedItem = expectedResult[i];
+      EXPECT_TRUE(std::equal(item.begin(), item.end(), expectedItem.begin(), expectedItem.end()));
+    }
+    EXPECT_EQ(result.GetReplacements(), expectedResult.GetReplacements());
+  }
+
+  ScPreparedTemplate const preparedTemplate = PrepareClassElementsTemplate(*m_ctx, relationAddr);
+
+  ScTemplateSearchResult result;
+  EXPECT_TRUE(m_ctx->SearchByTemplateInParallel(
+      preparedTemplate, ScTemplateParams().Add("_class", classesAddrs[0]), result, 4));
+  EXPECT_EQ(result.Size(), 10u);
+  result.ForEach(
+      [&](ScTemplateResultItem const & item)
+      {
+        EXPECT_EQ(item["_class"], classesAddrs[0]);
+      });
+
+  ScTemplate emptyTempl;
+  EXPECT_FALSE(m_ctx->SearchByTemplateInParallel(emptyTempl, result, 4));
+  EXPECT_TRUE(result.IsEmpty());
+}
+
+TEST_F(ScTemplateSearchApiTest, SearchInStructure)
+{
+  ScAddr const & structureAddr = m_ctx->GenerateNode(ScType::ConstNodeStructure);
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, structureAddr, classAddr);
+  ScAddrUnorderedSet expectedElementsAddrs;
+  for (size_t i = 0; i < 10; ++i)
+  {
+    ScAddr const & elementAddr = m_ctx->GenerateNode(ScType::ConstNode);
+    ScAddr const & arcAddr = m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, elementAddr);
+    if (i % 2 == 0)
+    {
+      m_ctx->GenerateConnector(ScType::ConstPermPosArc, structureAddr, elementAddr);
+      m_ctx->GenerateConnector(ScType::ConstPermPosArc, structureAddr, arcAddr);
+      expectedElementsAddrs.insert(elementAddr);
+    }
+    else if (i % 3 == 0)
+      m_ctx->GenerateConnector(ScType::ConstPermPosArc, structureAddr, elementAddr);
+  }
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_element");
+
+  ScTemplateSearchResult result;
+  EXPECT_TRUE(m_ctx->SearchByTemplateInStructure(templ, structureAddr, result));
+  EXPECT_EQ(result.Size(), expectedElementsAddrs.size());
+  result.ForEach(
+      [&](ScTemplateResultItem const & item)
+      {
+        EXPECT_EQ(expectedElementsAddrs.erase(item["_element"]), 1u);
+      });
+
+  ScAddr const & emptyStructureAddr = m_ctx->GenerateNode(ScType::ConstNodeStructure);
+  EXPECT_FALSE(m_ctx->SearchByTemplateInStructure(templ, emptyStructureAddr, result));
+  EXPECT_EQ(result.Size(), 0u);
+
+  EXPECT_THROW(m_ctx->SearchByTemplateInStructure(templ, ScAddr::Empty, result), utils::ExceptionInvalidParams);
+}
+
+TEST_F(ScTemplateSearchApiTest, SearchWithCheckCallbackCalledOncePerElement)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddr const & otherClassAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddr const & excludedElementAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  for (size_t i = 0; i < 5; ++i)
+  {
+    ScAddr const & elementAddr = i == 0 ? excludedElementAddr : m_ctx->GenerateNode(ScType::ConstNode);
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, elementAddr);
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, otherClassAddr, elementAddr);
+  }
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_element");
+  templ.Triple(otherClassAddr, ScType::VarPermPosArc, "_element");
+
+  ScAddrToValueUnorderedMap<size_t> checksCounts;
+  size_t foundCount = 0;
+  m_ctx->SearchByTemplate(
+      templ,
+      [&](ScTemplateResultItem const & item)
+      {
+        EXPECT_NE(item["_element"], excludedElementAddr);
+        ++foundCount;
+      },
+      {},
+      [&](ScAddr const & addr)
+      {
+        ++checksCounts[addr];
+        return addr != excludedElementAddr;
+      });
+
+  EXPECT_EQ(foundCount, 4u);
+  EXPECT_EQ(checksCounts[classAddr], 1u);
+  EXPECT_EQ(checksCounts[otherClassAddr], 1u);
+  EXPECT_EQ(checksCounts[excludedElementAddr], 1u);
+}
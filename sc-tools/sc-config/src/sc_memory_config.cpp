@@ -167,6 +167,9 @@ sc_memory_params ScMemoryConfig::GetParams()
       GetBoolByKey("limit_max_threads_by_max_physical_cores", DEFAULT_LIMIT_MAX_THREADS_BY_MAX_PHYSICAL_CORES);
   m_memoryParams.max_events_and_agents_threads =
       GetIntByKey("max_events_and_agents_threads", DEFAULT_MAX_EVENTS_AND_AGENTS_THREADS);
+  m_memoryParams.max_events_queue_size = GetIntByKey("max_events_queue_size", DEFAULT_MAX_EVENTS_QUEUE_SIZE);
+  m_memoryParams.events_queue_overflow_policy =
+      GetStringByKey("events_queue_overflow_policy", DEFAULT_EVENTS_QUEUE_OVERFLOW_POLICY);
 
   m_memoryParams.dump_memory = GetBoolByKey("dump_memory", DEFAULT_DUMP_MEMORY);
   if (HasKey("save_period"))
@@ -204,6 +207,8 @@ sc_memory_params ScMemoryConfig::GetParams()
       GetIntByKey("max_searchable_string_size", DEFAULT_MAX_SEARCHABLE_STRING_SIZE);
   m_memoryParams.term_separators = GetStringByKey("term_separators", DEFAULT_TERM_SEPARATORS);
   m_memoryParams.search_by_substring = GetBoolByKey("search_by_substring", DEFAULT_SEARCH_BY_SUBSTRING);
+  m_memoryParams.max_link_contents_cache_size =
+      GetIntByKey("max_link_contents_cache_size", DEFAULT_MAX_LINK_CONTENTS_CACHE_SIZE);
 
   return m_memoryParams;
 }
@@ -14,25 +14,27 @@ public:
   ScMemoryJsonPayload Complete(ScAgentContext * context, ScMemoryJsonPayload requestPayload, ScMemoryJsonPayload &)
       override
   {
-    ScTemplateSearchResult result;
     auto const & pair = GetTemplate(context, requestPayload);
-    context->SearchByTemplate(*pair.first, result);
 
-    std::vector<std::vector<size_t>> hashesVectors;
-    for (size_t i = 0; i < result.Size(); ++i)
+    // found sc-constructions are written to payload as they are found by cursor, without accumulating them in search
+    // result
+    ScMemoryJsonPayload resultPayload;
     {
-      auto const & item = result[i];
+      ScMemoryJsonPayload addrs = ScMemoryJsonPayload::array();
+      ScTemplateSearchCursor cursor = context->CreateTemplateSearchCursor(*pair.first);
+      while (cursor.Next())
+      {
+        ScMemoryJsonPayload hashes = ScMemoryJsonPayload::array();
+        for (ScAddr const & addr : cursor.Get())
+          hashes.push_back(addr.Hash());
 
-      std::vector<size_t> vector;
-      for (size_t j = 0; j != item.Size(); ++j)
-        vector.push_back(item[j].Hash());
+        addrs.push_back(std::move(hashes));
+      }
 
-      hashesVectors.push_back(vector);
+      SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_BEGIN
+      resultPayload = {{"aliases", cursor.GetReplacements()}, {"addrs", std::move(addrs)}};
+      SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_END
     }
-
-    SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_BEGIN
-    ScMemoryJsonPayload const & resultPayload = {{"aliases", result.GetReplacements()}, {"addrs", hashesVectors}};
-    SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_END
     delete pair.first;
     return resultPayload;
   }